@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include <dali/internal/system/common/capture-encoder.h>
+#include <dali/internal/system/linux/dali-ecore.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_capture_encoder_startup(void)
+{
+  test_return_value = TET_UNDEF;
+  ecore_init();
+}
+
+void utc_dali_capture_encoder_cleanup(void)
+{
+  ecore_shutdown();
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const uint32_t FRAME_SIZE = 4u;
+
+/**
+ * The callback run when frames have been encoded.
+ */
+struct EncodedCallback
+{
+  void Encoded()
+  {
+  }
+};
+
+CaptureEncoder::Frame CreateFrame(const std::string& path)
+{
+  CaptureEncoder::Frame frame;
+  frame.pixels.assign(FRAME_SIZE * FRAME_SIZE * 4u, 0x80u);
+  frame.path        = path;
+  frame.width       = FRAME_SIZE;
+  frame.height      = FRAME_SIZE;
+  frame.pixelFormat = Pixel::RGBA8888;
+  frame.quality     = 100u;
+  frame.succeeded   = false;
+  return frame;
+}
+
+} // namespace
+
+int UtcDaliCaptureEncoderEncode(void)
+{
+  tet_infoline("The frames are encoded into their files and retrieved in the order they are queued");
+
+  EncodedCallback callback;
+  CaptureEncoder  encoder(MakeCallback(&callback, &EncodedCallback::Encoded), 2u, Dali::WorkerThreadPool::BACKGROUND);
+  DALI_TEST_CHECK(encoder.IsIdle());
+  DALI_TEST_CHECK(!encoder.IsFull());
+
+  // Without an adaptor, there's no pool and the frames are encoded before Encode() returns
+  const std::string paths[] = {"/tmp/capture-encoder-0.png", "/tmp/capture-encoder-1.jpg"};
+  for(const auto& path : paths)
+  {
+    CaptureEncoder::Frame frame = CreateFrame(path);
+    DALI_TEST_CHECK(encoder.Encode(frame));
+    DALI_TEST_CHECK(frame.pixels.empty());
+  }
+
+  // Not idle until the frames are retrieved
+  DALI_TEST_CHECK(!encoder.IsIdle());
+
+  std::vector<CaptureEncoder::Frame> frames;
+  encoder.GetEncodedFrames(frames);
+  DALI_TEST_EQUALS(frames.size(), static_cast<size_t>(2u), TEST_LOCATION);
+  for(size_t index = 0u; index < frames.size(); ++index)
+  {
+    DALI_TEST_EQUALS(frames[index].path, paths[index], TEST_LOCATION);
+    DALI_TEST_CHECK(frames[index].succeeded);
+    DALI_TEST_CHECK(frames[index].pixels.empty());
+  }
+  DALI_TEST_CHECK(encoder.IsIdle());
+
+  encoder.GetEncodedFrames(frames);
+  DALI_TEST_CHECK(frames.empty());
+
+  END_TEST;
+}
+
+int UtcDaliCaptureEncoderEncodeFailed(void)
+{
+  tet_infoline("A frame which can't be written is retrieved as failed");
+
+  EncodedCallback callback;
+  CaptureEncoder  encoder(MakeCallback(&callback, &EncodedCallback::Encoded), 1u, Dali::WorkerThreadPool::PREFETCH);
+
+  CaptureEncoder::Frame frame = CreateFrame("/non-existent-directory/capture-encoder.png");
+  DALI_TEST_CHECK(encoder.Encode(frame));
+
+  // No pixels to encode
+  CaptureEncoder::Frame emptyFrame = CreateFrame("/tmp/capture-encoder-empty.png");
+  emptyFrame.pixels.clear();
+  DALI_TEST_CHECK(encoder.Encode(emptyFrame));
+
+  std::vector<CaptureEncoder::Frame> frames;
+  encoder.GetEncodedFrames(frames);
+  DALI_TEST_EQUALS(frames.size(), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_CHECK(!frames[0].succeeded);
+  DALI_TEST_CHECK(!frames[1].succeeded);
+
+  END_TEST;
+}
+
+int UtcDaliCaptureEncoderConfigure(void)
+{
+  tet_infoline("The encoder is reused with other limits once it's idle");
+
+  EncodedCallback callback;
+  CaptureEncoder  encoder(MakeCallback(&callback, &EncodedCallback::Encoded), 1u, Dali::WorkerThreadPool::PREFETCH);
+
+  // At least one frame
+  encoder.Configure(0u, Dali::WorkerThreadPool::BACKGROUND);
+  DALI_TEST_CHECK(!encoder.IsFull());
+
+  CaptureEncoder::Frame frame = CreateFrame("/tmp/capture-encoder-2.png");
+  DALI_TEST_CHECK(encoder.Encode(frame));
+
+  std::vector<CaptureEncoder::Frame> frames;
+  encoder.GetEncodedFrames(frames);
+  DALI_TEST_EQUALS(frames.size(), static_cast<size_t>(1u), TEST_LOCATION);
+  DALI_TEST_CHECK(frames[0].succeeded);
+
+  END_TEST;
+}
+
+int UtcDaliCaptureEncoderGetFramePath(void)
+{
+  tet_infoline("The index of the frame is inserted before the extension of the file");
+
+  DALI_TEST_EQUALS(CaptureEncoder::GetFramePath("/tmp/capture.png", 12u), std::string("/tmp/capture-000012.png"), TEST_LOCATION);
+  DALI_TEST_EQUALS(CaptureEncoder::GetFramePath("capture.frame.jpg", 0u), std::string("capture.frame-000000.jpg"), TEST_LOCATION);
+
+  // The dots of the directories are not extensions
+  DALI_TEST_EQUALS(CaptureEncoder::GetFramePath("/tmp/captures.d/capture", 3u), std::string("/tmp/captures.d/capture-000003"), TEST_LOCATION);
+
+  // Wider than the padding
+  DALI_TEST_EQUALS(CaptureEncoder::GetFramePath("capture.png", 1234567u), std::string("capture-1234567.png"), TEST_LOCATION);
+
+  END_TEST;
+}
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <dali/internal/window-system/common/damage-region.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_damage_region_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_damage_region_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const int      SURFACE_SIZE         = 64;
+const uint32_t NUMBER_OF_ITERATIONS = 200u;
+
+/**
+ * A deterministic random generator, so a failure can be reproduced.
+ */
+struct Random
+{
+  int Next(int range)
+  {
+    seed = seed * 1103515245u + 12345u;
+    return static_cast<int>((seed >> 16u) & 0x7FFFu) % range;
+  }
+
+  Rect<int> NextRect()
+  {
+    const int x = Next(SURFACE_SIZE);
+    const int y = Next(SURFACE_SIZE);
+    return Rect<int>(x, y, 1 + Next(SURFACE_SIZE - x), 1 + Next(SURFACE_SIZE - y));
+  }
+
+  uint32_t seed;
+};
+
+/**
+ * The pixels of the surface, to check the region against.
+ */
+typedef std::vector<bool> Pixels;
+
+void SetPixels(Pixels& pixels, const Rect<int>& rect, bool value)
+{
+  for(int y = rect.y; y < rect.y + rect.height; ++y)
+  {
+    for(int x = rect.x; x < rect.x + rect.width; ++x)
+    {
+      if(x >= 0 && y >= 0 && x < SURFACE_SIZE && y < SURFACE_SIZE)
+      {
+        pixels[y * SURFACE_SIZE + x] = value;
+      }
+    }
+  }
+}
+
+/**
+ * Whether the rects of the region don't overlap and cover exactly the given pixels.
+ */
+bool Matches(const DamageRegion& region, const Pixels& expected)
+{
+  Pixels pixels(SURFACE_SIZE * SURFACE_SIZE, false);
+  int    area = 0;
+  for(const auto& rect : region.GetRects())
+  {
+    if(rect.width <= 0 || rect.height <= 0)
+    {
+      return false;
+    }
+    for(int y = rect.y; y < rect.y + rect.height; ++y)
+    {
+      for(int x = rect.x; x < rect.x + rect.width; ++x)
+      {
+        if(pixels[y * SURFACE_SIZE + x])
+        {
+          return false; // overlap
+        }
+        pixels[y * SURFACE_SIZE + x] = true;
+        ++area;
+      }
+    }
+  }
+  return (pixels == expected) && (area == region.GetArea());
+}
+
+} // namespace
+
+int UtcDaliDamageRegionAddDisjoint(void)
+{
+  tet_infoline("Rects far apart are kept apart");
+
+  DamageRegion region;
+  DALI_TEST_CHECK(region.IsEmpty());
+
+  region.Add(Rect<int>(0, 0, 10, 10));
+  region.Add(Rect<int>(100, 100, 10, 10));
+
+  DALI_TEST_EQUALS(region.GetRects().size(), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetArea(), 200, TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetBounds(), Rect<int>(0, 0, 110, 110), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliDamageRegionAddOverlapping(void)
+{
+  tet_infoline("Only the parts of a rect not in the region are added");
+
+  DamageRegion region;
+  region.Add(Rect<int>(0, 0, 10, 10));
+  region.Add(Rect<int>(5, 5, 10, 10));
+  DALI_TEST_EQUALS(region.GetArea(), 175, TEST_LOCATION);
+
+  // Contained, and empty rects change nothing.
+  region.Add(Rect<int>(2, 2, 4, 4));
+  region.Add(Rect<int>(50, 50, 0, 10));
+  DALI_TEST_EQUALS(region.GetArea(), 175, TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetBounds(), Rect<int>(0, 0, 15, 15), TEST_LOCATION);
+
+  region.Clear();
+  DALI_TEST_CHECK(region.IsEmpty());
+  DALI_TEST_EQUALS(region.GetArea(), 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetBounds(), Rect<int>(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliDamageRegionSubtractAndIntersect(void)
+{
+  tet_infoline("Subtracting splits the rects, intersecting clips them");
+
+  DamageRegion region;
+  region.Add(Rect<int>(0, 0, 30, 30));
+
+  // A hole in the middle leaves a frame.
+  region.Subtract(Rect<int>(10, 10, 10, 10));
+  DALI_TEST_EQUALS(region.GetArea(), 800, TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetBounds(), Rect<int>(0, 0, 30, 30), TEST_LOCATION);
+
+  region.Intersect(Rect<int>(0, 0, 15, 30));
+  DALI_TEST_EQUALS(region.GetArea(), 400, TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetBounds(), Rect<int>(0, 0, 15, 30), TEST_LOCATION);
+
+  region.Intersect(Rect<int>(100, 100, 10, 10));
+  DALI_TEST_CHECK(region.IsEmpty());
+
+  END_TEST;
+}
+
+int UtcDaliDamageRegionRandomEdits(void)
+{
+  tet_infoline("The rects never overlap and cover the pixels added, subtracted and clipped");
+
+  DamageRegion region;
+  Pixels       expected(SURFACE_SIZE * SURFACE_SIZE, false);
+  Random       random{1u};
+
+  uint32_t mismatches = 0u;
+  for(uint32_t iteration = 0u; iteration < NUMBER_OF_ITERATIONS; ++iteration)
+  {
+    const Rect<int> rect = random.NextRect();
+    switch(random.Next(5))
+    {
+      case 0:
+      {
+        region.Subtract(rect);
+        SetPixels(expected, rect, false);
+        break;
+      }
+      case 1:
+      {
+        region.Intersect(rect);
+        Pixels clipped(SURFACE_SIZE * SURFACE_SIZE, false);
+        for(int y = rect.y; y < rect.y + rect.height; ++y)
+        {
+          for(int x = rect.x; x < rect.x + rect.width; ++x)
+          {
+            clipped[y * SURFACE_SIZE + x] = expected[y * SURFACE_SIZE + x];
+          }
+        }
+        expected = clipped;
+        break;
+      }
+      default:
+      {
+        region.Add(rect);
+        SetPixels(expected, rect, true);
+        break;
+      }
+    }
+
+    if(!Matches(region, expected))
+    {
+      ++mismatches;
+      region.Clear();
+      expected.assign(expected.size(), false);
+    }
+  }
+
+  DALI_TEST_EQUALS(mismatches, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliDamageRegionCoalesce(void)
+{
+  tet_infoline("Coalesce merges the rects whose bounding box adds fewer pixels than the cost of a rect");
+
+  DamageRegion region;
+  region.Add(Rect<int>(0, 0, 10, 10));
+  region.Add(Rect<int>(11, 0, 10, 10));    // The column in between adds 10 pixels
+  region.Add(Rect<int>(500, 500, 10, 10)); // Far away
+
+  region.Coalesce(20, 4u);
+  DALI_TEST_EQUALS(region.GetRects().size(), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetArea(), 310, TEST_LOCATION);
+
+  // Cheaper to draw the pixels in between than an extra rect.
+  region.Coalesce(1000000, 4u);
+  DALI_TEST_EQUALS(region.GetRects().size(), static_cast<size_t>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(region.GetRects()[0], Rect<int>(0, 0, 510, 510), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliDamageRegionCoalesceMaximumRects(void)
+{
+  tet_infoline("Coalesce merges the rects while there are more than the maximum, and they never overlap");
+
+  DamageRegion region;
+  Pixels       damaged(SURFACE_SIZE * SURFACE_SIZE, false);
+  for(int index = 0; index < 6; ++index)
+  {
+    const Rect<int> rect(index * 10, (index % 2) * 40, 5, 5);
+    region.Add(rect);
+    SetPixels(damaged, rect, true);
+  }
+  DALI_TEST_EQUALS(region.GetRects().size(), static_cast<size_t>(6u), TEST_LOCATION);
+
+  region.Coalesce(0, 3u);
+  DALI_TEST_CHECK(region.GetRects().size() <= 3u);
+
+  // Still covers the damage, without overlaps.
+  int area = 0;
+  for(const auto& rect : region.GetRects())
+  {
+    area += rect.width * rect.height;
+    for(const auto& other : region.GetRects())
+    {
+      DALI_TEST_CHECK((&rect == &other) || !rect.Intersects(other));
+    }
+  }
+  DALI_TEST_EQUALS(area, region.GetArea(), TEST_LOCATION);
+
+  Pixels covered(SURFACE_SIZE * SURFACE_SIZE, false);
+  for(const auto& rect : region.GetRects())
+  {
+    SetPixels(covered, rect, true);
+  }
+  bool allCovered = true;
+  for(size_t index = 0u; index < damaged.size(); ++index)
+  {
+    allCovered = allCovered && (!damaged[index] || covered[index]);
+  }
+  DALI_TEST_CHECK(allCovered);
+
+  END_TEST;
+}
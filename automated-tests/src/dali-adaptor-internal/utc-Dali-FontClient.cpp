@@ -20,6 +20,9 @@
 #include <dali-test-suite-utils.h>
 #include <dali/dali.h>
 #include <dali/internal/text/text-abstraction/font-client-helper.h>
+#include <dali/internal/text/text-abstraction/font-coverage-index.h>
+#include <dali/internal/text/text-abstraction/glyph-metrics-cache.h>
+#include <fontconfig/fontconfig.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -85,3 +88,149 @@ int UtcDaliFontClient(void)
 
   END_TEST;
 }
+
+int UtcDaliFontCoverageIndex(void)
+{
+  TestApplication application;
+
+  using TextAbstraction::Internal::CharacterSetList;
+  using TextAbstraction::Internal::FontCoverageIndex;
+
+  // Font 0 supports latin. Font 1 supports latin and some CJK. Font 2 has no character set.
+  FcCharSet* latin = FcCharSetCreate();
+  FcCharSet* cjk   = FcCharSetCreate();
+  for(uint32_t character = 0x20u; character < 0x7Fu; ++character)
+  {
+    FcCharSetAddChar(latin, character);
+    FcCharSetAddChar(cjk, character);
+  }
+  FcCharSetAddChar(cjk, 0x4E00u);
+  FcCharSetAddChar(cjk, 0x4E01u);
+
+  CharacterSetList characterSets;
+  characterSets.PushBack(latin);
+  characterSets.PushBack(cjk);
+  characterSets.PushBack(nullptr);
+
+  FontCoverageIndex index;
+
+  tet_infoline("UtcDaliFontCoverageIndex first font");
+  DALI_TEST_EQUALS(0u, index.FindFirstFont(characterSets, 'a'), TEST_LOCATION);
+  DALI_TEST_EQUALS(1u, index.FindFirstFont(characterSets, 0x4E00u), TEST_LOCATION);
+  DALI_TEST_EQUALS(1u, index.FindFirstFont(characterSets, 0x4E01u), TEST_LOCATION);
+  DALI_TEST_EQUALS(FontCoverageIndex::NO_FONT, index.FindFirstFont(characterSets, 0x4E02u), TEST_LOCATION);
+  DALI_TEST_EQUALS(FontCoverageIndex::NO_FONT, index.FindFirstFont(characterSets, 0x1F600u), TEST_LOCATION);
+
+  // Memoized results.
+  DALI_TEST_EQUALS(0u, index.FindFirstFont(characterSets, 'a'), TEST_LOCATION);
+  DALI_TEST_EQUALS(1u, index.FindFirstFont(characterSets, 0x4E00u), TEST_LOCATION);
+
+  tet_infoline("UtcDaliFontCoverageIndex candidate fonts");
+  const Vector<uint32_t>& latinCandidates = index.GetCandidateFonts(characterSets, 'b');
+  DALI_TEST_EQUALS(2u, latinCandidates.Count(), TEST_LOCATION);
+  DALI_TEST_EQUALS(0u, latinCandidates[0u], TEST_LOCATION);
+  DALI_TEST_EQUALS(1u, latinCandidates[1u], TEST_LOCATION);
+
+  const Vector<uint32_t>& cjkCandidates = index.GetCandidateFonts(characterSets, 0x4EFFu);
+  DALI_TEST_EQUALS(1u, cjkCandidates.Count(), TEST_LOCATION);
+  DALI_TEST_EQUALS(1u, cjkCandidates[0u], TEST_LOCATION);
+  DALI_TEST_CHECK(!FontCoverageIndex::IsCharacterSupported(characterSets, 1u, 0x4EFFu));
+  DALI_TEST_CHECK(!FontCoverageIndex::IsCharacterSupported(characterSets, 2u, 'a'));
+
+  tet_infoline("UtcDaliFontCoverageIndex clear");
+  index.Clear();
+  DALI_TEST_EQUALS(0u, index.FindFirstFont(characterSets, 'a'), TEST_LOCATION);
+
+  FcCharSetDestroy(latin);
+  FcCharSetDestroy(cjk);
+
+  END_TEST;
+}
+
+int UtcDaliGlyphMetricsCache(void)
+{
+  TestApplication application;
+
+  using TextAbstraction::Internal::GlyphMetricsCache;
+
+  GlyphMetricsCache cache;
+
+  tet_infoline("UtcDaliGlyphMetricsCache entries are created not cached");
+  DALI_TEST_EQUALS(GlyphMetricsCache::NOT_CACHED, cache.GetEntry(3u, false).state, TEST_LOCATION);
+  DALI_TEST_EQUALS(GlyphMetricsCache::NOT_CACHED, cache.GetEntry(40000u, false).state, TEST_LOCATION);
+
+  tet_infoline("UtcDaliGlyphMetricsCache regular and emboldened entries are different");
+  GlyphMetricsCache::Entry& entry = cache.GetEntry(3u, false);
+  entry.width                     = 10.f;
+  entry.state                     = GlyphMetricsCache::CACHED;
+
+  DALI_TEST_EQUALS(GlyphMetricsCache::CACHED, cache.GetEntry(3u, false).state, TEST_LOCATION);
+  DALI_TEST_EQUALS(10.f, cache.GetEntry(3u, false).width, TEST_LOCATION);
+  DALI_TEST_EQUALS(GlyphMetricsCache::NOT_CACHED, cache.GetEntry(3u, true).state, TEST_LOCATION);
+  DALI_TEST_EQUALS(GlyphMetricsCache::NOT_CACHED, cache.GetEntry(4u, false).state, TEST_LOCATION);
+
+  tet_infoline("UtcDaliGlyphMetricsCache clear");
+  cache.Clear();
+  DALI_TEST_EQUALS(GlyphMetricsCache::NOT_CACHED, cache.GetEntry(3u, false).state, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFontCoverageIndexRebuiltCharacterSets(void)
+{
+  TestApplication application;
+
+  using TextAbstraction::Internal::CharacterSetList;
+  using TextAbstraction::Internal::FontCoverageIndex;
+
+  FcCharSet* latin = FcCharSetCreate();
+  FcCharSet* cjk   = FcCharSetCreate();
+  FcCharSetAddChar(latin, 'a');
+  FcCharSetAddChar(cjk, 0x4E00u);
+
+  CharacterSetList characterSets;
+  characterSets.PushBack(latin);
+  characterSets.PushBack(cjk);
+
+  FontCoverageIndex index;
+  DALI_TEST_EQUALS(0u, index.FindFirstFont(characterSets, 'a'), TEST_LOCATION);
+  DALI_TEST_EQUALS(1u, index.FindFirstFont(characterSets, 0x4E00u), TEST_LOCATION);
+
+  // The character sets are rebuilt in another order, as after FcInitReinitialize()
+  characterSets.Clear();
+  characterSets.PushBack(cjk);
+  characterSets.PushBack(latin);
+
+  tet_infoline("UtcDaliFontCoverageIndexRebuiltCharacterSets cleared index follows the new character sets");
+  index.Clear();
+  DALI_TEST_EQUALS(1u, index.FindFirstFont(characterSets, 'a'), TEST_LOCATION);
+  DALI_TEST_EQUALS(0u, index.FindFirstFont(characterSets, 0x4E00u), TEST_LOCATION);
+
+  FcCharSetDestroy(latin);
+  FcCharSetDestroy(cjk);
+
+  END_TEST;
+}
+
+int UtcDaliFontClientFindDefaultFontAfterReset(void)
+{
+  TestApplication application;
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  const TextAbstraction::FontId fontId = fontClient.FindDefaultFont('a');
+  if(0u != fontId)
+  {
+    DALI_TEST_CHECK(fontClient.IsCharacterSupportedByFont(fontId, 'a'));
+  }
+
+  // Rebuilds the character sets of the default fonts, and clears their coverage index
+  fontClient.ResetSystemDefaults();
+  TextAbstraction::FontDescription fontDescription;
+  fontClient.GetDefaultPlatformFontDescription(fontDescription);
+
+  tet_infoline("UtcDaliFontClientFindDefaultFontAfterReset same font found after the reset");
+  DALI_TEST_EQUALS(fontId, fontClient.FindDefaultFont('a'), TEST_LOCATION);
+
+  END_TEST;
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <memory>
+
+#include <dali/internal/system/common/frame-time-histogram.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_frame_time_histogram_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_frame_time_histogram_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const unsigned int MAXIMUM_DURATION = (1u << 26u) - 1u;
+
+/**
+ * Retrieves the highest duration of the bucket a single duration is recorded in.
+ */
+unsigned int GetBucketUpperBound(unsigned int microseconds)
+{
+  FrameTimeHistogram           histogram;
+  FrameTimeHistogram::Snapshot snapshot;
+  histogram.Record(microseconds);
+  histogram.TakeSnapshot(snapshot);
+  return snapshot.GetPercentile(100.0f);
+}
+
+} // namespace
+
+int UtcDaliFrameTimeHistogramEmpty(void)
+{
+  tet_infoline("The percentiles of an empty histogram are zero");
+
+  FrameTimeHistogram           histogram;
+  FrameTimeHistogram::Snapshot snapshot;
+  histogram.TakeSnapshot(snapshot);
+
+  DALI_TEST_EQUALS(snapshot.count, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot.GetPercentile(0.0f), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot.GetPercentile(50.0f), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot.GetPercentile(100.0f), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFrameTimeHistogramBucketBoundaries(void)
+{
+  tet_infoline("The durations under 64 microseconds are exact, then each bucket is 1/32 of its power of two");
+
+  for(unsigned int microseconds = 0u; microseconds < 64u; ++microseconds)
+  {
+    DALI_TEST_EQUALS(GetBucketUpperBound(microseconds), microseconds, TEST_LOCATION);
+  }
+
+  // [64,65] is the first bucket two microseconds wide.
+  DALI_TEST_EQUALS(GetBucketUpperBound(64u), 65u, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetBucketUpperBound(65u), 65u, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetBucketUpperBound(66u), 67u, TEST_LOCATION);
+
+  // The last bucket of a range ends just before the next power of two.
+  DALI_TEST_EQUALS(GetBucketUpperBound(127u), 127u, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetBucketUpperBound(128u), 131u, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetBucketUpperBound(16383u), 16383u, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetBucketUpperBound(16384u), 16895u, TEST_LOCATION);
+
+  // The longest durations are clamped to the last bucket.
+  DALI_TEST_EQUALS(GetBucketUpperBound(MAXIMUM_DURATION), MAXIMUM_DURATION, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetBucketUpperBound(MAXIMUM_DURATION + 1u), MAXIMUM_DURATION, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetBucketUpperBound(0xFFFFFFFFu), MAXIMUM_DURATION, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFrameTimeHistogramBucketError(void)
+{
+  tet_infoline("A duration is never over the upper bound of its bucket, nor more than 1/32 under it");
+
+  uint32_t errors = 0u;
+  for(unsigned int microseconds = 1u; microseconds <= MAXIMUM_DURATION; microseconds += 1u + microseconds / 97u)
+  {
+    const unsigned int upperBound = GetBucketUpperBound(microseconds);
+    if(upperBound < microseconds || upperBound - microseconds > microseconds / 32u)
+    {
+      ++errors;
+    }
+  }
+
+  DALI_TEST_EQUALS(errors, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFrameTimeHistogramPercentiles(void)
+{
+  tet_infoline("The p50 and p99 of known distributions are within 1/32 of the exact values");
+
+  std::unique_ptr<FrameTimeHistogram>           histogram(new FrameTimeHistogram);
+  std::unique_ptr<FrameTimeHistogram::Snapshot> snapshot(new FrameTimeHistogram::Snapshot);
+
+  // A uniform distribution between 1 and 100000 microseconds.
+  for(unsigned int microseconds = 1u; microseconds <= 100000u; ++microseconds)
+  {
+    histogram->Record(microseconds);
+  }
+  histogram->TakeSnapshot(*snapshot);
+
+  DALI_TEST_EQUALS(snapshot->count, 100000u, TEST_LOCATION);
+
+  const unsigned int p50 = snapshot->GetPercentile(50.0f);
+  const unsigned int p99 = snapshot->GetPercentile(99.0f);
+  DALI_TEST_CHECK(p50 >= 50000u && p50 <= 50000u + 50000u / 32u);
+  DALI_TEST_CHECK(p99 >= 99000u && p99 <= 99000u + 99000u / 32u);
+  DALI_TEST_EQUALS(snapshot->GetPercentile(100.0f), GetBucketUpperBound(100000u), TEST_LOCATION);
+
+  // Frames at 16.6ms with one slow frame in 100: the p99 is the slow frame.
+  for(uint32_t frame = 0u; frame < 1000u; ++frame)
+  {
+    histogram->Record((frame % 100u == 99u) ? 50000u : 16667u);
+  }
+  histogram->TakeSnapshot(*snapshot);
+
+  DALI_TEST_EQUALS(snapshot->count, 1000u, TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot->GetPercentile(50.0f), GetBucketUpperBound(16667u), TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot->GetPercentile(98.5f), GetBucketUpperBound(16667u), TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot->GetPercentile(99.5f), GetBucketUpperBound(50000u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFrameTimeHistogramTakeSnapshot(void)
+{
+  tet_infoline("Taking a snapshot empties the histogram");
+
+  FrameTimeHistogram           histogram;
+  FrameTimeHistogram::Snapshot snapshot;
+  histogram.Record(100u);
+  histogram.Record(200u);
+  histogram.TakeSnapshot(snapshot);
+
+  DALI_TEST_EQUALS(snapshot.count, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot.GetPercentile(0.0f), GetBucketUpperBound(100u), TEST_LOCATION);
+
+  histogram.TakeSnapshot(snapshot);
+
+  DALI_TEST_EQUALS(snapshot.count, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(snapshot.GetPercentile(100.0f), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <dali/internal/graphics/gles/gl-call-trace-reader.h>
+#include <dali/internal/graphics/gles/gl-call-trace-writer.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_gl_call_trace_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_gl_call_trace_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* const TRACE_FILE = "/tmp/utc-dali-gl-call-trace.glt";
+
+long GetFileSize(const char* const path)
+{
+  FILE* file = fopen(path, "rb");
+  if(!file)
+  {
+    return -1;
+  }
+  fseek(file, 0, SEEK_END);
+  const long size = ftell(file);
+  fclose(file);
+  return size;
+}
+
+} // namespace
+
+int UtcDaliGlCallTraceRoundTrip(void)
+{
+  tet_infoline("The records written by the GlCallTraceWriter are read back with their arguments");
+
+  const float       values[]  = {0.25f, 0.5f, 0.75f, 1.0f};
+  const char* const sources[] = {"void main()", "{}"};
+  {
+    GlCallTraceWriter writer(TRACE_FILE);
+    DALI_TEST_CHECK(writer.IsOpen());
+
+    writer.Record(GlCallTrace::FRAME_BEGIN, 0u, uint64_t(123456789012u));
+    writer.Record(GlCallTrace::BIND_TEXTURE, 1500u, uint32_t(0x0DE1), uint32_t(7u));
+    writer.Record(GlCallTrace::UNIFORM4FV, 200u, int32_t(-1), GlCallTrace::MakeArray(values, 4));
+    writer.Record(GlCallTrace::BIND_ATTRIB_LOCATION, 300u, uint32_t(3u), uint32_t(1u), GlCallTrace::String("aPosition"));
+    writer.Record(GlCallTrace::SHADER_SOURCE, 400u, uint32_t(5u), GlCallTrace::StringList(sources, 2));
+    writer.WriteFrame();
+  }
+
+  GlCallTraceReader reader(TRACE_FILE);
+  DALI_TEST_CHECK(reader.IsValid());
+
+  GlCallTrace::RecordHeader header;
+  std::vector<uint8_t>      bytes;
+
+  DALI_TEST_CHECK(reader.ReadRecord(header, bytes));
+  DALI_TEST_EQUALS(header.call, static_cast<uint16_t>(GlCallTrace::FRAME_BEGIN), TEST_LOCATION);
+  {
+    GlCallTraceArguments arguments(bytes);
+    DALI_TEST_EQUALS(arguments.Read<uint64_t>(), uint64_t(123456789012u), TEST_LOCATION);
+    DALI_TEST_EQUALS(arguments.GetRemainingSize(), std::size_t(0u), TEST_LOCATION);
+  }
+
+  DALI_TEST_CHECK(reader.ReadRecord(header, bytes));
+  DALI_TEST_EQUALS(header.call, static_cast<uint16_t>(GlCallTrace::BIND_TEXTURE), TEST_LOCATION);
+  DALI_TEST_EQUALS(header.duration, 1500u, TEST_LOCATION);
+  {
+    GlCallTraceArguments arguments(bytes);
+    DALI_TEST_EQUALS(arguments.Read<uint32_t>(), uint32_t(0x0DE1), TEST_LOCATION);
+    DALI_TEST_EQUALS(arguments.Read<uint32_t>(), 7u, TEST_LOCATION);
+  }
+
+  DALI_TEST_CHECK(reader.ReadRecord(header, bytes));
+  DALI_TEST_EQUALS(header.call, static_cast<uint16_t>(GlCallTrace::UNIFORM4FV), TEST_LOCATION);
+  {
+    GlCallTraceArguments arguments(bytes);
+    DALI_TEST_EQUALS(arguments.Read<int32_t>(), -1, TEST_LOCATION);
+    std::vector<float> readValues;
+    DALI_TEST_EQUALS(arguments.ReadArray(readValues), 4u, TEST_LOCATION);
+    DALI_TEST_CHECK(readValues == std::vector<float>(values, values + 4));
+  }
+
+  DALI_TEST_CHECK(reader.ReadRecord(header, bytes));
+  DALI_TEST_EQUALS(header.call, static_cast<uint16_t>(GlCallTrace::BIND_ATTRIB_LOCATION), TEST_LOCATION);
+  {
+    GlCallTraceArguments arguments(bytes);
+    DALI_TEST_EQUALS(arguments.Read<uint32_t>(), 3u, TEST_LOCATION);
+    DALI_TEST_EQUALS(arguments.Read<uint32_t>(), 1u, TEST_LOCATION);
+    DALI_TEST_EQUALS(arguments.ReadString(), std::string("aPosition"), TEST_LOCATION);
+  }
+
+  DALI_TEST_CHECK(reader.ReadRecord(header, bytes));
+  DALI_TEST_EQUALS(header.call, static_cast<uint16_t>(GlCallTrace::SHADER_SOURCE), TEST_LOCATION);
+  {
+    GlCallTraceArguments arguments(bytes);
+    DALI_TEST_EQUALS(arguments.Read<uint32_t>(), 5u, TEST_LOCATION);
+    DALI_TEST_EQUALS(arguments.Read<uint32_t>(), 2u, TEST_LOCATION); // The number of strings
+    DALI_TEST_EQUALS(arguments.Read<uint32_t>(), 2u, TEST_LOCATION); // The number stored
+    DALI_TEST_EQUALS(arguments.ReadString(), std::string(sources[0]), TEST_LOCATION);
+    DALI_TEST_EQUALS(arguments.ReadString(), std::string(sources[1]), TEST_LOCATION);
+  }
+
+  DALI_TEST_CHECK(!reader.ReadRecord(header, bytes));
+
+  unlink(TRACE_FILE);
+
+  END_TEST;
+}
+
+int UtcDaliGlCallTraceLongArray(void)
+{
+  tet_infoline("An array too long for a record is stored partially, with the arguments after it");
+
+  const std::vector<uint32_t> names(100000u, 42u);
+  {
+    GlCallTraceWriter writer(TRACE_FILE);
+    writer.Record(GlCallTrace::DELETE_TEXTURES, 0u, GlCallTrace::MakeArray(names.data(), names.size()), uint32_t(99u));
+  }
+
+  GlCallTraceReader         reader(TRACE_FILE);
+  GlCallTrace::RecordHeader header;
+  std::vector<uint8_t>      bytes;
+  DALI_TEST_CHECK(reader.ReadRecord(header, bytes));
+  DALI_TEST_CHECK(header.size <= GlCallTrace::MAXIMUM_RECORD_SIZE);
+
+  GlCallTraceArguments  arguments(bytes);
+  std::vector<uint32_t> readNames;
+  DALI_TEST_EQUALS(arguments.ReadArray(readNames), 100000u, TEST_LOCATION);
+  DALI_TEST_CHECK(!readNames.empty());
+  DALI_TEST_CHECK(readNames.size() < names.size());
+  DALI_TEST_CHECK(readNames == std::vector<uint32_t>(readNames.size(), 42u));
+  DALI_TEST_EQUALS(arguments.Read<uint32_t>(), 99u, TEST_LOCATION);
+
+  unlink(TRACE_FILE);
+
+  END_TEST;
+}
+
+int UtcDaliGlCallTracePartialRecord(void)
+{
+  tet_infoline("The record being written at the end of a trace is ignored");
+
+  {
+    GlCallTraceWriter writer(TRACE_FILE);
+    writer.Record(GlCallTrace::CLEAR_COLOR, 0u, 0.0f, 0.0f, 0.0f, 1.0f);
+    writer.Record(GlCallTrace::DRAW_ARRAYS, 0u, uint32_t(4u), int32_t(0), int32_t(6));
+  }
+  DALI_TEST_EQUALS(truncate(TRACE_FILE, GetFileSize(TRACE_FILE) - 1), 0, TEST_LOCATION);
+
+  GlCallTraceReader         reader(TRACE_FILE);
+  GlCallTrace::RecordHeader header;
+  std::vector<uint8_t>      bytes;
+  DALI_TEST_CHECK(reader.ReadRecord(header, bytes));
+  DALI_TEST_EQUALS(header.call, static_cast<uint16_t>(GlCallTrace::CLEAR_COLOR), TEST_LOCATION);
+  DALI_TEST_CHECK(!reader.ReadRecord(header, bytes));
+
+  unlink(TRACE_FILE);
+
+  END_TEST;
+}
+
+int UtcDaliGlCallTraceInvalidFile(void)
+{
+  tet_infoline("A file which isn't a trace isn't read");
+
+  FILE* file = fopen(TRACE_FILE, "wb");
+  fputs("Not a trace of GLES calls", file);
+  fclose(file);
+
+  GlCallTraceReader         reader(TRACE_FILE);
+  GlCallTrace::RecordHeader header;
+  std::vector<uint8_t>      bytes;
+  DALI_TEST_CHECK(!reader.IsValid());
+  DALI_TEST_CHECK(!reader.ReadRecord(header, bytes));
+
+  unlink(TRACE_FILE);
+
+  GlCallTraceReader missingReader(TRACE_FILE);
+  DALI_TEST_CHECK(!missingReader.IsValid());
+
+  END_TEST;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdlib.h>
+
+#include <dali/internal/graphics/gles/gl-state-cache-implementation.h>
+#include <dali/internal/system/common/environment-options.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+// The calls which reach GL.
+unsigned int gActiveTextureCalls = 0u;
+unsigned int gBindTextureCalls   = 0u;
+unsigned int gEnableCalls        = 0u;
+unsigned int gUseProgramCalls    = 0u;
+
+void ResetCalls()
+{
+  gActiveTextureCalls = 0u;
+  gBindTextureCalls   = 0u;
+  gEnableCalls        = 0u;
+  gUseProgramCalls    = 0u;
+}
+
+// Two contexts, as told by the EGL implementation.
+int gContextA = 0;
+int gContextB = 0;
+} // namespace
+
+// The GL functions called by the state cache, so the calls it drops can be counted.
+extern "C"
+{
+  void glActiveTexture(GLenum texture)
+  {
+    ++gActiveTextureCalls;
+  }
+
+  void glBindTexture(GLenum target, GLuint texture)
+  {
+    ++gBindTextureCalls;
+  }
+
+  void glEnable(GLenum cap)
+  {
+    ++gEnableCalls;
+  }
+
+  void glUseProgram(GLuint program)
+  {
+    ++gUseProgramCalls;
+  }
+
+  void glDeleteTextures(GLsizei n, const GLuint* textures)
+  {
+  }
+
+  void glGetIntegerv(GLenum pname, GLint* data)
+  {
+    *data = 0;
+  }
+}
+
+void utc_dali_gl_state_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+  ResetCalls();
+}
+
+void utc_dali_gl_state_cache_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliGlStateCacheDropsRedundantCalls(void)
+{
+  tet_infoline("The calls setting the state to the value it already has are dropped");
+
+  EnvironmentOptions         environmentOptions;
+  GlStateCacheImplementation gl(environmentOptions);
+  gl.ContextMadeCurrent(&gContextA);
+
+  // Unknown until set.
+  gl.UseProgram(1u);
+  gl.UseProgram(1u);
+  DALI_TEST_EQUALS(gUseProgramCalls, 1u, TEST_LOCATION);
+
+  gl.UseProgram(2u);
+  DALI_TEST_EQUALS(gUseProgramCalls, 2u, TEST_LOCATION);
+
+  gl.ActiveTexture(GL_TEXTURE1);
+  gl.BindTexture(GL_TEXTURE_2D, 5u);
+  gl.ActiveTexture(GL_TEXTURE1);
+  gl.BindTexture(GL_TEXTURE_2D, 5u);
+  DALI_TEST_EQUALS(gActiveTextureCalls, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(gBindTextureCalls, 1u, TEST_LOCATION);
+
+  // The bindings are per texture unit.
+  gl.ActiveTexture(GL_TEXTURE0);
+  gl.BindTexture(GL_TEXTURE_2D, 5u);
+  DALI_TEST_EQUALS(gActiveTextureCalls, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(gBindTextureCalls, 2u, TEST_LOCATION);
+
+  gl.Enable(GL_BLEND);
+  gl.Enable(GL_BLEND);
+  DALI_TEST_EQUALS(gEnableCalls, 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGlStateCacheStatePerContext(void)
+{
+  tet_infoline("The state is shadowed per context");
+
+  EnvironmentOptions         environmentOptions;
+  GlStateCacheImplementation gl(environmentOptions);
+
+  gl.ContextMadeCurrent(&gContextA);
+  gl.UseProgram(1u);
+  gl.Enable(GL_BLEND);
+
+  // Unknown in the other context.
+  gl.ContextMadeCurrent(&gContextB);
+  gl.UseProgram(1u);
+  gl.Enable(GL_BLEND);
+  DALI_TEST_EQUALS(gUseProgramCalls, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(gEnableCalls, 2u, TEST_LOCATION);
+
+  gl.UseProgram(2u);
+  DALI_TEST_EQUALS(gUseProgramCalls, 3u, TEST_LOCATION);
+
+  // Still known in the first context.
+  gl.ContextMadeCurrent(&gContextA);
+  gl.UseProgram(1u);
+  gl.Enable(GL_BLEND);
+  DALI_TEST_EQUALS(gUseProgramCalls, 3u, TEST_LOCATION);
+  DALI_TEST_EQUALS(gEnableCalls, 2u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGlStateCacheContextDestroyed(void)
+{
+  tet_infoline("The state of a destroyed context is forgotten, even if a new context gets its address");
+
+  EnvironmentOptions         environmentOptions;
+  GlStateCacheImplementation gl(environmentOptions);
+
+  gl.ContextMadeCurrent(&gContextA);
+  gl.UseProgram(1u);
+  gl.ContextMadeCurrent(&gContextB);
+  gl.UseProgram(1u);
+
+  gl.ContextDestroyed(&gContextA);
+  gl.ContextMadeCurrent(&gContextA);
+  gl.UseProgram(1u);
+  DALI_TEST_EQUALS(gUseProgramCalls, 3u, TEST_LOCATION);
+
+  // The other context keeps its state.
+  gl.ContextMadeCurrent(&gContextB);
+  gl.UseProgram(1u);
+  DALI_TEST_EQUALS(gUseProgramCalls, 3u, TEST_LOCATION);
+
+  // Destroying the current context leaves no context current.
+  gl.ContextDestroyed(&gContextB);
+  gl.UseProgram(1u);
+  DALI_TEST_EQUALS(gUseProgramCalls, 4u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGlStateCacheContextCreated(void)
+{
+  tet_infoline("Creating a context makes the state of every context unknown");
+
+  EnvironmentOptions         environmentOptions;
+  GlStateCacheImplementation gl(environmentOptions);
+
+  gl.ContextMadeCurrent(&gContextA);
+  gl.UseProgram(1u);
+  gl.ContextMadeCurrent(&gContextB);
+  gl.UseProgram(1u);
+
+  gl.ContextCreated();
+  gl.UseProgram(1u);
+  gl.ContextMadeCurrent(&gContextA);
+  gl.UseProgram(1u);
+  DALI_TEST_EQUALS(gUseProgramCalls, 4u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGlStateCacheDeleteTexture(void)
+{
+  tet_infoline("Deleting a texture makes the bindings to it unknown in every context");
+
+  EnvironmentOptions         environmentOptions;
+  GlStateCacheImplementation gl(environmentOptions);
+
+  gl.ContextMadeCurrent(&gContextA);
+  gl.ActiveTexture(GL_TEXTURE0);
+  gl.BindTexture(GL_TEXTURE_2D, 7u);
+  gl.ContextMadeCurrent(&gContextB);
+  gl.ActiveTexture(GL_TEXTURE0);
+  gl.BindTexture(GL_TEXTURE_2D, 7u);
+  DALI_TEST_EQUALS(gBindTextureCalls, 2u, TEST_LOCATION);
+
+  // A new texture may get the name of the deleted one.
+  const GLuint texture = 7u;
+  gl.DeleteTextures(1, &texture);
+  gl.BindTexture(GL_TEXTURE_2D, 7u);
+  DALI_TEST_EQUALS(gBindTextureCalls, 3u, TEST_LOCATION);
+
+  gl.ContextMadeCurrent(&gContextA);
+  gl.BindTexture(GL_TEXTURE_2D, 7u);
+  DALI_TEST_EQUALS(gBindTextureCalls, 4u, TEST_LOCATION);
+
+  END_TEST;
+}
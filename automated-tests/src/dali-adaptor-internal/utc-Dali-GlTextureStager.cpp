@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+
+#include <dali/internal/graphics/gles/gl-texture-stager.h>
+#include <test-gl-abstraction.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_gl_texture_stager_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_gl_texture_stager_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const uint32_t FRAME_BUDGET = 256u * 1024u;
+const GLsizei  TEXTURE_SIZE = 128; // 64KB of RGBA pixels, staged
+const int      CONTEXT      = 1;
+
+/**
+ * The test GL abstraction, with pixel unpack buffers which can be mapped, and fences.
+ */
+class StagingGlAbstraction : public TestGlAbstraction
+{
+public:
+  StagingGlAbstraction()
+  : mBuffers(),
+    mBoundBuffer(0u),
+    mUploadPixels(),
+    mFences(0u),
+    mWaitStatus(GL_ALREADY_SIGNALED)
+  {
+  }
+
+  void GenBuffers(GLsizei n, GLuint* buffers) override
+  {
+    for(GLsizei index = 0; index < n; ++index)
+    {
+      mBuffers.push_back(std::vector<uint8_t>());
+      buffers[index] = mBuffers.size();
+    }
+  }
+
+  void BindBuffer(GLenum target, GLuint buffer) override
+  {
+    mBoundBuffer = buffer;
+  }
+
+  void BufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage) override
+  {
+    mBuffers[mBoundBuffer - 1u].resize(size);
+  }
+
+  GLvoid* MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) override
+  {
+    return mBoundBuffer ? &mBuffers[mBoundBuffer - 1u][offset] : NULL;
+  }
+
+  GLboolean UnmapBuffer(GLenum target) override
+  {
+    return GL_TRUE;
+  }
+
+  void TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels) override
+  {
+    TestGlAbstraction::TexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+
+    // An offset in the bound buffer
+    mUploadPixels.push_back(&mBuffers[mBoundBuffer - 1u][reinterpret_cast<uintptr_t>(pixels)]);
+  }
+
+  GLsync FenceSync(GLenum condition, GLbitfield flags) override
+  {
+    ++mFences;
+    return reinterpret_cast<GLsync>(static_cast<uintptr_t>(mFences));
+  }
+
+  GLenum ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) override
+  {
+    return mWaitStatus;
+  }
+
+  std::vector<std::vector<uint8_t> > mBuffers;      ///< The content of each buffer
+  GLuint                             mBoundBuffer;  ///< The pixel unpack buffer bound
+  std::vector<const uint8_t*>        mUploadPixels; ///< The pixels each staged upload was made from
+  uint32_t                           mFences;       ///< The number of fences created
+  GLenum                             mWaitStatus;   ///< The status of the fences
+};
+
+std::vector<uint8_t> CreatePixels(uint8_t value)
+{
+  return std::vector<uint8_t>(TEXTURE_SIZE * TEXTURE_SIZE * 4u, value);
+}
+
+bool Upload(GlTextureStager& stager, const std::vector<uint8_t>& pixels)
+{
+  return stager.TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, TEXTURE_SIZE, TEXTURE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+}
+
+} // namespace
+
+int UtcDaliGlTextureStagerStage(void)
+{
+  tet_infoline("The large uploads of a frame are copied into the same buffer and made from it");
+
+  StagingGlAbstraction gl;
+  gl.GetTextureTrace().Enable(true);
+  GlTextureStager stager(gl, FRAME_BUDGET);
+  stager.ContextMadeCurrent(&CONTEXT);
+
+  const std::vector<uint8_t> firstPixels  = CreatePixels(1u);
+  const std::vector<uint8_t> secondPixels = CreatePixels(2u);
+  DALI_TEST_CHECK(Upload(stager, firstPixels));
+  DALI_TEST_CHECK(Upload(stager, secondPixels));
+
+  DALI_TEST_EQUALS(gl.mBuffers.size(), std::size_t(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(gl.GetTextureTrace().CountMethod("TexImage2D"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(gl.mUploadPixels.size(), std::size_t(2u), TEST_LOCATION);
+  DALI_TEST_CHECK(std::equal(firstPixels.begin(), firstPixels.end(), gl.mUploadPixels[0]));
+  DALI_TEST_CHECK(std::equal(secondPixels.begin(), secondPixels.end(), gl.mUploadPixels[1]));
+  DALI_TEST_EQUALS(gl.mBoundBuffer, 0u, TEST_LOCATION);
+
+  stager.FrameEnded();
+  DALI_TEST_EQUALS(gl.mFences, 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGlTextureStagerDirectUploads(void)
+{
+  tet_infoline("The small uploads, those over the budget and those from the caller's buffer aren't staged");
+
+  StagingGlAbstraction gl;
+  GlTextureStager      stager(gl, FRAME_BUDGET);
+
+  const std::vector<uint8_t> pixels = CreatePixels(1u);
+  DALI_TEST_CHECK(!Upload(stager, pixels)); // No context current yet
+
+  stager.ContextMadeCurrent(&CONTEXT);
+  DALI_TEST_CHECK(!stager.TexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 8, 8, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data()));
+
+  stager.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 5u);
+  DALI_TEST_CHECK(!Upload(stager, pixels));
+  stager.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0u);
+
+  stager.PixelStorei(GL_UNPACK_ROW_LENGTH, 256);
+  DALI_TEST_CHECK(!Upload(stager, pixels));
+  stager.PixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+  for(uint32_t index = 0u; index < FRAME_BUDGET / pixels.size(); ++index)
+  {
+    DALI_TEST_CHECK(Upload(stager, pixels));
+  }
+  DALI_TEST_CHECK(!Upload(stager, pixels));
+  DALI_TEST_EQUALS(gl.mUploadPixels.size(), FRAME_BUDGET / pixels.size(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGlTextureStagerFences(void)
+{
+  tet_infoline("A buffer isn't written again until the fence of its frame is signalled");
+
+  StagingGlAbstraction gl;
+  GlTextureStager      stager(gl, FRAME_BUDGET);
+  stager.ContextMadeCurrent(&CONTEXT);
+  gl.mWaitStatus = GL_TIMEOUT_EXPIRED;
+
+  const std::vector<uint8_t> pixels = CreatePixels(1u);
+  for(uint32_t frame = 0u; frame < 3u; ++frame)
+  {
+    DALI_TEST_CHECK(Upload(stager, pixels));
+    stager.FrameEnded();
+  }
+  DALI_TEST_EQUALS(gl.mBuffers.size(), std::size_t(3u), TEST_LOCATION);
+
+  // The driver is still reading the first buffer
+  DALI_TEST_CHECK(!Upload(stager, pixels));
+  stager.FrameEnded();
+  DALI_TEST_EQUALS(gl.mFences, 3u, TEST_LOCATION);
+
+  gl.mWaitStatus = GL_ALREADY_SIGNALED;
+  stager.FrameEnded();
+  DALI_TEST_CHECK(Upload(stager, pixels));
+  DALI_TEST_EQUALS(gl.mBuffers.size(), std::size_t(3u), TEST_LOCATION);
+
+  END_TEST;
+}
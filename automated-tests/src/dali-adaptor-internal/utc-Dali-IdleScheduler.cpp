@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <chrono>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include <dali/internal/system/common/callback-manager.h>
+#include <dali/internal/system/common/idle-scheduler.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_idle_scheduler_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_idle_scheduler_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const uint64_t NO_TIME_SLICE   = 0u;          ///< A single callback runs in each slice.
+const uint64_t LONG_TIME_SLICE = 1000000000u; ///< 1s, all the callbacks run in a slice.
+
+/**
+ * A callback manager running its idle callbacks when asked, like a main loop would when idle.
+ */
+class TestCallbackManager : public CallbackManager
+{
+public:
+  TestCallbackManager()
+  : mIdleCallbacks(),
+    mRunning(true)
+  {
+  }
+
+  ~TestCallbackManager() override
+  {
+    ClearIdleCallbacks();
+  }
+
+  bool AddIdleCallback(CallbackBase* callback, bool hasReturnValue) override
+  {
+    if(mRunning)
+    {
+      mIdleCallbacks.push_back(callback);
+    }
+    return mRunning;
+  }
+
+  void RemoveIdleCallback(CallbackBase* callback) override
+  {
+    for(auto iter = mIdleCallbacks.begin(); iter != mIdleCallbacks.end(); ++iter)
+    {
+      if(*iter == callback)
+      {
+        delete callback;
+        mIdleCallbacks.erase(iter);
+        return;
+      }
+    }
+  }
+
+  bool ProcessIdle()
+  {
+    // Like the main loop, the callbacks installed while running are run the next time.
+    std::vector<CallbackBase*> idleCallbacks;
+    idleCallbacks.swap(mIdleCallbacks);
+    for(auto callback : idleCallbacks)
+    {
+      CallbackBase::Execute(*callback);
+      delete callback;
+    }
+    return !idleCallbacks.empty();
+  }
+
+  void ClearIdleCallbacks()
+  {
+    for(auto callback : mIdleCallbacks)
+    {
+      delete callback;
+    }
+    mIdleCallbacks.clear();
+  }
+
+  bool AddIdleEntererCallback(CallbackBase* callback) override
+  {
+    delete callback;
+    return false;
+  }
+
+  void RemoveIdleEntererCallback(CallbackBase* callback) override
+  {
+  }
+
+  void Start() override
+  {
+    mRunning = true;
+  }
+
+  void Stop() override
+  {
+    mRunning = false;
+  }
+
+  size_t GetNumberOfIdleCallbacks() const
+  {
+    return mIdleCallbacks.size();
+  }
+
+private:
+  std::vector<CallbackBase*> mIdleCallbacks;
+  bool                       mRunning;
+};
+
+/**
+ * An idle callback recording its id in the order the callbacks run.
+ */
+class TestIdle
+{
+public:
+  TestIdle(std::vector<int>& calls, int id)
+  : mCalls(calls),
+    mScheduler(nullptr),
+    mId(id),
+    mRepeats(0u),
+    mSleep(0u),
+    mYield(false),
+    mRemoveSelf(false),
+    mSelf(nullptr)
+  {
+  }
+
+  void Run()
+  {
+    mCalls.push_back(mId);
+    std::this_thread::sleep_for(std::chrono::milliseconds(mSleep));
+    if(mYield)
+    {
+      mScheduler->Yield();
+    }
+    if(mRemoveSelf)
+    {
+      mScheduler->RemoveIdle(mSelf);
+    }
+  }
+
+  bool RunAgain()
+  {
+    Run();
+    if(0u == mRepeats)
+    {
+      return false;
+    }
+    --mRepeats;
+    return true;
+  }
+
+  std::vector<int>& mCalls;
+  IdleScheduler*    mScheduler;
+  int               mId;
+  unsigned int      mRepeats;    ///< The number of times RunAgain() asks to be called again.
+  unsigned int      mSleep;      ///< The time a call takes, in milliseconds.
+  bool              mYield;      ///< Whether a call ends the time slice.
+  bool              mRemoveSelf; ///< Whether a call removes its own callback.
+  CallbackBase*     mSelf;
+};
+
+} // namespace
+
+int UtcDaliIdleSchedulerPriorityOrder(void)
+{
+  tet_infoline("The callbacks run by priority, in the order they're added");
+
+  TestCallbackManager callbackManager;
+  IdleScheduler       scheduler(callbackManager, LONG_TIME_SLICE);
+
+  std::vector<int> calls;
+  TestIdle         normal1(calls, 1);
+  TestIdle         low(calls, 2);
+  TestIdle         high(calls, 3);
+  TestIdle         normal2(calls, 4);
+
+  DALI_TEST_CHECK(scheduler.AddIdle(MakeCallback(&normal1, &TestIdle::Run), false, IdleScheduler::NORMAL));
+  DALI_TEST_CHECK(scheduler.AddIdle(MakeCallback(&low, &TestIdle::Run), false, IdleScheduler::LOW));
+  DALI_TEST_CHECK(scheduler.AddIdle(MakeCallback(&high, &TestIdle::Run), false, IdleScheduler::HIGH));
+  DALI_TEST_CHECK(scheduler.AddIdle(MakeCallback(&normal2, &TestIdle::Run), false, IdleScheduler::NORMAL));
+
+  // A single idle callback of the main loop for all of them.
+  DALI_TEST_EQUALS(callbackManager.GetNumberOfIdleCallbacks(), static_cast<size_t>(1u), TEST_LOCATION);
+
+  DALI_TEST_CHECK(callbackManager.ProcessIdle());
+  DALI_TEST_EQUALS(calls.size(), static_cast<size_t>(4u), TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[0], 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[1], 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[2], 4, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[3], 2, TEST_LOCATION);
+
+  // Not installed again once the queue is empty.
+  DALI_TEST_EQUALS(callbackManager.GetNumberOfIdleCallbacks(), static_cast<size_t>(0u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliIdleSchedulerTimeSlice(void)
+{
+  tet_infoline("The callbacks run until the time slice is used, then the scheduler waits for the next idle");
+
+  TestCallbackManager callbackManager;
+  IdleScheduler       scheduler(callbackManager, NO_TIME_SLICE);
+
+  std::vector<int> calls;
+  TestIdle         idle1(calls, 1);
+  TestIdle         idle2(calls, 2);
+  TestIdle         idle3(calls, 3);
+  scheduler.AddIdle(MakeCallback(&idle1, &TestIdle::Run), false, IdleScheduler::NORMAL);
+  scheduler.AddIdle(MakeCallback(&idle2, &TestIdle::Run), false, IdleScheduler::NORMAL);
+  scheduler.AddIdle(MakeCallback(&idle3, &TestIdle::Run), false, IdleScheduler::NORMAL);
+
+  for(size_t slice = 1u; slice <= 3u; ++slice)
+  {
+    DALI_TEST_EQUALS(callbackManager.GetNumberOfIdleCallbacks(), static_cast<size_t>(1u), TEST_LOCATION);
+    callbackManager.ProcessIdle();
+    DALI_TEST_EQUALS(calls.size(), slice, TEST_LOCATION);
+  }
+  DALI_TEST_EQUALS(callbackManager.GetNumberOfIdleCallbacks(), static_cast<size_t>(0u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliIdleSchedulerTimeSliceSlowCallbacks(void)
+{
+  tet_infoline("Slow callbacks are spread over several time slices");
+
+  TestCallbackManager callbackManager;
+  IdleScheduler       scheduler(callbackManager, 5000000u); // 5ms
+
+  std::vector<int>      calls;
+  std::vector<TestIdle> idles(5u, TestIdle(calls, 0));
+  for(auto& idle : idles)
+  {
+    idle.mSleep = 3u;
+    scheduler.AddIdle(MakeCallback(&idle, &TestIdle::Run), false, IdleScheduler::NORMAL);
+  }
+
+  // The slice is used after two callbacks at most.
+  callbackManager.ProcessIdle();
+  DALI_TEST_CHECK(calls.size() >= 1u);
+  DALI_TEST_CHECK(calls.size() <= 2u);
+
+  while(callbackManager.ProcessIdle())
+  {
+  }
+  DALI_TEST_EQUALS(calls.size(), static_cast<size_t>(5u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliIdleSchedulerSetTimeSlice(void)
+{
+  tet_infoline("The time slice set, e.g. when the render refresh rate changes, is used from the next idle");
+
+  TestCallbackManager callbackManager;
+  IdleScheduler       scheduler(callbackManager, LONG_TIME_SLICE);
+
+  std::vector<int> calls;
+  TestIdle         idle1(calls, 1);
+  TestIdle         idle2(calls, 2);
+  TestIdle         idle3(calls, 3);
+  scheduler.AddIdle(MakeCallback(&idle1, &TestIdle::Run), false, IdleScheduler::NORMAL);
+  scheduler.AddIdle(MakeCallback(&idle2, &TestIdle::Run), false, IdleScheduler::NORMAL);
+  scheduler.AddIdle(MakeCallback(&idle3, &TestIdle::Run), false, IdleScheduler::NORMAL);
+
+  scheduler.SetTimeSlice(NO_TIME_SLICE);
+  callbackManager.ProcessIdle();
+  DALI_TEST_EQUALS(calls.size(), static_cast<size_t>(1u), TEST_LOCATION);
+
+  scheduler.SetTimeSlice(LONG_TIME_SLICE);
+  callbackManager.ProcessIdle();
+  DALI_TEST_EQUALS(calls.size(), static_cast<size_t>(3u), TEST_LOCATION);
+  DALI_TEST_EQUALS(callbackManager.GetNumberOfIdleCallbacks(), static_cast<size_t>(0u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliIdleSchedulerRepeat(void)
+{
+  tet_infoline("A callback returning true runs again after the other callbacks of its priority");
+
+  TestCallbackManager callbackManager;
+  IdleScheduler       scheduler(callbackManager, LONG_TIME_SLICE);
+
+  std::vector<int> calls;
+  TestIdle         repeating(calls, 1);
+  TestIdle         other(calls, 2);
+  TestIdle         low(calls, 3);
+  repeating.mRepeats = 2u;
+
+  scheduler.AddIdle(MakeCallback(&repeating, &TestIdle::RunAgain), true, IdleScheduler::NORMAL);
+  scheduler.AddIdle(MakeCallback(&other, &TestIdle::Run), false, IdleScheduler::NORMAL);
+  scheduler.AddIdle(MakeCallback(&low, &TestIdle::Run), false, IdleScheduler::LOW);
+
+  callbackManager.ProcessIdle();
+  DALI_TEST_EQUALS(calls.size(), static_cast<size_t>(5u), TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[0], 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[1], 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[2], 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[3], 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[4], 3, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliIdleSchedulerYield(void)
+{
+  tet_infoline("A yield ends the time slice after the running callback");
+
+  TestCallbackManager callbackManager;
+  IdleScheduler       scheduler(callbackManager, LONG_TIME_SLICE);
+
+  std::vector<int> calls;
+  TestIdle         yielding(calls, 1);
+  TestIdle         other(calls, 2);
+  yielding.mScheduler = &scheduler;
+  yielding.mYield     = true;
+
+  scheduler.AddIdle(MakeCallback(&yielding, &TestIdle::Run), false, IdleScheduler::NORMAL);
+  scheduler.AddIdle(MakeCallback(&other, &TestIdle::Run), false, IdleScheduler::NORMAL);
+
+  callbackManager.ProcessIdle();
+  DALI_TEST_EQUALS(calls.size(), static_cast<size_t>(1u), TEST_LOCATION);
+
+  callbackManager.ProcessIdle();
+  DALI_TEST_EQUALS(calls.size(), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[1], 2, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliIdleSchedulerRemoveIdle(void)
+{
+  tet_infoline("A callback can be removed while queued or by itself while running");
+
+  TestCallbackManager callbackManager;
+  IdleScheduler       scheduler(callbackManager, LONG_TIME_SLICE);
+
+  std::vector<int> calls;
+  TestIdle         removing(calls, 1);
+  TestIdle         removed(calls, 2);
+  TestIdle         other(calls, 3);
+
+  removing.mScheduler  = &scheduler;
+  removing.mRemoveSelf = true;
+  removing.mRepeats    = 10u;
+  removing.mSelf       = MakeCallback(&removing, &TestIdle::RunAgain);
+  CallbackBase* removedCallback = MakeCallback(&removed, &TestIdle::Run);
+
+  scheduler.AddIdle(removing.mSelf, true, IdleScheduler::NORMAL);
+  scheduler.AddIdle(removedCallback, false, IdleScheduler::NORMAL);
+  scheduler.AddIdle(MakeCallback(&other, &TestIdle::Run), false, IdleScheduler::NORMAL);
+  scheduler.RemoveIdle(removedCallback);
+
+  callbackManager.ProcessIdle();
+
+  // The removing callback asked to run again, but removed itself.
+  DALI_TEST_EQUALS(calls.size(), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[0], 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[1], 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(callbackManager.GetNumberOfIdleCallbacks(), static_cast<size_t>(0u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliIdleSchedulerClear(void)
+{
+  tet_infoline("Clear deletes the queued callbacks and removes the idle callback of the scheduler");
+
+  TestCallbackManager callbackManager;
+  IdleScheduler       scheduler(callbackManager, LONG_TIME_SLICE);
+
+  std::vector<int> calls;
+  TestIdle         idle(calls, 1);
+  scheduler.AddIdle(MakeCallback(&idle, &TestIdle::Run), false, IdleScheduler::NORMAL);
+  DALI_TEST_EQUALS(callbackManager.GetNumberOfIdleCallbacks(), static_cast<size_t>(1u), TEST_LOCATION);
+
+  scheduler.Clear();
+  DALI_TEST_EQUALS(callbackManager.GetNumberOfIdleCallbacks(), static_cast<size_t>(0u), TEST_LOCATION);
+  DALI_TEST_CHECK(!scheduler.Process());
+  DALI_TEST_CHECK(calls.empty());
+
+  // Not added while the callback manager is stopped.
+  callbackManager.Stop();
+  CallbackBase* callback = MakeCallback(&idle, &TestIdle::Run);
+  DALI_TEST_CHECK(!scheduler.AddIdle(callback, false, IdleScheduler::NORMAL));
+  delete callback;
+
+  END_TEST;
+}
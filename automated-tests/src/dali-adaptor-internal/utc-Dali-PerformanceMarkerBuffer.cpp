@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <memory>
+#include <thread>
+
+#include <dali/internal/system/common/performance-marker-buffer.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_performance_marker_buffer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_performance_marker_buffer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const uint32_t CAPACITY          = PerformanceMarkerBuffer::CAPACITY;
+const uint64_t NUMBER_OF_MARKERS = 200000u;
+
+PerformanceMarkerBuffer::Entry CreateEntry(uint64_t microseconds)
+{
+  PerformanceMarkerBuffer::Entry entry;
+  entry.microseconds = microseconds;
+  entry.type         = PerformanceInterface::UPDATE_START;
+  entry.threadId     = 1u;
+  entry.contextId    = 0u;
+  entry.custom       = false;
+  return entry;
+}
+
+} // namespace
+
+int UtcDaliPerformanceMarkerBufferEmpty(void)
+{
+  tet_infoline("Nothing is popped from an empty buffer");
+
+  std::unique_ptr<PerformanceMarkerBuffer> buffer(new PerformanceMarkerBuffer);
+
+  PerformanceMarkerBuffer::Entry entry;
+  DALI_TEST_CHECK(!buffer->Pop(entry));
+  DALI_TEST_EQUALS(buffer->GetSize(), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer->TakeDroppedCount(), 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(!buffer->HasProducerExited());
+
+  END_TEST;
+}
+
+int UtcDaliPerformanceMarkerBufferWrapAround(void)
+{
+  tet_infoline("The markers are popped in the order they are pushed when the indices wrap around the buffer");
+
+  std::unique_ptr<PerformanceMarkerBuffer> buffer(new PerformanceMarkerBuffer);
+
+  // Chunks not dividing the capacity, so the ends of the chunks move around the buffer.
+  const uint32_t CHUNK  = CAPACITY / 3u + 1u;
+  uint64_t       pushed = 0u;
+  uint64_t       popped = 0u;
+  uint32_t       errors = 0u;
+  for(uint32_t iteration = 0u; iteration < 20u; ++iteration)
+  {
+    for(uint32_t index = 0u; index < CHUNK; ++index)
+    {
+      if(!buffer->Push(CreateEntry(pushed++)))
+      {
+        ++errors;
+      }
+    }
+    DALI_TEST_EQUALS(buffer->GetSize(), CHUNK, TEST_LOCATION);
+
+    PerformanceMarkerBuffer::Entry entry;
+    while(buffer->Pop(entry))
+    {
+      if(entry.microseconds != popped++)
+      {
+        ++errors;
+      }
+    }
+    DALI_TEST_EQUALS(buffer->GetSize(), 0u, TEST_LOCATION);
+  }
+
+  DALI_TEST_EQUALS(errors, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(popped, pushed, TEST_LOCATION);
+  DALI_TEST_CHECK(pushed > CAPACITY * 2u);
+  DALI_TEST_EQUALS(buffer->TakeDroppedCount(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPerformanceMarkerBufferFull(void)
+{
+  tet_infoline("The markers pushed to a full buffer are dropped and counted, and the buffer accepts markers again once popped");
+
+  std::unique_ptr<PerformanceMarkerBuffer> buffer(new PerformanceMarkerBuffer);
+
+  for(uint32_t index = 0u; index < CAPACITY; ++index)
+  {
+    DALI_TEST_CHECK(buffer->Push(CreateEntry(index)));
+  }
+  DALI_TEST_EQUALS(buffer->GetSize(), CAPACITY, TEST_LOCATION);
+
+  DALI_TEST_CHECK(!buffer->Push(CreateEntry(CAPACITY)));
+  DALI_TEST_CHECK(!buffer->Push(CreateEntry(CAPACITY + 1u)));
+  DALI_TEST_EQUALS(buffer->GetSize(), CAPACITY, TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer->TakeDroppedCount(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(buffer->TakeDroppedCount(), 0u, TEST_LOCATION);
+
+  // The oldest marker is kept, not overwritten.
+  PerformanceMarkerBuffer::Entry entry;
+  DALI_TEST_CHECK(buffer->Pop(entry));
+  DALI_TEST_EQUALS(entry.microseconds, static_cast<uint64_t>(0u), TEST_LOCATION);
+
+  DALI_TEST_CHECK(buffer->Push(CreateEntry(CAPACITY + 2u)));
+  DALI_TEST_CHECK(!buffer->Push(CreateEntry(CAPACITY + 3u)));
+  DALI_TEST_EQUALS(buffer->TakeDroppedCount(), 1u, TEST_LOCATION);
+
+  uint32_t count = 0u;
+  while(buffer->Pop(entry))
+  {
+    ++count;
+  }
+  DALI_TEST_EQUALS(count, CAPACITY, TEST_LOCATION);
+  DALI_TEST_EQUALS(entry.microseconds, static_cast<uint64_t>(CAPACITY + 2u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPerformanceMarkerBufferTwoThreads(void)
+{
+  tet_infoline("A consumer thread pops all the markers of a producer thread in order, and sees the producer exit after its last marker");
+
+  std::unique_ptr<PerformanceMarkerBuffer> buffer(new PerformanceMarkerBuffer);
+
+  std::thread producer([&buffer]() {
+    for(uint64_t index = 0u; index < NUMBER_OF_MARKERS; ++index)
+    {
+      // Waits for the consumer instead of dropping the marker.
+      while(!buffer->Push(CreateEntry(index)))
+      {
+        std::this_thread::yield();
+      }
+    }
+    buffer->SetProducerExited();
+  });
+
+  uint64_t expected = 0u;
+  uint32_t errors   = 0u;
+  bool     exited   = false;
+  while(!exited)
+  {
+    // Checked first, so all the markers of the producer are popped below once it has exited.
+    exited = buffer->HasProducerExited();
+
+    PerformanceMarkerBuffer::Entry entry;
+    while(buffer->Pop(entry))
+    {
+      if(entry.microseconds != expected++)
+      {
+        ++errors;
+      }
+    }
+  }
+
+  producer.join();
+
+  DALI_TEST_EQUALS(errors, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(expected, NUMBER_OF_MARKERS, TEST_LOCATION);
+
+  END_TEST;
+}
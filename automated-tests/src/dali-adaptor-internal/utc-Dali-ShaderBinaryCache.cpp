@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <algorithm>
+#include <chrono>
+#include <fcntl.h>
+#include <memory>
+#include <stdlib.h>
+#include <string>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <dali/internal/graphics/gles/shader-binary-cache.h>
+#include <dali/internal/system/common/environment-options.h>
+#include <dali/internal/thread/common/worker-thread-pool-impl.h>
+
+using namespace Dali;
+
+namespace
+{
+char gDirectory[] = "/tmp/utc-dali-shader-binary-cache-XXXXXX";
+
+std::string gPath; ///< The path of the archive of the test.
+
+} // namespace
+
+void utc_dali_shader_binary_cache_startup(void)
+{
+  test_return_value = TET_UNDEF;
+
+  setenv("DALI_WORKER_THREAD_COUNT", "1", 1);
+  if(gPath.empty())
+  {
+    gPath = std::string(mkdtemp(gDirectory)) + "/dali-shader-binaries.cache";
+  }
+  unlink(gPath.c_str());
+}
+
+void utc_dali_shader_binary_cache_cleanup(void)
+{
+  unlink(gPath.c_str());
+  unsetenv("DALI_WORKER_THREAD_COUNT");
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const std::chrono::milliseconds COMPACTION_POLL_INTERVAL(10);
+const unsigned int              MAXIMUM_COMPACTION_POLLS = 500u;
+
+/**
+ * A cache of the archive of the test, with its worker thread.
+ */
+class TestCache
+{
+public:
+  TestCache()
+  : mEnvironmentOptions(),
+    mWorkerThreadPool(new Internal::Adaptor::WorkerThreadPool(mEnvironmentOptions)),
+    mCache(new Internal::Adaptor::ShaderBinaryCache(gPath, *mWorkerThreadPool))
+  {
+  }
+
+  ~TestCache()
+  {
+    // The worker is stopped before the cache it may be compacting is destroyed.
+    mWorkerThreadPool.reset();
+    mCache.reset();
+  }
+
+  Internal::Adaptor::ShaderBinaryCache* operator->()
+  {
+    return mCache.get();
+  }
+
+private:
+  Internal::Adaptor::EnvironmentOptions                 mEnvironmentOptions;
+  std::unique_ptr<Internal::Adaptor::WorkerThreadPool>  mWorkerThreadPool;
+  std::unique_ptr<Internal::Adaptor::ShaderBinaryCache> mCache;
+};
+
+std::vector<unsigned char> CreateBinary(size_t size, unsigned char seed)
+{
+  std::vector<unsigned char> binary(size);
+  for(size_t index = 0u; index < size; ++index)
+  {
+    binary[index] = static_cast<unsigned char>(seed + index * 7u);
+  }
+  return binary;
+}
+
+bool Save(TestCache& cache, const std::string& name, const std::vector<unsigned char>& binary)
+{
+  return cache->Save(name, binary.data(), static_cast<unsigned int>(binary.size()));
+}
+
+bool LoadEquals(TestCache& cache, const std::string& name, const std::vector<unsigned char>& binary)
+{
+  Dali::Vector<unsigned char> buffer;
+  return cache->Load(name, buffer) &&
+         (buffer.Count() == binary.size()) &&
+         std::equal(binary.begin(), binary.end(), buffer.Begin());
+}
+
+off_t GetArchiveSize()
+{
+  struct stat fileStat;
+  return (0 == stat(gPath.c_str(), &fileStat)) ? fileStat.st_size : -1;
+}
+
+void FlipByte(off_t offset)
+{
+  const int     fileDescriptor = open(gPath.c_str(), O_RDWR);
+  unsigned char byte           = 0u;
+  if(pread(fileDescriptor, &byte, 1u, offset) == 1)
+  {
+    byte ^= 0xFFu;
+    if(pwrite(fileDescriptor, &byte, 1u, offset) != 1)
+    {
+      tet_infoline("Unable to write the archive");
+    }
+  }
+  close(fileDescriptor);
+}
+
+} // namespace
+
+int UtcDaliShaderBinaryCacheSaveAndLoad(void)
+{
+  tet_infoline("The binaries saved are loaded by the next run");
+
+  const std::vector<unsigned char> binary1 = CreateBinary(100u, 1u);
+  const std::vector<unsigned char> binary2 = CreateBinary(3000u, 2u);
+  {
+    TestCache cache;
+    cache->SetGraphicsDriver("TestRenderer 1.0");
+    DALI_TEST_CHECK(Save(cache, "shader1", binary1));
+    DALI_TEST_CHECK(Save(cache, "shader2", binary2));
+    DALI_TEST_CHECK(LoadEquals(cache, "shader1", binary1));
+  }
+
+  TestCache cache;
+  cache->SetGraphicsDriver("TestRenderer 1.0");
+  DALI_TEST_CHECK(cache->Contains("shader1"));
+  DALI_TEST_CHECK(LoadEquals(cache, "shader1", binary1));
+  DALI_TEST_CHECK(LoadEquals(cache, "shader2", binary2));
+  DALI_TEST_CHECK(!cache->Contains("shader3"));
+  DALI_TEST_EQUALS(cache->GetNames().size(), static_cast<size_t>(2u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheSaveBeforeDriverSet(void)
+{
+  tet_infoline("The binaries are not saved until the graphics driver is set, as the driver which built them is not known");
+
+  const std::vector<unsigned char> binary1 = CreateBinary(100u, 1u);
+  const std::vector<unsigned char> binary2 = CreateBinary(200u, 2u);
+  {
+    TestCache cache;
+    cache->SetGraphicsDriver("TestRenderer 1.0");
+    DALI_TEST_CHECK(Save(cache, "shader1", binary1));
+  }
+
+  {
+    // The last binary was saved by the driver 1.0, but the binary is built by the driver 2.0.
+    TestCache cache;
+    DALI_TEST_CHECK(!Save(cache, "shader2", binary2));
+    DALI_TEST_CHECK(!cache->Contains("shader2"));
+
+    cache->SetGraphicsDriver("TestRenderer 2.0");
+    DALI_TEST_CHECK(Save(cache, "shader2", binary2));
+  }
+
+  TestCache cache;
+  cache->SetGraphicsDriver("TestRenderer 1.0");
+  DALI_TEST_CHECK(LoadEquals(cache, "shader1", binary1));
+  DALI_TEST_CHECK(!cache->Contains("shader2"));
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheTornRecord(void)
+{
+  tet_infoline("A record cut short at the end of the archive is discarded, and the archive is truncated before it");
+
+  const std::vector<unsigned char> binary1 = CreateBinary(100u, 1u);
+  const std::vector<unsigned char> binary2 = CreateBinary(200u, 2u);
+  const std::vector<unsigned char> binary3 = CreateBinary(300u, 3u);
+  off_t                            sizeAfterFirstRecord = 0;
+  {
+    TestCache cache;
+    cache->SetGraphicsDriver("TestRenderer 1.0");
+    DALI_TEST_CHECK(Save(cache, "shader1", binary1));
+    sizeAfterFirstRecord = GetArchiveSize();
+    DALI_TEST_CHECK(Save(cache, "shader2", binary2));
+  }
+
+  // As if the process stopped while writing the second record.
+  DALI_TEST_EQUALS(truncate(gPath.c_str(), GetArchiveSize() - 50), 0, TEST_LOCATION);
+  {
+    TestCache cache;
+    cache->SetGraphicsDriver("TestRenderer 1.0");
+    DALI_TEST_CHECK(LoadEquals(cache, "shader1", binary1));
+    DALI_TEST_CHECK(!cache->Contains("shader2"));
+    DALI_TEST_EQUALS(GetArchiveSize(), sizeAfterFirstRecord, TEST_LOCATION);
+
+    // Appended after the valid records.
+    DALI_TEST_CHECK(Save(cache, "shader3", binary3));
+  }
+
+  TestCache cache;
+  cache->SetGraphicsDriver("TestRenderer 1.0");
+  DALI_TEST_CHECK(LoadEquals(cache, "shader1", binary1));
+  DALI_TEST_CHECK(LoadEquals(cache, "shader3", binary3));
+  DALI_TEST_CHECK(!cache->Contains("shader2"));
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheChecksumMismatch(void)
+{
+  tet_infoline("A corrupted record is discarded with the records after it");
+
+  const std::vector<unsigned char> binary1 = CreateBinary(100u, 1u);
+  const std::vector<unsigned char> binary2 = CreateBinary(200u, 2u);
+  const std::vector<unsigned char> binary3 = CreateBinary(300u, 3u);
+  off_t                            sizeAfterFirstRecord  = 0;
+  off_t                            sizeAfterSecondRecord = 0;
+  {
+    TestCache cache;
+    cache->SetGraphicsDriver("TestRenderer 1.0");
+    DALI_TEST_CHECK(Save(cache, "shader1", binary1));
+    sizeAfterFirstRecord = GetArchiveSize();
+    DALI_TEST_CHECK(Save(cache, "shader2", binary2));
+    sizeAfterSecondRecord = GetArchiveSize();
+    DALI_TEST_CHECK(Save(cache, "shader3", binary3));
+  }
+
+  // A byte of the binary of the last record.
+  FlipByte(GetArchiveSize() - 1);
+  {
+    TestCache cache;
+    cache->SetGraphicsDriver("TestRenderer 1.0");
+    DALI_TEST_CHECK(LoadEquals(cache, "shader1", binary1));
+    DALI_TEST_CHECK(LoadEquals(cache, "shader2", binary2));
+    DALI_TEST_CHECK(!cache->Contains("shader3"));
+    DALI_TEST_EQUALS(GetArchiveSize(), sizeAfterSecondRecord, TEST_LOCATION);
+  }
+
+  // A byte of the binary of the first record.
+  FlipByte(sizeAfterFirstRecord - 1);
+  TestCache cache;
+  cache->SetGraphicsDriver("TestRenderer 1.0");
+  DALI_TEST_CHECK(!cache->Contains("shader1"));
+  DALI_TEST_CHECK(!cache->Contains("shader2"));
+  DALI_TEST_CHECK(GetArchiveSize() < sizeAfterFirstRecord);
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheDriverChange(void)
+{
+  tet_infoline("The binaries built by another driver are not loaded");
+
+  const std::vector<unsigned char> oldBinary = CreateBinary(100u, 1u);
+  const std::vector<unsigned char> newBinary = CreateBinary(120u, 2u);
+  {
+    TestCache cache;
+    cache->SetGraphicsDriver("TestRenderer 1.0");
+    DALI_TEST_CHECK(Save(cache, "shader1", oldBinary));
+    DALI_TEST_CHECK(Save(cache, "shader2", oldBinary));
+  }
+
+  {
+    // Until the driver is set, it's the one which saved the last binary.
+    TestCache cache;
+    DALI_TEST_CHECK(LoadEquals(cache, "shader1", oldBinary));
+
+    cache->SetGraphicsDriver("TestRenderer 2.0");
+    DALI_TEST_CHECK(!cache->Contains("shader1"));
+    DALI_TEST_CHECK(cache->GetNames().empty());
+
+    DALI_TEST_CHECK(Save(cache, "shader1", newBinary));
+    DALI_TEST_CHECK(LoadEquals(cache, "shader1", newBinary));
+  }
+
+  {
+    TestCache cache;
+    cache->SetGraphicsDriver("TestRenderer 2.0");
+    DALI_TEST_CHECK(LoadEquals(cache, "shader1", newBinary));
+    DALI_TEST_CHECK(!cache->Contains("shader2"));
+  }
+
+  TestCache cache;
+  cache->SetGraphicsDriver("TestRenderer 1.0");
+  DALI_TEST_CHECK(!cache->Contains("shader1"));
+  DALI_TEST_CHECK(LoadEquals(cache, "shader2", oldBinary));
+
+  END_TEST;
+}
+
+int UtcDaliShaderBinaryCacheCompaction(void)
+{
+  tet_infoline("The archive is compacted once the superseded records take more space than the others");
+
+  const std::vector<unsigned char> binary1 = CreateBinary(40000u, 1u);
+  const std::vector<unsigned char> binary2 = CreateBinary(40000u, 2u);
+  const std::vector<unsigned char> binary3 = CreateBinary(40000u, 3u);
+  const std::vector<unsigned char> small   = CreateBinary(100u, 4u);
+  {
+    TestCache cache;
+    cache->SetGraphicsDriver("TestRenderer 1.0");
+    DALI_TEST_CHECK(Save(cache, "small", small));
+    DALI_TEST_CHECK(Save(cache, "shader", binary1));
+    DALI_TEST_CHECK(Save(cache, "shader", binary2));
+    DALI_TEST_CHECK(Save(cache, "shader", binary3));
+  }
+  const off_t fullSize = GetArchiveSize();
+
+  // Compacted on a worker thread once opened.
+  TestCache cache;
+  cache->SetGraphicsDriver("TestRenderer 1.0");
+  DALI_TEST_CHECK(cache->Contains("shader"));
+  for(unsigned int poll = 0u; (poll < MAXIMUM_COMPACTION_POLLS) && (GetArchiveSize() == fullSize); ++poll)
+  {
+    std::this_thread::sleep_for(COMPACTION_POLL_INTERVAL);
+  }
+  DALI_TEST_CHECK(GetArchiveSize() < fullSize - 80000);
+
+  // The latest binaries are kept, and the ones saved after compacting are appended.
+  DALI_TEST_CHECK(LoadEquals(cache, "shader", binary3));
+  DALI_TEST_CHECK(LoadEquals(cache, "small", small));
+  DALI_TEST_CHECK(Save(cache, "shader", binary1));
+  DALI_TEST_CHECK(LoadEquals(cache, "shader", binary1));
+  DALI_TEST_EQUALS(access((gPath + ".tmp").c_str(), F_OK), -1, TEST_LOCATION);
+
+  END_TEST;
+}
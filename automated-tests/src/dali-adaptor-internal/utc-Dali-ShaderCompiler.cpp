@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dali/devel-api/adaptor-framework/shader-precompiler.h>
+#include <dali/devel-api/common/hash.h>
+#include <dali/internal/graphics/gles/shader-binary-cache.h>
+#include <dali/internal/graphics/gles/shader-compiler.h>
+#include <dali/internal/system/common/environment-options.h>
+#include <dali/internal/thread/common/worker-thread-pool-impl.h>
+#include <dali/public-api/dali-core-version.h>
+#include <test-gl-abstraction.h>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::ShaderCompiler;
+
+namespace
+{
+char gDirectory[] = "/tmp/utc-dali-shader-compiler-XXXXXX";
+
+std::string gPath; ///< The path of the archive of the test.
+
+} // namespace
+
+void utc_dali_shader_compiler_startup(void)
+{
+  test_return_value = TET_UNDEF;
+
+  setenv("DALI_WORKER_THREAD_COUNT", "1", 1);
+  if(gPath.empty())
+  {
+    gPath = std::string(mkdtemp(gDirectory)) + "/dali-shader-binaries.cache";
+  }
+  unlink(gPath.c_str());
+}
+
+void utc_dali_shader_compiler_cleanup(void)
+{
+  unlink(gPath.c_str());
+  unsetenv("DALI_WORKER_THREAD_COUNT");
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const std::chrono::milliseconds POLL_INTERVAL(10);
+const unsigned int              MAXIMUM_POLLS = 500u;
+const GLint                     BINARY_FORMAT = 0x1234;
+const GLint                     BINARY_LENGTH = 64;
+
+const char* const VERTEX_SOURCE   = "void main() { gl_Position = vec4(0.0); }";
+const char* const FRAGMENT_SOURCE = "void main() { gl_FragColor = vec4(1.0); }";
+
+/**
+ * The test GL abstraction, with programs which have a binary.
+ */
+class BinaryGlAbstraction : public TestGlAbstraction
+{
+public:
+  BinaryGlAbstraction()
+  {
+    SetNumBinaryFormats(1);
+    SetBinaryFormats(BINARY_FORMAT);
+    SetProgramBinaryLength(BINARY_LENGTH);
+  }
+
+  void GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, GLvoid* binary) override
+  {
+    std::fill(static_cast<unsigned char*>(binary), static_cast<unsigned char*>(binary) + bufSize, static_cast<unsigned char>(program));
+    *length       = bufSize;
+    *binaryFormat = BINARY_FORMAT;
+  }
+};
+
+/**
+ * What happened to the context of the compiler, as the compiler owns it.
+ */
+struct ContextState
+{
+  std::atomic<unsigned int> madeCurrent{0u};
+  std::atomic<unsigned int> released{0u};
+  std::atomic<bool>         destroyed{false};
+};
+
+/**
+ * A context current on any thread, making the GL calls through the test GL abstraction.
+ */
+class TestContext : public ShaderCompiler::Context
+{
+public:
+  TestContext(Integration::GlAbstraction& gl, ContextState& state)
+  : mGl(gl),
+    mState(state)
+  {
+  }
+
+  ~TestContext() override
+  {
+    mState.destroyed = true;
+  }
+
+  bool MakeCurrent() override
+  {
+    ++mState.madeCurrent;
+    return true;
+  }
+
+  void ReleaseCurrent() override
+  {
+    ++mState.released;
+  }
+
+  void EnableParallelCompilation() override
+  {
+  }
+
+  Integration::GlAbstraction& GetGlAbstraction() override
+  {
+    return mGl;
+  }
+
+private:
+  Integration::GlAbstraction& mGl;
+  ContextState&               mState;
+};
+
+/**
+ * A compiler saving in the archive of the test, with its worker thread.
+ */
+class TestCompiler
+{
+public:
+  TestCompiler()
+  : mEnvironmentOptions(),
+    mWorkerThreadPool(new Internal::Adaptor::WorkerThreadPool(mEnvironmentOptions)),
+    mCache(new Internal::Adaptor::ShaderBinaryCache(gPath, *mWorkerThreadPool)),
+    mCompiler(new ShaderCompiler(*mCache, *mWorkerThreadPool))
+  {
+    mCache->SetGraphicsDriver("TestRenderer 1.0");
+  }
+
+  ~TestCompiler()
+  {
+    mCompiler->Stop();
+    mWorkerThreadPool.reset();
+    mCompiler.reset();
+    mCache.reset();
+  }
+
+  bool Start(Integration::GlAbstraction& gl, ContextState& state)
+  {
+    return mCompiler->Start(std::unique_ptr<ShaderCompiler::Context>(new TestContext(gl, state)));
+  }
+
+  ShaderCompiler* operator->()
+  {
+    return mCompiler.get();
+  }
+
+  Internal::Adaptor::EnvironmentOptions                 mEnvironmentOptions;
+  std::unique_ptr<Internal::Adaptor::WorkerThreadPool>  mWorkerThreadPool;
+  std::unique_ptr<Internal::Adaptor::ShaderBinaryCache> mCache;
+  std::unique_ptr<ShaderCompiler>                       mCompiler;
+};
+
+/**
+ * Waits for the task of the compiler to release the context a number of times.
+ */
+bool WaitForRelease(ContextState& state, unsigned int count)
+{
+  for(unsigned int poll = 0u; poll < MAXIMUM_POLLS && state.released < count; ++poll)
+  {
+    std::this_thread::sleep_for(POLL_INTERVAL);
+  }
+  return state.released >= count;
+}
+
+} // namespace
+
+int UtcDaliShaderCompilerGetBinaryName(void)
+{
+  tet_infoline("The binaries are named with the version of core and the hash of the sources, as core loads them");
+
+  std::ostringstream expectedName;
+  expectedName << CORE_MAJOR_VERSION << '-' << CORE_MINOR_VERSION << '-' << CORE_MICRO_VERSION << '-'
+               << CalculateHash(std::string(VERTEX_SOURCE), std::string(FRAGMENT_SOURCE)) << ".dali-bin";
+
+  DALI_TEST_EQUALS(ShaderCompiler::GetBinaryName(VERTEX_SOURCE, FRAGMENT_SOURCE), expectedName.str(), TEST_LOCATION);
+  DALI_TEST_CHECK(ShaderCompiler::GetBinaryName(VERTEX_SOURCE, FRAGMENT_SOURCE) != ShaderCompiler::GetBinaryName(FRAGMENT_SOURCE, VERTEX_SOURCE));
+
+  END_TEST;
+}
+
+int UtcDaliShaderPrecompilerCompileWithoutAdaptor(void)
+{
+  tet_infoline("The programs can't be precompiled without an adaptor");
+
+  DALI_TEST_CHECK(!ShaderPrecompiler::Compile(VERTEX_SOURCE, FRAGMENT_SOURCE));
+
+  END_TEST;
+}
+
+int UtcDaliShaderCompilerCompile(void)
+{
+  tet_infoline("The binary of a requested program is saved in the cache under its name");
+
+  BinaryGlAbstraction gl;
+  ContextState        state;
+  TestCompiler        compiler;
+  DALI_TEST_CHECK(compiler.Start(gl, state));
+
+  const std::string name = ShaderCompiler::GetBinaryName(VERTEX_SOURCE, FRAGMENT_SOURCE);
+  compiler->Compile(name, VERTEX_SOURCE, FRAGMENT_SOURCE);
+  DALI_TEST_CHECK(WaitForRelease(state, 1u));
+
+  Dali::Vector<unsigned char> binary;
+  DALI_TEST_CHECK(compiler.mCache->Load(name, binary));
+  DALI_TEST_EQUALS(binary.Count(), static_cast<std::size_t>(BINARY_LENGTH), TEST_LOCATION);
+  DALI_TEST_EQUALS(state.madeCurrent.load(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(state.released.load(), 1u, TEST_LOCATION);
+
+  compiler->Stop();
+  DALI_TEST_CHECK(state.destroyed);
+
+  END_TEST;
+}
+
+int UtcDaliShaderCompilerCompileBeforeStart(void)
+{
+  tet_infoline("The requests made before the compiler is started are compiled once it's started");
+
+  BinaryGlAbstraction gl;
+  gl.GetShaderTrace().Enable(true);
+  ContextState state;
+  TestCompiler compiler;
+
+  compiler->Compile("program1", VERTEX_SOURCE, FRAGMENT_SOURCE);
+  compiler->Compile("program2", FRAGMENT_SOURCE, VERTEX_SOURCE);
+  compiler->Compile("program1", VERTEX_SOURCE, FRAGMENT_SOURCE);
+  std::this_thread::sleep_for(POLL_INTERVAL);
+  DALI_TEST_EQUALS(state.madeCurrent.load(), 0u, TEST_LOCATION);
+
+  DALI_TEST_CHECK(compiler.Start(gl, state));
+  DALI_TEST_CHECK(WaitForRelease(state, 1u));
+  compiler->Stop();
+
+  DALI_TEST_CHECK(compiler.mCache->Contains("program1"));
+  DALI_TEST_CHECK(compiler.mCache->Contains("program2"));
+
+  // The duplicate request is compiled once, and the programs are deleted
+  DALI_TEST_EQUALS(gl.GetShaderTrace().CountMethod("CreateProgram"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(gl.GetShaderTrace().CountMethod("LinkProgram"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(gl.GetShaderTrace().CountMethod("DeleteProgram"), 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(gl.GetShaderTrace().CountMethod("DeleteShader"), 4, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderCompilerSkipped(void)
+{
+  tet_infoline("The programs already in the cache and those failing to link are not saved");
+
+  BinaryGlAbstraction gl;
+  gl.GetShaderTrace().Enable(true);
+  ContextState state;
+  TestCompiler compiler;
+
+  const unsigned char cachedBinary[] = {1u, 2u, 3u};
+  DALI_TEST_CHECK(compiler.mCache->Save("cached", cachedBinary, sizeof(cachedBinary)));
+
+  DALI_TEST_CHECK(compiler.Start(gl, state));
+  compiler->Compile("cached", VERTEX_SOURCE, FRAGMENT_SOURCE);
+  DALI_TEST_CHECK(WaitForRelease(state, 1u));
+  DALI_TEST_EQUALS(gl.GetShaderTrace().CountMethod("CreateProgram"), 0, TEST_LOCATION);
+
+  gl.SetLinkStatus(GL_FALSE);
+  compiler->Compile("unlinked", VERTEX_SOURCE, FRAGMENT_SOURCE);
+  DALI_TEST_CHECK(WaitForRelease(state, 2u));
+  compiler->Stop();
+
+  DALI_TEST_EQUALS(gl.GetShaderTrace().CountMethod("CreateProgram"), 1, TEST_LOCATION);
+  DALI_TEST_CHECK(!compiler.mCache->Contains("unlinked"));
+
+  Dali::Vector<unsigned char> binary;
+  DALI_TEST_CHECK(compiler.mCache->Load("cached", binary));
+  DALI_TEST_EQUALS(binary.Count(), sizeof(cachedBinary), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliShaderCompilerStop(void)
+{
+  tet_infoline("Once stopped, the context is destroyed and the requests are kept until the compiler is started again");
+
+  BinaryGlAbstraction gl;
+  ContextState        state;
+  TestCompiler        compiler;
+
+  DALI_TEST_CHECK(compiler.Start(gl, state));
+  DALI_TEST_CHECK(!compiler.Start(gl, state)); // Already started
+  compiler->Stop();
+  DALI_TEST_CHECK(state.destroyed);
+
+  compiler->Compile("program", VERTEX_SOURCE, FRAGMENT_SOURCE);
+  std::this_thread::sleep_for(POLL_INTERVAL);
+  DALI_TEST_EQUALS(state.madeCurrent.load(), 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(!compiler.mCache->Contains("program"));
+
+  ContextState restartedState;
+  DALI_TEST_CHECK(compiler.Start(gl, restartedState));
+  DALI_TEST_CHECK(WaitForRelease(restartedState, 1u));
+  DALI_TEST_CHECK(compiler.mCache->Contains("program"));
+
+  END_TEST;
+}
+
+int UtcDaliShaderCompilerNoBinaryFormat(void)
+{
+  tet_infoline("The requests are dropped if the driver has no binary format");
+
+  BinaryGlAbstraction gl;
+  gl.SetNumBinaryFormats(0);
+  ContextState state;
+  TestCompiler compiler;
+
+  DALI_TEST_CHECK(compiler.Start(gl, state));
+  compiler->Compile("program", VERTEX_SOURCE, FRAGMENT_SOURCE);
+  DALI_TEST_CHECK(WaitForRelease(state, 1u));
+  DALI_TEST_CHECK(!compiler.mCache->Contains("program"));
+
+  END_TEST;
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdlib.h>
+#include <cstring>
+
+#include <dali/internal/imaging/common/shared-buffer-queue.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_shared_buffer_queue_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_shared_buffer_queue_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliSharedBufferQueueDequeueEnqueue(void)
+{
+  SharedBufferQueue queue(3u);
+  queue.SetSize(5u, 4u, 3u);
+
+  uint8_t* buffer = nullptr;
+  uint32_t width  = 0u;
+  uint32_t height = 0u;
+  uint32_t stride = 0u;
+  DALI_TEST_CHECK(queue.Dequeue(buffer, width, height, stride));
+  DALI_TEST_EQUALS(width, 5u, TEST_LOCATION);
+  DALI_TEST_EQUALS(height, 4u, TEST_LOCATION);
+  DALI_TEST_EQUALS(stride, 16u, TEST_LOCATION); // Rows aligned to 4 bytes
+
+  memset(buffer, 0x7f, stride * height);
+  DALI_TEST_CHECK(queue.Enqueue(buffer));
+  DALI_TEST_CHECK(!queue.Enqueue(buffer)); // Not dequeued any more
+
+  const uint8_t* pixels = queue.Acquire(width, height, stride);
+  DALI_TEST_CHECK(pixels == buffer);
+  DALI_TEST_EQUALS(static_cast<int>(pixels[stride * height - 1u]), 0x7f, TEST_LOCATION);
+  queue.Release(pixels);
+
+  DALI_TEST_CHECK(queue.Acquire(width, height, stride) == nullptr);
+
+  Dali::NativeImageSourceQueue::BufferStatistics statistics = queue.GetStatistics();
+  DALI_TEST_EQUALS(statistics.enqueuedBuffers, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.consumedBuffers, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.queueDepth, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliSharedBufferQueueDropsOldBuffers(void)
+{
+  SharedBufferQueue queue(3u);
+  queue.SetSize(8u, 8u, 4u);
+
+  uint8_t* buffers[3];
+  uint32_t width, height, stride;
+  for(auto& buffer : buffers)
+  {
+    DALI_TEST_CHECK(queue.Dequeue(buffer, width, height, stride));
+    DALI_TEST_CHECK(queue.Enqueue(buffer));
+  }
+  DALI_TEST_EQUALS(queue.GetStatistics().queueDepth, 3u, TEST_LOCATION);
+
+  // No buffer is free, so the oldest queued buffer is dequeued again
+  uint8_t* buffer = nullptr;
+  DALI_TEST_CHECK(queue.Dequeue(buffer, width, height, stride));
+  DALI_TEST_CHECK(buffer == buffers[0]);
+
+  // The latest buffer is acquired and the older one dropped
+  const uint8_t* pixels = queue.Acquire(width, height, stride);
+  DALI_TEST_CHECK(pixels == buffers[2]);
+
+  Dali::NativeImageSourceQueue::BufferStatistics statistics = queue.GetStatistics();
+  DALI_TEST_EQUALS(statistics.droppedBuffers, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.queueDepth, 0u, TEST_LOCATION);
+
+  // One buffer dequeued and one acquired, so only one is left
+  uint8_t* other = nullptr;
+  DALI_TEST_CHECK(queue.Dequeue(other, width, height, stride));
+  DALI_TEST_CHECK(!queue.Dequeue(other, width, height, stride));
+  DALI_TEST_EQUALS(queue.GetStatistics().dequeueFailures, 1u, TEST_LOCATION);
+
+  queue.Release(pixels);
+  queue.CancelDequeue(buffer);
+  DALI_TEST_CHECK(queue.Dequeue(other, width, height, stride));
+
+  END_TEST;
+}
+
+int UtcDaliSharedBufferQueueSetSize(void)
+{
+  SharedBufferQueue queue(2u);
+
+  uint8_t* buffer = nullptr;
+  uint32_t width, height, stride;
+  DALI_TEST_CHECK(!queue.Dequeue(buffer, width, height, stride)); // No size yet
+
+  queue.SetSize(4u, 4u, 4u);
+  DALI_TEST_CHECK(queue.Dequeue(buffer, width, height, stride));
+
+  // A buffer written in the previous size is refused
+  queue.SetSize(16u, 2u, 4u);
+  DALI_TEST_CHECK(!queue.Enqueue(buffer));
+
+  DALI_TEST_CHECK(queue.Dequeue(buffer, width, height, stride));
+  DALI_TEST_EQUALS(width, 16u, TEST_LOCATION);
+  DALI_TEST_EQUALS(height, 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(stride, 64u, TEST_LOCATION);
+  DALI_TEST_CHECK(queue.Enqueue(buffer));
+
+  END_TEST;
+}
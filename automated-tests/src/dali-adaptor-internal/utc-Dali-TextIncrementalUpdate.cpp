@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <algorithm>
+#include <stdint.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <dali/internal/text/text-abstraction/bidirectional-support-impl.h>
+#include <dali/internal/text/text-abstraction/segmentation-impl.h>
+
+using namespace Dali;
+using namespace Dali::TextAbstraction;
+
+void utc_dali_text_incremental_update_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_text_incremental_update_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const uint32_t NUMBER_OF_EDITS = 500u;
+
+// Latin, hebrew, digits, punctuation, spaces and new lines. Hebrew letters followed by hyphens exercise the rule LB21a.
+const Character LINE_BREAK_ALPHABET[] = {'a', 'b', 'c', 'Z', '1', '9', ' ', ' ', '-', '-', 0x2010, ',', '.', '!', '(', ')', '"', 0x000A, 0x000D, 0x2029, 0x05D0, 0x05D1, 0x4E00, 0x0627, 0x00A0};
+
+// As above, with apostrophes.
+const Character WORD_BREAK_ALPHABET[] = {'a', 'b', 'c', 'Z', '1', '9', ' ', ' ', '-', ',', '.', '\'', ':', 0x000A, 0x000D, 0x2029, 0x05D0, 0x05D1, 0x0627, 0x4E00};
+
+// A single paragraph mixing left to right, right to left and neutral characters.
+const Character BIDI_ALPHABET[] = {'a', 'b', 'Z', '1', '2', ' ', ' ', '.', '(', ')', '-', 0x05D0, 0x05D1, 0x0627, 0x0628, 0x0661, 0x200F, 0x200E};
+
+/**
+ * A deterministic random generator, so a failure can be reproduced.
+ */
+struct Random
+{
+  uint32_t Next(uint32_t range)
+  {
+    seed = seed * 1103515245u + 12345u;
+    return ((seed >> 16u) & 0x7FFFu) % range;
+  }
+
+  uint32_t seed;
+};
+
+/**
+ * An edit of the text: the characters removed at an index, and the ones added instead.
+ */
+struct Edit
+{
+  CharacterIndex         index;
+  Length                 numberOfCharactersRemoved;
+  std::vector<Character> added;
+};
+
+Edit CreateEdit(Random& random, Length numberOfCharacters, const Character* alphabet, uint32_t alphabetSize, Length minimumSize)
+{
+  Edit edit;
+  edit.index                     = random.Next(numberOfCharacters + 1u);
+  edit.numberOfCharactersRemoved = random.Next(std::min(numberOfCharacters - edit.index, 4u) + 1u);
+
+  // Don't let the text shrink below the minimum size, nor grow forever
+  Length numberOfCharactersAdded = random.Next(5u);
+  if(numberOfCharacters - edit.numberOfCharactersRemoved + numberOfCharactersAdded < minimumSize)
+  {
+    numberOfCharactersAdded = minimumSize;
+  }
+  else if(numberOfCharacters > 200u)
+  {
+    numberOfCharactersAdded = 0u;
+  }
+
+  for(Length index = 0u; index < numberOfCharactersAdded; ++index)
+  {
+    edit.added.push_back(alphabet[random.Next(alphabetSize)]);
+  }
+  return edit;
+}
+
+/**
+ * Applies an edit to the text, and moves the info of the characters not edited to their new positions.
+ */
+template<typename Info>
+void ApplyEdit(const Edit& edit, std::vector<Character>& text, std::vector<Info>& info)
+{
+  text.erase(text.begin() + edit.index, text.begin() + edit.index + edit.numberOfCharactersRemoved);
+  text.insert(text.begin() + edit.index, edit.added.begin(), edit.added.end());
+
+  info.erase(info.begin() + edit.index, info.begin() + edit.index + edit.numberOfCharactersRemoved);
+  info.insert(info.begin() + edit.index, edit.added.size(), Info(0x7F));
+}
+
+std::vector<Character> CreateText(Random& random, Length numberOfCharacters, const Character* alphabet, uint32_t alphabetSize)
+{
+  std::vector<Character> text;
+  for(Length index = 0u; index < numberOfCharacters; ++index)
+  {
+    text.push_back(alphabet[random.Next(alphabetSize)]);
+  }
+  return text;
+}
+
+} // namespace
+
+int UtcDaliSegmentationUpdateLineBreakPositions(void)
+{
+  tet_infoline("UpdateLineBreakPositions after random edits gives the same result as a full analysis");
+
+  Internal::Segmentation segmentation;
+
+  const uint32_t         alphabetSize = sizeof(LINE_BREAK_ALPHABET) / sizeof(Character);
+  Random                 random{1u};
+  std::vector<Character> text = CreateText(random, 40u, LINE_BREAK_ALPHABET, alphabetSize);
+
+  std::vector<LineBreakInfo> breakInfo(text.size());
+  segmentation.GetLineBreakPositions(text.data(), text.size(), breakInfo.data());
+
+  uint32_t mismatches = 0u;
+  for(uint32_t iteration = 0u; iteration < NUMBER_OF_EDITS; ++iteration)
+  {
+    const Edit edit = CreateEdit(random, text.size(), LINE_BREAK_ALPHABET, alphabetSize, 0u);
+    ApplyEdit(edit, text, breakInfo);
+    segmentation.UpdateLineBreakPositions(text.data(), text.size(), edit.index, edit.added.size(), breakInfo.data());
+
+    std::vector<LineBreakInfo> expected(text.size());
+    segmentation.GetLineBreakPositions(text.data(), text.size(), expected.data());
+    if(expected != breakInfo)
+    {
+      ++mismatches;
+      breakInfo = expected;
+    }
+  }
+
+  DALI_TEST_EQUALS(mismatches, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliSegmentationLineBreakPositionsHebrewAcrossNewLine(void)
+{
+  tet_infoline("The rule LB21a of a hebrew letter doesn't apply to a hyphen after a new line");
+
+  Internal::Segmentation segmentation;
+
+  // A hebrew letter, a new line, then a hyphen followed by a latin letter.
+  const Character text[]      = {0x05D0, 0x000A, '-', 'a'};
+  const Character paragraph[] = {'-', 'a'};
+
+  LineBreakInfo breakInfo[4u];
+  LineBreakInfo paragraphBreakInfo[2u];
+  segmentation.GetLineBreakPositions(text, 4u, breakInfo);
+  segmentation.GetLineBreakPositions(paragraph, 2u, paragraphBreakInfo);
+
+  DALI_TEST_EQUALS(breakInfo[1u], static_cast<LineBreakInfo>(TextAbstraction::LINE_MUST_BREAK), TEST_LOCATION);
+  DALI_TEST_EQUALS(breakInfo[2u], paragraphBreakInfo[0u], TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliSegmentationUpdateWordBreakPositions(void)
+{
+  tet_infoline("UpdateWordBreakPositions after random edits gives the same result as a full analysis");
+
+  Internal::Segmentation segmentation;
+
+  const uint32_t         alphabetSize = sizeof(WORD_BREAK_ALPHABET) / sizeof(Character);
+  Random                 random{2u};
+  std::vector<Character> text = CreateText(random, 40u, WORD_BREAK_ALPHABET, alphabetSize);
+
+  std::vector<WordBreakInfo> breakInfo(text.size());
+  segmentation.GetWordBreakPositions(text.data(), text.size(), breakInfo.data());
+
+  uint32_t mismatches = 0u;
+  for(uint32_t iteration = 0u; iteration < NUMBER_OF_EDITS; ++iteration)
+  {
+    const Edit edit = CreateEdit(random, text.size(), WORD_BREAK_ALPHABET, alphabetSize, 0u);
+    ApplyEdit(edit, text, breakInfo);
+    segmentation.UpdateWordBreakPositions(text.data(), text.size(), edit.index, edit.added.size(), breakInfo.data());
+
+    std::vector<WordBreakInfo> expected(text.size());
+    segmentation.GetWordBreakPositions(text.data(), text.size(), expected.data());
+    if(expected != breakInfo)
+    {
+      ++mismatches;
+      breakInfo = expected;
+    }
+  }
+
+  DALI_TEST_EQUALS(mismatches, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliBidirectionalSupportUpdateInfo(void)
+{
+  tet_infoline("UpdateInfo after random edits gives the same directions and order as CreateInfo");
+
+  Internal::BidirectionalSupport bidirectionalSupport;
+
+  const uint32_t         alphabetSize = sizeof(BIDI_ALPHABET) / sizeof(Character);
+  Random                 random{3u};
+  std::vector<Character> text = CreateText(random, 20u, BIDI_ALPHABET, alphabetSize);
+
+  BidiInfoIndex updatedIndex = bidirectionalSupport.CreateInfo(text.data(), text.size(), false, LayoutDirection::LEFT_TO_RIGHT);
+
+  uint32_t mismatches = 0u;
+  for(uint32_t iteration = 0u; iteration < NUMBER_OF_EDITS; ++iteration)
+  {
+    const Edit edit = CreateEdit(random, text.size(), BIDI_ALPHABET, alphabetSize, 1u);
+    text.erase(text.begin() + edit.index, text.begin() + edit.index + edit.numberOfCharactersRemoved);
+    text.insert(text.begin() + edit.index, edit.added.begin(), edit.added.end());
+
+    const bool updated = bidirectionalSupport.UpdateInfo(updatedIndex, text.data(), text.size(), edit.index, edit.numberOfCharactersRemoved, edit.added.size(), false, LayoutDirection::LEFT_TO_RIGHT);
+    DALI_TEST_CHECK(updated);
+
+    const BidiInfoIndex expectedIndex = bidirectionalSupport.CreateInfo(text.data(), text.size(), false, LayoutDirection::LEFT_TO_RIGHT);
+
+    std::vector<CharacterDirection> directions(text.size());
+    std::vector<CharacterDirection> expectedDirections(text.size());
+    bidirectionalSupport.GetCharactersDirection(updatedIndex, directions.data(), text.size());
+    bidirectionalSupport.GetCharactersDirection(expectedIndex, expectedDirections.data(), text.size());
+
+    std::vector<CharacterIndex> visualToLogical(text.size());
+    std::vector<CharacterIndex> expectedVisualToLogical(text.size());
+    bidirectionalSupport.Reorder(updatedIndex, 0u, text.size(), visualToLogical.data());
+    bidirectionalSupport.Reorder(expectedIndex, 0u, text.size(), expectedVisualToLogical.data());
+
+    if((bidirectionalSupport.GetParagraphDirection(updatedIndex) != bidirectionalSupport.GetParagraphDirection(expectedIndex)) ||
+       (directions != expectedDirections) ||
+       (visualToLogical != expectedVisualToLogical))
+    {
+      ++mismatches;
+    }
+
+    bidirectionalSupport.DestroyInfo(expectedIndex);
+  }
+
+  bidirectionalSupport.DestroyInfo(updatedIndex);
+
+  DALI_TEST_EQUALS(mismatches, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
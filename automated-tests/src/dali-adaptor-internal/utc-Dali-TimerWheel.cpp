@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <memory>
+#include <vector>
+
+#include <dali/internal/system/common/timer-wheel.h>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::TimerWheel;
+
+void utc_dali_timer_wheel_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_timer_wheel_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const uint64_t START_TIME = 1001u; // Not a multiple of the slots, so rounding to them would show
+
+uint64_t wheel_time = 0u; // The time the wheel is advanced to, in milliseconds
+
+struct Expiration
+{
+  int      id;
+  uint64_t time;
+};
+
+/**
+ * A timer of the wheel, which records its expirations.
+ */
+class WheelTimer
+{
+public:
+  WheelTimer(TimerWheel& wheel, std::vector<Expiration>& expirations, int id, bool repeat)
+  : mCallback(MakeCallback(this, &WheelTimer::Expired)),
+    mEntry(mCallback.get()),
+    mWheel(wheel),
+    mExpirations(expirations),
+    mTimerToStop(NULL),
+    mId(id),
+    mRepeat(repeat)
+  {
+  }
+
+  ~WheelTimer()
+  {
+    mWheel.Stop(mEntry);
+  }
+
+  bool Expired()
+  {
+    mExpirations.push_back(Expiration{mId, wheel_time});
+    if(mTimerToStop)
+    {
+      mWheel.Stop(mTimerToStop->mEntry);
+    }
+    return mRepeat;
+  }
+
+  std::unique_ptr<CallbackBase> mCallback;
+  TimerWheel::Entry             mEntry;
+  TimerWheel&                   mWheel;
+  std::vector<Expiration>&      mExpirations;
+  WheelTimer*                   mTimerToStop;
+  int                           mId;
+  bool                          mRepeat;
+};
+
+/**
+ * Advances the wheel from one expiry to the next up to the given time, as the timer of the main loop does.
+ * @return The number of wakeups
+ */
+uint32_t AdvanceWheel(TimerWheel& wheel, uint64_t endTime)
+{
+  uint32_t wakeups = 0u;
+  uint64_t expiry  = 0u;
+  while(wheel.GetNextExpiry(expiry) && expiry <= endTime)
+  {
+    wheel_time = expiry;
+    wheel.Expire(expiry);
+    ++wakeups;
+  }
+  wheel_time = endTime;
+  return wakeups;
+}
+
+/**
+ * @return Whether a timer expired at its expiry, or late by less than an eighth of its interval.
+ */
+bool ExpiredOnTime(uint64_t time, uint64_t expiry, uint32_t interval)
+{
+  const uint64_t tolerance = (interval >= 8u) ? interval / 8u : 1u;
+  return (expiry <= time) && (time < expiry + tolerance);
+}
+
+} // namespace
+
+int UtcDaliTimerWheelExpiryOrder(void)
+{
+  tet_infoline("The timers of every level expire within their tolerance, in the order of their expiry");
+
+  const uint32_t DELAYS[]         = {700u, 5u, 64u, 4100u, 63u, 512u, 1u, 30000u};
+  const int      NUMBER_OF_TIMERS = sizeof(DELAYS) / sizeof(DELAYS[0]);
+
+  TimerWheel                               wheel;
+  std::vector<Expiration>                  expirations;
+  std::vector<std::unique_ptr<WheelTimer>> timers;
+  for(int id = 0; id < NUMBER_OF_TIMERS; ++id)
+  {
+    timers.emplace_back(new WheelTimer(wheel, expirations, id, false));
+    wheel.Start(timers.back()->mEntry, START_TIME, DELAYS[id], DELAYS[id]);
+  }
+
+  AdvanceWheel(wheel, START_TIME + 60000u);
+
+  DALI_TEST_EQUALS(expirations.size(), static_cast<size_t>(NUMBER_OF_TIMERS), TEST_LOCATION);
+  for(size_t index = 0u; index < expirations.size(); ++index)
+  {
+    const uint32_t delay = DELAYS[expirations[index].id];
+    DALI_TEST_CHECK(ExpiredOnTime(expirations[index].time, START_TIME + delay, delay));
+    DALI_TEST_CHECK(index == 0u || expirations[index - 1u].time <= expirations[index].time);
+  }
+
+  uint64_t expiry = 0u;
+  DALI_TEST_CHECK(!wheel.GetNextExpiry(expiry));
+
+  END_TEST;
+}
+
+int UtcDaliTimerWheelCoalescing(void)
+{
+  tet_infoline("The timers expiring within the tolerance of each other expire in the same wakeup");
+
+  const int NUMBER_OF_TIMERS = 32;
+
+  TimerWheel                               wheel;
+  std::vector<Expiration>                  expirations;
+  std::vector<std::unique_ptr<WheelTimer>> timers;
+  for(int id = 0; id < NUMBER_OF_TIMERS; ++id)
+  {
+    // Spread over 93ms, under the tolerance of 125ms
+    const uint32_t delay = 1000u + id * 3u;
+    timers.emplace_back(new WheelTimer(wheel, expirations, id, false));
+    wheel.Start(timers.back()->mEntry, START_TIME, delay, delay);
+  }
+
+  AdvanceWheel(wheel, START_TIME + 2000u);
+
+  DALI_TEST_EQUALS(expirations.size(), static_cast<size_t>(NUMBER_OF_TIMERS), TEST_LOCATION);
+  for(const auto& expiration : expirations)
+  {
+    const uint32_t delay = 1000u + expiration.id * 3u;
+    DALI_TEST_CHECK(ExpiredOnTime(expiration.time, START_TIME + delay, delay));
+  }
+
+  // Neither a wakeup per timer, nor a wakeup per level the timers move down
+  const TimerWheel::Statistics& statistics = wheel.GetStatistics();
+  DALI_TEST_CHECK(statistics.wakeups < static_cast<uint32_t>(NUMBER_OF_TIMERS));
+  DALI_TEST_CHECK(statistics.wakeups <= 3u);
+  DALI_TEST_EQUALS(statistics.spuriousWakeups, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.expirations, static_cast<uint32_t>(NUMBER_OF_TIMERS), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTimerWheelRepeat(void)
+{
+  tet_infoline("A timer started again by its callback expires at each interval, within its tolerance");
+
+  TimerWheel              wheel;
+  std::vector<Expiration> expirations;
+  WheelTimer              timer(wheel, expirations, 0, true);
+  WheelTimer              slowTimer(wheel, expirations, 1, true);
+  wheel.Start(timer.mEntry, START_TIME, 100u, 100u);
+  wheel.Start(slowTimer.mEntry, START_TIME, 333u, 333u);
+
+  AdvanceWheel(wheel, START_TIME + 1050u);
+
+  // The intervals are counted from the expiries, so the lateness doesn't add up
+  uint64_t count     = 0u;
+  uint64_t slowCount = 0u;
+  for(const auto& expiration : expirations)
+  {
+    if(expiration.id == 0)
+    {
+      ++count;
+      DALI_TEST_CHECK(ExpiredOnTime(expiration.time, START_TIME + count * 100u, 100u));
+    }
+    else
+    {
+      ++slowCount;
+      DALI_TEST_CHECK(ExpiredOnTime(expiration.time, START_TIME + slowCount * 333u, 333u));
+    }
+  }
+  DALI_TEST_EQUALS(count, static_cast<uint64_t>(10u), TEST_LOCATION);
+  DALI_TEST_EQUALS(slowCount, static_cast<uint64_t>(3u), TEST_LOCATION);
+
+  // Stopped, it doesn't expire anymore
+  wheel.Stop(timer.mEntry);
+  wheel.Stop(slowTimer.mEntry);
+  expirations.clear();
+  AdvanceWheel(wheel, START_TIME + 2000u);
+  DALI_TEST_CHECK(expirations.empty());
+
+  END_TEST;
+}
+
+int UtcDaliTimerWheelStopDuringExpire(void)
+{
+  tet_infoline("A timer stopped by a callback doesn't run, even if it has already expired");
+
+  TimerWheel              wheel;
+  std::vector<Expiration> expirations;
+  WheelTimer              first(wheel, expirations, 0, false);
+  WheelTimer              second(wheel, expirations, 1, false);
+  WheelTimer              repeating(wheel, expirations, 2, true);
+  first.mTimerToStop     = &second;
+  repeating.mTimerToStop = &repeating;
+
+  wheel.Start(first.mEntry, START_TIME, 100u, 100u);
+  wheel.Start(second.mEntry, START_TIME, 150u, 150u);
+  wheel.Start(repeating.mEntry, START_TIME, 120u, 120u);
+
+  // Both have expired by the time the wheel is advanced
+  wheel_time = START_TIME + 200u;
+  wheel.Expire(START_TIME + 200u);
+
+  // The repeating timer stopped itself, so it's not started again
+  DALI_TEST_EQUALS(expirations.size(), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(expirations[0].id, 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(expirations[1].id, 2, TEST_LOCATION);
+
+  uint64_t expiry = 0u;
+  DALI_TEST_CHECK(!wheel.GetNextExpiry(expiry));
+
+  END_TEST;
+}
+
+int UtcDaliTimerWheelFarTimer(void)
+{
+  tet_infoline("A timer further than the last level of the wheel expires within its tolerance");
+
+  const uint32_t FAR_DELAY = 0xFFFFFFFFu; // About 50 days
+
+  TimerWheel              wheel;
+  std::vector<Expiration> expirations;
+  WheelTimer              farTimer(wheel, expirations, 0, false);
+  WheelTimer              nearTimer(wheel, expirations, 1, false);
+  wheel.Start(farTimer.mEntry, START_TIME, FAR_DELAY, 0u);
+  wheel.Start(nearTimer.mEntry, START_TIME, 10u, 0u);
+
+  const uint32_t wakeups = AdvanceWheel(wheel, START_TIME + FAR_DELAY + FAR_DELAY / 8u);
+
+  DALI_TEST_EQUALS(expirations.size(), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_CHECK(ExpiredOnTime(expirations[0].time, START_TIME + 10u, 10u));
+  DALI_TEST_CHECK(ExpiredOnTime(expirations[1].time, START_TIME + FAR_DELAY, FAR_DELAY));
+
+  // A wakeup each time the far timer reaches the last slot, every 36 hours or so, not one per slot
+  DALI_TEST_CHECK(wakeups < 64u);
+
+  END_TEST;
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <dali/internal/system/common/trace-event-writer.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_trace_event_writer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_trace_event_writer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* const TRACE_FILE         = "/tmp/utc-dali-trace-event-writer.json";
+const char* const ROTATED_TRACE_FILE = "/tmp/utc-dali-trace-event-writer.json.1";
+
+std::string ReadFile(const char* const path)
+{
+  std::ifstream     file(path);
+  std::stringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+uint32_t Count(const std::string& text, const std::string& pattern)
+{
+  uint32_t count = 0u;
+  for(size_t position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + 1u))
+  {
+    ++count;
+  }
+  return count;
+}
+
+std::string GetValue(const std::string& event, const std::string& key)
+{
+  const std::string prefix   = "\"" + key + "\":";
+  const size_t      position = event.find(prefix);
+  if(position == std::string::npos)
+  {
+    return std::string();
+  }
+  return event.substr(position + prefix.size(), event.find_first_of(",}", position + prefix.size()) - position - prefix.size());
+}
+
+/**
+ * Checks the duration events of each thread nest, and are all ended.
+ * @return The number of begin events without an end and end events without a begin.
+ */
+uint32_t CountUnmatchedEvents(const std::string& trace)
+{
+  std::vector<std::pair<std::string, std::string> > open; // the thread id and name of the begun events
+
+  uint32_t           unmatched = 0u;
+  std::istringstream lines(trace);
+  std::string        event;
+  while(std::getline(lines, event))
+  {
+    const std::string phase  = GetValue(event, "ph");
+    const std::string thread = GetValue(event, "tid");
+    const std::string name   = GetValue(event, "name");
+    if(phase == "\"B\"")
+    {
+      open.push_back(std::make_pair(thread, name));
+    }
+    else if(phase == "\"E\"")
+    {
+      auto it = open.rbegin();
+      while(it != open.rend() && it->first != thread)
+      {
+        ++it;
+      }
+      if(it == open.rend() || it->second != name)
+      {
+        ++unmatched;
+      }
+      else
+      {
+        open.erase(std::next(it).base());
+      }
+    }
+  }
+  return unmatched + open.size();
+}
+
+void AddMarker(TraceEventWriter& writer, PerformanceInterface::MarkerType type, const char* const description, uint64_t microseconds, unsigned int threadId)
+{
+  writer.AddMarker(PerformanceMarker(type, FrameTimeStamp(0, microseconds)), description, threadId);
+}
+
+} // namespace
+
+int UtcDaliTraceEventWriterEscaping(void)
+{
+  tet_infoline("The quotes, backslashes and control characters of the thread and marker names are escaped");
+
+  remove(TRACE_FILE);
+  {
+    TraceEventWriter writer(TRACE_FILE, 0u);
+    DALI_TEST_CHECK(writer.IsOpen());
+
+    writer.AddThread(3u, "a\"b\\c\nd\x01");
+    AddMarker(writer, PerformanceInterface::START, "say \"hi\"\\\t_START", 10u, 3u);
+    AddMarker(writer, PerformanceInterface::END, "say \"hi\"\\\t_END", 20u, 3u);
+    AddMarker(writer, PerformanceInterface::VSYNC, "VSYNC\r", 30u, 3u);
+  }
+
+  const std::string trace = ReadFile(TRACE_FILE);
+  DALI_TEST_EQUALS(Count(trace, "\"args\":{\"name\":\"a\\\"b\\\\c\\u000ad\\u0001\"}"), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(Count(trace, "\"name\":\"say \\\"hi\\\"\\\\\\u0009\",\"ph\":\"B\""), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(Count(trace, "\"name\":\"say \\\"hi\\\"\\\\\\u0009\",\"ph\":\"E\""), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(Count(trace, "\"name\":\"VSYNC\\u000d\",\"ph\":\"i\""), 1u, TEST_LOCATION);
+
+  // No raw control character is left, but the new lines between the events.
+  uint32_t controlCharacters = 0u;
+  for(char character : trace)
+  {
+    if(static_cast<unsigned char>(character) < 0x20 && character != '\n')
+    {
+      ++controlCharacters;
+    }
+  }
+  DALI_TEST_EQUALS(controlCharacters, 0u, TEST_LOCATION);
+
+  remove(TRACE_FILE);
+
+  END_TEST;
+}
+
+int UtcDaliTraceEventWriterRotation(void)
+{
+  tet_infoline("The file is rotated when full, and the duration events open at the rotation are split between the files");
+
+  remove(TRACE_FILE);
+  remove(ROTATED_TRACE_FILE);
+  {
+    TraceEventWriter writer(TRACE_FILE, 1024u);
+    writer.AddThread(1u, "update");
+    writer.AddThread(2u, "render");
+
+    // A custom context open during the whole trace, with frames nested in it.
+    uint64_t microseconds = 1000u;
+    AddMarker(writer, PerformanceInterface::START, "CONTEXT_START", microseconds, 1u);
+    for(uint32_t frame = 0u; frame < 100u; ++frame)
+    {
+      AddMarker(writer, PerformanceInterface::UPDATE_START, "UPDATE_START", microseconds++, 1u);
+      AddMarker(writer, PerformanceInterface::RENDER_START, "RENDER_START", microseconds++, 2u);
+      AddMarker(writer, PerformanceInterface::UPDATE_END, "UPDATE_END", microseconds++, 1u);
+      AddMarker(writer, PerformanceInterface::RENDER_END, "RENDER_END", microseconds++, 2u);
+    }
+    AddMarker(writer, PerformanceInterface::END, "CONTEXT_END", microseconds, 1u);
+  }
+
+  const std::string trace        = ReadFile(TRACE_FILE);
+  const std::string rotatedTrace = ReadFile(ROTATED_TRACE_FILE);
+
+  // At most twice the maximum size is kept.
+  DALI_TEST_CHECK(!rotatedTrace.empty());
+  DALI_TEST_CHECK(rotatedTrace.size() < 2048u);
+  DALI_TEST_CHECK(trace.size() < 2048u);
+
+  // Both files are complete JSON arrays with the thread names.
+  DALI_TEST_EQUALS(trace.substr(0u, 2u), std::string("[\n"), TEST_LOCATION);
+  DALI_TEST_EQUALS(trace.substr(trace.size() - 3u), std::string("\n]\n"), TEST_LOCATION);
+  DALI_TEST_EQUALS(rotatedTrace.substr(0u, 2u), std::string("[\n"), TEST_LOCATION);
+  DALI_TEST_EQUALS(rotatedTrace.substr(rotatedTrace.size() - 3u), std::string("\n]\n"), TEST_LOCATION);
+  DALI_TEST_EQUALS(Count(trace, "\"thread_name\""), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(Count(rotatedTrace, "\"thread_name\""), 2u, TEST_LOCATION);
+
+  // The begin and end events match within each file, and the context spans both.
+  DALI_TEST_EQUALS(CountUnmatchedEvents(trace), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(CountUnmatchedEvents(rotatedTrace), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(Count(trace, "\"name\":\"CONTEXT\",\"ph\":\"B\""), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(Count(trace, "\"name\":\"CONTEXT\",\"ph\":\"E\""), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(Count(rotatedTrace, "\"name\":\"CONTEXT\",\"ph\":\"B\""), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(Count(rotatedTrace, "\"name\":\"CONTEXT\",\"ph\":\"E\""), 1u, TEST_LOCATION);
+
+  remove(TRACE_FILE);
+  remove(ROTATED_TRACE_FILE);
+
+  END_TEST;
+}
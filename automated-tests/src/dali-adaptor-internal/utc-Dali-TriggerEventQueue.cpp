@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include <dali/internal/system/common/trigger-event-queue.h>
+#include <dali/internal/system/common/trigger-event.h>
+#include <dali/internal/system/linux/dali-ecore.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_trigger_event_queue_startup(void)
+{
+  test_return_value = TET_UNDEF;
+  ecore_init();
+}
+
+void utc_dali_trigger_event_queue_cleanup(void)
+{
+  ecore_shutdown();
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const unsigned int MAXIMUM_ITERATIONS = 100u;
+
+/**
+ * Records the callbacks of the trigger events in the order they run.
+ */
+struct CallbackRecorder
+{
+  void Called(int id)
+  {
+    calls.push_back(id);
+  }
+
+  std::vector<int> calls;
+};
+
+/**
+ * A trigger event callback, which can destroy a trigger event when it runs.
+ */
+class TestCallback
+{
+public:
+  TestCallback(CallbackRecorder& recorder, int id)
+  : mRecorder(recorder),
+    mId(id),
+    mEventToDestroy(nullptr)
+  {
+  }
+
+  void Callback()
+  {
+    mRecorder.Called(mId);
+    if(mEventToDestroy)
+    {
+      TriggerEvent* triggerEvent = mEventToDestroy;
+      mEventToDestroy            = nullptr;
+      delete triggerEvent;
+    }
+  }
+
+  CallbackRecorder& mRecorder;
+  int               mId;
+  TriggerEvent*     mEventToDestroy;
+};
+
+/**
+ * Runs the main loop until the number of callbacks is reached, or for a few iterations if none is expected.
+ */
+void RunMainLoop(const CallbackRecorder& recorder, size_t expectedCalls)
+{
+  for(unsigned int iteration = 0u; iteration < MAXIMUM_ITERATIONS; ++iteration)
+  {
+    ecore_main_loop_iterate();
+    if(expectedCalls > 0u && recorder.calls.size() >= expectedCalls)
+    {
+      break;
+    }
+  }
+}
+
+} // namespace
+
+int UtcDaliTriggerEventQueueCoalescing(void)
+{
+  tet_infoline("An event triggered several times before its callback runs is called once");
+
+  CallbackRecorder recorder;
+  TestCallback     callback(recorder, 1);
+  TriggerEvent*    triggerEvent = new TriggerEvent(MakeCallback(&callback, &TestCallback::Callback), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER);
+
+  triggerEvent->Trigger();
+  triggerEvent->Trigger();
+  triggerEvent->Trigger();
+  RunMainLoop(recorder, 1u);
+  RunMainLoop(recorder, 0u);
+  DALI_TEST_EQUALS(recorder.calls.size(), static_cast<size_t>(1u), TEST_LOCATION);
+
+  TriggerEventQueue::Statistics statistics;
+  DALI_TEST_CHECK(TriggerEventQueue::GetStatistics(statistics));
+  DALI_TEST_EQUALS(statistics.triggers, static_cast<uint64_t>(3u), TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.coalesced, static_cast<uint64_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.callbacks, static_cast<uint64_t>(1u), TEST_LOCATION);
+
+  // Queued again once the callback has run
+  triggerEvent->Trigger();
+  RunMainLoop(recorder, 2u);
+  DALI_TEST_EQUALS(recorder.calls.size(), static_cast<size_t>(2u), TEST_LOCATION);
+
+  delete triggerEvent;
+  DALI_TEST_CHECK(!TriggerEventQueue::GetStatistics(statistics));
+
+  END_TEST;
+}
+
+int UtcDaliTriggerEventQueueOrder(void)
+{
+  tet_infoline("The callbacks run in the order the events are triggered");
+
+  CallbackRecorder recorder;
+  TestCallback     callback1(recorder, 1);
+  TestCallback     callback2(recorder, 2);
+  TestCallback     callback3(recorder, 3);
+  TriggerEvent*    triggerEvent1 = new TriggerEvent(MakeCallback(&callback1, &TestCallback::Callback), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER);
+  TriggerEvent*    triggerEvent2 = new TriggerEvent(MakeCallback(&callback2, &TestCallback::Callback), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER);
+  TriggerEvent*    triggerEvent3 = new TriggerEvent(MakeCallback(&callback3, &TestCallback::Callback), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER);
+
+  triggerEvent3->Trigger();
+  triggerEvent1->Trigger();
+  triggerEvent2->Trigger();
+  triggerEvent3->Trigger(); // Coalesced, keeps its place
+  RunMainLoop(recorder, 3u);
+
+  DALI_TEST_EQUALS(recorder.calls.size(), static_cast<size_t>(3u), TEST_LOCATION);
+  DALI_TEST_EQUALS(recorder.calls[0], 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(recorder.calls[1], 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(recorder.calls[2], 2, TEST_LOCATION);
+
+  delete triggerEvent1;
+  delete triggerEvent2;
+  delete triggerEvent3;
+
+  END_TEST;
+}
+
+int UtcDaliTriggerEventQueueDestroyQueuedEventInCallback(void)
+{
+  tet_infoline("A queued event destroyed by the callback of another event is not called");
+
+  CallbackRecorder recorder;
+  TestCallback     callback1(recorder, 1);
+  TestCallback     callback2(recorder, 2);
+  TriggerEvent*    triggerEvent1 = new TriggerEvent(MakeCallback(&callback1, &TestCallback::Callback), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER);
+  TriggerEvent*    triggerEvent2 = new TriggerEvent(MakeCallback(&callback2, &TestCallback::Callback), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER);
+  callback1.mEventToDestroy      = triggerEvent2;
+
+  triggerEvent1->Trigger();
+  triggerEvent2->Trigger();
+  RunMainLoop(recorder, 1u);
+  RunMainLoop(recorder, 0u);
+
+  DALI_TEST_EQUALS(recorder.calls.size(), static_cast<size_t>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(recorder.calls[0], 1, TEST_LOCATION);
+
+  delete triggerEvent1;
+
+  END_TEST;
+}
+
+int UtcDaliTriggerEventQueueDestroyLastEventInCallback(void)
+{
+  tet_infoline("The last event destroyed by its own callback releases the queue once the callbacks have run");
+
+  CallbackRecorder recorder;
+  TestCallback     callback(recorder, 1);
+  TriggerEvent*    triggerEvent = new TriggerEvent(MakeCallback(&callback, &TestCallback::Callback), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER);
+  callback.mEventToDestroy      = triggerEvent;
+
+  triggerEvent->Trigger();
+  RunMainLoop(recorder, 1u);
+
+  DALI_TEST_EQUALS(recorder.calls.size(), static_cast<size_t>(1u), TEST_LOCATION);
+  TriggerEventQueue::Statistics statistics;
+  DALI_TEST_CHECK(!TriggerEventQueue::GetStatistics(statistics));
+
+  END_TEST;
+}
+
+int UtcDaliTriggerEventQueueDeleteAfterTrigger(void)
+{
+  tet_infoline("A DELETE_AFTER_TRIGGER event is destroyed once its callback has run");
+
+  CallbackRecorder recorder;
+  TestCallback     callback1(recorder, 1);
+  TestCallback     callback2(recorder, 2);
+  TriggerEvent*    keptEvent = new TriggerEvent(MakeCallback(&callback1, &TestCallback::Callback), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER);
+  TriggerEvent*    oneShot   = new TriggerEvent(MakeCallback(&callback2, &TestCallback::Callback), TriggerEventInterface::DELETE_AFTER_TRIGGER);
+
+  oneShot->Trigger();
+  keptEvent->Trigger();
+  RunMainLoop(recorder, 2u);
+
+  DALI_TEST_EQUALS(recorder.calls.size(), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(recorder.calls[0], 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(recorder.calls[1], 1, TEST_LOCATION);
+
+  delete keptEvent;
+  TriggerEventQueue::Statistics statistics;
+  DALI_TEST_CHECK(!TriggerEventQueue::GetStatistics(statistics));
+
+  END_TEST;
+}
+
+int UtcDaliTriggerEventQueueTriggerAndDestroyFromAnotherThread(void)
+{
+  tet_infoline("Events triggered from another thread run on the main loop, and a queued event destroyed by another thread is not called");
+
+  CallbackRecorder recorder;
+  TestCallback     callback1(recorder, 1);
+  TestCallback     callback2(recorder, 2);
+  TriggerEvent*    triggerEvent1 = new TriggerEvent(MakeCallback(&callback1, &TestCallback::Callback), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER);
+  TriggerEvent*    triggerEvent2 = new TriggerEvent(MakeCallback(&callback2, &TestCallback::Callback), TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER);
+
+  std::thread thread([triggerEvent1, triggerEvent2]() {
+    triggerEvent1->Trigger();
+    triggerEvent2->Trigger();
+    delete triggerEvent2;
+  });
+  thread.join();
+
+  RunMainLoop(recorder, 1u);
+  RunMainLoop(recorder, 0u);
+
+  DALI_TEST_EQUALS(recorder.calls.size(), static_cast<size_t>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(recorder.calls[0], 1, TEST_LOCATION);
+
+  delete triggerEvent1;
+
+  END_TEST;
+}
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-test-suite-utils.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdlib.h>
+#include <vector>
+
+#include <dali/internal/system/common/environment-options.h>
+#include <dali/internal/thread/common/worker-thread-pool-impl.h>
+
+using namespace Dali;
+
+void utc_dali_worker_thread_pool_startup(void)
+{
+  test_return_value = TET_UNDEF;
+
+  // A single worker, so the order the tasks start in is known.
+  setenv("DALI_WORKER_THREAD_COUNT", "1", 1);
+}
+
+void utc_dali_worker_thread_pool_cleanup(void)
+{
+  unsetenv("DALI_WORKER_THREAD_COUNT");
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const std::chrono::seconds TIMEOUT(5);
+
+/**
+ * Records the tasks in the order they run, and blocks the worker until opened.
+ */
+class TaskRecorder
+{
+public:
+  TaskRecorder()
+  : mWaiting(0u),
+    mOpen(true)
+  {
+  }
+
+  void Close()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mOpen = false;
+  }
+
+  void Open()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mOpen = true;
+    }
+    mCondition.notify_all();
+  }
+
+  void Record(int id)
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    ++mWaiting;
+    mCondition.notify_all();
+    mCondition.wait(lock, [this]() { return mOpen; });
+    --mWaiting;
+    mCalls.push_back(id);
+    mCondition.notify_all();
+  }
+
+  bool WaitForBlockedTask()
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    return mCondition.wait_for(lock, TIMEOUT, [this]() { return mWaiting > 0u; });
+  }
+
+  bool WaitForCalls(size_t numberOfCalls)
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    return mCondition.wait_for(lock, TIMEOUT, [this, numberOfCalls]() { return mCalls.size() >= numberOfCalls; });
+  }
+
+  std::vector<int> GetCalls()
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mCalls;
+  }
+
+private:
+  std::mutex              mMutex;
+  std::condition_variable mCondition;
+  std::vector<int>        mCalls;
+  unsigned int            mWaiting;
+  bool                    mOpen;
+};
+
+/**
+ * A task recording its id, which can add other tasks from the worker.
+ */
+class TestTask
+{
+public:
+  TestTask(TaskRecorder& recorder, int id)
+  : mRecorder(recorder),
+    mId(id),
+    mPool(nullptr),
+    mTasksToAdd()
+  {
+  }
+
+  void Run()
+  {
+    mRecorder.Record(mId);
+    for(auto task : mTasksToAdd)
+    {
+      mPool->AddTask(MakeCallback(task, &TestTask::Run), Dali::WorkerThreadPool::INTERACTIVE);
+    }
+  }
+
+  TaskRecorder&                        mRecorder;
+  int                                  mId;
+  Internal::Adaptor::WorkerThreadPool* mPool;
+  std::vector<TestTask*>               mTasksToAdd;
+};
+
+} // namespace
+
+int UtcDaliWorkerThreadPoolOrder(void)
+{
+  tet_infoline("The tasks added by the event thread start in the order they're added");
+
+  TaskRecorder recorder;
+  TestTask     blocker(recorder, 0);
+  TestTask     task1(recorder, 1);
+  TestTask     task2(recorder, 2);
+  TestTask     task3(recorder, 3);
+
+  // Destroyed first, so the tasks outlive the worker.
+  Internal::Adaptor::EnvironmentOptions environmentOptions;
+  Internal::Adaptor::WorkerThreadPool  pool(environmentOptions);
+  DALI_TEST_EQUALS(pool.GetNumberOfThreads(), 1u, TEST_LOCATION);
+
+  // The worker waits in the first task while the others are added.
+  recorder.Close();
+  pool.AddTask(MakeCallback(&blocker, &TestTask::Run), Dali::WorkerThreadPool::PREFETCH);
+  DALI_TEST_CHECK(recorder.WaitForBlockedTask());
+  pool.AddTask(MakeCallback(&task1, &TestTask::Run), Dali::WorkerThreadPool::PREFETCH);
+  pool.AddTask(MakeCallback(&task2, &TestTask::Run), Dali::WorkerThreadPool::PREFETCH);
+  pool.AddTask(MakeCallback(&task3, &TestTask::Run), Dali::WorkerThreadPool::PREFETCH);
+  recorder.Open();
+
+  DALI_TEST_CHECK(recorder.WaitForCalls(4u));
+  const std::vector<int> calls = recorder.GetCalls();
+  DALI_TEST_EQUALS(calls[0], 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[1], 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[2], 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[3], 3, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliWorkerThreadPoolOwnTasksNewestFirst(void)
+{
+  tet_infoline("The tasks added by a task start newest first, before the older tasks added by the event thread");
+
+  TaskRecorder recorder;
+  TestTask     parent(recorder, 0);
+  TestTask     child1(recorder, 1);
+  TestTask     child2(recorder, 2);
+  TestTask     other(recorder, 3);
+
+  // Destroyed first, so the tasks outlive the worker.
+  Internal::Adaptor::EnvironmentOptions environmentOptions;
+  Internal::Adaptor::WorkerThreadPool  pool(environmentOptions);
+  parent.mPool = &pool;
+  parent.mTasksToAdd.push_back(&child1);
+  parent.mTasksToAdd.push_back(&child2);
+
+  recorder.Close();
+  pool.AddTask(MakeCallback(&parent, &TestTask::Run), Dali::WorkerThreadPool::INTERACTIVE);
+  pool.AddTask(MakeCallback(&other, &TestTask::Run), Dali::WorkerThreadPool::INTERACTIVE);
+  recorder.Open();
+
+  DALI_TEST_CHECK(recorder.WaitForCalls(4u));
+  const std::vector<int> calls = recorder.GetCalls();
+  DALI_TEST_EQUALS(calls[0], 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[1], 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[2], 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[3], 3, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliWorkerThreadPoolPriority(void)
+{
+  tet_infoline("The interactive tasks start before the prefetch ones, and these before the background ones");
+
+  TaskRecorder recorder;
+  TestTask     blocker(recorder, 0);
+  TestTask     background(recorder, 1);
+  TestTask     prefetch(recorder, 2);
+  TestTask     interactive(recorder, 3);
+
+  // Destroyed first, so the tasks outlive the worker.
+  Internal::Adaptor::EnvironmentOptions environmentOptions;
+  Internal::Adaptor::WorkerThreadPool  pool(environmentOptions);
+
+  // The worker waits in the first task while the others are added.
+  recorder.Close();
+  pool.AddTask(MakeCallback(&blocker, &TestTask::Run), Dali::WorkerThreadPool::BACKGROUND);
+  DALI_TEST_CHECK(recorder.WaitForBlockedTask());
+  pool.AddTask(MakeCallback(&background, &TestTask::Run), Dali::WorkerThreadPool::BACKGROUND);
+  pool.AddTask(MakeCallback(&prefetch, &TestTask::Run), Dali::WorkerThreadPool::PREFETCH);
+  pool.AddTask(MakeCallback(&interactive, &TestTask::Run), Dali::WorkerThreadPool::INTERACTIVE);
+  recorder.Open();
+
+  DALI_TEST_CHECK(recorder.WaitForCalls(4u));
+  const std::vector<int> calls = recorder.GetCalls();
+  DALI_TEST_EQUALS(calls[0], 0, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[1], 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[2], 2, TEST_LOCATION);
+  DALI_TEST_EQUALS(calls[3], 1, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliWorkerThreadPoolPause(void)
+{
+  tet_infoline("Only the interactive tasks start while the pool is paused");
+
+  TaskRecorder recorder;
+  TestTask     background(recorder, 1);
+  TestTask     interactive(recorder, 2);
+
+  // Destroyed first, so the tasks outlive the worker.
+  Internal::Adaptor::EnvironmentOptions environmentOptions;
+  Internal::Adaptor::WorkerThreadPool  pool(environmentOptions);
+
+  pool.Pause();
+  pool.AddTask(MakeCallback(&background, &TestTask::Run), Dali::WorkerThreadPool::BACKGROUND);
+  pool.AddTask(MakeCallback(&interactive, &TestTask::Run), Dali::WorkerThreadPool::INTERACTIVE);
+
+  DALI_TEST_CHECK(recorder.WaitForCalls(1u));
+  DALI_TEST_EQUALS(recorder.GetCalls().size(), static_cast<size_t>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(recorder.GetCalls()[0], 2, TEST_LOCATION);
+
+  pool.Resume();
+  DALI_TEST_CHECK(recorder.WaitForCalls(2u));
+  DALI_TEST_EQUALS(recorder.GetCalls()[1], 1, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliWorkerThreadPoolDestroyWithPendingTasks(void)
+{
+  tet_infoline("The tasks which didn't start when the pool is destroyed are deleted without running");
+
+  TaskRecorder recorder;
+  TestTask     background(recorder, 1);
+  {
+    Internal::Adaptor::EnvironmentOptions environmentOptions;
+    Internal::Adaptor::WorkerThreadPool  pool(environmentOptions);
+    pool.Pause();
+    pool.AddTask(MakeCallback(&background, &TestTask::Run), Dali::WorkerThreadPool::BACKGROUND);
+  }
+
+  DALI_TEST_CHECK(recorder.GetCalls().empty());
+
+  END_TEST;
+}
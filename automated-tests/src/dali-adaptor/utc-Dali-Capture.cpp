@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <adaptor-test-application.h>
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/capture-devel.h>
+#include <dali/public-api/capture/capture.h>
+
+using namespace Dali;
+
+void utc_dali_capture_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_capture_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliCaptureNew(void)
+{
+  AdaptorTestApplication application;
+
+  Capture capture = Capture::New();
+  DALI_TEST_CHECK(capture);
+
+  Capture cast = Capture::DownCast(capture);
+  DALI_TEST_CHECK(cast);
+  DALI_TEST_CHECK(cast == capture);
+
+  Capture empty;
+  DALI_TEST_CHECK(!Capture::DownCast(empty));
+
+  END_TEST;
+}
+
+int UtcDaliCaptureCopyAndAssignment(void)
+{
+  AdaptorTestApplication application;
+
+  Capture capture = Capture::New();
+
+  Capture copy(capture);
+  DALI_TEST_CHECK(copy == capture);
+
+  Capture assigned;
+  assigned = capture;
+  DALI_TEST_CHECK(assigned == capture);
+  DALI_TEST_EQUALS(3, capture.GetBaseObject().ReferenceCount(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliCaptureStartInvalidPathN(void)
+{
+  AdaptorTestApplication application;
+
+  Capture capture = Capture::New();
+
+  try
+  {
+    capture.Start(Actor::New(), Vector2(10.0f, 10.0f), "a.png");
+    tet_result(TET_FAIL);
+  }
+  catch(Dali::DaliException& e)
+  {
+    DALI_TEST_PRINT_ASSERT(e);
+    DALI_TEST_ASSERT(e, "Path is invalid.", TEST_LOCATION);
+  }
+
+  // Not referenced by the capture which hasn't started
+  DALI_TEST_EQUALS(1, capture.GetBaseObject().ReferenceCount(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliCaptureStartEmptySourceN(void)
+{
+  AdaptorTestApplication application;
+
+  Capture capture = Capture::New();
+
+  try
+  {
+    capture.Start(Actor(), Vector2(10.0f, 10.0f), "capture.png");
+    tet_result(TET_FAIL);
+  }
+  catch(Dali::DaliException& e)
+  {
+    DALI_TEST_PRINT_ASSERT(e);
+    DALI_TEST_ASSERT(e, "Source is NULL.", TEST_LOCATION);
+  }
+
+  DALI_TEST_EQUALS(1, capture.GetBaseObject().ReferenceCount(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliCaptureStartStreamInvalidPathN(void)
+{
+  AdaptorTestApplication application;
+
+  Capture capture = Capture::New();
+
+  try
+  {
+    DevelCapture::StartStream(capture, Actor::New(), Vector2::ZERO, Vector2(10.0f, 10.0f), "a.png", Color::TRANSPARENT, 1u, 4u);
+    tet_result(TET_FAIL);
+  }
+  catch(Dali::DaliException& e)
+  {
+    DALI_TEST_PRINT_ASSERT(e);
+    DALI_TEST_ASSERT(e, "Path is invalid.", TEST_LOCATION);
+  }
+
+  DALI_TEST_EQUALS(1, capture.GetBaseObject().ReferenceCount(), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliCaptureStreamStatistics(void)
+{
+  AdaptorTestApplication application;
+
+  Capture capture = Capture::New();
+
+  DevelCapture::StreamStatistics statistics = DevelCapture::GetStreamStatistics(capture);
+  DALI_TEST_EQUALS(statistics.capturedFrames, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.droppedFrames, 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.failedFrames, 0u, TEST_LOCATION);
+
+  // Stopping a stream which hasn't started does nothing
+  DevelCapture::StopStream(capture);
+  DALI_TEST_EQUALS(1, capture.GetBaseObject().ReferenceCount(), TEST_LOCATION);
+
+  END_TEST;
+}
@@ -18,6 +18,11 @@
 #include <dali-test-suite-utils.h>
 #include <dali/dali.h>
 #include <dali/devel-api/adaptor-framework/file-loader.h>
+#include <dali/devel-api/adaptor-framework/mapped-file.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
 
 using namespace Dali;
 
@@ -96,3 +101,100 @@ int UtcDaliReadFileNew3(void)
 
   END_TEST;
 }
+
+int UtcDaliReadFileMapped(void)
+{
+  tet_infoline("A regular file is mapped with the same content as the buffered read");
+
+  Dali::Vector<char> buffer;
+  DALI_TEST_CHECK(FileLoader::ReadFile(TEST_RESOURCE_DIR "/test.txt", buffer, FileLoader::BINARY) != 0);
+
+  MappedFile mappedFile;
+  DALI_TEST_CHECK(FileLoader::ReadFile(TEST_RESOURCE_DIR "/test.txt", mappedFile) != 0);
+  DALI_TEST_CHECK(mappedFile);
+  DALI_TEST_EQUALS(mappedFile.GetSize(), static_cast<size_t>(buffer.Count()), TEST_LOCATION);
+  DALI_TEST_CHECK(mappedFile.GetData() != NULL);
+  DALI_TEST_CHECK(memcmp(mappedFile.GetData(), buffer.Begin(), buffer.Count()) == 0);
+
+  // The handles share the mapping
+  MappedFile copy(mappedFile);
+  const uint8_t* data = mappedFile.GetData();
+  mappedFile.Reset();
+  DALI_TEST_CHECK(copy.GetData() == data);
+  DALI_TEST_CHECK(memcmp(copy.GetData(), buffer.Begin(), buffer.Count()) == 0);
+
+  END_TEST;
+}
+
+int UtcDaliReadFileMappedLarge(void)
+{
+  tet_infoline("A file over the mapping threshold is mapped with the same content as the buffered read");
+
+  const char* const    path = "/tmp/utc-dali-file-loader-large.bin";
+  std::vector<uint8_t> content(256u * 1024u + 3u);
+  for(size_t index = 0u; index < content.size(); ++index)
+  {
+    content[index] = static_cast<uint8_t>(index * 13u);
+  }
+  FILE* file = fopen(path, "wb");
+  DALI_TEST_CHECK(file != NULL);
+  DALI_TEST_EQUALS(fwrite(content.data(), 1u, content.size(), file), content.size(), TEST_LOCATION);
+  fclose(file);
+
+  Dali::Vector<char> buffer;
+  DALI_TEST_CHECK(FileLoader::ReadFile(path, buffer, FileLoader::BINARY) != 0);
+  DALI_TEST_EQUALS(static_cast<size_t>(buffer.Count()), content.size(), TEST_LOCATION);
+
+  MappedFile mappedFile;
+  DALI_TEST_CHECK(FileLoader::ReadFile(path, mappedFile) != 0);
+  DALI_TEST_EQUALS(mappedFile.GetSize(), content.size(), TEST_LOCATION);
+  DALI_TEST_CHECK(memcmp(mappedFile.GetData(), content.data(), content.size()) == 0);
+
+  unlink(path);
+
+  END_TEST;
+}
+
+int UtcDaliReadFileMappedEmpty(void)
+{
+  tet_infoline("An empty file is read with no content, whether mapped or buffered");
+
+  Dali::Vector<char> buffer;
+  std::streampos     fileSize = 1;
+  DALI_TEST_CHECK(FileLoader::ReadFile(TEST_RESOURCE_DIR "/empty.txt", fileSize, buffer, FileLoader::BINARY) != 0);
+  DALI_TEST_CHECK(fileSize == 0);
+  DALI_TEST_EQUALS(static_cast<size_t>(buffer.Count()), static_cast<size_t>(0u), TEST_LOCATION);
+
+  MappedFile mappedFile;
+  DALI_TEST_CHECK(FileLoader::ReadFile(TEST_RESOURCE_DIR "/empty.txt", mappedFile) != 0);
+  DALI_TEST_CHECK(mappedFile);
+  DALI_TEST_EQUALS(mappedFile.GetSize(), static_cast<size_t>(0u), TEST_LOCATION);
+  DALI_TEST_CHECK(mappedFile.GetData() == NULL);
+
+  END_TEST;
+}
+
+int UtcDaliReadFileMappedNotRegular(void)
+{
+  tet_infoline("A file which can't be mapped is read into a buffer");
+
+  // Its size is not known before reading it
+  MappedFile mappedFile;
+  DALI_TEST_CHECK(FileLoader::ReadFile("/proc/self/status", mappedFile) != 0);
+  DALI_TEST_CHECK(mappedFile);
+  DALI_TEST_CHECK(mappedFile.GetSize() > 0u);
+  DALI_TEST_CHECK(mappedFile.GetData() != NULL);
+
+  END_TEST;
+}
+
+int UtcDaliReadFileMappedNotExist(void)
+{
+  tet_infoline("A file which doesn't exist is not mapped");
+
+  MappedFile mappedFile;
+  DALI_TEST_CHECK(FileLoader::ReadFile(TEST_RESOURCE_DIR "/not_exist.txt", mappedFile) == 0);
+  DALI_TEST_CHECK(!mappedFile);
+
+  END_TEST;
+}
@@ -72,10 +72,18 @@ void test_ecore_main_loop_begin()
   if(timer_callback_func != NULL)
   {
     main_loop_can_run = true;
-    while(main_loop_can_run)
+    while(main_loop_can_run && timer_callback_func != NULL)
     {
-      if(!timer_callback_func(const_cast<void*>(timer_callback_data)))
-        break;
+      Ecore_Task_Cb func = timer_callback_func;
+      const void*   data = timer_callback_data;
+
+      // Deleted when it returns false, unless the callback has added a timer again
+      timer_callback_func = NULL;
+      if(func(const_cast<void*>(data)) && timer_callback_func == NULL)
+      {
+        timer_callback_func = func;
+        timer_callback_data = data;
+      }
     }
   }
 }
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <dali/public-api/dali-core.h>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/adaptor-framework/application.h>
+#include <dali/public-api/adaptor-framework/window.h>
+
+using namespace Dali;
+
+/*****************************************************************************
+ * Benchmark of the adaptor's Update/Render thread.
+ *
+ * Renders a grid of animated quads for a given number of frames as fast as possible
+ * and writes the timings of each frame as JSON (see DALI_BENCHMARK_OUTPUT).
+ * The animations are driven by a virtual clock, so each run renders the same frames.
+ *
+ * To run it without a GPU or a display, use a software EGL implementation and a virtual
+ * X server, e.g. LIBGL_ALWAYS_SOFTWARE=1 xvfb-run ./benchmark --frames 600
+ *
+ * To compare the threading modes under an update-heavy load, run it with DALI_THREADING_MODE=1
+ * and DALI_THREADING_MODE=2 and a non-zero --update-cost.
+ *
+ * Options:
+ *   --frames <n>      number of frames to render (600)
+ *   --actors <n>      number of quads in the grid (100)
+ *   --update-cost <n> iterations of busy work done by a constraint of each quad on every update (0)
+ *   --width <n>       width of the window (800)
+ *   --height <n>      height of the window (600)
+ *   --output <file>   file the timings are written to (benchmark.json)
+ */
+
+namespace
+{
+
+const float FRAME_DURATION = 1.0f / 60.0f; ///< The duration of a frame of the virtual clock, in seconds.
+
+const char* VERTEX_SHADER = DALI_COMPOSE_SHADER(
+  attribute mediump vec2 aPosition;\n
+  uniform mediump mat4 uMvpMatrix;\n
+  uniform mediump vec3 uSize;\n
+  \n
+  void main()\n
+  {\n
+    gl_Position = uMvpMatrix * vec4( aPosition * uSize.xy, 0.0, 1.0 );\n
+  }\n
+);
+
+const char* FRAGMENT_SHADER = DALI_COMPOSE_SHADER(
+  uniform lowp vec4 uColor;\n
+  \n
+  void main()\n
+  {\n
+    gl_FragColor = uColor;\n
+  }\n
+);
+
+struct Options
+{
+  unsigned int frames;
+  unsigned int actors;
+  unsigned int updateCost;
+  unsigned int width;
+  unsigned int height;
+  std::string output;
+};
+
+Geometry CreateQuadGeometry()
+{
+  Property::Map vertexFormat;
+  vertexFormat["aPosition"] = Property::VECTOR2;
+
+  const Vector2 vertices[4] = { Vector2( -0.5f, -0.5f ), Vector2( 0.5f, -0.5f ), Vector2( -0.5f, 0.5f ), Vector2( 0.5f, 0.5f ) };
+  VertexBuffer vertexBuffer = VertexBuffer::New( vertexFormat );
+  vertexBuffer.SetData( vertices, 4u );
+
+  const unsigned short indices[6] = { 0, 3, 1, 0, 2, 3 };
+  Geometry geometry = Geometry::New();
+  geometry.AddVertexBuffer( vertexBuffer );
+  geometry.SetIndexBuffer( indices, 6u );
+
+  return geometry;
+}
+
+/**
+ * A constraint doing busy work on the update thread.
+ */
+struct BusyConstraint
+{
+  BusyConstraint( unsigned int iterations )
+  : mIterations( iterations )
+  {
+  }
+
+  void operator()( float& current, const PropertyInputContainer& inputs )
+  {
+    float value = inputs[0]->GetFloat();
+    for( unsigned int iteration = 0u; iteration < mIterations; ++iteration )
+    {
+      value = std::sin( value + 1.0f );
+    }
+    current = value;
+  }
+
+  unsigned int mIterations;
+};
+
+} // unnamed namespace
+
+class BenchmarkApp : public ConnectionTracker
+{
+public:
+
+  BenchmarkApp( Application& application, const Options& options )
+  : mApplication( application ),
+    mOptions( options )
+  {
+    mApplication.InitSignal().Connect( this, &BenchmarkApp::Create );
+  }
+
+  void Create( Application& application )
+  {
+    Window window = application.GetWindow();
+    window.SetBackgroundColor( Color::BLACK );
+
+    Geometry geometry = CreateQuadGeometry();
+    Shader shader = Shader::New( VERTEX_SHADER, FRAGMENT_SHADER );
+
+    // The animations loop every second and the benchmark stops once the given number of frames has been rendered.
+    Animation loop = Animation::New( 1.0f );
+    loop.SetLooping( true );
+
+    const unsigned int columns = std::max( 1u, static_cast<unsigned int>( std::ceil( std::sqrt( static_cast<float>( mOptions.actors ) ) ) ) );
+    const unsigned int rows = ( mOptions.actors + columns - 1u ) / columns;
+    const Vector2 cellSize( static_cast<float>( mOptions.width ) / columns, static_cast<float>( mOptions.height ) / std::max( 1u, rows ) );
+
+    for( unsigned int index = 0u; index < mOptions.actors; ++index )
+    {
+      Renderer renderer = Renderer::New( geometry, shader );
+      renderer.SetProperty( Renderer::Property::BLEND_MODE, BlendMode::ON );
+
+      Actor actor = Actor::New();
+      actor.AddRenderer( renderer );
+      actor.SetProperty( Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT );
+      actor.SetProperty( Actor::Property::SIZE, cellSize * 0.8f );
+      actor.SetProperty( Actor::Property::POSITION, Vector2( ( 0.5f + index % columns ) * cellSize.width, ( 0.5f + index / columns ) * cellSize.height ) );
+      actor.SetProperty( Actor::Property::COLOR, Vector4( static_cast<float>( index % columns ) / columns, static_cast<float>( index / columns ) / rows, 1.0f, 0.8f ) );
+      window.Add( actor );
+
+      loop.AnimateBy( Property( actor, Actor::Property::ORIENTATION ), Quaternion( Radian( Degree( 360.0f ) ), Vector3::ZAXIS ) );
+      loop.AnimateTo( Property( actor, Actor::Property::COLOR_ALPHA ), 0.2f, AlphaFunction::BOUNCE );
+
+      if( 0u != mOptions.updateCost )
+      {
+        Property::Index workIndex = actor.RegisterProperty( "work", 0.0f );
+        Constraint constraint = Constraint::New<float>( actor, workIndex, BusyConstraint( mOptions.updateCost ) );
+        constraint.AddSource( LocalSource( Actor::Property::COLOR_ALPHA ) );
+        constraint.Apply();
+      }
+    }
+    loop.Play();
+    mLoop = loop;
+
+    mTimeline = Animation::New( mOptions.frames * FRAME_DURATION );
+    mTimeline.FinishedSignal().Connect( this, &BenchmarkApp::OnFinished );
+    mTimeline.Play();
+  }
+
+  void OnFinished( Animation& animation )
+  {
+    mLoop.Stop();
+    mApplication.Quit();
+  }
+
+private:
+
+  Application& mApplication;
+  Options mOptions;
+  Animation mLoop;
+  Animation mTimeline;
+};
+
+/*****************************************************************************/
+
+int
+main(int argc, char **argv)
+{
+  Options options = { 600u, 100u, 0u, 800u, 600u, "benchmark.json" };
+
+  for( int index = 1; index + 1 < argc; index += 2 )
+  {
+    const char* const option = argv[index];
+    const char* const value = argv[index + 1];
+    if( 0 == strcmp( option, "--frames" ) )
+    {
+      options.frames = std::max( 1, atoi( value ) );
+    }
+    else if( 0 == strcmp( option, "--actors" ) )
+    {
+      options.actors = std::max( 0, atoi( value ) );
+    }
+    else if( 0 == strcmp( option, "--update-cost" ) )
+    {
+      options.updateCost = std::max( 0, atoi( value ) );
+    }
+    else if( 0 == strcmp( option, "--width" ) )
+    {
+      options.width = std::max( 1, atoi( value ) );
+    }
+    else if( 0 == strcmp( option, "--height" ) )
+    {
+      options.height = std::max( 1, atoi( value ) );
+    }
+    else if( 0 == strcmp( option, "--output" ) )
+    {
+      options.output = value;
+    }
+    else
+    {
+      std::cout << "Unknown option " << option << std::endl;
+      return 1;
+    }
+  }
+
+  // Enables the benchmark mode of the Update/Render thread
+  setenv( "DALI_BENCHMARK_OUTPUT", options.output.c_str(), 1 );
+
+  try
+  {
+    Application app = Application::New( &argc, &argv, "", Application::OPAQUE, PositionSize( 0, 0, options.width, options.height ) );
+
+    BenchmarkApp benchmarkApp( app, options );
+    app.MainLoop();
+  }
+  catch(...)
+  {
+    std::cout << "Exception caught";
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/window-system/common/damage-region.h>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::DamageRegion;
+
+/*****************************************************************************
+ * Benchmark of the damaged regions of the window render surface.
+ *
+ * Replays synthetic damage patterns on a 1920x1080 surface, with the damage of the last three
+ * frames merged as for a buffer age of three, and prints the pixels passed to EGL as damaged
+ * with a single merged rect and with the coalesced damage region, the number of rects and the
+ * time taken to build the region. The scene is rendered once in the merged rect in both cases.
+ */
+
+namespace
+{
+
+const int SURFACE_WIDTH = 1920;
+const int SURFACE_HEIGHT = 1080;
+const unsigned int FRAMES = 600u;
+const unsigned int BUFFER_AGE = 3u;
+const float RECT_COST_RATIO = 0.05f;         ///< As used by the window render surface.
+const unsigned int MAXIMUM_RECTS = 4u;       ///< As used by the window render surface.
+
+/**
+ * A random number generator giving the same numbers on every run.
+ */
+struct Random
+{
+  unsigned int Next( unsigned int range )
+  {
+    seed = seed * 1103515245u + 12345u;
+    return ( seed >> 16u ) % range;
+  }
+
+  unsigned int seed;
+};
+
+typedef void (*Pattern)( unsigned int frame, Random& random, std::vector<Rect<int>>& rects );
+
+/**
+ * Two small items animated in opposite corners.
+ */
+void OppositeCorners( unsigned int frame, Random& random, std::vector<Rect<int>>& rects )
+{
+  rects.push_back( Rect<int>( 16, 16, 96, 96 ) );
+  rects.push_back( Rect<int>( SURFACE_WIDTH - 112, SURFACE_HEIGHT - 112, 96, 96 ) );
+}
+
+/**
+ * A clock in a corner and a progress bar growing at the bottom.
+ */
+void ClockAndProgress( unsigned int frame, Random& random, std::vector<Rect<int>>& rects )
+{
+  rects.push_back( Rect<int>( SURFACE_WIDTH - 200, 20, 180, 48 ) );
+  rects.push_back( Rect<int>( 100 + static_cast<int>( frame % 1700u ), SURFACE_HEIGHT - 60, 20, 12 ) );
+}
+
+/**
+ * A few small items changing at random positions, e.g. icons being updated.
+ */
+void Scattered( unsigned int frame, Random& random, std::vector<Rect<int>>& rects )
+{
+  for( unsigned int index = 0u; index < 12u; ++index )
+  {
+    rects.push_back( Rect<int>( random.Next( SURFACE_WIDTH - 64 ), random.Next( SURFACE_HEIGHT - 64 ), 64, 64 ) );
+  }
+}
+
+/**
+ * Items moving next to each other, e.g. the cursor and the text of a text field.
+ */
+void Adjacent( unsigned int frame, Random& random, std::vector<Rect<int>>& rects )
+{
+  const int x = 300 + static_cast<int>( ( frame * 8u ) % 1200u );
+  rects.push_back( Rect<int>( 300, 500, x - 300, 40 ) );
+  rects.push_back( Rect<int>( x, 496, 4, 48 ) );
+}
+
+/**
+ * A list scrolling under a static header, with an indicator on the side.
+ */
+void Scrolling( unsigned int frame, Random& random, std::vector<Rect<int>>& rects )
+{
+  rects.push_back( Rect<int>( 0, 120, SURFACE_WIDTH - 40, SURFACE_HEIGHT - 120 ) );
+  rects.push_back( Rect<int>( SURFACE_WIDTH - 24, 120 + static_cast<int>( frame % 900u ), 8, 60 ) );
+}
+
+void Run( const char* name, Pattern pattern )
+{
+  const Rect<int> surfaceRect( 0, 0, SURFACE_WIDTH, SURFACE_HEIGHT );
+  const int rectCost = static_cast<int>( surfaceRect.Area() * RECT_COST_RATIO );
+
+  Random random{ 1u };
+  std::vector<std::vector<Rect<int>>> history( BUFFER_AGE );
+  DamageRegion region;
+
+  uint64_t mergedPixels = 0u;
+  uint64_t regionPixels = 0u;
+  uint64_t rects = 0u;
+  uint64_t splitFrames = 0u;
+  std::chrono::steady_clock::duration time( 0 );
+
+  for( unsigned int frame = 0u; frame < FRAMES; ++frame )
+  {
+    std::vector<Rect<int>>& damagedRects = history[frame % BUFFER_AGE];
+    damagedRects.clear();
+    pattern( frame, random, damagedRects );
+
+    // A single merged rect, as the scene is clipped without a region.
+    Rect<int> mergedRect;
+    for( const auto& frameRects : history )
+    {
+      for( const auto& rect : frameRects )
+      {
+        if( mergedRect.IsEmpty() )
+        {
+          mergedRect = rect;
+        }
+        else
+        {
+          mergedRect.Merge( rect );
+        }
+      }
+    }
+    mergedRect.Intersect( surfaceRect );
+    mergedPixels += mergedRect.Area();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    region.Clear();
+    for( const auto& frameRects : history )
+    {
+      region.Add( frameRects );
+    }
+    region.Intersect( surfaceRect );
+    region.Coalesce( rectCost, MAXIMUM_RECTS );
+
+    time += std::chrono::steady_clock::now() - start;
+
+    regionPixels += region.GetArea();
+    rects += region.GetRects().size();
+    splitFrames += ( region.GetRects().size() > 1u ) ? 1u : 0u;
+  }
+
+  const double microseconds = std::chrono::duration_cast<std::chrono::nanoseconds>( time ).count() * 0.001 / FRAMES;
+  printf( "%-20s merged %10.0f px/frame, region %10.0f px/frame (%5.1f%%), %4.2f rects/frame, %3u%% frames split, %6.2fus/frame\n",
+          name,
+          static_cast<double>( mergedPixels ) / FRAMES,
+          static_cast<double>( regionPixels ) / FRAMES,
+          ( 0u != mergedPixels ) ? 100.0 * regionPixels / mergedPixels : 100.0,
+          static_cast<double>( rects ) / FRAMES,
+          static_cast<unsigned int>( 100u * splitFrames / FRAMES ),
+          microseconds );
+}
+
+} // unnamed namespace
+
+int main( int argc, char** argv )
+{
+  Run( "opposite-corners", OppositeCorners );
+  Run( "clock-and-progress", ClockAndProgress );
+  Run( "scattered", Scattered );
+  Run( "adjacent", Adjacent );
+  Run( "scrolling", Scrolling );
+
+  return 0;
+}
@@ -0,0 +1,513 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <GLES3/gl3.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/graphics/gles/gl-call-trace-reader.h>
+
+using namespace Dali::Internal::Adaptor;
+
+/*****************************************************************************
+ * Profiler of the traces of GLES calls recorded with DALI_GLES_CALL_TRACE.
+ *
+ * Usage: gl-call-trace-profiler <trace> [--frames]
+ *
+ * Prints the time spent in each call type, in each render pass (the calls after a framebuffer
+ * is bound, i.e. the render tasks drawing to it) and, with --frames, in each frame. The times are
+ * the ones measured around the driver calls on the device when the trace was recorded.
+ *
+ * The state changes which set the value the state already has, e.g. binding the bound texture or
+ * setting a uniform of the program in use to its current value, are counted as redundant, and the
+ * uniforms set to their current value most often are listed with their names.
+ *
+ * The trace isn't replayed: only the arguments of the calls are recorded, not the contents of the
+ * buffers and textures they point to, and the times of a software GLES implementation on the host
+ * wouldn't be the ones of the driver of the device anyway.
+ */
+
+namespace
+{
+
+const unsigned int MAXIMUM_LISTED_UNIFORMS = 20u;
+
+struct CallStatistics
+{
+  uint64_t count;
+  uint64_t time;
+  uint32_t maximumTime;
+  uint64_t redundantCount;
+  uint64_t redundantTime;
+};
+
+struct FrameStatistics
+{
+  uint64_t beginTime;
+  uint64_t endTime;
+  uint64_t calls;
+  uint64_t time;
+  uint64_t draws;
+  uint64_t redundantCount;
+};
+
+struct PassStatistics
+{
+  uint64_t passes;
+  uint64_t calls;
+  uint64_t time;
+  uint64_t draws;
+};
+
+struct UniformStatistics
+{
+  uint64_t count;
+  uint64_t redundantCount;
+};
+
+typedef std::pair< uint32_t, uint64_t > StateKey;     ///< The call setting the state, and e.g. the target or capability
+typedef std::pair< uint32_t, int32_t > UniformKey;    ///< The program and the location of a uniform
+
+/**
+ * Accumulates the statistics of the records of a trace.
+ */
+class Profiler
+{
+public:
+
+  Profiler()
+  : mCalls( GlCallTrace::NUMBER_OF_CALLS, CallStatistics() ),
+    mFrames(),
+    mPasses(),
+    mUniforms(),
+    mUniformNames(),
+    mState(),
+    mFramebuffer( 0u ),
+    mActiveTexture( GL_TEXTURE0 ),
+    mProgram( 0u ),
+    mInFrame( false )
+  {
+  }
+
+  void Add( const GlCallTrace::RecordHeader& header, const std::vector< uint8_t >& bytes )
+  {
+    const GlCallTrace::Call call = static_cast< GlCallTrace::Call >( header.call );
+    GlCallTraceArguments arguments( bytes );
+
+    if( call == GlCallTrace::FRAME_BEGIN )
+    {
+      mFrames.push_back( FrameStatistics() );
+      mFrames.back().beginTime = arguments.Read< uint64_t >();
+      mInFrame = true;
+      return;
+    }
+    if( call == GlCallTrace::FRAME_END )
+    {
+      if( mInFrame )
+      {
+        mFrames.back().endTime = arguments.Read< uint64_t >();
+      }
+      mInFrame = false;
+      return;
+    }
+
+    const bool redundant = IsRedundant( call, bytes );
+    const bool draw = ( call == GlCallTrace::DRAW_ARRAYS ) || ( call == GlCallTrace::DRAW_ELEMENTS ) ||
+                      ( call == GlCallTrace::DRAW_RANGE_ELEMENTS ) || ( call == GlCallTrace::DRAW_ARRAYS_INSTANCED ) ||
+                      ( call == GlCallTrace::DRAW_ELEMENTS_INSTANCED );
+
+    CallStatistics& callStatistics = mCalls[call];
+    ++callStatistics.count;
+    callStatistics.time += header.duration;
+    callStatistics.maximumTime = std::max( callStatistics.maximumTime, header.duration );
+    if( redundant )
+    {
+      ++callStatistics.redundantCount;
+      callStatistics.redundantTime += header.duration;
+    }
+
+    if( mInFrame )
+    {
+      FrameStatistics& frame = mFrames.back();
+      ++frame.calls;
+      frame.time += header.duration;
+      frame.draws += draw ? 1u : 0u;
+      frame.redundantCount += redundant ? 1u : 0u;
+    }
+
+    if( ( call == GlCallTrace::BIND_FRAMEBUFFER ) && !redundant )
+    {
+      const uint32_t target = arguments.Read< uint32_t >();
+      if( ( target == GL_FRAMEBUFFER ) || ( target == GL_DRAW_FRAMEBUFFER ) )
+      {
+        mFramebuffer = arguments.Read< uint32_t >();
+        ++mPasses[mFramebuffer].passes;
+      }
+    }
+
+    PassStatistics& pass = mPasses[mFramebuffer];
+    ++pass.calls;
+    pass.time += header.duration;
+    pass.draws += draw ? 1u : 0u;
+  }
+
+  void Print( bool printFrames ) const
+  {
+    uint64_t frameCount = 0u;
+    std::vector< uint64_t > frameTimes;
+    for( const auto& frame : mFrames )
+    {
+      if( frame.endTime != 0u )
+      {
+        frameTimes.push_back( frame.time );
+        ++frameCount;
+      }
+    }
+    const double frames = static_cast< double >( std::max< uint64_t >( frameCount, 1u ) );
+
+    printf( "%llu frames\n", static_cast< unsigned long long >( frameCount ) );
+    if( !frameTimes.empty() )
+    {
+      std::sort( frameTimes.begin(), frameTimes.end() );
+      uint64_t total = 0u;
+      for( auto time : frameTimes )
+      {
+        total += time;
+      }
+      printf( "Time in GLES calls per frame: mean %.3fms, median %.3fms, 95th percentile %.3fms, maximum %.3fms\n",
+              total * 1e-6 / frameTimes.size(),
+              frameTimes[frameTimes.size() / 2u] * 1e-6,
+              frameTimes[( frameTimes.size() * 95u ) / 100u] * 1e-6,
+              frameTimes.back() * 1e-6 );
+    }
+
+    printf( "\nCalls:\n%-32s %10s %10s %10s %10s %10s %10s %10s\n", "", "count", "per frame", "total ms", "mean us", "max us", "redundant", "wasted ms" );
+    std::vector< GlCallTrace::Call > calls;
+    for( unsigned int call = 0u; call < GlCallTrace::NUMBER_OF_CALLS; ++call )
+    {
+      if( mCalls[call].count > 0u )
+      {
+        calls.push_back( static_cast< GlCallTrace::Call >( call ) );
+      }
+    }
+    std::sort( calls.begin(), calls.end(), [this]( GlCallTrace::Call first, GlCallTrace::Call second ) { return mCalls[first].time > mCalls[second].time; } );
+    for( auto call : calls )
+    {
+      const CallStatistics& statistics = mCalls[call];
+      printf( "%-32s %10llu %10.1f %10.3f %10.2f %10.2f %10llu %10.3f\n",
+              GlCallTrace::GetCallName( call ),
+              static_cast< unsigned long long >( statistics.count ),
+              statistics.count / frames,
+              statistics.time * 1e-6,
+              statistics.time * 1e-3 / statistics.count,
+              statistics.maximumTime * 1e-3,
+              static_cast< unsigned long long >( statistics.redundantCount ),
+              statistics.redundantTime * 1e-6 );
+    }
+
+    printf( "\nRender passes, by framebuffer (0 is the surface):\n%-12s %12s %12s %12s %12s\n", "framebuffer", "per frame", "draws/frame", "calls/frame", "ms/frame" );
+    for( const auto& pass : mPasses )
+    {
+      printf( "%-12u %12.2f %12.1f %12.1f %12.3f\n",
+              pass.first,
+              pass.second.passes / frames,
+              pass.second.draws / frames,
+              pass.second.calls / frames,
+              pass.second.time * 1e-6 / frames );
+    }
+
+    std::vector< std::pair< UniformKey, UniformStatistics > > uniforms( mUniforms.begin(), mUniforms.end() );
+    std::sort( uniforms.begin(), uniforms.end(), []( const std::pair< UniformKey, UniformStatistics >& first, const std::pair< UniformKey, UniformStatistics >& second )
+                                                 { return first.second.redundantCount > second.second.redundantCount; } );
+    if( uniforms.size() > MAXIMUM_LISTED_UNIFORMS )
+    {
+      uniforms.resize( MAXIMUM_LISTED_UNIFORMS );
+    }
+    printf( "\nUniforms set to their current value most often:\n%-40s %8s %8s %12s %12s\n", "", "program", "location", "sets/frame", "redundant" );
+    for( const auto& uniform : uniforms )
+    {
+      const auto name = mUniformNames.find( uniform.first );
+      printf( "%-40s %8u %8d %12.1f %11.1f%%\n",
+              ( name != mUniformNames.end() ) ? name->second.c_str() : "?",
+              uniform.first.first,
+              uniform.first.second,
+              uniform.second.count / frames,
+              100.0 * uniform.second.redundantCount / uniform.second.count );
+    }
+
+    if( printFrames )
+    {
+      printf( "\nFrames:\n%-8s %10s %10s %10s %10s %10s\n", "frame", "render ms", "GLES ms", "calls", "draws", "redundant" );
+      for( std::size_t index = 0u; index < mFrames.size(); ++index )
+      {
+        const FrameStatistics& frame = mFrames[index];
+        printf( "%-8zu %10.3f %10.3f %10llu %10llu %10llu\n",
+                index,
+                ( frame.endTime > frame.beginTime ) ? ( frame.endTime - frame.beginTime ) * 1e-6 : 0.0,
+                frame.time * 1e-6,
+                static_cast< unsigned long long >( frame.calls ),
+                static_cast< unsigned long long >( frame.draws ),
+                static_cast< unsigned long long >( frame.redundantCount ) );
+      }
+    }
+  }
+
+private:
+
+  /**
+   * Updates the state set by a call.
+   * @return Whether the call sets the state to the value it already has
+   */
+  bool IsRedundant( GlCallTrace::Call call, const std::vector< uint8_t >& bytes )
+  {
+    GlCallTraceArguments arguments( bytes );
+
+    switch( call )
+    {
+      case GlCallTrace::ACTIVE_TEXTURE:
+      {
+        mActiveTexture = arguments.Read< uint32_t >();
+        return SetState( StateKey( call, 0u ), bytes, 0u );
+      }
+      case GlCallTrace::USE_PROGRAM:
+      {
+        mProgram = arguments.Read< uint32_t >();
+        return SetState( StateKey( call, 0u ), bytes, 0u );
+      }
+      case GlCallTrace::BIND_VERTEX_ARRAY:
+      case GlCallTrace::BLEND_COLOR:
+      case GlCallTrace::BLEND_EQUATION:
+      case GlCallTrace::BLEND_EQUATION_SEPARATE:
+      case GlCallTrace::BLEND_FUNC:
+      case GlCallTrace::BLEND_FUNC_SEPARATE:
+      case GlCallTrace::CLEAR_COLOR:
+      case GlCallTrace::CLEAR_DEPTHF:
+      case GlCallTrace::CLEAR_STENCIL:
+      case GlCallTrace::COLOR_MASK:
+      case GlCallTrace::CULL_FACE:
+      case GlCallTrace::DEPTH_FUNC:
+      case GlCallTrace::DEPTH_MASK:
+      case GlCallTrace::DEPTH_RANGEF:
+      case GlCallTrace::FRONT_FACE:
+      case GlCallTrace::LINE_WIDTH:
+      case GlCallTrace::POLYGON_OFFSET:
+      case GlCallTrace::SCISSOR:
+      case GlCallTrace::STENCIL_FUNC:
+      case GlCallTrace::STENCIL_MASK:
+      case GlCallTrace::STENCIL_OP:
+      case GlCallTrace::VIEWPORT:
+      {
+        return SetState( StateKey( call, 0u ), bytes, 0u );
+      }
+      case GlCallTrace::BIND_BUFFER:
+      case GlCallTrace::BIND_FRAMEBUFFER:
+      case GlCallTrace::BIND_RENDERBUFFER:
+      case GlCallTrace::BIND_SAMPLER:
+      case GlCallTrace::HINT:
+      case GlCallTrace::PIXEL_STOREI:
+      case GlCallTrace::STENCIL_FUNC_SEPARATE:
+      case GlCallTrace::STENCIL_MASK_SEPARATE:
+      case GlCallTrace::STENCIL_OP_SEPARATE:
+      {
+        // The first argument is the target, unit or face the state is set for.
+        return SetState( StateKey( call, arguments.Read< uint32_t >() ), bytes, sizeof( uint32_t ) );
+      }
+      case GlCallTrace::BIND_TEXTURE:
+      {
+        const uint64_t target = arguments.Read< uint32_t >();
+        return SetState( StateKey( call, ( static_cast< uint64_t >( mActiveTexture ) << 32u ) | target ), bytes, sizeof( uint32_t ) );
+      }
+      case GlCallTrace::ENABLE:
+      case GlCallTrace::DISABLE:
+      {
+        const uint8_t enabled = ( call == GlCallTrace::ENABLE ) ? 1u : 0u;
+        return SetState( StateKey( GlCallTrace::ENABLE, arguments.Read< uint32_t >() ), std::vector< uint8_t >( 1u, enabled ), 0u );
+      }
+      case GlCallTrace::ENABLE_VERTEX_ATTRIB_ARRAY:
+      case GlCallTrace::DISABLE_VERTEX_ATTRIB_ARRAY:
+      {
+        const uint8_t enabled = ( call == GlCallTrace::ENABLE_VERTEX_ATTRIB_ARRAY ) ? 1u : 0u;
+        return SetState( StateKey( GlCallTrace::ENABLE_VERTEX_ATTRIB_ARRAY, arguments.Read< uint32_t >() ), std::vector< uint8_t >( 1u, enabled ), 0u );
+      }
+      case GlCallTrace::DELETE_BUFFERS:
+      {
+        ClearState( GlCallTrace::BIND_BUFFER );
+        return false;
+      }
+      case GlCallTrace::DELETE_FRAMEBUFFERS:
+      {
+        ClearState( GlCallTrace::BIND_FRAMEBUFFER );
+        return false;
+      }
+      case GlCallTrace::DELETE_RENDERBUFFERS:
+      {
+        ClearState( GlCallTrace::BIND_RENDERBUFFER );
+        return false;
+      }
+      case GlCallTrace::DELETE_TEXTURES:
+      {
+        ClearState( GlCallTrace::BIND_TEXTURE );
+        return false;
+      }
+      case GlCallTrace::DELETE_SAMPLERS:
+      {
+        ClearState( GlCallTrace::BIND_SAMPLER );
+        return false;
+      }
+      case GlCallTrace::DELETE_VERTEX_ARRAYS:
+      {
+        ClearState( GlCallTrace::BIND_VERTEX_ARRAY );
+        return false;
+      }
+      case GlCallTrace::DELETE_PROGRAM:
+      case GlCallTrace::LINK_PROGRAM:
+      {
+        // The uniforms are reset when a program is linked, and a new program may get the same name.
+        ClearUniforms( arguments.Read< uint32_t >() );
+        if( call == GlCallTrace::DELETE_PROGRAM )
+        {
+          ClearState( GlCallTrace::USE_PROGRAM );
+        }
+        return false;
+      }
+      case GlCallTrace::GET_UNIFORM_LOCATION:
+      {
+        const uint32_t program = arguments.Read< uint32_t >();
+        const std::string name = arguments.ReadString();
+        const int32_t location = arguments.Read< int32_t >();
+        mUniformNames[UniformKey( program, location )] = name;
+        return false;
+      }
+      default:
+      {
+        if( IsUniform( call ) )
+        {
+          const int32_t location = arguments.Read< int32_t >();
+          const UniformKey key( mProgram, location );
+
+          // The uniforms keep their values when another program is used, so the state is per program.
+          std::vector< uint8_t > value( bytes.begin() + sizeof( int32_t ), bytes.end() );
+          value.push_back( static_cast< uint8_t >( call ) );
+          const bool redundant = SetState( StateKey( GlCallTrace::UNIFORM1F, ( static_cast< uint64_t >( key.first ) << 32u ) | static_cast< uint32_t >( key.second ) ), value, 0u );
+
+          UniformStatistics& statistics = mUniforms[key];
+          ++statistics.count;
+          statistics.redundantCount += redundant ? 1u : 0u;
+          return redundant;
+        }
+        return false;
+      }
+    }
+  }
+
+  bool IsUniform( GlCallTrace::Call call ) const
+  {
+    return ( ( call >= GlCallTrace::UNIFORM1F ) && ( call <= GlCallTrace::UNIFORM_MATRIX4FV ) ) ||
+           ( ( call >= GlCallTrace::UNIFORM_MATRIX2X3FV ) && ( call <= GlCallTrace::UNIFORM_MATRIX4X3FV ) ) ||
+           ( ( call >= GlCallTrace::UNIFORM1UI ) && ( call <= GlCallTrace::UNIFORM4UIV ) );
+  }
+
+  /**
+   * Sets a state.
+   * @param[in] key The state
+   * @param[in] bytes The arguments setting it
+   * @param[in] offset The offset of the value in the arguments
+   * @return Whether the state already had the value
+   */
+  bool SetState( const StateKey& key, const std::vector< uint8_t >& bytes, std::size_t offset )
+  {
+    const std::vector< uint8_t > value( bytes.begin() + std::min( offset, bytes.size() ), bytes.end() );
+    auto iter = mState.find( key );
+    if( iter != mState.end() && iter->second == value )
+    {
+      return true;
+    }
+    mState[key] = value;
+    return false;
+  }
+
+  void ClearState( GlCallTrace::Call call )
+  {
+    for( auto iter = mState.begin(); iter != mState.end(); )
+    {
+      iter = ( iter->first.first == static_cast< uint32_t >( call ) ) ? mState.erase( iter ) : std::next( iter );
+    }
+  }
+
+  void ClearUniforms( uint32_t program )
+  {
+    for( auto iter = mState.begin(); iter != mState.end(); )
+    {
+      const bool uniform = ( iter->first.first == static_cast< uint32_t >( GlCallTrace::UNIFORM1F ) ) && ( ( iter->first.second >> 32u ) == program );
+      iter = uniform ? mState.erase( iter ) : std::next( iter );
+    }
+  }
+
+private:
+
+  std::vector< CallStatistics > mCalls;
+  std::vector< FrameStatistics > mFrames;
+  std::map< uint32_t, PassStatistics > mPasses;
+  std::map< UniformKey, UniformStatistics > mUniforms;
+  std::map< UniformKey, std::string > mUniformNames;
+  std::map< StateKey, std::vector< uint8_t > > mState;
+  uint32_t mFramebuffer;
+  uint32_t mActiveTexture;
+  uint32_t mProgram;
+  bool mInFrame;
+};
+
+} // unnamed namespace
+
+int main( int argc, char** argv )
+{
+  if( argc < 2 )
+  {
+    printf( "Usage: %s <trace> [--frames]\n", argv[0] );
+    return 1;
+  }
+
+  GlCallTraceReader reader( argv[1] );
+  if( !reader.IsValid() )
+  {
+    printf( "%s is not a trace of version %u\n", argv[1], GlCallTrace::FILE_VERSION );
+    return 1;
+  }
+
+  Profiler profiler;
+  GlCallTrace::RecordHeader header;
+  std::vector< uint8_t > bytes;
+  while( reader.ReadRecord( header, bytes ) )
+  {
+    // The calls added after this tool was built are skipped.
+    if( header.call < GlCallTrace::NUMBER_OF_CALLS )
+    {
+      profiler.Add( header, bytes );
+    }
+  }
+
+  profiler.Print( ( argc > 2 ) && ( strcmp( argv[2], "--frames" ) == 0 ) );
+
+  return 0;
+}
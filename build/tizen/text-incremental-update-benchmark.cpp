@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/text/text-abstraction/bidirectional-support-impl.h>
+#include <dali/internal/text/text-abstraction/segmentation-impl.h>
+
+using namespace Dali;
+using namespace Dali::TextAbstraction;
+
+/*****************************************************************************
+ * Benchmark of the incremental text analysis.
+ *
+ * Types one character at a time at random positions of a text, as a user editing a text field, and prints
+ * the time taken to update the line breaks, the word breaks and the bidirectional info after each edit with
+ * a full analysis of the text and with the incremental update.
+ */
+
+namespace
+{
+
+const unsigned int EDITS = 2000u;
+
+// Latin and hebrew words, punctuation and spaces.
+const Character ALPHABET[] = { 'a', 'e', 'n', 's', 't', 'Z', '1', ' ', ' ', ' ', '-', ',', '.', 0x05D0, 0x05D1, 0x05E9 };
+const unsigned int ALPHABET_SIZE = sizeof( ALPHABET ) / sizeof( Character );
+
+/**
+ * A random number generator giving the same numbers on every run.
+ */
+struct Random
+{
+  unsigned int Next( unsigned int range )
+  {
+    seed = seed * 1103515245u + 12345u;
+    return ( seed >> 16u ) % range;
+  }
+
+  unsigned int seed;
+};
+
+/**
+ * Creates a text of @p numberOfParagraphs paragraphs of @p paragraphSize characters.
+ */
+std::vector<Character> CreateText( Random& random, unsigned int numberOfParagraphs, unsigned int paragraphSize )
+{
+  std::vector<Character> text;
+  for( unsigned int paragraph = 0u; paragraph < numberOfParagraphs; ++paragraph )
+  {
+    for( unsigned int index = 0u; index + 1u < paragraphSize; ++index )
+    {
+      text.push_back( ALPHABET[random.Next( ALPHABET_SIZE )] );
+    }
+    text.push_back( '\n' );
+  }
+  return text;
+}
+
+template<typename Clock>
+double MicrosecondsPerEdit( typename Clock::duration time )
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>( time ).count() * 0.001 / EDITS;
+}
+
+/**
+ * Line and word breaks of a text of several paragraphs.
+ */
+void RunSegmentation( unsigned int numberOfParagraphs, unsigned int paragraphSize )
+{
+  typedef std::chrono::steady_clock Clock;
+
+  Internal::Segmentation segmentation;
+
+  Random random{ 1u };
+  std::vector<Character> text = CreateText( random, numberOfParagraphs, paragraphSize );
+
+  std::vector<LineBreakInfo> lineBreakInfo( text.size() );
+  std::vector<WordBreakInfo> wordBreakInfo( text.size() );
+  segmentation.GetLineBreakPositions( text.data(), text.size(), lineBreakInfo.data() );
+  segmentation.GetWordBreakPositions( text.data(), text.size(), wordBreakInfo.data() );
+
+  Clock::duration fullTime( 0 );
+  Clock::duration incrementalTime( 0 );
+
+  for( unsigned int edit = 0u; edit < EDITS; ++edit )
+  {
+    const CharacterIndex index = random.Next( text.size() );
+    text.insert( text.begin() + index, ALPHABET[random.Next( ALPHABET_SIZE )] );
+    lineBreakInfo.insert( lineBreakInfo.begin() + index, 0 );
+    wordBreakInfo.insert( wordBreakInfo.begin() + index, 0 );
+
+    auto start = Clock::now();
+    segmentation.UpdateLineBreakPositions( text.data(), text.size(), index, 1u, lineBreakInfo.data() );
+    segmentation.UpdateWordBreakPositions( text.data(), text.size(), index, 1u, wordBreakInfo.data() );
+    incrementalTime += Clock::now() - start;
+
+    start = Clock::now();
+    segmentation.GetLineBreakPositions( text.data(), text.size(), lineBreakInfo.data() );
+    segmentation.GetWordBreakPositions( text.data(), text.size(), wordBreakInfo.data() );
+    fullTime += Clock::now() - start;
+  }
+
+  const double full = MicrosecondsPerEdit<Clock>( fullTime );
+  const double incremental = MicrosecondsPerEdit<Clock>( incrementalTime );
+  printf( "breaks %4u paragraphs of %4u characters: full %9.2fus/edit, incremental %9.2fus/edit (%6.1fx)\n",
+          numberOfParagraphs,
+          paragraphSize,
+          full,
+          incremental,
+          ( incremental > 0.0 ) ? full / incremental : 0.0 );
+}
+
+/**
+ * Bidirectional info of a single paragraph.
+ */
+void RunBidirectionalSupport( unsigned int paragraphSize )
+{
+  typedef std::chrono::steady_clock Clock;
+
+  Internal::BidirectionalSupport bidirectionalSupport;
+
+  Random random{ 2u };
+  std::vector<Character> text = CreateText( random, 1u, paragraphSize + 1u );
+  text.pop_back();
+
+  const BidiInfoIndex updatedIndex = bidirectionalSupport.CreateInfo( text.data(), text.size(), false, LayoutDirection::LEFT_TO_RIGHT );
+
+  Clock::duration fullTime( 0 );
+  Clock::duration incrementalTime( 0 );
+
+  for( unsigned int edit = 0u; edit < EDITS; ++edit )
+  {
+    const CharacterIndex index = random.Next( text.size() );
+    text.insert( text.begin() + index, ALPHABET[random.Next( ALPHABET_SIZE )] );
+
+    auto start = Clock::now();
+    bidirectionalSupport.UpdateInfo( updatedIndex, text.data(), text.size(), index, 0u, 1u, false, LayoutDirection::LEFT_TO_RIGHT );
+    incrementalTime += Clock::now() - start;
+
+    start = Clock::now();
+    const BidiInfoIndex fullIndex = bidirectionalSupport.CreateInfo( text.data(), text.size(), false, LayoutDirection::LEFT_TO_RIGHT );
+    fullTime += Clock::now() - start;
+
+    bidirectionalSupport.DestroyInfo( fullIndex );
+  }
+
+  bidirectionalSupport.DestroyInfo( updatedIndex );
+
+  const double full = MicrosecondsPerEdit<Clock>( fullTime );
+  const double incremental = MicrosecondsPerEdit<Clock>( incrementalTime );
+  printf( "bidi   paragraph of %4u characters:      full %9.2fus/edit, incremental %9.2fus/edit (%6.1fx)\n",
+          paragraphSize,
+          full,
+          incremental,
+          ( incremental > 0.0 ) ? full / incremental : 0.0 );
+}
+
+} // unnamed namespace
+
+int main( int argc, char** argv )
+{
+  RunSegmentation( 1u, 200u );
+  RunSegmentation( 20u, 200u );
+  RunSegmentation( 200u, 200u );
+  RunSegmentation( 20u, 2000u );
+
+  RunBidirectionalSupport( 200u );
+  RunBidirectionalSupport( 2000u );
+
+  return 0;
+}
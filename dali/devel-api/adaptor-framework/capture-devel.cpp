@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/devel-api/adaptor-framework/capture-devel.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/capture-impl.h>
+
+namespace Dali
+{
+namespace DevelCapture
+{
+void StartStream(Capture capture, Actor source, const Vector2& position, const Vector2& size, const std::string& path, const Vector4& clearColor, uint32_t frameInterval, uint32_t maximumFrames)
+{
+  GetImpl(capture).StartStream(source, position, size, path, clearColor, frameInterval, maximumFrames);
+}
+
+void StopStream(Capture capture)
+{
+  GetImpl(capture).StopStream();
+}
+
+StreamStatistics GetStreamStatistics(Capture capture)
+{
+  return GetImpl(capture).GetStreamStatistics();
+}
+
+} // namespace DevelCapture
+
+} // namespace Dali
@@ -0,0 +1,79 @@
+#ifndef DALI_CAPTURE_DEVEL_H
+#define DALI_CAPTURE_DEVEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/capture/capture.h>
+
+namespace Dali
+{
+namespace DevelCapture
+{
+/**
+ * @brief The counts of the frames of a stream.
+ */
+struct StreamStatistics
+{
+  uint32_t capturedFrames; ///< The number of frames encoded into files.
+  uint32_t droppedFrames;  ///< The number of frames skipped, neither rendered nor captured, as the queue was full.
+  uint32_t failedFrames;   ///< The number of frames which failed to be read or encoded.
+};
+
+/**
+ * @brief Starts capturing a stream of frames.
+ *
+ * A frame is rendered and its pixels are copied every frameInterval frames, at 60 frames per second.
+ * The frames are encoded into files on a worker thread, one at a time. While the maximum number of frames
+ * are waiting to be encoded, the frames are dropped, so the rendering is never blocked by the encoding.
+ *
+ * The files are named after the path, with the index of the frame before the extension, e.g. "capture-000012.png".
+ * The FinishedSignal is emitted once each frame is encoded, or with FAILED if a frame isn't rendered in time,
+ * which stops the stream.
+ *
+ * @param[in] capture The capture. The stream is not started, and an error is logged, while a previous capture is rendered or encoded.
+ * @param[in] source The source actor to be rendered
+ * @param[in] position The top-left position of the area to be captured
+ * @param[in] size The size of the area to be captured
+ * @param[in] path The path of the files
+ * @param[in] clearColor The color to clear the background with
+ * @param[in] frameInterval The number of frames between two captures, at least one
+ * @param[in] maximumFrames The maximum number of frames waiting to be encoded
+ */
+DALI_ADAPTOR_API void StartStream(Capture capture, Actor source, const Vector2& position, const Vector2& size, const std::string& path, const Vector4& clearColor, uint32_t frameInterval, uint32_t maximumFrames);
+
+/**
+ * @brief Stops capturing a stream. The frames already captured are still encoded.
+ *
+ * @param[in] capture The capture.
+ */
+DALI_ADAPTOR_API void StopStream(Capture capture);
+
+/**
+ * @brief Retrieves the counts of the frames of the stream.
+ *
+ * @param[in] capture The capture.
+ * @return The counts since the stream was started.
+ */
+DALI_ADAPTOR_API StreamStatistics GetStreamStatistics(Capture capture);
+
+} // namespace DevelCapture
+
+} // namespace Dali
+
+#endif // DALI_CAPTURE_DEVEL_H
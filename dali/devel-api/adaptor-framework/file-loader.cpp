@@ -52,6 +52,11 @@ int ReadFile(const std::string& filename, std::streampos& fileSize, Dali::Vector
   ;
 }
 
+int ReadFile(const std::string& filename, MappedFile& mappedFile)
+{
+  return Dali::Internal::Adaptor::ReadFile(filename, mappedFile);
+}
+
 std::streampos GetFileSize(const std::string& filename)
 {
   return Dali::Internal::Adaptor::GetFileSize(filename);
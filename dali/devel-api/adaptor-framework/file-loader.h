@@ -22,6 +22,7 @@
 #include <string>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/mapped-file.h>
 #include <dali/public-api/dali-adaptor-common.h>
 
 namespace Dali
@@ -74,6 +75,17 @@ DALI_ADAPTOR_API int ReadFile(const std::string& filename, Dali::Vector<uint8_t>
  */
 DALI_ADAPTOR_API int ReadFile(const std::string& filename, std::streampos& fileSize, Dali::Vector<char>& memblock, FileLoader::FileType fileType = BINARY);
 
+/**
+ * @brief Map the file in memory instead of copying it into a buffer.
+ *
+ * Suits the large files parsed in place, e.g. scenes, animations or fonts.
+ *
+ * @param[in] filename  Filename of the file to map.
+ * @param[out] mappedFile  The read-only view of the content of the file
+ * @return error code. 0 - Error, 1 - Ok
+ */
+DALI_ADAPTOR_API int ReadFile(const std::string& filename, MappedFile& mappedFile);
+
 /**
  * @brief Get the file size of a file
  *
@@ -55,4 +55,9 @@ FILE* FileStream::GetFile()
   return mImpl->GetFile();
 }
 
+MappedFile FileStream::GetMappedFile()
+{
+  return mImpl->GetMappedFile();
+}
+
 } // namespace Dali
@@ -26,6 +26,7 @@
 #include <string>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/mapped-file.h>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/dali-adaptor-common.h>
 
@@ -110,6 +111,17 @@ public:
    */
   FILE* GetFile();
 
+  /**
+   * @brief Returns the content of the file, mapped in memory, so it can be parsed without copying it.
+   * @return The mapped file, or an empty handle if the stream is opened for writing or on a buffer, or the file can't be opened.
+   * In that case, GetStream() or GetFile() are used instead.
+   * @note The mapping is shared with the handle, so it stays valid after the stream is destroyed.
+   * @note The file must not be truncated or rewritten in place while the handle is held: reading the pages past
+   * its new end raises SIGBUS, which the caller can't recover from. Files written by another process while they're
+   * read, e.g. logs, are read with GetStream() or GetFile() instead.
+   */
+  MappedFile GetMappedFile();
+
 private:
   class Impl;
   std::unique_ptr<Impl> mImpl;
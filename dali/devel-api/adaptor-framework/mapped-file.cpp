@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/devel-api/adaptor-framework/mapped-file.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/mapped-file.h>
+
+namespace Dali
+{
+MappedFile::MappedFile()
+{
+}
+
+MappedFile::~MappedFile()
+{
+}
+
+MappedFile::MappedFile(Internal::Adaptor::MappedFile* internal)
+: BaseHandle(internal)
+{
+}
+
+MappedFile::MappedFile(const MappedFile& handle)
+: BaseHandle(handle)
+{
+}
+
+MappedFile& MappedFile::operator=(const MappedFile& rhs)
+{
+  BaseHandle::operator=(rhs);
+  return *this;
+}
+
+const uint8_t* MappedFile::GetData() const
+{
+  return GetImplementation(*this).GetData();
+}
+
+size_t MappedFile::GetSize() const
+{
+  return GetImplementation(*this).GetSize();
+}
+
+} // namespace Dali
@@ -0,0 +1,102 @@
+#ifndef DALI_MAPPED_FILE_H
+#define DALI_MAPPED_FILE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <stddef.h>
+#include <stdint.h>
+#include <dali/public-api/object/base-handle.h>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/dali-adaptor-common.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+class MappedFile;
+}
+} // namespace Internal
+
+/**
+ * @brief A read-only view of the content of a file, mapped in memory instead of copied into a buffer.
+ *
+ * The handles share the mapping, which is released with the last one. The content can be read from any thread.
+ * Where a file is small or can't be mapped, e.g. an Android asset, its content is read into a buffer owned by the view.
+ * The file must not be truncated while it's mapped: reading the pages past the new end raises SIGBUS.
+ *
+ * @see FileLoader::ReadFile()
+ */
+class DALI_ADAPTOR_API MappedFile : public BaseHandle
+{
+public:
+  /**
+   * @brief Creates an empty handle.
+   * Use FileLoader::ReadFile() to map a file.
+   */
+  MappedFile();
+
+  /**
+   * @brief Destructor.
+   */
+  ~MappedFile();
+
+  /**
+   * @brief This copy constructor is required for (smart) pointer semantics.
+   *
+   * @param[in] handle A reference to the copied handle
+   */
+  MappedFile(const MappedFile& handle);
+
+  /**
+   * @brief This assignment operator is required for (smart) pointer semantics.
+   *
+   * @param[in] rhs A reference to the copied handle
+   * @return A reference to this object
+   */
+  MappedFile& operator=(const MappedFile& rhs);
+
+  /**
+   * @brief Retrieves the content of the file.
+   *
+   * @return The first byte of the content, valid as long as a handle refers to the view, or NULL if the file is empty.
+   */
+  const uint8_t* GetData() const;
+
+  /**
+   * @brief Retrieves the size of the content of the file.
+   *
+   * @return The size in bytes.
+   */
+  size_t GetSize() const;
+
+public: // Not intended for application developers
+  /**
+   * @brief The constructor.
+   * @note  Not intended for application developers.
+   *
+   * @param[in] internal A pointer to a newly allocated MappedFile.
+   */
+  explicit DALI_INTERNAL MappedFile(Internal::Adaptor::MappedFile* internal);
+};
+
+} // namespace Dali
+
+#endif // DALI_MAPPED_FILE_H
@@ -60,6 +60,26 @@ void NativeImageSourceQueue::IgnoreSourceImage()
   mImpl->IgnoreSourceImage();
 }
 
+bool NativeImageSourceQueue::DequeueBuffer(uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride, Pixel::Format& pixelFormat)
+{
+  return mImpl->DequeueBuffer(buffer, width, height, stride, pixelFormat);
+}
+
+bool NativeImageSourceQueue::EnqueueBuffer(uint8_t* buffer)
+{
+  return mImpl->EnqueueBuffer(buffer);
+}
+
+void NativeImageSourceQueue::CancelDequeuedBuffer(uint8_t* buffer)
+{
+  mImpl->CancelDequeuedBuffer(buffer);
+}
+
+NativeImageSourceQueue::BufferStatistics NativeImageSourceQueue::GetBufferStatistics() const
+{
+  return mImpl->GetBufferStatistics();
+}
+
 bool NativeImageSourceQueue::CreateResource()
 {
   return mImpl->CreateResource();
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/images/native-image-interface.h>
+#include <dali/public-api/images/pixel.h>
 #include <dali/public-api/object/any.h>
 #include <memory>
 
@@ -69,6 +70,18 @@ public:
     COLOR_DEPTH_32       ///< 32 bits per pixel
   };
 
+  /**
+   * @brief The counts of the buffers of the queue.
+   */
+  struct BufferStatistics
+  {
+    uint32_t queueDepth;      ///< The number of buffers enqueued and not shown yet
+    uint32_t enqueuedBuffers; ///< The number of buffers enqueued since the queue was created
+    uint32_t consumedBuffers; ///< The number of buffers shown since the queue was created
+    uint32_t droppedBuffers;  ///< The number of buffers enqueued but never shown, as a newer buffer replaced them or they were ignored
+    uint32_t dequeueFailures; ///< The number of times no buffer could be dequeued
+  };
+
   /**
    * @brief Creates a new NativeImageSourceQueue.
    *        Depending on hardware, the width and height may have to be a power of two.
@@ -110,6 +123,48 @@ public:
    */
   void IgnoreSourceImage();
 
+  /**
+   * @brief Dequeues a free buffer of the queue, to be written and then enqueued.
+   *
+   * The buffers are a fixed pool, so the producer writes them in place. A buffer is not dequeued again until
+   * DALi has finished reading it.
+   * @param[out] buffer The pixels of the buffer
+   * @param[out] width The width of the buffer
+   * @param[out] height The height of the buffer
+   * @param[out] stride The number of bytes of a row of the buffer
+   * @param[out] pixelFormat The layout of the pixels, which is the platform's: e.g. Pixel::BGRA8888 for the 32 bit
+   * buffers on Tizen, Pixel::RGBA8888 where the buffers are in CPU memory. Pixel::INVALID if the layout has no
+   * Pixel::Format, like the B,G,R bytes of the 24 bit buffers on Tizen.
+   * @return True if a buffer is dequeued, false if none is free
+   * @note This can be called from worker threads.
+   */
+  bool DequeueBuffer(uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride, Pixel::Format& pixelFormat);
+
+  /**
+   * @brief Enqueues a dequeued buffer, which is shown the next time the image is rendered.
+   *
+   * @param[in] buffer The pixels of the buffer returned by DequeueBuffer()
+   * @return True if the buffer is enqueued, false if it's not a dequeued buffer or the size of the image has changed since it was dequeued
+   * @note This can be called from worker threads.
+   */
+  bool EnqueueBuffer(uint8_t* buffer);
+
+  /**
+   * @brief Returns a dequeued buffer to the queue without showing it.
+   *
+   * @param[in] buffer The pixels of the buffer returned by DequeueBuffer()
+   * @note This can be called from worker threads.
+   */
+  void CancelDequeuedBuffer(uint8_t* buffer);
+
+  /**
+   * @brief Retrieves the counts of the buffers of the queue.
+   *
+   * @return The counts of the buffers
+   * @note This can be called from worker threads.
+   */
+  BufferStatistics GetBufferStatistics() const;
+
   /**
    * @copydoc Dali::NativeImageInterface::GetTextureTarget()
    */
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/devel-api/adaptor-framework/shader-precompiler.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/adaptor/common/adaptor-impl.h>
+#include <dali/internal/graphics/gles/shader-compiler.h>
+
+namespace Dali
+{
+namespace ShaderPrecompiler
+{
+bool Compile(const std::string& vertexSource, const std::string& fragmentSource)
+{
+  if(!Adaptor::IsAvailable())
+  {
+    return false;
+  }
+
+  Internal::Adaptor::ShaderCompiler* compiler = Internal::Adaptor::Adaptor::GetImplementation(Adaptor::Get()).GetShaderCompiler();
+  if(!compiler)
+  {
+    return false;
+  }
+
+  compiler->Compile(Internal::Adaptor::ShaderCompiler::GetBinaryName(vertexSource, fragmentSource), vertexSource, fragmentSource);
+  return true;
+}
+
+} // namespace ShaderPrecompiler
+
+} // namespace Dali
@@ -0,0 +1,53 @@
+#ifndef DALI_SHADER_PRECOMPILER_H
+#define DALI_SHADER_PRECOMPILER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <string>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/dali-adaptor-common.h>
+
+namespace Dali
+{
+/**
+ * @brief Compiles shader programs ahead of their first use.
+ *
+ * The programs are compiled on a worker thread and their binaries are saved in the shader binary cache,
+ * so the render thread loads them instead of compiling the sources when a renderer first uses them.
+ * It requires the shader binary cache and OpenGL ES 3.0, otherwise the programs are compiled when first used as before.
+ */
+namespace ShaderPrecompiler
+{
+/**
+ * @brief Requests a program to be compiled.
+ *
+ * Can be called before the render thread has started, e.g. in the init signal of the application.
+ * The sources must be the ones given to Dali::Shader::New().
+ *
+ * @param[in] vertexSource The source of the vertex shader.
+ * @param[in] fragmentSource The source of the fragment shader.
+ * @return Whether the request is added, false if there's no adaptor or the binaries are not cached.
+ */
+DALI_ADAPTOR_API bool Compile(const std::string& vertexSource, const std::string& fragmentSource);
+
+} // namespace ShaderPrecompiler
+
+} // namespace Dali
+
+#endif // DALI_SHADER_PRECOMPILER_H
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/devel-api/adaptor-framework/worker-thread-pool.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/adaptor/common/adaptor-impl.h>
+#include <dali/internal/thread/common/worker-thread-pool-impl.h>
+
+namespace Dali
+{
+namespace WorkerThreadPool
+{
+namespace
+{
+/**
+ * @brief Retrieves the pool of the calling thread, the adaptor's one on the event thread.
+ */
+Internal::Adaptor::WorkerThreadPool* GetPool()
+{
+  Internal::Adaptor::WorkerThreadPool* pool = Internal::Adaptor::WorkerThreadPool::GetCurrent();
+  if(!pool && Adaptor::IsAvailable())
+  {
+    pool = &Internal::Adaptor::Adaptor::GetImplementation(Adaptor::Get()).GetWorkerThreadPool();
+  }
+  return pool;
+}
+
+} // unnamed namespace
+
+bool AddTask(CallbackBase* task, Priority priority)
+{
+  Internal::Adaptor::WorkerThreadPool* pool = GetPool();
+  if(pool)
+  {
+    pool->AddTask(task, priority);
+    return true;
+  }
+  return false;
+}
+
+unsigned int GetNumberOfThreads()
+{
+  Internal::Adaptor::WorkerThreadPool* pool = GetPool();
+  return pool ? pool->GetNumberOfThreads() : 0u;
+}
+
+} // namespace WorkerThreadPool
+
+} // namespace Dali
@@ -0,0 +1,71 @@
+#ifndef DALI_WORKER_THREAD_POOL_H
+#define DALI_WORKER_THREAD_POOL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/dali-adaptor-common.h>
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/signals/callback.h>
+
+namespace Dali
+{
+/**
+ * @brief The pool of worker threads owned by the adaptor.
+ *
+ * The tasks of the different subsystems share the pool, so they don't create more threads than cores.
+ * Tasks of a higher priority run before the tasks of a lower one. The prefetch and background tasks
+ * don't run while the adaptor is paused.
+ */
+namespace WorkerThreadPool
+{
+/**
+ * @brief The priority classes of the tasks.
+ */
+enum Priority
+{
+  INTERACTIVE, ///< The result is waited for, e.g. to render the next frame.
+  PREFETCH,    ///< The result is likely to be needed soon.
+  BACKGROUND   ///< The result is not needed soon.
+};
+
+/**
+ * @brief Adds a task to the pool.
+ *
+ * Can be called from the event thread or from a task. Within a priority, the tasks added by the event thread are
+ * taken by the workers oldest first, and the tasks added by a task newest first.
+ * The tasks which haven't started when the adaptor is destroyed are deleted without running.
+ *
+ * @param[in] task The task to run on a worker thread. The ownership is taken if the task is added.
+ * @param[in] priority The priority of the task.
+ * @return Whether the task is added, false if there's no adaptor.
+ */
+DALI_ADAPTOR_API bool AddTask(CallbackBase* task, Priority priority);
+
+/**
+ * @brief Retrieves the number of worker threads.
+ *
+ * @return The number of worker threads, zero if there's no adaptor.
+ */
+DALI_ADAPTOR_API unsigned int GetNumberOfThreads();
+
+} // namespace WorkerThreadPool
+
+} // namespace Dali
+
+#endif // DALI_WORKER_THREAD_POOL_H
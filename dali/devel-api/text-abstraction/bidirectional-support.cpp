@@ -54,6 +54,25 @@ BidiInfoIndex BidirectionalSupport::CreateInfo(const Character* const paragraph,
                                              layoutDirection);
 }
 
+bool BidirectionalSupport::UpdateInfo(BidiInfoIndex          bidiInfoIndex,
+                                      const Character* const paragraph,
+                                      Length                 numberOfCharacters,
+                                      CharacterIndex         updateStartIndex,
+                                      Length                 numberOfCharactersRemoved,
+                                      Length                 numberOfCharactersAdded,
+                                      bool                   matchSystemLanguageDirection,
+                                      LayoutDirection::Type  layoutDirection)
+{
+  return GetImplementation(*this).UpdateInfo(bidiInfoIndex,
+                                             paragraph,
+                                             numberOfCharacters,
+                                             updateStartIndex,
+                                             numberOfCharactersRemoved,
+                                             numberOfCharactersAdded,
+                                             matchSystemLanguageDirection,
+                                             layoutDirection);
+}
+
 void BidirectionalSupport::DestroyInfo(BidiInfoIndex bidiInfoIndex)
 {
   GetImplementation(*this).DestroyInfo(bidiInfoIndex);
@@ -86,6 +86,34 @@ public:
                            bool                   matchSystemLanguageDirection,
                            LayoutDirection::Type  layoutDirection);
 
+  /**
+   * @brief Updates the bidirectional data of a paragraph after an edit.
+   *
+   * The types of the characters outside the edited range are reused and the buffers of the paragraph are only reallocated when it grows
+   * beyond their capacity. The paragraph's direction and the embedding levels are retrieved again for the whole paragraph.
+   *
+   * @note If the edited range is not consistent with the number of characters of the stored data, the whole paragraph is analyzed again.
+   *
+   * @param[in] bidiInfoIndex The index to the object inside the table storing the bidirectional data of the paragraph.
+   * @param[in] paragraph Pointer to the first character of the edited paragraph coded in UTF32.
+   * @param[in] numberOfCharacters The number of characters of the edited paragraph.
+   * @param[in] updateStartIndex Index to the first edited character, relative to the paragraph.
+   * @param[in] numberOfCharactersRemoved The number of characters removed from the paragraph at @p updateStartIndex.
+   * @param[in] numberOfCharactersAdded The number of characters added to the paragraph at @p updateStartIndex.
+   * @param[in] matchSystemLanguageDirection Whether match for system language direction or not.
+   * @param[in] layoutDirection The direction of the system language.
+   *
+   * @return @e true if the bidirectional data has been updated. Otherwise the data must be destroyed and created again.
+   */
+  bool UpdateInfo(BidiInfoIndex          bidiInfoIndex,
+                  const Character* const paragraph,
+                  Length                 numberOfCharacters,
+                  CharacterIndex         updateStartIndex,
+                  Length                 numberOfCharactersRemoved,
+                  Length                 numberOfCharactersAdded,
+                  bool                   matchSystemLanguageDirection,
+                  LayoutDirection::Type  layoutDirection);
+
   /**
    * @brief Destroys the bidirectional data.
    *
@@ -264,6 +264,26 @@ public:
                           PointSize26Dot6        requestedPointSize = DEFAULT_POINT_SIZE,
                           bool                   preferColor        = false);
 
+  /**
+   * @brief Find the fallback-fonts for displaying a run of UTF-32 characters.
+   *
+   * Equivalent to calling FindFallbackFont() for each character of the run, but the fallback font list is retrieved only once
+   * and the fonts supporting each character are looked up in a coverage index.
+   *
+   * @param[in] text Pointer to the first character of the run.
+   * @param[in] numberOfCharacters The number of characters of the run.
+   * @param[in] preferredFontDescription Description of the preferred font which may not provide a glyph for the characters.
+   * @param[in] requestedPointSize The point size in 26.6 fractional points.
+   * @param[in] preferColor @e true if a color font is preferred.
+   * @param[out] fontIds Pointer to a buffer with room for @p numberOfCharacters font identifiers. Zero is set for the characters without font.
+   */
+  void FindFallbackFonts(const Character* const text,
+                         Length                 numberOfCharacters,
+                         const FontDescription& preferredFontDescription,
+                         PointSize26Dot6        requestedPointSize,
+                         bool                   preferColor,
+                         FontId*                fontIds);
+
   /**
    * @brief Retrieve the unique identifier for a font.
    *
@@ -61,6 +61,32 @@ void Segmentation::GetWordBreakPositions(const Character* const text,
                                                  breakInfo);
 }
 
+void Segmentation::UpdateLineBreakPositions(const Character* const text,
+                                            Length                 numberOfCharacters,
+                                            CharacterIndex         updateStartIndex,
+                                            Length                 numberOfCharactersToUpdate,
+                                            LineBreakInfo*         breakInfo)
+{
+  GetImplementation(*this).UpdateLineBreakPositions(text,
+                                                    numberOfCharacters,
+                                                    updateStartIndex,
+                                                    numberOfCharactersToUpdate,
+                                                    breakInfo);
+}
+
+void Segmentation::UpdateWordBreakPositions(const Character* const text,
+                                            Length                 numberOfCharacters,
+                                            CharacterIndex         updateStartIndex,
+                                            Length                 numberOfCharactersToUpdate,
+                                            WordBreakInfo*         breakInfo)
+{
+  GetImplementation(*this).UpdateWordBreakPositions(text,
+                                                    numberOfCharacters,
+                                                    updateStartIndex,
+                                                    numberOfCharactersToUpdate,
+                                                    breakInfo);
+}
+
 } // namespace TextAbstraction
 
 } // namespace Dali
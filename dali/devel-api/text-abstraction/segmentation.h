@@ -119,6 +119,47 @@ public:
   void GetWordBreakPositions(const Character* const text,
                              Length                 numberOfCharacters,
                              WordBreakInfo*         breakInfo);
+
+  /**
+   * @brief Updates the line break info after an edit.
+   *
+   * Only the paragraphs affected by the edit are analyzed again. A paragraph ends with a mandatory break character
+   * (i.e. a new line or a paragraph separator) or with the end of the text.
+   *
+   * @pre @p breakInfo must have enough space allocated for @p numberOfCharacters.
+   * @pre The break info of the characters not edited must have been moved to their new positions in @p breakInfo.
+   *
+   * @param[in] text Pointer to the first character of the edited text coded in UTF32.
+   * @param[in] numberOfCharacters The number of characters of the edited text.
+   * @param[in] updateStartIndex Index to the first edited character.
+   * @param[in] numberOfCharactersToUpdate The number of characters added or modified. Zero if characters have been removed only.
+   * @param[in,out] breakInfo The line break info.
+   */
+  void UpdateLineBreakPositions(const Character* const text,
+                                Length                 numberOfCharacters,
+                                CharacterIndex         updateStartIndex,
+                                Length                 numberOfCharactersToUpdate,
+                                LineBreakInfo*         breakInfo);
+
+  /**
+   * @brief Updates the word break info after an edit.
+   *
+   * Only the paragraphs affected by the edit are analyzed again.
+   *
+   * @pre @p breakInfo must have enough space allocated for @p numberOfCharacters.
+   * @pre The break info of the characters not edited must have been moved to their new positions in @p breakInfo.
+   *
+   * @param[in] text Pointer to the first character of the edited text coded in UTF32.
+   * @param[in] numberOfCharacters The number of characters of the edited text.
+   * @param[in] updateStartIndex Index to the first edited character.
+   * @param[in] numberOfCharactersToUpdate The number of characters added or modified. Zero if characters have been removed only.
+   * @param[in,out] breakInfo The word break info.
+   */
+  void UpdateWordBreakPositions(const Character* const text,
+                                Length                 numberOfCharacters,
+                                CharacterIndex         updateStartIndex,
+                                Length                 numberOfCharactersToUpdate,
+                                WordBreakInfo*         breakInfo);
 };
 
 } // namespace TextAbstraction
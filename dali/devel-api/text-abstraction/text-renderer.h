@@ -95,26 +95,28 @@ public:
       centerY{0},
       beginAngle{0.f},
       pixelFormat{A8},
-      circularLayout{CLOCKWISE}
+      circularLayout{CLOCKWISE},
+      maximumNumberOfTiles{1u}
     {
     }
 
-    Vector<GlyphInfo>&         glyphs;         ///< The glyphs to be rendered.
-    Vector<Vector2>&           positions;      ///< The position for each glyph.
-    Vector<Vector4>&           colors;         ///< Colors of the glyphs.
-    Vector<ColorIndex>&        colorIndices;   ///< Indices to the vector of colors for each glyphs.
-    Vector<ColorBlendingMode>& blendingMode;   ///< How each glyph is going to be blended with the color of the text.
-    Vector<bool>&              isEmoji;        ///< Whether each glyph is an emoji.
-    unsigned int               width;          ///< The width of the pixel buffer. @note Some implementations may change the width for performance reasons.
-    unsigned int               height;         ///< The height of the pixel buffer.
-    unsigned int               radius;         ///< The radius in pixels of the circular text.
-    unsigned int               circularWidth;  ///< The width of the text laid out on an horizontal straight line.
-    unsigned int               circularHeight; ///< The height of the text laid out on an horizontal straight line.
-    int                        centerX;        ///< The 'x' coordinate of the center. For circular layout.
-    int                        centerY;        ///< The 'y' coordinate of the center. For circular layout.
-    float                      beginAngle;     ///< The angle in radians where the circular text begins.
-    PixelFormat                pixelFormat;    ///< The pixel format of the pixel buffer.
-    CircularLayout             circularLayout; ///< The direction of the text's layout.
+    Vector<GlyphInfo>&         glyphs;               ///< The glyphs to be rendered.
+    Vector<Vector2>&           positions;            ///< The position for each glyph.
+    Vector<Vector4>&           colors;               ///< Colors of the glyphs.
+    Vector<ColorIndex>&        colorIndices;         ///< Indices to the vector of colors for each glyphs.
+    Vector<ColorBlendingMode>& blendingMode;         ///< How each glyph is going to be blended with the color of the text.
+    Vector<bool>&              isEmoji;              ///< Whether each glyph is an emoji.
+    unsigned int               width;                ///< The width of the pixel buffer. @note Some implementations may change the width for performance reasons.
+    unsigned int               height;               ///< The height of the pixel buffer.
+    unsigned int               radius;               ///< The radius in pixels of the circular text.
+    unsigned int               circularWidth;        ///< The width of the text laid out on an horizontal straight line.
+    unsigned int               circularHeight;       ///< The height of the text laid out on an horizontal straight line.
+    int                        centerX;              ///< The 'x' coordinate of the center. For circular layout.
+    int                        centerY;              ///< The 'y' coordinate of the center. For circular layout.
+    float                      beginAngle;           ///< The angle in radians where the circular text begins.
+    PixelFormat                pixelFormat;          ///< The pixel format of the pixel buffer.
+    CircularLayout             circularLayout;       ///< The direction of the text's layout.
+    unsigned int               maximumNumberOfTiles; ///< The maximum number of horizontal tiles rasterized concurrently. @note The text is rasterized on the calling thread if it's 0 or 1.
   };
 
 public:
@@ -26,6 +26,7 @@
 // INTERNAL INCLUDES
 #include <dali/integration-api/adaptor-framework/android/android-framework.h>
 #include <dali/internal/adaptor/common/framework.h>
+#include <dali/internal/system/common/mapped-file.h>
 
 namespace Dali
 {
@@ -134,6 +135,36 @@ int ReadFile(const std::string& filename, std::streampos& fileSize, Dali::Vector
   return errorCode;
 }
 
+int ReadFile(const std::string& filename, Dali::MappedFile& mappedFile)
+{
+  MappedFilePtr internal;
+
+  const std::string assetsPrefix = "assets/";
+  if( hasPrefix( assetsPrefix, filename ) )
+  {
+    // The assets are compressed in the package, so they're read into a buffer
+    std::streampos size = 0;
+    Dali::Vector<uint8_t> buffer;
+    if( ReadFile( filename, size, buffer, Dali::FileLoader::BINARY ) )
+    {
+      buffer.Resize( static_cast<size_t>( size ) );
+      internal = MappedFile::New( buffer );
+    }
+  }
+  else
+  {
+    internal = MappedFile::New( filename );
+  }
+
+  if( !internal )
+  {
+    return 0;
+  }
+
+  mappedFile = Dali::MappedFile( internal.Get() );
+  return 1;
+}
+
 std::streampos GetFileSize(const std::string& filename)
 {
   std::streampos size = 0;
@@ -135,12 +135,12 @@ std::iostream& FileStream::Impl::GetStream()
     // TODO: it works only with text files, we need custom stream buffer implementation for binary and to avoid buffer copy
     if( !( mMode & Dali::FileStream::WRITE ) && !( mMode & Dali::FileStream::APPEND ) && !( mMode & Dali::FileStream::BINARY ) )
     {
-      std::streampos fileSize;
-      if( ReadFile( mFileName, fileSize, mFileBuffer, Dali::FileLoader::TEXT ) )
+      Dali::MappedFile mappedFile = GetMappedFile();
+      if( mappedFile )
       {
-        mBuffer = reinterpret_cast<uint8_t*>( &mFileBuffer[0] );
-        mDataSize = fileSize;
-        mBufferStream.str( std::string ( &mFileBuffer[0], fileSize ) );
+        mBuffer = const_cast<uint8_t*>( mappedFile.GetData() );
+        mDataSize = mappedFile.GetSize();
+        mBufferStream.str( mDataSize > 0u ? std::string( reinterpret_cast<const char*>( mBuffer ), mDataSize ) : std::string() );
         if( !mBufferStream.rdbuf()->in_avail() )
         {
           DALI_LOG_ERROR( "File open failed for memory buffer at location: \"%p\", of size: \"%u\", in mode: \"%d\".\n",
@@ -216,11 +216,12 @@ FILE* FileStream::Impl::GetFile()
   {
     if ( !( mMode & Dali::FileStream::WRITE ) && !( mMode & Dali::FileStream::APPEND ) )
     {
-      std::streampos fileSize;
-      if ( ReadFile( mFileName, fileSize, mFileBuffer, ( mMode & Dali::FileStream::BINARY ) ? Dali::FileLoader::BINARY : Dali::FileLoader::TEXT ) )
+      // The file is read in place from its mapping, which fmemopen doesn't write to in read mode
+      Dali::MappedFile mappedFile = GetMappedFile();
+      if( mappedFile )
       {
-        mBuffer = reinterpret_cast<uint8_t*>( &mFileBuffer[0] );
-        mDataSize = fileSize;
+        mBuffer = const_cast<uint8_t*>( mappedFile.GetData() );
+        mDataSize = mappedFile.GetSize();
         mFile = fmemopen( mBuffer, mDataSize, openMode );
         if( !mFile )
         {
@@ -255,4 +256,14 @@ FILE* FileStream::Impl::GetFile()
   return mFile;
 }
 
+Dali::MappedFile FileStream::Impl::GetMappedFile()
+{
+  if( !mMappedFile && !mFileName.empty() && !( mMode & Dali::FileStream::WRITE ) && !( mMode & Dali::FileStream::APPEND ) )
+  {
+    Dali::Internal::Adaptor::ReadFile( mFileName, mMappedFile );
+  }
+
+  return mMappedFile;
+}
+
 } // Dali
@@ -38,6 +38,8 @@ int ReadFile(const std::string& filename, Dali::Vector<uint8_t>& memblock, Dali:
 template<typename T>
 int ReadFile(const std::string& filename, std::streampos& fileSize, Dali::Vector<T>& memblock, Dali::FileLoader::FileType fileType = Dali::FileLoader::BINARY);
 
+int ReadFile(const std::string& filename, Dali::MappedFile& mappedFile);
+
 std::streampos GetFileSize(const std::string& filename);
 
 } // Adaptor
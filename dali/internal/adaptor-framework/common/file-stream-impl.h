@@ -42,13 +42,15 @@ public:
 
   FILE* GetFile();
 
+  Dali::MappedFile GetMappedFile();
+
 private:
   std::string mFileName;
   uint8_t mMode;
   uint8_t* mBuffer; // external buffer, not owned
   size_t mDataSize;
 
-  Dali::Vector<char> mFileBuffer; // for internal usage only
+  Dali::MappedFile mMappedFile; // for internal usage only
   FILE* mFile;
   std::fstream mFileStream;
   std::stringstream mBufferStream;
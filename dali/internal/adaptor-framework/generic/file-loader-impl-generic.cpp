@@ -23,6 +23,9 @@
 
 #include <dali/integration-api/debug.h>
 
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/mapped-file.h>
+
 namespace Dali
 {
 
@@ -50,32 +53,31 @@ template<typename T>
 int ReadFile(const std::string& filename, std::streampos& fileSize, Dali::Vector<T>& memblock, Dali::FileLoader::FileType fileType)
 {
   int errorCode = 0;
-  std::ifstream * file;
+  std::ifstream file;
 
   if( fileType == Dali::FileLoader::BINARY )
   {
-    file = new std::ifstream (filename.c_str(), std::ios::in|std::ios::binary|std::ios::ate);
+    file.open( filename.c_str(), std::ios::in|std::ios::binary|std::ios::ate );
   }
   else if( fileType == Dali::FileLoader::TEXT )
   {
-    file = new std::ifstream (filename.c_str(), std::ios::in|std::ios::ate);
+    file.open( filename.c_str(), std::ios::in|std::ios::ate );
   }
   else
   {
     return errorCode;
   }
 
-  if( file->is_open() )
+  if( file.is_open() )
   {
-    fileSize = file->tellg();
-
-    memblock.Resize( fileSize );
+    fileSize = file.tellg();
 
-    file->seekg (0, std::ios::beg);
-    file->read( reinterpret_cast<char*>(memblock.Begin()), fileSize );
-    file->close();
+    // The content is overwritten by the read, so it's not initialised
+    memblock.ResizeUninitialized( fileSize );
 
-    delete file;
+    file.seekg (0, std::ios::beg);
+    file.read( reinterpret_cast<char*>(memblock.Begin()), fileSize );
+    file.close();
 
     errorCode = 1;
   }
@@ -87,6 +89,18 @@ int ReadFile(const std::string& filename, std::streampos& fileSize, Dali::Vector
   return errorCode;
 }
 
+int ReadFile(const std::string& filename, Dali::MappedFile& mappedFile)
+{
+  MappedFilePtr internal = MappedFile::New( filename );
+  if( !internal )
+  {
+    return 0;
+  }
+
+  mappedFile = Dali::MappedFile( internal.Get() );
+  return 1;
+}
+
 std::streampos GetFileSize(const std::string& filename)
 {
   std::streampos size = 0;
@@ -23,6 +23,9 @@
 
 #include <dali/integration-api/debug.h>
 
+// INTERNAL INCLUDES
+#include <dali/internal/adaptor-framework/common/file-loader-impl.h>
+
 namespace Dali
 {
 
@@ -206,4 +209,14 @@ FILE* FileStream::Impl::GetFile()
   return mFile;
 }
 
+Dali::MappedFile FileStream::Impl::GetMappedFile()
+{
+  if( !mMappedFile && !mFileName.empty() && !( mMode & Dali::FileStream::WRITE ) && !( mMode & Dali::FileStream::APPEND ) )
+  {
+    Dali::Internal::Adaptor::ReadFile( mFileName, mMappedFile );
+  }
+
+  return mMappedFile;
+}
+
 } // Dali
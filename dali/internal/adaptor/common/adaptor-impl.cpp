@@ -59,6 +59,8 @@
 #include <dali/internal/graphics/gles/gl-proxy-implementation.h>
 #include <dali/internal/graphics/gles/gl-implementation.h>
 #include <dali/internal/graphics/gles/egl-sync-implementation.h>
+#include <dali/internal/graphics/gles/shader-binary-cache.h>
+#include <dali/internal/graphics/gles/shader-compiler.h>
 #include <dali/internal/graphics/common/egl-image-extensions.h>
 #include <dali/internal/clipboard/common/clipboard-impl.h>
 #include <dali/internal/system/common/object-profiler.h>
@@ -75,6 +77,7 @@
 
 #include <dali/internal/system/common/configuration-manager.h>
 #include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/thread/common/worker-thread-pool-impl.h>
 
 using Dali::TextAbstraction::FontClient;
 
@@ -94,6 +97,22 @@ namespace
 
 thread_local Adaptor* gThreadLocalAdaptor = NULL; // raw thread specific pointer to allow Adaptor::Get
 
+const uint64_t DEFAULT_FRAME_DURATION = 16666667u; ///< The duration of a frame at 60Hz, in nanoseconds.
+const uint64_t IDLE_TIME_SLICES_PER_FRAME = 4u;    ///< The idle callbacks run for a quarter of a frame at a time.
+#ifdef SHADERBIN_CACHE_ENABLED
+const char* const SHADER_BINARY_CACHE_FILE = "dali-shader-binaries.cache"; ///< The archive of the shader binaries, in the data storage path.
+#endif
+
+/**
+ * Retrieves the time the idle callbacks run for each time the main loop is idle.
+ * @param[in] numberOfVSyncsPerRender The number of vsyncs between successive renders.
+ * @return The time slice in nanoseconds.
+ */
+uint64_t GetIdleTimeSlice( unsigned int numberOfVSyncsPerRender )
+{
+  return DEFAULT_FRAME_DURATION * ( ( numberOfVSyncsPerRender > 0u ) ? numberOfVSyncsPerRender : 1u ) / IDLE_TIME_SLICES_PER_FRAME;
+}
+
 } // unnamed namespace
 
 Dali::Adaptor* Adaptor::New( Dali::Integration::SceneHolder window, Dali::RenderSurfaceInterface *surface, EnvironmentOptions* environmentOptions, ThreadMode threadMode )
@@ -159,7 +178,16 @@ void Adaptor::Initialize( GraphicsFactory& graphicsFactory )
   mEnvironmentOptions->CreateTraceManager( mPerformanceInterface );
   mEnvironmentOptions->InstallTraceFunction(); // install tracing for main thread
 
+  mWorkerThreadPool.reset( new WorkerThreadPool( *mEnvironmentOptions ) );
+
+#ifdef SHADERBIN_CACHE_ENABLED
+  mShaderBinaryCache.reset( new ShaderBinaryCache( path + SHADER_BINARY_CACHE_FILE, *mWorkerThreadPool ) );
+  mPlatformAbstraction->SetShaderBinaryCache( mShaderBinaryCache.get() );
+  mShaderCompiler.reset( new ShaderCompiler( *mShaderBinaryCache, *mWorkerThreadPool ) );
+#endif
+
   mCallbackManager = CallbackManager::New();
+  mIdleScheduler.reset( new IdleScheduler( *mCallbackManager, GetIdleTimeSlice( mEnvironmentOptions->GetRenderRefreshRate() ) ) );
 
   Dali::Internal::Adaptor::SceneHolder* defaultWindow = mWindows.front();
 
@@ -338,6 +366,9 @@ Adaptor::~Adaptor()
   // Clear out all the handles to Windows
   mWindows.clear();
 
+  // Wait for the running tasks before the objects they may use are destroyed
+  mWorkerThreadPool.reset();
+
   delete mThreadController; // this will shutdown render thread, which will call Core::ContextDestroyed before exit
   delete mObjectProfiler;
 
@@ -345,6 +376,7 @@ Adaptor::~Adaptor()
 
   delete mDisplayConnection;
   delete mPlatformAbstraction;
+  mIdleScheduler.reset();
   delete mCallbackManager;
   delete mPerformanceInterface;
 
@@ -441,6 +473,7 @@ void Adaptor::Pause()
     }
 
     mThreadController->Pause();
+    mWorkerThreadPool->Pause();
     mState = PAUSED;
 
     // Ensure any messages queued during pause callbacks are processed by doing another update.
@@ -480,6 +513,8 @@ void Adaptor::Resume()
       (*iter)->OnResume();
     }
 
+    mWorkerThreadPool->Resume();
+
     // Trigger processing of events queued up while paused
     mCore->ProcessEvents();
 
@@ -527,6 +562,7 @@ void Adaptor::Stop()
     delete mNotificationTrigger;
     mNotificationTrigger = NULL;
 
+    mIdleScheduler->Clear();
     mCallbackManager->Stop();
 
     mState = STOPPED;
@@ -620,13 +656,18 @@ Dali::TtsPlayer Adaptor::GetTtsPlayer(Dali::TtsPlayer::Mode mode)
 }
 
 bool Adaptor::AddIdle( CallbackBase* callback, bool hasReturnValue, bool forceAdd )
+{
+  return AddIdle( callback, hasReturnValue, forceAdd, IdleScheduler::NORMAL );
+}
+
+bool Adaptor::AddIdle( CallbackBase* callback, bool hasReturnValue, bool forceAdd, IdleScheduler::Priority priority )
 {
   bool idleAdded(false);
 
   // Only add an idle if the Adaptor is actually running
   if( RUNNING == mState || READY == mState || forceAdd )
   {
-    idleAdded = mCallbackManager->AddIdleCallback( callback, hasReturnValue );
+    idleAdded = mIdleScheduler->AddIdle( callback, hasReturnValue, priority );
   }
 
   return idleAdded;
@@ -634,12 +675,13 @@ bool Adaptor::AddIdle( CallbackBase* callback, bool hasReturnValue, bool forceAd
 
 void Adaptor::RemoveIdle( CallbackBase* callback )
 {
-  mCallbackManager->RemoveIdleCallback( callback );
+  mIdleScheduler->RemoveIdle( callback );
 }
 
 void Adaptor::ProcessIdle()
 {
-  bool idleProcessed = mCallbackManager->ProcessIdle();
+  // all the idle callbacks of the adaptor are queued in the scheduler
+  const bool idleProcessed = mIdleScheduler->Process();
   mNotificationOnIdleInstalled = mNotificationOnIdleInstalled && !idleProcessed;
 }
 
@@ -735,6 +777,9 @@ Dali::Integration::Core& Adaptor::GetCore()
 void Adaptor::SetRenderRefreshRate( unsigned int numberOfVSyncsPerRender )
 {
   mThreadController->SetRenderRefreshRate( numberOfVSyncsPerRender );
+
+  // the frames are longer or shorter, so are the idle time slices
+  mIdleScheduler->SetTimeSlice( GetIdleTimeSlice( numberOfVSyncsPerRender ) );
 }
 
 Dali::DisplayConnection& Adaptor::GetDisplayConnectionInterface()
@@ -800,6 +845,21 @@ void Adaptor::GetWindowContainerInterface( WindowContainer& windows )
   windows = mWindows;
 }
 
+WorkerThreadPool& Adaptor::GetWorkerThreadPool()
+{
+  return *mWorkerThreadPool;
+}
+
+ShaderBinaryCache* Adaptor::GetShaderBinaryCache()
+{
+  return mShaderBinaryCache.get();
+}
+
+ShaderCompiler* Adaptor::GetShaderCompiler()
+{
+  return mShaderCompiler.get();
+}
+
 void Adaptor::DestroyTtsPlayer(Dali::TtsPlayer::Mode mode)
 {
   if( mTtsPlayers[mode] )
@@ -932,6 +992,9 @@ void Adaptor::RequestProcessEventsOnIdle( bool forceProcess )
   if( ( ! mNotificationOnIdleInstalled ) && ( RUNNING == mState || READY == mState || forceProcess ) )
   {
     mNotificationOnIdleInstalled = AddIdleEnterer( MakeCallback( this, &Adaptor::ProcessCoreEventsFromIdle ), forceProcess );
+
+    // Let the events be processed before the remaining idle callbacks run, so the frame is not delayed
+    mIdleScheduler->Yield();
   }
 }
 
@@ -1191,6 +1254,7 @@ Adaptor::Adaptor(Dali::Integration::SceneHolder window, Dali::Adaptor& adaptor,
   mConfigurationManager( nullptr ),
   mPlatformAbstraction( nullptr ),
   mCallbackManager( nullptr ),
+  mIdleScheduler(),
   mNotificationOnIdleInstalled( false ),
   mNotificationTrigger( nullptr ),
   mDaliFeedbackPlugin(),
@@ -1199,6 +1263,9 @@ Adaptor::Adaptor(Dali::Integration::SceneHolder window, Dali::Adaptor& adaptor,
   mObservers(),
   mEnvironmentOptions( environmentOptions ? environmentOptions : new EnvironmentOptions /* Create the options if not provided */),
   mPerformanceInterface( nullptr ),
+  mWorkerThreadPool(),
+  mShaderBinaryCache(),
+  mShaderCompiler(),
   mKernelTracer(),
   mSystemTracer(),
   mObjectProfiler( nullptr ),
@@ -38,6 +38,7 @@
 #include <dali/internal/network/common/socket-factory.h>
 #include <dali/internal/system/common/core-event-interface.h>
 #include <dali/internal/system/common/environment-options.h>
+#include <dali/internal/system/common/idle-scheduler.h>
 #include <dali/internal/system/common/kernel-trace.h>
 #include <dali/internal/system/common/system-trace.h>
 #include <dali/internal/window-system/common/damage-observer.h>
@@ -76,6 +77,9 @@ class LifeCycleObserver;
 class ObjectProfiler;
 class SceneHolder;
 class ConfigurationManager;
+class ShaderBinaryCache;
+class ShaderCompiler;
+class WorkerThreadPool;
 enum class ThreadMode;
 
 /**
@@ -241,6 +245,16 @@ public: // AdaptorInternalServices implementation
    */
   virtual bool AddIdle( CallbackBase* callback, bool hasReturnValue, bool forceAdd );
 
+  /**
+   * Adds an idle callback with the given priority.
+   * @param[in] callback The callback. The ownership is taken if it's added.
+   * @param[in] hasReturnValue Whether the callback returns whether it has to be called again.
+   * @param[in] forceAdd Whether the callback is added even if the adaptor is not running.
+   * @param[in] priority The priority of the callback.
+   * @return Whether the callback is added.
+   */
+  bool AddIdle( CallbackBase* callback, bool hasReturnValue, bool forceAdd, IdleScheduler::Priority priority );
+
   /**
    * Adds a new Window instance to the Adaptor
    * @param[in]  childWindow The child window instance
@@ -496,6 +510,21 @@ public:  //AdaptorInternalServices
    */
   void GetWindowContainerInterface( WindowContainer& windows ) override;
 
+  /**
+   * copydoc Dali::Internal::Adaptor::AdaptorInternalServices::GetWorkerThreadPool()
+   */
+  WorkerThreadPool& GetWorkerThreadPool() override;
+
+  /**
+   * copydoc Dali::Internal::Adaptor::AdaptorInternalServices::GetShaderBinaryCache()
+   */
+  ShaderBinaryCache* GetShaderBinaryCache() override;
+
+  /**
+   * copydoc Dali::Internal::Adaptor::AdaptorInternalServices::GetShaderCompiler()
+   */
+  ShaderCompiler* GetShaderCompiler() override;
+
 public: // Signals
 
   /**
@@ -669,6 +698,7 @@ private: // Data
   TizenPlatform::TizenPlatformAbstraction* mPlatformAbstraction;      ///< Platform abstraction
 
   CallbackManager*                      mCallbackManager;             ///< Used to install callbacks
+  std::unique_ptr<IdleScheduler>        mIdleScheduler;               ///< Runs the idle callbacks in time slices
   bool                                  mNotificationOnIdleInstalled; ///< whether the idle handler is installed to send an notification event
   TriggerEventInterface*                mNotificationTrigger;         ///< Notification event trigger
   FeedbackPluginProxy*                  mDaliFeedbackPlugin;          ///< Used to access feedback support
@@ -677,6 +707,9 @@ private: // Data
   ObserverContainer                     mObservers;                   ///< A list of adaptor observer pointers
   EnvironmentOptions*                   mEnvironmentOptions;          ///< environment options
   PerformanceInterface*                 mPerformanceInterface;        ///< Performance interface
+  std::unique_ptr<WorkerThreadPool>     mWorkerThreadPool;            ///< Worker threads shared by the subsystems
+  std::unique_ptr<ShaderBinaryCache>    mShaderBinaryCache;           ///< The shader binaries saved by the previous runs
+  std::unique_ptr<ShaderCompiler>       mShaderCompiler;              ///< Compiles the shader programs into the binary cache on the worker threads
   KernelTrace                           mKernelTracer;                ///< Kernel tracer
   SystemTrace                           mSystemTracer;                ///< System tracer
   ObjectProfiler*                       mObjectProfiler;              ///< Tracks object lifetime for profiling
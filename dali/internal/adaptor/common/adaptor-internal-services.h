@@ -42,6 +42,9 @@ namespace Adaptor
 {
 
 class SceneHolder;
+class ShaderBinaryCache;
+class ShaderCompiler;
+class WorkerThreadPool;
 using WindowContainer = std::vector<Internal::Adaptor::SceneHolder*>;
 
 /**
@@ -115,6 +118,24 @@ public:
    */
   virtual void GetWindowContainerInterface( WindowContainer& windows ) = 0;
 
+  /**
+   * Used to run tasks on the worker threads shared by the subsystems of the adaptor
+   * @return the worker thread pool
+   */
+  virtual WorkerThreadPool& GetWorkerThreadPool() = 0;
+
+  /**
+   * Used by the render thread to set the graphics driver the shader binaries are cached for
+   * @return the shader binary cache, or NULL if the shader binaries are not cached
+   */
+  virtual ShaderBinaryCache* GetShaderBinaryCache() = 0;
+
+  /**
+   * Used by the render thread to start and stop compiling the shader programs on the worker threads
+   * @return the shader compiler, or NULL if the shader binaries are not cached
+   */
+  virtual ShaderCompiler* GetShaderCompiler() = 0;
+
 protected:
 
   /**
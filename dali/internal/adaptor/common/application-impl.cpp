@@ -30,6 +30,7 @@
 #include <dali/internal/system/common/command-line-options.h>
 #include <dali/internal/adaptor/common/framework.h>
 #include <dali/internal/adaptor/common/lifecycle-controller-impl.h>
+#include <dali/internal/text/text-abstraction/text-renderer-impl.h>
 #include <dali/internal/window-system/common/window-impl.h>
 #include <dali/internal/window-system/common/window-render-surface.h>
 #include <dali/internal/window-system/common/render-surface-factory.h>
@@ -196,7 +197,7 @@ void Application::Quit()
 {
   // Actually quit the application.
   // Force a call to Quit even if adaptor is not running.
-  Internal::Adaptor::Adaptor::GetImplementation(*mAdaptor).AddIdle( MakeCallback( this, &Application::QuitFromMainLoop ), false, true );
+  Internal::Adaptor::Adaptor::GetImplementation(*mAdaptor).AddIdle( MakeCallback( this, &Application::QuitFromMainLoop ), false, true, IdleScheduler::HIGH );
 }
 
 void Application::QuitFromMainLoop()
@@ -322,6 +323,12 @@ void Application::OnBatteryLow( Dali::DeviceStatus::Battery::Status status )
 
 void Application::OnMemoryLow( Dali::DeviceStatus::Memory::Status status )
 {
+  if( Dali::DeviceStatus::Memory::NORMAL != status )
+  {
+    // The fonts and surfaces of the text renderer are created again when needed
+    Dali::TextAbstraction::Internal::TextRenderer::ClearCache();
+  }
+
   Dali::Application application(this);
   mLowMemorySignal.Emit( status );
 }
@@ -19,6 +19,7 @@
 #include <dali/internal/adaptor/common/combined-update-render-controller.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <errno.h>
 #include <dali/integration-api/platform-abstraction.h>
 #include <unistd.h>
@@ -30,6 +31,8 @@
 #include <dali/internal/adaptor/common/combined-update-render-controller-debug.h>
 #include <dali/internal/graphics/gles/egl-graphics.h>
 #include <dali/internal/graphics/gles/egl-implementation.h>
+#include <dali/internal/graphics/gles/shader-binary-cache.h>
+#include <dali/internal/graphics/gles/shader-compiler.h>
 #include <dali/internal/graphics/common/graphics-interface.h>
 #include <dali/internal/system/common/environment-options.h>
 #include <dali/internal/system/common/time-service.h>
@@ -92,9 +95,12 @@ const unsigned int MAXIMUM_UPDATE_REQUESTS = 2;
 CombinedUpdateRenderController::CombinedUpdateRenderController( AdaptorInternalServices& adaptorInterfaces, const EnvironmentOptions& environmentOptions, ThreadMode threadMode )
 : mFpsTracker( environmentOptions ),
   mUpdateStatusLogger( environmentOptions ),
+  mFramePacer( environmentOptions, DEFAULT_FRAME_DURATION_IN_NANOSECONDS ),
+  mFrameBenchmark( environmentOptions ),
   mEventThreadSemaphore(),
   mGraphicsInitializeSemaphore(),
   mUpdateRenderThreadWaitCondition(),
+  mUpdateThreadWaitCondition(),
   mAdaptorInterfaces( adaptorInterfaces ),
   mPerformanceInterface( adaptorInterfaces.GetPerformanceInterface() ),
   mCore( adaptorInterfaces.GetCore() ),
@@ -103,10 +109,13 @@ CombinedUpdateRenderController::CombinedUpdateRenderController( AdaptorInternalS
   mSleepTrigger( NULL ),
   mPreRenderCallback( NULL ),
   mUpdateRenderThread( NULL ),
+  mUpdateThread( NULL ),
   mDefaultFrameDelta( 0.0f ),
   mDefaultFrameDurationMilliseconds( 0u ),
   mDefaultFrameDurationNanoseconds( 0u ),
   mDefaultHalfFrameNanoseconds( 0u ),
+  mRequestedRefreshRate( 1u ),
+  mFramesPerRender( 1u ),
   mUpdateRequestCount( 0u ),
   mRunning( FALSE ),
   mThreadMode( threadMode ),
@@ -121,12 +130,29 @@ CombinedUpdateRenderController::CombinedUpdateRenderController( AdaptorInternalS
   mSurfaceResized( FALSE ),
   mForceClear( FALSE ),
   mUploadWithoutRendering( FALSE ),
-  mFirstFrameAfterResume( FALSE )
+  mFirstFrameAfterResume( FALSE ),
+  mDamagedRects(),
+  mPendingPresents(),
+  mUpdateStatus(),
+  mUpdateFrameDelta( 0.0f ),
+  mUpdateCurrentTime( 0u ),
+  mUpdateNextFrameTime( 0u ),
+  mUpdateRenderToFboEnabled( false ),
+  mUpdateIsRenderingToFbo( false ),
+  mUpdateRequested( false ),
+  mUpdateInFlight( false ),
+  mUpdateDiscarded( false ),
+  mUpdateCompleted( false ),
+  mDestroyUpdateThread( false ),
+  mUpdateDuration( 0u ),
+  mLateFrameDelta( 0.0f ),
+  mPipelineUpdates( false )
 {
   LOG_EVENT_TRACE;
 
   // Initialise frame delta/duration variables first
-  SetRenderRefreshRate( environmentOptions.GetRenderRefreshRate() );
+  mRequestedRefreshRate = environmentOptions.GetRenderRefreshRate();
+  ApplyRenderRefreshRate( mRequestedRefreshRate );
 
   // Set the thread-synchronization interface on the render-surface
   Dali::RenderSurfaceInterface* currentSurface = mAdaptorInterfaces.GetRenderSurfaceInterface();
@@ -164,6 +190,14 @@ void CombinedUpdateRenderController::Initialize()
   int error = pthread_create( mUpdateRenderThread, NULL, InternalUpdateRenderThreadEntryFunc, this );
   DALI_ASSERT_ALWAYS( !error && "Return code from pthread_create() when creating UpdateRenderThread" );
 
+  if( ThreadingMode::PIPELINED_UPDATE_RENDER == mEnvironmentOptions.GetThreadingMode() )
+  {
+    // Create Update Thread. It waits until the Update/Render thread starts the first update.
+    mUpdateThread = new pthread_t();
+    error = pthread_create( mUpdateThread, NULL, InternalUpdateThreadEntryFunc, this );
+    DALI_ASSERT_ALWAYS( !error && "Return code from pthread_create() when creating UpdateThread" );
+  }
+
   // The Update/Render thread will now run and initialise the graphics interface etc. and will then wait for Start to be called
   // When this function returns, the application initialisation on the event thread should occur
 }
@@ -379,7 +413,15 @@ void CombinedUpdateRenderController::ResizeSurface()
 
 void CombinedUpdateRenderController::SetRenderRefreshRate( unsigned int numberOfFramesPerRender )
 {
-  // Not protected by lock, but written to rarely so not worth adding a lock when reading
+  // The Update/Render thread applies it at the start of its next frame. The frame pacer may lower the refresh rate
+  // under sustained overload but never raises it over the requested one.
+  ConditionalWait::ScopedLock lock( mUpdateRenderThreadWaitCondition );
+  mRequestedRefreshRate = numberOfFramesPerRender;
+}
+
+void CombinedUpdateRenderController::ApplyRenderRefreshRate( unsigned int numberOfFramesPerRender )
+{
+  mFramesPerRender                    = numberOfFramesPerRender;
   mDefaultFrameDelta                  = numberOfFramesPerRender * DEFAULT_FRAME_DURATION_IN_SECONDS;
   mDefaultFrameDurationMilliseconds   = uint64_t( numberOfFramesPerRender ) * DEFAULT_FRAME_DURATION_IN_MILLISECONDS;
   mDefaultFrameDurationNanoseconds    = uint64_t( numberOfFramesPerRender ) * DEFAULT_FRAME_DURATION_IN_NANOSECONDS;
@@ -561,6 +603,20 @@ void CombinedUpdateRenderController::UpdateRenderThread()
 
   eglGraphics->GetGlesInterface().ContextCreated();
 
+  // The cached shader binaries built by another driver are discarded
+  ShaderBinaryCache* shaderBinaryCache = mAdaptorInterfaces.GetShaderBinaryCache();
+  if( shaderBinaryCache )
+  {
+    shaderBinaryCache->SetGraphicsDriver( eglGraphics->GetGlesInterface().GetGraphicsDriver() );
+  }
+
+  // The shader programs are compiled on the worker threads with a context sharing the resource context
+  ShaderCompiler* shaderCompiler = mAdaptorInterfaces.GetShaderCompiler();
+  if( shaderCompiler && isSurfacelessContextSupported )
+  {
+    shaderCompiler->Start( eglImpl );
+  }
+
   // Tell core it has a context
   mCore.ContextCreated();
 
@@ -576,12 +632,13 @@ void CombinedUpdateRenderController::UpdateRenderThread()
   bool updateRequired = true;
   uint64_t timeToSleepUntil = 0;
   int extraFramesDropped = 0;
+  unsigned int requestedRefreshRate = mFramesPerRender;
 
   const unsigned int renderToFboInterval = mEnvironmentOptions.GetRenderToFboInterval();
   const bool renderToFboEnabled = 0u != renderToFboInterval;
   unsigned int frameCount = 0u;
 
-  while( UpdateRenderReady( useElapsedTime, updateRequired, timeToSleepUntil ) )
+  while( UpdateRenderReady( useElapsedTime, updateRequired, timeToSleepUntil, requestedRefreshRate ) )
   {
     LOG_UPDATE_RENDER_TRACE;
 
@@ -593,6 +650,13 @@ void CombinedUpdateRenderController::UpdateRenderThread()
 
     uint64_t timeSinceLastFrame = currentFrameStartTime - lastFrameTime;
 
+    if( mFrameBenchmark.Enabled() )
+    {
+      // The virtual clock advances by one frame whatever the time spent, so the frames are deterministic.
+      mFrameBenchmark.FrameStarted();
+      timeSinceLastFrame = mDefaultFrameDurationNanoseconds;
+    }
+
     // Optional FPS Tracking when continuously rendering
     if( useElapsedTime && mFpsTracker.Enabled() )
     {
@@ -602,6 +666,23 @@ void CombinedUpdateRenderController::UpdateRenderThread()
 
     lastFrameTime = currentFrameStartTime; // Store frame start time
 
+    const bool framePacingEnabled = mFramePacer.Enabled() && ( 0u == renderToFboInterval ) && !mFrameBenchmark.Enabled();
+    if( !framePacingEnabled && ( requestedRefreshRate != mFramesPerRender ) )
+    {
+      // Otherwise the frame pacer applies it once the frame is presented.
+      ApplyRenderRefreshRate( requestedRefreshRate );
+    }
+
+    if( framePacingEnabled )
+    {
+      if( 0u == timeToSleepUntil )
+      {
+        // First frame after the thread is initialized or resumed.
+        mFramePacer.Reset();
+      }
+      mFramePacer.FrameStarted( currentFrameStartTime );
+    }
+
     //////////////////////////////
     // REPLACE SURFACE
     //////////////////////////////
@@ -614,6 +695,9 @@ void CombinedUpdateRenderController::UpdateRenderThread()
       // we need to delete the surface and renderable (pixmap / window)
       // Then create a new pixmap/window and new surface
       // If the new surface has a different display connection, then the context will be lost
+      // The update started while the last frame was rendered must not run while the context is replaced.
+      DiscardUpdate();
+
       mAdaptorInterfaces.GetDisplayConnectionInterface().Initialize();
       newSurface->InitializeGraphics();
       newSurface->MakeContextCurrent();
@@ -631,7 +715,8 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     // UPDATE
     //////////////////////////////
 
-    const unsigned int currentTime = currentFrameStartTime / NANOSECONDS_PER_MILLISECOND;
+    const unsigned int currentTime = mFrameBenchmark.Enabled() ? mFrameBenchmark.GetVirtualTime( mDefaultFrameDurationMilliseconds )
+                                                               : currentFrameStartTime / NANOSECONDS_PER_MILLISECOND;
     const unsigned int nextFrameTime = currentTime + mDefaultFrameDurationMilliseconds;
 
     uint64_t noOfFramesSinceLastUpdate = 1;
@@ -640,12 +725,8 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     {
       if( mThreadMode == ThreadMode::RUN_IF_REQUESTED )
       {
-        extraFramesDropped = 0;
-        while( timeSinceLastFrame >= mDefaultFrameDurationNanoseconds )
-        {
-           timeSinceLastFrame -= mDefaultFrameDurationNanoseconds;
-           extraFramesDropped++;
-        }
+        extraFramesDropped = timeSinceLastFrame / mDefaultFrameDurationNanoseconds;
+        timeSinceLastFrame -= extraFramesDropped * mDefaultFrameDurationNanoseconds;
       }
 
       // If using the elapsed time, then calculate frameDelta as a multiple of mDefaultFrameDelta
@@ -656,25 +737,65 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     LOG_UPDATE_RENDER( "timeSinceLastFrame(%llu) noOfFramesSinceLastUpdate(%u) frameDelta(%.6f)", timeSinceLastFrame, noOfFramesSinceLastUpdate, frameDelta );
 
     Integration::UpdateStatus updateStatus;
+    uint64_t updateDuration = 0u;
 
-    AddPerformanceMarker( PerformanceInterface::UPDATE_START );
-    mCore.Update( frameDelta,
-                  currentTime,
-                  nextFrameTime,
-                  updateStatus,
-                  renderToFboEnabled,
-                  isRenderingToFbo );
-    AddPerformanceMarker( PerformanceInterface::UPDATE_END );
+    if( mUpdateThread )
+    {
+      if( mUpdateDiscarded )
+      {
+        // The discarded update has already advanced the animations to this frame.
+        frameDelta = 0.0f;
+        mUpdateDiscarded = false;
+      }
+
+      if( mUpdateInFlight )
+      {
+        // The update of this frame was started while the previous frame was rendered, before the frames dropped since
+        // were known. They are added to the next update.
+        mLateFrameDelta = std::max( frameDelta - mDefaultFrameDelta, 0.0f );
+      }
+      else
+      {
+        StartUpdate( frameDelta + mLateFrameDelta, currentTime, nextFrameTime, renderToFboEnabled, isRenderingToFbo );
+        mLateFrameDelta = 0.0f;
+      }
+      WaitForUpdate( updateStatus, updateDuration );
+    }
+    else
+    {
+      AddPerformanceMarker( PerformanceInterface::UPDATE_START );
+      mCore.Update( frameDelta,
+                    currentTime,
+                    nextFrameTime,
+                    updateStatus,
+                    renderToFboEnabled,
+                    isRenderingToFbo );
+      AddPerformanceMarker( PerformanceInterface::UPDATE_END );
+    }
+
+    mFrameBenchmark.UpdateFinished();
 
     unsigned int keepUpdatingStatus = updateStatus.KeepUpdating();
 
-    // Tell the event-thread to wake up (if asleep) and send a notification event to Core if required
-    if( updateStatus.NeedsNotification() )
+    // Tell the event-thread to wake up (if asleep) and send a notification event to Core if required.
+    // The update thread does it as soon as the update completes.
+    if( !mUpdateThread && updateStatus.NeedsNotification() )
     {
       mNotificationTrigger.Trigger();
       LOG_UPDATE_RENDER( "Notification Triggered" );
     }
 
+    // Update the next frame while this one is rendered if animations keep running. Core double buffers the scene graph
+    // and the render instructions, so the update of the next frame may run while the current one is rendered.
+    if( mUpdateThread && mPipelineUpdates && ( mThreadMode == ThreadMode::NORMAL ) &&
+        ( Integration::KeepUpdating::NOT_REQUESTED != keepUpdatingStatus ) )
+    {
+      const bool isNextFrameRenderingToFbo = renderToFboEnabled && ( 0u != frameCount % renderToFboInterval );
+
+      StartUpdate( mDefaultFrameDelta + mLateFrameDelta, nextFrameTime, nextFrameTime + mDefaultFrameDurationMilliseconds, renderToFboEnabled, isNextFrameRenderingToFbo );
+      mLateFrameDelta = 0.0f;
+    }
+
     // Check resize
     bool surfaceResized = false;
     bool shouldSurfaceBeResized = ShouldSurfaceBeResized();
@@ -722,6 +843,17 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     }
 
     Integration::RenderStatus renderStatus;
+    uint64_t swapTime = 0u;
+    uint64_t presentTime = 0u;
+
+    // The render cost is measured without the wait for the vsync by the frame pacer, and to decide whether to update
+    // the next frame while rendering.
+    const bool measureRenderCost = framePacingEnabled || mUpdateThread;
+    uint64_t renderStartTime = 0u;
+    if( measureRenderCost )
+    {
+      TimeService::GetNanoseconds( renderStartTime );
+    }
 
     AddPerformanceMarker( PerformanceInterface::RENDER_START );
 
@@ -734,6 +866,11 @@ void CombinedUpdateRenderController::UpdateRenderThread()
       WindowContainer windows;
       mAdaptorInterfaces.GetWindowContainerInterface( windows );
 
+      // Swap the buffers once all the windows are rendered, so the GPU renders a window while the next one is recorded
+      // and a swap blocked on the vsync doesn't delay the rendering of the next windows.
+      const bool deferPresent = mEnvironmentOptions.DeferredPresentEnabled() && ( windows.size() > 1u );
+      unsigned int pendingPresentCount = 0u;
+
       for( auto&& window : windows )
       {
         Dali::Integration::Scene scene = window->GetScene();
@@ -764,19 +901,86 @@ void CombinedUpdateRenderController::UpdateRenderThread()
             mDamagedRects.clear();
           }
 
-          // Render the surface
+          // Render the surface once in the bounds of the damaged areas
           mCore.RenderScene( windowRenderStatus, scene, false, clippingRect );
 
           if( windowRenderStatus.NeedsPostRender() )
           {
-            windowSurface->PostRender( false, false, surfaceResized, mDamagedRects ); // Swap Buffer with damage
+            if( deferPresent )
+            {
+              if( pendingPresentCount == mPendingPresents.size() )
+              {
+                mPendingPresents.push_back( PendingPresent() );
+              }
+
+              // Swapping keeps the capacity of both vectors between frames.
+              PendingPresent& pendingPresent = mPendingPresents[pendingPresentCount++];
+              pendingPresent.surface = windowSurface;
+              pendingPresent.damagedRects.swap( mDamagedRects );
+            }
+            else
+            {
+              if( measureRenderCost && ( 0u == swapTime ) )
+              {
+                // The render cost doesn't include the wait for the vsync.
+                TimeService::GetNanoseconds( swapTime );
+              }
+              AddPerformanceMarker( PerformanceInterface::SWAP_START );
+              mFrameBenchmark.SwapStarted();
+              windowSurface->PostRender( false, false, surfaceResized, mDamagedRects ); // Swap Buffer with damage
+              mFrameBenchmark.SwapFinished();
+              if( framePacingEnabled )
+              {
+                // The swap returns at the vsync the frame is presented at.
+                TimeService::GetNanoseconds( presentTime );
+              }
+              AddPerformanceMarker( PerformanceInterface::SWAP_END );
+            }
           }
         }
       }
+
+      if( measureRenderCost && ( 0u != pendingPresentCount ) )
+      {
+        TimeService::GetNanoseconds( swapTime );
+      }
+
+      for( unsigned int index = 0u; index < pendingPresentCount; ++index )
+      {
+        PendingPresent& pendingPresent = mPendingPresents[index];
+
+        // Switching the context flushes the commands of the previous window.
+        pendingPresent.surface->MakeContextCurrent();
+        AddPerformanceMarker( PerformanceInterface::SWAP_START );
+        mFrameBenchmark.SwapStarted();
+        pendingPresent.surface->PostRender( false, false, surfaceResized, pendingPresent.damagedRects ); // Swap Buffer with damage
+        mFrameBenchmark.SwapFinished();
+        if( framePacingEnabled )
+        {
+          TimeService::GetNanoseconds( presentTime );
+        }
+        AddPerformanceMarker( PerformanceInterface::SWAP_END );
+        pendingPresent.surface = nullptr;
+      }
     }
 
     mCore.PostRender( mUploadWithoutRendering );
 
+    if( mUpdateThread )
+    {
+      // Updating a frame while the previous one is rendered delays the events by a frame, so it's only done when the
+      // frames are rendered back to back or when a serial update and render don't fit in a frame.
+      uint64_t renderEndTime = swapTime;
+      if( 0u == renderEndTime )
+      {
+        TimeService::GetNanoseconds( renderEndTime );
+      }
+
+      mPipelineUpdates = ( 0u != renderToFboInterval ) ||
+                         mFrameBenchmark.Enabled() ||
+                         ( updateDuration + renderEndTime - renderStartTime > mDefaultFrameDurationNanoseconds );
+    }
+
     //////////////////////////////
     // DELETE SURFACE
     //////////////////////////////
@@ -793,6 +997,8 @@ void CombinedUpdateRenderController::UpdateRenderThread()
 
     AddPerformanceMarker( PerformanceInterface::RENDER_END );
 
+    mFrameBenchmark.FrameFinished();
+
     mForceClear = false;
 
     // Trigger event thread to request Update/Render thread to sleep if update not required
@@ -813,7 +1019,28 @@ void CombinedUpdateRenderController::UpdateRenderThread()
 
     extraFramesDropped = 0;
 
-    if (timeToSleepUntil == 0)
+    if( mFrameBenchmark.Enabled() )
+    {
+      // The virtual clock never drops frames, the next frame starts straight away.
+    }
+    else if( framePacingEnabled )
+    {
+      if( 0u != swapTime )
+      {
+        mFramePacer.FramePresented( swapTime, presentTime );
+      }
+
+      uint64_t currentFrameEndTime = 0;
+      TimeService::GetNanoseconds( currentFrameEndTime );
+
+      if( mFramePacer.UpdateFramesPerRender( requestedRefreshRate ) )
+      {
+        ApplyRenderRefreshRate( mFramePacer.GetFramesPerRender() );
+      }
+
+      extraFramesDropped = mFramePacer.ScheduleNextFrame( currentFrameEndTime, timeToSleepUntil );
+    }
+    else if (timeToSleepUntil == 0)
     {
       // If this is the first frame after the thread is initialized or resumed, we
       // use the actual time the current frame starts from to calculate the time to
@@ -833,24 +1060,32 @@ void CombinedUpdateRenderController::UpdateRenderThread()
       // Check the current time at the end of the frame
       uint64_t currentFrameEndTime = 0;
       TimeService::GetNanoseconds( currentFrameEndTime );
-      while ( currentFrameEndTime > timeToSleepUntil + mDefaultFrameDurationNanoseconds )
+      if( currentFrameEndTime > timeToSleepUntil + mDefaultFrameDurationNanoseconds )
       {
          // We are more than one frame behind already, so just drop the next frames
          // until the sleep-until time is later than the current time so that we can
          // catch up.
-         timeToSleepUntil += mDefaultFrameDurationNanoseconds;
-         extraFramesDropped++;
+         extraFramesDropped = ( currentFrameEndTime - timeToSleepUntil - 1u ) / mDefaultFrameDurationNanoseconds;
+         timeToSleepUntil += extraFramesDropped * mDefaultFrameDurationNanoseconds;
       }
     }
 
-    // Render to FBO is intended to measure fps above 60 so sleep is not wanted.
-    if( 0u == renderToFboInterval )
+    // Render to FBO is intended to measure fps above 60 so sleep is not wanted, nor in the benchmark mode.
+    if( ( 0u == renderToFboInterval ) && !mFrameBenchmark.Enabled() )
     {
       // Sleep until at least the the default frame duration has elapsed. This will return immediately if the specified end-time has already passed.
       TimeService::SleepUntil( timeToSleepUntil );
     }
   }
 
+  if( mUpdateThread )
+  {
+    // Core must not be updated once the context is destroyed.
+    StopUpdateThread();
+  }
+
+  mFrameBenchmark.WriteReport();
+
   // Inform core of context destruction
   mCore.ContextDestroyed();
 
@@ -864,6 +1099,12 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     surface->DestroySurface();
   }
 
+  // The shared context must be destroyed before EGL is terminated
+  if( shaderCompiler )
+  {
+    shaderCompiler->Stop();
+  }
+
   // Shutdown EGL
   eglInterface->TerminateGles();
 
@@ -873,7 +1114,7 @@ void CombinedUpdateRenderController::UpdateRenderThread()
   mEnvironmentOptions.UnInstallLogFunction();
 }
 
-bool CombinedUpdateRenderController::UpdateRenderReady( bool& useElapsedTime, bool updateRequired, uint64_t& timeToSleepUntil )
+bool CombinedUpdateRenderController::UpdateRenderReady( bool& useElapsedTime, bool updateRequired, uint64_t& timeToSleepUntil, unsigned int& requestedRefreshRate )
 {
   useElapsedTime = true;
 
@@ -897,6 +1138,9 @@ bool CombinedUpdateRenderController::UpdateRenderReady( bool& useElapsedTime, bo
     // of the first frame.
     timeToSleepUntil = 0;
 
+    // Core is not updated while paused, and the first frame after resuming is updated for its actual start time.
+    DiscardUpdate();
+
     mUpdateRenderThreadWaitCondition.Wait( updateLock );
 
     if( ! mUseElapsedTimeAfterWait )
@@ -916,6 +1160,8 @@ bool CombinedUpdateRenderController::UpdateRenderReady( bool& useElapsedTime, bo
   mUpdateRenderThreadCanSleep = FALSE;
   mPendingRequestUpdate = FALSE;
 
+  requestedRefreshRate = mRequestedRefreshRate;
+
   // If we've been asked to run Update/Render cycles a finite number of times then decrement so we wait after the
   // requested number of cycles
   if( mUpdateRenderRunCount > 0 )
@@ -971,6 +1217,135 @@ void CombinedUpdateRenderController::SurfaceResized()
   mSurfaceResized = FALSE;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// UPDATE THREAD (PIPELINED_UPDATE_RENDER only)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CombinedUpdateRenderController::UpdateThread()
+{
+  SetThreadName("UpdateThread\0");
+
+  // Install a function for logging
+  mEnvironmentOptions.InstallLogFunction();
+
+  // Install a function for tracing
+  mEnvironmentOptions.InstallTraceFunction();
+
+  LOG_UPDATE_RENDER( "UPDATE THREAD CREATED" );
+
+  while( UpdateReady() )
+  {
+    Integration::UpdateStatus updateStatus;
+
+    uint64_t updateStartTime = 0u;
+    TimeService::GetNanoseconds( updateStartTime );
+
+    AddPerformanceMarker( PerformanceInterface::UPDATE_START );
+    mCore.Update( mUpdateFrameDelta,
+                  mUpdateCurrentTime,
+                  mUpdateNextFrameTime,
+                  updateStatus,
+                  mUpdateRenderToFboEnabled,
+                  mUpdateIsRenderingToFbo );
+    AddPerformanceMarker( PerformanceInterface::UPDATE_END );
+
+    uint64_t updateEndTime = 0u;
+    TimeService::GetNanoseconds( updateEndTime );
+
+    // Tell the event-thread to wake up (if asleep) and send a notification event to Core if required,
+    // without waiting for the Update/Render thread to retrieve the status
+    if( updateStatus.NeedsNotification() )
+    {
+      mNotificationTrigger.Trigger();
+      LOG_UPDATE_RENDER( "Notification Triggered" );
+    }
+
+    ConditionalWait::ScopedLock lock( mUpdateThreadWaitCondition );
+    mUpdateStatus = updateStatus;
+    mUpdateDuration = updateEndTime - updateStartTime;
+    mUpdateCompleted = true;
+    mUpdateThreadWaitCondition.Notify( lock );
+  }
+
+  LOG_UPDATE_RENDER( "UPDATE THREAD DESTROYED" );
+
+  // Uninstall the logging function
+  mEnvironmentOptions.UnInstallLogFunction();
+}
+
+bool CombinedUpdateRenderController::UpdateReady()
+{
+  ConditionalWait::ScopedLock lock( mUpdateThreadWaitCondition );
+  while( !mUpdateRequested && !mDestroyUpdateThread )
+  {
+    mUpdateThreadWaitCondition.Wait( lock );
+  }
+
+  // The update parameters are not modified until the update completes, so they can be read without the lock.
+  mUpdateRequested = false;
+
+  return !mDestroyUpdateThread;
+}
+
+void CombinedUpdateRenderController::StartUpdate( float frameDelta, unsigned int currentTime, unsigned int nextFrameTime, bool renderToFboEnabled, bool isRenderingToFbo )
+{
+  ConditionalWait::ScopedLock lock( mUpdateThreadWaitCondition );
+
+  mUpdateFrameDelta = frameDelta;
+  mUpdateCurrentTime = currentTime;
+  mUpdateNextFrameTime = nextFrameTime;
+  mUpdateRenderToFboEnabled = renderToFboEnabled;
+  mUpdateIsRenderingToFbo = isRenderingToFbo;
+
+  mUpdateRequested = true;
+  mUpdateInFlight = true;
+  mUpdateCompleted = false;
+  mUpdateThreadWaitCondition.Notify( lock );
+}
+
+void CombinedUpdateRenderController::WaitForUpdate( Integration::UpdateStatus& updateStatus, uint64_t& updateDuration )
+{
+  ConditionalWait::ScopedLock lock( mUpdateThreadWaitCondition );
+  while( !mUpdateCompleted )
+  {
+    mUpdateThreadWaitCondition.Wait( lock );
+  }
+
+  updateStatus = mUpdateStatus;
+  updateDuration = mUpdateDuration;
+  mUpdateCompleted = false;
+  mUpdateInFlight = false;
+}
+
+void CombinedUpdateRenderController::DiscardUpdate()
+{
+  if( mUpdateInFlight )
+  {
+    // The update thread has notified the event thread if the update required it.
+    Integration::UpdateStatus updateStatus;
+    uint64_t updateDuration = 0u;
+    WaitForUpdate( updateStatus, updateDuration );
+    mUpdateDiscarded = true;
+    mLateFrameDelta = 0.0f;
+  }
+}
+
+void CombinedUpdateRenderController::StopUpdateThread()
+{
+  DiscardUpdate();
+
+  {
+    ConditionalWait::ScopedLock lock( mUpdateThreadWaitCondition );
+    mDestroyUpdateThread = true;
+    mUpdateThreadWaitCondition.Notify( lock );
+  }
+
+  pthread_join( *mUpdateThread, NULL );
+
+  delete mUpdateThread;
+  mUpdateThread = NULL;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // ALL THREADS
 ///////////////////////////////////////////////////////////////////////////////////////////////////
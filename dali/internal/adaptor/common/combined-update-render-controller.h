@@ -30,6 +30,8 @@
 #include <dali/integration-api/adaptor-framework/thread-synchronization-interface.h>
 #include <dali/internal/adaptor/common/thread-controller-interface.h>
 #include <dali/internal/system/common/fps-tracker.h>
+#include <dali/internal/system/common/frame-benchmark.h>
+#include <dali/internal/system/common/frame-pacer.h>
 #include <dali/internal/system/common/performance-interface.h>
 #include <dali/internal/system/common/update-status-logger.h>
 #include <dali/internal/window-system/common/display-connection.h>
@@ -71,6 +73,19 @@ class EnvironmentOptions;
  *  5. When we resume from paused, elapsed time is used for the animations, i.e. the could have finished while we were paused.
  *     However, FinishedSignal emission will only happen upon resumption.
  *  6. Elapsed time is NOT used while if we are waking up from a sleep state or doing an UpdateOnce.
+ *  7. In the PIPELINED_UPDATE_RENDER threading mode, Core::Update runs on a third thread:
+ *    a. While animations are running, the Update/Render thread starts the update of the next frame as soon as the update
+ *       of the current frame completes, so the next frame is updated while the current one is rendered. Core double buffers
+ *       the scene graph and the render instructions, so the update may run one frame ahead of the render, but not more:
+ *       the update of a frame is only started once the previous frames have been rendered.
+ *    b. The events processed while a frame is rendered are only seen by the update after the next one, so the update is
+ *       only started ahead when a serial update and render don't fit in a frame, or when the frames are rendered back to back
+ *       (benchmark mode, rendering to FBO). Otherwise the frames are updated and rendered in turn as in the combined mode.
+ *    c. The next frame is updated with a single frame delta; the frames dropped meanwhile are added to the following update.
+ *    d. The update in flight is discarded when the Update/Render thread pauses or sleeps and when the surface is replaced;
+ *       the frame after that is updated again without advancing the animations, as the discarded update already did.
+ *    e. The update thread notifies the event thread as soon as the update completes. The update status is handed over to
+ *       the Update/Render thread, which keeps deciding whether to sleep, resize the surface etc.
  */
 class CombinedUpdateRenderController : public ThreadControllerInterface,
                                        public ThreadSynchronizationInterface
@@ -230,9 +245,10 @@ private:
    *                               If false when returned, then there should NOT be any animation progression in the next Update.
    * @param[in]  updateRequired    Whether another update is required.
    * @param[out] timeToSleepUntil  The time remaining in nanoseconds to keep the thread sleeping before resuming.
+   * @param[out] requestedRefreshRate The number of frames per render requested by the application.
    * @return false, if the thread should stop.
    */
-  bool UpdateRenderReady( bool& useElapsedTime, bool updateRequired, uint64_t& timeToSleepUntil );
+  bool UpdateRenderReady( bool& useElapsedTime, bool updateRequired, uint64_t& timeToSleepUntil, unsigned int& requestedRefreshRate );
 
   /**
    * Checks to see if the surface needs to be replaced.
@@ -289,6 +305,65 @@ private:
     return NULL;
   }
 
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+  // UpdateThread (PIPELINED_UPDATE_RENDER only)
+  /////////////////////////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * The Update thread loop. Runs Core::Update whenever the Update/Render thread starts an update.
+   */
+  void UpdateThread();
+
+  /**
+   * Called by the Update thread to wait until an update is started.
+   * This will lock the mutex in mUpdateThreadWaitCondition.
+   *
+   * @return false, if the thread should stop.
+   */
+  bool UpdateReady();
+
+  /**
+   * Called by the Update/Render thread to start the update of a frame in the Update thread.
+   * This will lock the mutex in mUpdateThreadWaitCondition.
+   *
+   * @param[in] frameDelta        The time in seconds the animations progress.
+   * @param[in] currentTime       The time in milliseconds the frame starts.
+   * @param[in] nextFrameTime     The time in milliseconds the next frame starts.
+   * @param[in] renderToFboEnabled Whether rendering to FBO is enabled.
+   * @param[in] isRenderingToFbo   Whether this frame is rendered to FBO.
+   */
+  void StartUpdate( float frameDelta, unsigned int currentTime, unsigned int nextFrameTime, bool renderToFboEnabled, bool isRenderingToFbo );
+
+  /**
+   * Called by the Update/Render thread to wait until the update started with StartUpdate() completes.
+   * This will lock the mutex in mUpdateThreadWaitCondition.
+   *
+   * @param[out] updateStatus The status of the update.
+   * @param[out] updateDuration The time the update took in nanoseconds.
+   */
+  void WaitForUpdate( Integration::UpdateStatus& updateStatus, uint64_t& updateDuration );
+
+  /**
+   * Called by the Update/Render thread to wait for the update in flight, if any, and drop its status.
+   * The event thread is still notified if the update requires it.
+   */
+  void DiscardUpdate();
+
+  /**
+   * Called by the Update/Render thread to stop the Update thread. Discards the update in flight, if any.
+   */
+  void StopUpdateThread();
+
+  /**
+   * Helper for the thread calling the entry function
+   * @param[in] This A pointer to the current object
+   */
+  static void* InternalUpdateThreadEntryFunc( void* This )
+  {
+    ( static_cast<CombinedUpdateRenderController*>( This ) )->UpdateThread();
+    return NULL;
+  }
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   // ALL Threads
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -311,6 +386,14 @@ private:
    */
   void AddPerformanceMarker( PerformanceInterface::MarkerType type );
 
+  /**
+   * Sets the frame delta & durations for the given number of frames per render.
+   * Called by the update-render-thread when the application changes the refresh rate or the frame pacer adapts it,
+   * and by the constructor before the update-render-thread is started.
+   * @param[in]  numberOfFramesPerRender  The number of vsyncs between successive renders
+   */
+  void ApplyRenderRefreshRate( unsigned int numberOfFramesPerRender );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////
   // POST RENDERING - ThreadSynchronizationInterface overrides
   /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -338,15 +421,29 @@ private:
    */
   void PostRenderWaitForCompletion() override;
 
+private:
+
+  /**
+   * A window surface rendered in the current frame whose buffers are not swapped yet.
+   */
+  struct PendingPresent
+  {
+    Dali::RenderSurfaceInterface* surface;       ///< The window surface.
+    std::vector<Rect<int>>        damagedRects;  ///< The damaged rects the buffers are swapped with.
+  };
+
 private:
 
   FpsTracker                        mFpsTracker;                       ///< Object that tracks the FPS
   UpdateStatusLogger                mUpdateStatusLogger;               ///< Object that logs the update-status as required.
+  FramePacer                        mFramePacer;                       ///< Object that paces the frames with the present times if enabled.
+  FrameBenchmark                    mFrameBenchmark;                   ///< Object that records the timings of the frames in the benchmark mode.
 
   sem_t                             mEventThreadSemaphore;             ///< Used by the event thread to ensure all threads have been initialised, and when replacing the surface.
   sem_t                             mGraphicsInitializeSemaphore;      ///< Used by the render thread to ensure the graphics has been initialised.
 
   ConditionalWait                   mUpdateRenderThreadWaitCondition;  ///< The wait condition for the update-render-thread.
+  ConditionalWait                   mUpdateThreadWaitCondition;        ///< The wait condition shared by the update-thread and the update-render-thread. PIPELINED_UPDATE_RENDER only.
 
   AdaptorInternalServices&          mAdaptorInterfaces;                ///< The adaptor internal interface
   PerformanceInterface*             mPerformanceInterface;             ///< The performance logging interface
@@ -357,12 +454,16 @@ private:
   CallbackBase*                     mPreRenderCallback;                ///< Used by Update/Render thread when PreRender is about to be called on graphics.
 
   pthread_t*                        mUpdateRenderThread;               ///< The Update/Render thread.
+  pthread_t*                        mUpdateThread;                     ///< The Update thread. PIPELINED_UPDATE_RENDER only.
 
-  float                             mDefaultFrameDelta;                ///< Default time delta between each frame (used for animations). Not protected by lock, but written to rarely so not worth adding a lock when reading.
+  float                             mDefaultFrameDelta;                ///< Default time delta between each frame (used for animations). Only written by the update-render-thread once it's started.
   // TODO: mDefaultFrameDurationMilliseconds is defined as uint64_t, the only place where it is used, it is converted to an unsigned int!!!
-  uint64_t                          mDefaultFrameDurationMilliseconds; ///< Default duration of a frame (used for predicting the time of the next frame). Not protected by lock, but written to rarely so not worth adding a lock when reading.
-  uint64_t                          mDefaultFrameDurationNanoseconds;  ///< Default duration of a frame (used for sleeping if not enough time elapsed). Not protected by lock, but written to rarely so not worth adding a lock when reading.
-  uint64_t                          mDefaultHalfFrameNanoseconds;      ///< Is half of mDefaultFrameDurationNanoseconds. Using a member variable avoids having to do the calculation every frame. Not protected by lock, but written to rarely so not worth adding a lock when reading.
+  uint64_t                          mDefaultFrameDurationMilliseconds; ///< Default duration of a frame (used for predicting the time of the next frame). Only written by the update-render-thread once it's started.
+  uint64_t                          mDefaultFrameDurationNanoseconds;  ///< Default duration of a frame (used for sleeping if not enough time elapsed). Only written by the update-render-thread once it's started.
+  uint64_t                          mDefaultHalfFrameNanoseconds;      ///< Is half of mDefaultFrameDurationNanoseconds. Using a member variable avoids having to do the calculation every frame. Only written by the update-render-thread once it's started.
+
+  unsigned int                      mRequestedRefreshRate;             ///< The number of frames per render requested by the application (set by the event-thread, read by the update-render-thread, protected by mUpdateRenderThreadWaitCondition).
+  unsigned int                      mFramesPerRender;                  ///< The number of frames per render the frame delta & durations are set for. Only written by the update-render-thread once it's started.
 
   unsigned int                      mUpdateRequestCount;               ///< Count of update-requests we have received to ensure we do not go to sleep too early.
   unsigned int                      mRunning;                          ///< Read and set on the event-thread only to state whether we are running.
@@ -393,6 +494,31 @@ private:
   volatile unsigned int             mFirstFrameAfterResume;            ///< Will be set to check the first frame after resume (for log)
 
   std::vector<Rect<int>>            mDamagedRects;                     ///< Keeps collected damaged render items rects for one render pass
+  std::vector<PendingPresent>       mPendingPresents;                  ///< The windows to be swapped once all the windows are rendered. Only used with deferred present.
+
+  //
+  // The following members are protected by mUpdateThreadWaitCondition.
+  //
+
+  Integration::UpdateStatus         mUpdateStatus;                     ///< The status of the last update (set by the update-thread, read by the update-render-thread).
+  float                             mUpdateFrameDelta;                 ///< The frame delta of the update to be run (set by the update-render-thread, read by the update-thread).
+  unsigned int                      mUpdateCurrentTime;                ///< The current time of the update to be run (set by the update-render-thread, read by the update-thread).
+  unsigned int                      mUpdateNextFrameTime;              ///< The next frame time of the update to be run (set by the update-render-thread, read by the update-thread).
+  bool                              mUpdateRenderToFboEnabled;         ///< Whether rendering to FBO is enabled for the update to be run (set by the update-render-thread, read by the update-thread).
+  bool                              mUpdateIsRenderingToFbo;           ///< Whether the frame of the update to be run is rendered to FBO (set by the update-render-thread, read by the update-thread).
+  bool                              mUpdateRequested;                  ///< Whether an update has been started and not run yet (set by the update-render-thread, cleared by the update-thread).
+  bool                              mUpdateInFlight;                   ///< Whether an update has been started and its status not retrieved yet (set & cleared by the update-render-thread).
+  bool                              mUpdateDiscarded;                  ///< Whether the last update was discarded, so the next one doesn't advance the animations (update-render-thread only).
+  bool                              mUpdateCompleted;                  ///< Whether the update in flight has completed (set by the update-thread, cleared by the update-render-thread).
+  bool                              mDestroyUpdateThread;              ///< Whether the update-thread should be destroyed (set by the update-render-thread, read by the update-thread).
+  uint64_t                          mUpdateDuration;                   ///< The time the last update took in nanoseconds (set by the update-thread, read by the update-render-thread).
+
+  //
+  // The following members are only used by the update-render-thread. PIPELINED_UPDATE_RENDER only.
+  //
+
+  float                             mLateFrameDelta;                   ///< The frame delta of the frames dropped after the update in flight was started, added to the next update.
+  bool                              mPipelineUpdates;                  ///< Whether the next frame is updated while the current one is rendered.
 };
 
 } // namespace Adaptor
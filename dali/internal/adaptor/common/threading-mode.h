@@ -32,6 +32,7 @@ struct ThreadingMode
   enum Type
   {
     COMBINED_UPDATE_RENDER = 1,      ///< Three threads: Event, V-Sync & a Joint Update/Render thread.
+    PIPELINED_UPDATE_RENDER = 2,     ///< Three threads: Event, Update & Render. The update of the next frame runs while the current frame is rendered.
   };
 };
 
@@ -24,7 +24,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/internal/window-system/windows/platform-implement-win.h>
-#include <dali/internal/system/common/callback-manager.h>
+#include <dali/internal/system/windows/callback-manager-win.h>
 
 namespace Dali
 {
@@ -59,7 +59,7 @@ struct Framework::Impl
 
   Impl(void* data)
   : mAbortCallBack( NULL ),
-    mCallbackManager( CallbackManager::New() ),
+    mCallbackManager( new WinCallbackManager ),
     mLanguage( "NOT_SUPPORTED" ),
     mRegion( "NOT_SUPPORTED" )
   {
@@ -183,7 +183,7 @@ private:
 private:
   // Data
   CallbackBase* mAbortCallBack;
-  CallbackManager *mCallbackManager;
+  WinCallbackManager *mCallbackManager;
   std::string mLanguage;
   std::string mRegion;
 };
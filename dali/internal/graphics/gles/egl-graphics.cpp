@@ -30,12 +30,17 @@ namespace Adaptor
 {
 
 EglGraphics::EglGraphics( )
-: mMultiSamplingLevel( 0 )
+: mMultiSamplingLevel( 0 ),
+  mTextureUploadBudget( 0u )
 {
 }
 
 EglGraphics::~EglGraphics()
 {
+  if( mGLES )
+  {
+    mGLES->SetTextureStager( NULL );
+  }
 }
 
 void EglGraphics::SetGlesVersion( const int32_t glesVersion )
@@ -51,7 +56,15 @@ void EglGraphics::SetIsSurfacelessContextSupported( const bool isSupported )
 
 void EglGraphics::Initialize( EnvironmentOptions* environmentOptions )
 {
-  if( environmentOptions->GetGlesCallTime() > 0 )
+  if( !environmentOptions->GetGlesCallTraceFile().empty() )
+  {
+    mGLES = Utils::MakeUnique< GlCallRecorder >( environmentOptions->GetGlesCallTraceFile() );
+  }
+  else if( environmentOptions->GlesStateCacheEnabled() )
+  {
+    mGLES = Utils::MakeUnique< GlStateCacheImplementation >( *environmentOptions );
+  }
+  else if( environmentOptions->GetGlesCallTime() > 0 )
   {
     mGLES = Utils::MakeUnique< GlProxyImplementation >( *environmentOptions );
   }
@@ -66,6 +79,8 @@ void EglGraphics::Initialize( EnvironmentOptions* environmentOptions )
 
   mMultiSamplingLevel = environmentOptions->GetMultiSamplingLevel();
 
+  mTextureUploadBudget = environmentOptions->GetTextureUploadBudget();
+
   mEglSync = Utils::MakeUnique< EglSyncImplementation >();
 
   mEglContextHelper = Utils::MakeUnique< EglContextHelperImplementation >();
@@ -86,10 +101,18 @@ void EglGraphics::Initialize( bool depth, bool stencil, int msaa )
 EglInterface* EglGraphics::Create()
 {
   mEglImplementation = Utils::MakeUnique< EglImplementation >( mMultiSamplingLevel, mDepthBufferRequired, mStencilBufferRequired, mPartialUpdateRequired );
+  mEglImplementation->SetGlesInterface( mGLES.get() );
   mEglImageExtensions = Utils::MakeUnique< EglImageExtensions >( mEglImplementation.get() );
 
   mEglSync->Initialize( mEglImplementation.get() ); // The sync impl needs the EglDisplay
 
+  if( mGLES && mTextureUploadBudget > 0u )
+  {
+    mTextureStagerGl = Utils::MakeUnique< GlImplementation >();
+    mTextureStager = Utils::MakeUnique< GlTextureStager >( *mTextureStagerGl, mTextureUploadBudget * 1024u );
+    mGLES->SetTextureStager( mTextureStager.get() );
+  }
+
   mEglContextHelper->Initialize( mEglImplementation.get() ); // The context helper impl needs the EglContext
 
   return mEglImplementation.get();
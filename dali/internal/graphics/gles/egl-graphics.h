@@ -23,7 +23,10 @@
 #include <dali/internal/graphics/common/egl-image-extensions.h>
 #include <dali/internal/graphics/common/graphics-interface.h>
 #include <dali/internal/graphics/gles/gl-implementation.h>
+#include <dali/internal/graphics/gles/gl-call-recorder.h>
 #include <dali/internal/graphics/gles/gl-proxy-implementation.h>
+#include <dali/internal/graphics/gles/gl-state-cache-implementation.h>
+#include <dali/internal/graphics/gles/gl-texture-stager.h>
 #include <dali/internal/graphics/gles/egl-context-helper-implementation.h>
 #include <dali/internal/graphics/gles/egl-implementation.h>
 #include <dali/internal/graphics/gles/egl-sync-implementation.h>
@@ -150,8 +153,11 @@ private:
   std::unique_ptr< EglImageExtensions > mEglImageExtensions;    ///< EGL image extension
   std::unique_ptr< EglSyncImplementation > mEglSync;            ///< GlSyncAbstraction implementation for EGL
   std::unique_ptr< EglContextHelperImplementation > mEglContextHelper; ///< GlContextHelperAbstraction implementation for EGL
+  std::unique_ptr< GlImplementation > mTextureStagerGl;         ///< Makes the GL calls of the stager directly to the driver
+  std::unique_ptr< GlTextureStager > mTextureStager;            ///< Stages the texture uploads, if enabled
 
   int mMultiSamplingLevel;                                      ///< The multiple sampling level
+  unsigned int mTextureUploadBudget;                            ///< The size in kilobytes of the uploads staged per frame
 };
 
 } // namespace Adaptor
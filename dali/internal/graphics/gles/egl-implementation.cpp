@@ -77,6 +77,7 @@ EglImplementation::EglImplementation( int multiSamplingLevel,
   mEglContext( 0 ),
   mCurrentEglSurface( 0 ),
   mCurrentEglContext( EGL_NO_CONTEXT ),
+  mGlesInterface( NULL ),
   mMultiSamplingLevel( multiSamplingLevel ),
   mGlesVersion( 30 ),
   mColorDepth( COLOR_DEPTH_24 ),
@@ -90,7 +91,8 @@ EglImplementation::EglImplementation( int multiSamplingLevel,
   mIsKhrCreateContextSupported( false ),
   mSwapBufferCountAfterResume( 0 ),
   mEglSetDamageRegionKHR( 0 ),
-  mEglSwapBuffersWithDamageKHR( 0 )
+  mEglSwapBuffersWithDamageKHR( 0 ),
+  mDamagedRects()
 {
 }
 
@@ -249,10 +251,24 @@ bool EglImplementation::CreateWindowContext( EGLContext& eglContext )
   return true;
 }
 
+EGLContext EglImplementation::CreateSharedContext()
+{
+  if( mEglContext == EGL_NO_CONTEXT )
+  {
+    return EGL_NO_CONTEXT;
+  }
+
+  EGLContext eglContext = eglCreateContext( mEglDisplay, mEglConfig, mEglContext, &(mContextAttribs[0]) );
+  TEST_EGL_ERROR("eglCreateContext shared");
+
+  return eglContext;
+}
+
 void EglImplementation::DestroyContext( EGLContext& eglContext )
 {
   if( eglContext )
   {
+    NotifyContextDestroyed( eglContext );
     eglDestroyContext( mEglDisplay, eglContext );
     eglContext = 0;
   }
@@ -282,7 +298,7 @@ void EglImplementation::MakeContextCurrent( EGLSurface eglSurface, EGLContext eg
   {
     eglMakeCurrent( mEglDisplay, eglSurface, eglSurface, eglContext );
 
-    mCurrentEglContext = eglContext;
+    SetCurrentContext( eglContext );
   }
 
   EGLint error = eglGetError();
@@ -309,7 +325,7 @@ void EglImplementation::MakeCurrent( EGLNativePixmapType pixmap, EGLSurface eglS
   {
     eglMakeCurrent( mEglDisplay, eglSurface, eglSurface, mEglContext );
 
-    mCurrentEglContext = mEglContext;
+    SetCurrentContext( mEglContext );
   }
 
   EGLint error = eglGetError();
@@ -326,7 +342,7 @@ void EglImplementation::MakeContextNull()
 {
   // clear the current context
   eglMakeCurrent( mEglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
-  mCurrentEglContext = EGL_NO_CONTEXT;
+  SetCurrentContext( EGL_NO_CONTEXT );
 }
 
 void EglImplementation::TerminateGles()
@@ -343,9 +359,11 @@ void EglImplementation::TerminateGles()
         eglDestroySurface(mEglDisplay, eglSurface);
       }
     }
+    NotifyContextDestroyed( mEglContext );
     eglDestroyContext(mEglDisplay, mEglContext);
     for ( auto eglContext : mEglWindowContexts )
     {
+      NotifyContextDestroyed( eglContext );
       eglDestroyContext(mEglDisplay, eglContext);
     }
 
@@ -411,7 +429,21 @@ EGLint EglImplementation::GetBufferAge(EGLSurface& eglSurface) const
   return age;
 }
 
-void EglImplementation::SetDamageRegion( EGLSurface& eglSurface, std::vector< Rect< int > >& damagedRects )
+EGLint* EglImplementation::CopyDamagedRects( const std::vector< Rect< int > >& damagedRects )
+{
+  // The buffer keeps its capacity, so it's not allocated each frame.
+  mDamagedRects.clear();
+  for( const auto& rect : damagedRects )
+  {
+    mDamagedRects.push_back( rect.x );
+    mDamagedRects.push_back( rect.y );
+    mDamagedRects.push_back( rect.width );
+    mDamagedRects.push_back( rect.height );
+  }
+  return mDamagedRects.data();
+}
+
+void EglImplementation::SetDamageRegion( EGLSurface& eglSurface, const std::vector< Rect< int > >& damagedRects )
 {
   if( !mPartialUpdateRequired )
   {
@@ -420,7 +452,7 @@ void EglImplementation::SetDamageRegion( EGLSurface& eglSurface, std::vector< Re
 
   if( eglSurface != EGL_NO_SURFACE ) // skip if using surfaceless context
   {
-    EGLBoolean result = mEglSetDamageRegionKHR( mEglDisplay, eglSurface, reinterpret_cast< int* >( damagedRects.data() ), 1 );
+    EGLBoolean result = mEglSetDamageRegionKHR( mEglDisplay, eglSurface, CopyDamagedRects( damagedRects ), damagedRects.size() );
     if (result == EGL_FALSE)
     {
       DALI_LOG_ERROR( "eglSetDamageRegionKHR(%d)\n", eglGetError() );
@@ -445,7 +477,7 @@ void EglImplementation::SwapBuffers(EGLSurface& eglSurface, const std::vector<Re
     }
 #endif //DALI_PROFILE_UBUNTU
 
-    EGLBoolean result = mEglSwapBuffersWithDamageKHR(mEglDisplay, eglSurface, reinterpret_cast<int*>(const_cast< std::vector< Rect< int > >& >( damagedRects ).data()), damagedRects.size());
+    EGLBoolean result = mEglSwapBuffersWithDamageKHR(mEglDisplay, eglSurface, CopyDamagedRects( damagedRects ), damagedRects.size());
     if (result == EGL_FALSE)
     {
       DALI_LOG_ERROR("eglSwapBuffersWithDamageKHR(%d)\n", eglGetError());
@@ -725,6 +757,29 @@ bool EglImplementation::IsPartialUpdateRequired() const
   return mPartialUpdateRequired;
 }
 
+void EglImplementation::SetGlesInterface( GlImplementation* glesInterface )
+{
+  mGlesInterface = glesInterface;
+}
+
+void EglImplementation::SetCurrentContext( EGLContext eglContext )
+{
+  mCurrentEglContext = eglContext;
+
+  if( mGlesInterface )
+  {
+    mGlesInterface->ContextMadeCurrent( eglContext );
+  }
+}
+
+void EglImplementation::NotifyContextDestroyed( EGLContext eglContext )
+{
+  if( mGlesInterface && eglContext )
+  {
+    mGlesInterface->ContextDestroyed( eglContext );
+  }
+}
+
 } // namespace Adaptor
 
 } // namespace Internal
@@ -38,6 +38,8 @@ namespace Internal
 namespace Adaptor
 {
 
+class GlImplementation;
+
 /**
  * EglImplementation class provides an EGL implementation.
  */
@@ -85,6 +87,13 @@ public:
     */
   bool CreateWindowContext( EGLContext& mEglContext );
 
+  /**
+    * Create an OpenGL context sharing the objects of the resource context, to be used in another thread.
+    * It's not tracked: the caller makes it current in its thread and destroys it with EGL directly.
+    * @return The context, or EGL_NO_CONTEXT if it can't be created
+    */
+  EGLContext CreateSharedContext();
+
   /**
     * Destroy the OpenGL context.
     */
@@ -137,7 +146,7 @@ public:
   /**
    * Performs an OpenGL set damage command with damaged rects
    */
-  void SetDamageRegion( EGLSurface& eglSurface, std::vector< Rect< int > >& damagedRects );
+  void SetDamageRegion( EGLSurface& eglSurface, const std::vector< Rect< int > >& damagedRects );
 
   /**
    * Performs an OpenGL swap buffers command with damaged rects
@@ -240,6 +249,33 @@ public:
    */
   bool IsPartialUpdateRequired() const;
 
+  /**
+   * @brief Sets the GLES implementation told about the contexts made current and destroyed.
+   * @param[in] glesInterface The GLES implementation, or NULL
+   */
+  void SetGlesInterface( GlImplementation* glesInterface );
+
+private:
+
+  /**
+   * Sets the current context and tells the GLES implementation about it.
+   * @param[in] eglContext The context, or EGL_NO_CONTEXT
+   */
+  void SetCurrentContext( EGLContext eglContext );
+
+  /**
+   * Tells the GLES implementation about a context being destroyed.
+   * @param[in] eglContext The context
+   */
+  void NotifyContextDestroyed( EGLContext eglContext );
+
+  /**
+   * Copies the damaged rects to the array passed to the damage extensions.
+   * @param[in] damagedRects The damaged rects
+   * @return The x, y, width and height of each rect
+   */
+  EGLint* CopyDamagedRects( const std::vector< Rect< int > >& damagedRects );
+
 private:
 
   Vector<EGLint>       mContextAttribs;
@@ -260,6 +296,8 @@ private:
   EGLSurface           mCurrentEglSurface;
   EGLContext           mCurrentEglContext;
 
+  GlImplementation*    mGlesInterface;                         ///< Told about the contexts made current and destroyed
+
   typedef std::vector<EGLSurface> EglWindowSurfaceContainer;
   EglWindowSurfaceContainer mEglWindowSurfaces;                ///< The EGL surface for the window
 
@@ -280,6 +318,7 @@ private:
   uint32_t              mSwapBufferCountAfterResume;
   PFNEGLSETDAMAGEREGIONKHRPROC mEglSetDamageRegionKHR;
   PFNEGLSWAPBUFFERSWITHDAMAGEEXTPROC mEglSwapBuffersWithDamageKHR;
+  std::vector<EGLint> mDamagedRects;                          ///< The damaged rects as passed to EGL, which takes a non-const array
 
 };
 
@@ -0,0 +1,1830 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/graphics/gles/gl-call-recorder.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/time-service.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+template< typename... Arguments >
+void GlCallRecorder::Record( GlCallTrace::Call call, uint64_t startTime, const Arguments&... arguments )
+{
+  if( mWriter.IsOpen() )
+  {
+    mWriter.Record( call, GetTime() - startTime, arguments... );
+  }
+}
+
+GlCallRecorder::GlCallRecorder( const std::string& traceFile )
+: GlImplementation(),
+  mWriter( traceFile )
+{
+}
+
+GlCallRecorder::~GlCallRecorder()
+{
+}
+
+void GlCallRecorder::PreRender()
+{
+  const uint64_t time = GetTime();
+  Record( GlCallTrace::FRAME_BEGIN, time, time );
+}
+
+void GlCallRecorder::PostRender()
+{
+  GlImplementation::PostRender();
+
+  const uint64_t time = GetTime();
+  Record( GlCallTrace::FRAME_END, time, time );
+
+  // Written once per frame, so only the frame being rendered is lost if the application is killed.
+  mWriter.WriteFrame();
+}
+
+/* OpenGL ES 2.0 */
+
+void GlCallRecorder::ActiveTexture( GLenum texture )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ActiveTexture( texture );
+  Record( GlCallTrace::ACTIVE_TEXTURE, startTime, texture );
+}
+
+void GlCallRecorder::AttachShader( GLuint program, GLuint shader )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::AttachShader( program, shader );
+  Record( GlCallTrace::ATTACH_SHADER, startTime, program, shader );
+}
+
+void GlCallRecorder::BindAttribLocation( GLuint program, GLuint index, const char* name )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BindAttribLocation( program, index, name );
+  Record( GlCallTrace::BIND_ATTRIB_LOCATION, startTime, program, index, GlCallTrace::String( name ) );
+}
+
+void GlCallRecorder::BindBuffer( GLenum target, GLuint buffer )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BindBuffer( target, buffer );
+  Record( GlCallTrace::BIND_BUFFER, startTime, target, buffer );
+}
+
+void GlCallRecorder::BindFramebuffer( GLenum target, GLuint framebuffer )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BindFramebuffer( target, framebuffer );
+  Record( GlCallTrace::BIND_FRAMEBUFFER, startTime, target, framebuffer );
+}
+
+void GlCallRecorder::BindRenderbuffer( GLenum target, GLuint renderbuffer )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BindRenderbuffer( target, renderbuffer );
+  Record( GlCallTrace::BIND_RENDERBUFFER, startTime, target, renderbuffer );
+}
+
+void GlCallRecorder::BindTexture( GLenum target, GLuint texture )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BindTexture( target, texture );
+  Record( GlCallTrace::BIND_TEXTURE, startTime, target, texture );
+}
+
+void GlCallRecorder::BlendColor( GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BlendColor( red, green, blue, alpha );
+  Record( GlCallTrace::BLEND_COLOR, startTime, red, green, blue, alpha );
+}
+
+void GlCallRecorder::BlendEquation( GLenum mode )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BlendEquation( mode );
+  Record( GlCallTrace::BLEND_EQUATION, startTime, mode );
+}
+
+void GlCallRecorder::BlendEquationSeparate( GLenum modeRGB, GLenum modeAlpha )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BlendEquationSeparate( modeRGB, modeAlpha );
+  Record( GlCallTrace::BLEND_EQUATION_SEPARATE, startTime, modeRGB, modeAlpha );
+}
+
+void GlCallRecorder::BlendFunc( GLenum sfactor, GLenum dfactor )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BlendFunc( sfactor, dfactor );
+  Record( GlCallTrace::BLEND_FUNC, startTime, sfactor, dfactor );
+}
+
+void GlCallRecorder::BlendFuncSeparate( GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BlendFuncSeparate( srcRGB, dstRGB, srcAlpha, dstAlpha );
+  Record( GlCallTrace::BLEND_FUNC_SEPARATE, startTime, srcRGB, dstRGB, srcAlpha, dstAlpha );
+}
+
+void GlCallRecorder::BufferData( GLenum target, GLsizeiptr size, const void* data, GLenum usage )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BufferData( target, size, data, usage );
+  Record( GlCallTrace::BUFFER_DATA, startTime, target, static_cast<int64_t>( size ), data, usage );
+}
+
+void GlCallRecorder::BufferSubData( GLenum target, GLintptr offset, GLsizeiptr size, const void* data )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BufferSubData( target, offset, size, data );
+  Record( GlCallTrace::BUFFER_SUB_DATA, startTime, target, static_cast<int64_t>( offset ), static_cast<int64_t>( size ), data );
+}
+
+GLenum GlCallRecorder::CheckFramebufferStatus( GLenum target )
+{
+  const uint64_t startTime = GetTime();
+  const GLenum result = GlImplementation::CheckFramebufferStatus( target );
+  Record( GlCallTrace::CHECK_FRAMEBUFFER_STATUS, startTime, target );
+  return result;
+}
+
+void GlCallRecorder::Clear( GLbitfield mask )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Clear( mask );
+  Record( GlCallTrace::CLEAR, startTime, mask );
+}
+
+void GlCallRecorder::ClearColor( GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ClearColor( red, green, blue, alpha );
+  Record( GlCallTrace::CLEAR_COLOR, startTime, red, green, blue, alpha );
+}
+
+void GlCallRecorder::ClearDepthf( GLclampf depth )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ClearDepthf( depth );
+  Record( GlCallTrace::CLEAR_DEPTHF, startTime, depth );
+}
+
+void GlCallRecorder::ClearStencil( GLint s )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ClearStencil( s );
+  Record( GlCallTrace::CLEAR_STENCIL, startTime, s );
+}
+
+void GlCallRecorder::ColorMask( GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ColorMask( red, green, blue, alpha );
+  Record( GlCallTrace::COLOR_MASK, startTime, red, green, blue, alpha );
+}
+
+void GlCallRecorder::CompileShader( GLuint shader )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::CompileShader( shader );
+  Record( GlCallTrace::COMPILE_SHADER, startTime, shader );
+}
+
+void GlCallRecorder::CompressedTexImage2D( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::CompressedTexImage2D( target, level, internalformat, width, height, border, imageSize, data );
+  Record( GlCallTrace::COMPRESSED_TEX_IMAGE2D, startTime, target, level, internalformat, width, height, border, imageSize, data );
+}
+
+void GlCallRecorder::CompressedTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::CompressedTexSubImage2D( target, level, xoffset, yoffset, width, height, format, imageSize, data );
+  Record( GlCallTrace::COMPRESSED_TEX_SUB_IMAGE2D, startTime, target, level, xoffset, yoffset, width, height, format, imageSize, data );
+}
+
+void GlCallRecorder::CopyTexImage2D( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::CopyTexImage2D( target, level, internalformat, x, y, width, height, border );
+  Record( GlCallTrace::COPY_TEX_IMAGE2D, startTime, target, level, internalformat, x, y, width, height, border );
+}
+
+void GlCallRecorder::CopyTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::CopyTexSubImage2D( target, level, xoffset, yoffset, x, y, width, height );
+  Record( GlCallTrace::COPY_TEX_SUB_IMAGE2D, startTime, target, level, xoffset, yoffset, x, y, width, height );
+}
+
+GLuint GlCallRecorder::CreateProgram()
+{
+  const uint64_t startTime = GetTime();
+  const GLuint result = GlImplementation::CreateProgram();
+  Record( GlCallTrace::CREATE_PROGRAM, startTime, result );
+  return result;
+}
+
+GLuint GlCallRecorder::CreateShader( GLenum type )
+{
+  const uint64_t startTime = GetTime();
+  const GLuint result = GlImplementation::CreateShader( type );
+  Record( GlCallTrace::CREATE_SHADER, startTime, type, result );
+  return result;
+}
+
+void GlCallRecorder::CullFace( GLenum mode )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::CullFace( mode );
+  Record( GlCallTrace::CULL_FACE, startTime, mode );
+}
+
+void GlCallRecorder::DeleteBuffers( GLsizei n, const GLuint* buffers )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteBuffers( n, buffers );
+  Record( GlCallTrace::DELETE_BUFFERS, startTime, GlCallTrace::MakeArray( buffers, n ) );
+}
+
+void GlCallRecorder::DeleteFramebuffers( GLsizei n, const GLuint* framebuffers )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteFramebuffers( n, framebuffers );
+  Record( GlCallTrace::DELETE_FRAMEBUFFERS, startTime, GlCallTrace::MakeArray( framebuffers, n ) );
+}
+
+void GlCallRecorder::DeleteProgram( GLuint program )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteProgram( program );
+  Record( GlCallTrace::DELETE_PROGRAM, startTime, program );
+}
+
+void GlCallRecorder::DeleteRenderbuffers( GLsizei n, const GLuint* renderbuffers )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteRenderbuffers( n, renderbuffers );
+  Record( GlCallTrace::DELETE_RENDERBUFFERS, startTime, GlCallTrace::MakeArray( renderbuffers, n ) );
+}
+
+void GlCallRecorder::DeleteShader( GLuint shader )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteShader( shader );
+  Record( GlCallTrace::DELETE_SHADER, startTime, shader );
+}
+
+void GlCallRecorder::DeleteTextures( GLsizei n, const GLuint* textures )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteTextures( n, textures );
+  Record( GlCallTrace::DELETE_TEXTURES, startTime, GlCallTrace::MakeArray( textures, n ) );
+}
+
+void GlCallRecorder::DepthFunc( GLenum func )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DepthFunc( func );
+  Record( GlCallTrace::DEPTH_FUNC, startTime, func );
+}
+
+void GlCallRecorder::DepthMask( GLboolean flag )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DepthMask( flag );
+  Record( GlCallTrace::DEPTH_MASK, startTime, flag );
+}
+
+void GlCallRecorder::DepthRangef( GLclampf zNear, GLclampf zFar )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DepthRangef( zNear, zFar );
+  Record( GlCallTrace::DEPTH_RANGEF, startTime, zNear, zFar );
+}
+
+void GlCallRecorder::DetachShader( GLuint program, GLuint shader )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DetachShader( program, shader );
+  Record( GlCallTrace::DETACH_SHADER, startTime, program, shader );
+}
+
+void GlCallRecorder::Disable( GLenum cap )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Disable( cap );
+  Record( GlCallTrace::DISABLE, startTime, cap );
+}
+
+void GlCallRecorder::DisableVertexAttribArray( GLuint index )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DisableVertexAttribArray( index );
+  Record( GlCallTrace::DISABLE_VERTEX_ATTRIB_ARRAY, startTime, index );
+}
+
+void GlCallRecorder::DrawArrays( GLenum mode, GLint first, GLsizei count )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DrawArrays( mode, first, count );
+  Record( GlCallTrace::DRAW_ARRAYS, startTime, mode, first, count );
+}
+
+void GlCallRecorder::DrawElements( GLenum mode, GLsizei count, GLenum type, const void* indices )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DrawElements( mode, count, type, indices );
+  Record( GlCallTrace::DRAW_ELEMENTS, startTime, mode, count, type, indices );
+}
+
+void GlCallRecorder::Enable( GLenum cap )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Enable( cap );
+  Record( GlCallTrace::ENABLE, startTime, cap );
+}
+
+void GlCallRecorder::EnableVertexAttribArray( GLuint index )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::EnableVertexAttribArray( index );
+  Record( GlCallTrace::ENABLE_VERTEX_ATTRIB_ARRAY, startTime, index );
+}
+
+void GlCallRecorder::Finish()
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Finish();
+  Record( GlCallTrace::FINISH, startTime );
+}
+
+void GlCallRecorder::Flush()
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Flush();
+  Record( GlCallTrace::FLUSH, startTime );
+}
+
+void GlCallRecorder::FramebufferRenderbuffer( GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::FramebufferRenderbuffer( target, attachment, renderbuffertarget, renderbuffer );
+  Record( GlCallTrace::FRAMEBUFFER_RENDERBUFFER, startTime, target, attachment, renderbuffertarget, renderbuffer );
+}
+
+void GlCallRecorder::FramebufferTexture2D( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::FramebufferTexture2D( target, attachment, textarget, texture, level );
+  Record( GlCallTrace::FRAMEBUFFER_TEXTURE2D, startTime, target, attachment, textarget, texture, level );
+}
+
+void GlCallRecorder::FrontFace( GLenum mode )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::FrontFace( mode );
+  Record( GlCallTrace::FRONT_FACE, startTime, mode );
+}
+
+void GlCallRecorder::GenBuffers( GLsizei n, GLuint* buffers )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GenBuffers( n, buffers );
+  Record( GlCallTrace::GEN_BUFFERS, startTime, GlCallTrace::MakeArray( buffers, n ) );
+}
+
+void GlCallRecorder::GenerateMipmap( GLenum target )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GenerateMipmap( target );
+  Record( GlCallTrace::GENERATE_MIPMAP, startTime, target );
+}
+
+void GlCallRecorder::GenFramebuffers( GLsizei n, GLuint* framebuffers )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GenFramebuffers( n, framebuffers );
+  Record( GlCallTrace::GEN_FRAMEBUFFERS, startTime, GlCallTrace::MakeArray( framebuffers, n ) );
+}
+
+void GlCallRecorder::GenRenderbuffers( GLsizei n, GLuint* renderbuffers )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GenRenderbuffers( n, renderbuffers );
+  Record( GlCallTrace::GEN_RENDERBUFFERS, startTime, GlCallTrace::MakeArray( renderbuffers, n ) );
+}
+
+void GlCallRecorder::GenTextures( GLsizei n, GLuint* textures )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GenTextures( n, textures );
+  Record( GlCallTrace::GEN_TEXTURES, startTime, GlCallTrace::MakeArray( textures, n ) );
+}
+
+void GlCallRecorder::GetActiveAttrib( GLuint program, GLuint index, GLsizei bufsize, GLsizei* length, GLint* size, GLenum* type, char* name )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetActiveAttrib( program, index, bufsize, length, size, type, name );
+  Record( GlCallTrace::GET_ACTIVE_ATTRIB, startTime, program, index, bufsize );
+}
+
+void GlCallRecorder::GetActiveUniform( GLuint program, GLuint index, GLsizei bufsize, GLsizei* length, GLint* size, GLenum* type, char* name )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetActiveUniform( program, index, bufsize, length, size, type, name );
+  Record( GlCallTrace::GET_ACTIVE_UNIFORM, startTime, program, index, bufsize );
+}
+
+void GlCallRecorder::GetAttachedShaders( GLuint program, GLsizei maxcount, GLsizei* count, GLuint* shaders )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetAttachedShaders( program, maxcount, count, shaders );
+  Record( GlCallTrace::GET_ATTACHED_SHADERS, startTime, program, maxcount );
+}
+
+int GlCallRecorder::GetAttribLocation( GLuint program, const char* name )
+{
+  const uint64_t startTime = GetTime();
+  const int result = GlImplementation::GetAttribLocation( program, name );
+  Record( GlCallTrace::GET_ATTRIB_LOCATION, startTime, program, GlCallTrace::String( name ), result );
+  return result;
+}
+
+void GlCallRecorder::GetBooleanv( GLenum pname, GLboolean* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetBooleanv( pname, params );
+  Record( GlCallTrace::GET_BOOLEANV, startTime, pname );
+}
+
+void GlCallRecorder::GetBufferParameteriv( GLenum target, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetBufferParameteriv( target, pname, params );
+  Record( GlCallTrace::GET_BUFFER_PARAMETERIV, startTime, target, pname );
+}
+
+GLenum GlCallRecorder::GetError()
+{
+  const uint64_t startTime = GetTime();
+  const GLenum result = GlImplementation::GetError();
+  Record( GlCallTrace::GET_ERROR, startTime );
+  return result;
+}
+
+void GlCallRecorder::GetFloatv( GLenum pname, GLfloat* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetFloatv( pname, params );
+  Record( GlCallTrace::GET_FLOATV, startTime, pname );
+}
+
+void GlCallRecorder::GetFramebufferAttachmentParameteriv( GLenum target, GLenum attachment, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetFramebufferAttachmentParameteriv( target, attachment, pname, params );
+  Record( GlCallTrace::GET_FRAMEBUFFER_ATTACHMENT_PARAMETERIV, startTime, target, attachment, pname );
+}
+
+void GlCallRecorder::GetIntegerv( GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetIntegerv( pname, params );
+  Record( GlCallTrace::GET_INTEGERV, startTime, pname );
+}
+
+void GlCallRecorder::GetProgramiv( GLuint program, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetProgramiv( program, pname, params );
+  Record( GlCallTrace::GET_PROGRAMIV, startTime, program, pname );
+}
+
+void GlCallRecorder::GetProgramInfoLog( GLuint program, GLsizei bufsize, GLsizei* length, char* infolog )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetProgramInfoLog( program, bufsize, length, infolog );
+  Record( GlCallTrace::GET_PROGRAM_INFO_LOG, startTime, program, bufsize );
+}
+
+void GlCallRecorder::GetRenderbufferParameteriv( GLenum target, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetRenderbufferParameteriv( target, pname, params );
+  Record( GlCallTrace::GET_RENDERBUFFER_PARAMETERIV, startTime, target, pname );
+}
+
+void GlCallRecorder::GetShaderiv( GLuint shader, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetShaderiv( shader, pname, params );
+  Record( GlCallTrace::GET_SHADERIV, startTime, shader, pname );
+}
+
+void GlCallRecorder::GetShaderInfoLog( GLuint shader, GLsizei bufsize, GLsizei* length, char* infolog )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetShaderInfoLog( shader, bufsize, length, infolog );
+  Record( GlCallTrace::GET_SHADER_INFO_LOG, startTime, shader, bufsize );
+}
+
+void GlCallRecorder::GetShaderPrecisionFormat( GLenum shadertype, GLenum precisiontype, GLint* range, GLint* precision )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetShaderPrecisionFormat( shadertype, precisiontype, range, precision );
+  Record( GlCallTrace::GET_SHADER_PRECISION_FORMAT, startTime, shadertype, precisiontype );
+}
+
+void GlCallRecorder::GetShaderSource( GLuint shader, GLsizei bufsize, GLsizei* length, char* source )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetShaderSource( shader, bufsize, length, source );
+  Record( GlCallTrace::GET_SHADER_SOURCE, startTime, shader, bufsize );
+}
+
+const GLubyte* GlCallRecorder::GetString( GLenum name )
+{
+  const uint64_t startTime = GetTime();
+  const GLubyte* result = GlImplementation::GetString( name );
+  Record( GlCallTrace::GET_STRING, startTime, name );
+  return result;
+}
+
+void GlCallRecorder::GetTexParameterfv( GLenum target, GLenum pname, GLfloat* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetTexParameterfv( target, pname, params );
+  Record( GlCallTrace::GET_TEX_PARAMETERFV, startTime, target, pname );
+}
+
+void GlCallRecorder::GetTexParameteriv( GLenum target, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetTexParameteriv( target, pname, params );
+  Record( GlCallTrace::GET_TEX_PARAMETERIV, startTime, target, pname );
+}
+
+void GlCallRecorder::GetUniformfv( GLuint program, GLint location, GLfloat* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetUniformfv( program, location, params );
+  Record( GlCallTrace::GET_UNIFORMFV, startTime, program, location );
+}
+
+void GlCallRecorder::GetUniformiv( GLuint program, GLint location, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetUniformiv( program, location, params );
+  Record( GlCallTrace::GET_UNIFORMIV, startTime, program, location );
+}
+
+int GlCallRecorder::GetUniformLocation( GLuint program, const char* name )
+{
+  const uint64_t startTime = GetTime();
+  const int result = GlImplementation::GetUniformLocation( program, name );
+  Record( GlCallTrace::GET_UNIFORM_LOCATION, startTime, program, GlCallTrace::String( name ), result );
+  return result;
+}
+
+void GlCallRecorder::GetVertexAttribfv( GLuint index, GLenum pname, GLfloat* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetVertexAttribfv( index, pname, params );
+  Record( GlCallTrace::GET_VERTEX_ATTRIBFV, startTime, index, pname );
+}
+
+void GlCallRecorder::GetVertexAttribiv( GLuint index, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetVertexAttribiv( index, pname, params );
+  Record( GlCallTrace::GET_VERTEX_ATTRIBIV, startTime, index, pname );
+}
+
+void GlCallRecorder::GetVertexAttribPointerv( GLuint index, GLenum pname, void** pointer )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetVertexAttribPointerv( index, pname, pointer );
+  Record( GlCallTrace::GET_VERTEX_ATTRIB_POINTERV, startTime, index, pname );
+}
+
+void GlCallRecorder::Hint( GLenum target, GLenum mode )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Hint( target, mode );
+  Record( GlCallTrace::HINT, startTime, target, mode );
+}
+
+GLboolean GlCallRecorder::IsBuffer( GLuint buffer )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsBuffer( buffer );
+  Record( GlCallTrace::IS_BUFFER, startTime, buffer );
+  return result;
+}
+
+GLboolean GlCallRecorder::IsEnabled( GLenum cap )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsEnabled( cap );
+  Record( GlCallTrace::IS_ENABLED, startTime, cap );
+  return result;
+}
+
+GLboolean GlCallRecorder::IsFramebuffer( GLuint framebuffer )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsFramebuffer( framebuffer );
+  Record( GlCallTrace::IS_FRAMEBUFFER, startTime, framebuffer );
+  return result;
+}
+
+GLboolean GlCallRecorder::IsProgram( GLuint program )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsProgram( program );
+  Record( GlCallTrace::IS_PROGRAM, startTime, program );
+  return result;
+}
+
+GLboolean GlCallRecorder::IsRenderbuffer( GLuint renderbuffer )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsRenderbuffer( renderbuffer );
+  Record( GlCallTrace::IS_RENDERBUFFER, startTime, renderbuffer );
+  return result;
+}
+
+GLboolean GlCallRecorder::IsShader( GLuint shader )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsShader( shader );
+  Record( GlCallTrace::IS_SHADER, startTime, shader );
+  return result;
+}
+
+GLboolean GlCallRecorder::IsTexture( GLuint texture )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsTexture( texture );
+  Record( GlCallTrace::IS_TEXTURE, startTime, texture );
+  return result;
+}
+
+void GlCallRecorder::LineWidth( GLfloat width )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::LineWidth( width );
+  Record( GlCallTrace::LINE_WIDTH, startTime, width );
+}
+
+void GlCallRecorder::LinkProgram( GLuint program )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::LinkProgram( program );
+  Record( GlCallTrace::LINK_PROGRAM, startTime, program );
+}
+
+void GlCallRecorder::PixelStorei( GLenum pname, GLint param )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::PixelStorei( pname, param );
+  Record( GlCallTrace::PIXEL_STOREI, startTime, pname, param );
+}
+
+void GlCallRecorder::PolygonOffset( GLfloat factor, GLfloat units )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::PolygonOffset( factor, units );
+  Record( GlCallTrace::POLYGON_OFFSET, startTime, factor, units );
+}
+
+void GlCallRecorder::ReadPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ReadPixels( x, y, width, height, format, type, pixels );
+  Record( GlCallTrace::READ_PIXELS, startTime, x, y, width, height, format, type );
+}
+
+void GlCallRecorder::ReleaseShaderCompiler()
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ReleaseShaderCompiler();
+  Record( GlCallTrace::RELEASE_SHADER_COMPILER, startTime );
+}
+
+void GlCallRecorder::RenderbufferStorage( GLenum target, GLenum internalformat, GLsizei width, GLsizei height )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::RenderbufferStorage( target, internalformat, width, height );
+  Record( GlCallTrace::RENDERBUFFER_STORAGE, startTime, target, internalformat, width, height );
+}
+
+void GlCallRecorder::SampleCoverage( GLclampf value, GLboolean invert )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::SampleCoverage( value, invert );
+  Record( GlCallTrace::SAMPLE_COVERAGE, startTime, value, invert );
+}
+
+void GlCallRecorder::Scissor( GLint x, GLint y, GLsizei width, GLsizei height )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Scissor( x, y, width, height );
+  Record( GlCallTrace::SCISSOR, startTime, x, y, width, height );
+}
+
+void GlCallRecorder::ShaderBinary( GLsizei n, const GLuint* shaders, GLenum binaryformat, const void* binary, GLsizei length )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ShaderBinary( n, shaders, binaryformat, binary, length );
+  Record( GlCallTrace::SHADER_BINARY, startTime, GlCallTrace::MakeArray( shaders, n ), binaryformat, binary, length );
+}
+
+void GlCallRecorder::ShaderSource( GLuint shader, GLsizei count, const char** string, const GLint* length )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ShaderSource( shader, count, string, length );
+  Record( GlCallTrace::SHADER_SOURCE, startTime, shader, GlCallTrace::StringList( string, count, length ) );
+}
+
+void GlCallRecorder::StencilFunc( GLenum func, GLint ref, GLuint mask )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::StencilFunc( func, ref, mask );
+  Record( GlCallTrace::STENCIL_FUNC, startTime, func, ref, mask );
+}
+
+void GlCallRecorder::StencilFuncSeparate( GLenum face, GLenum func, GLint ref, GLuint mask )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::StencilFuncSeparate( face, func, ref, mask );
+  Record( GlCallTrace::STENCIL_FUNC_SEPARATE, startTime, face, func, ref, mask );
+}
+
+void GlCallRecorder::StencilMask( GLuint mask )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::StencilMask( mask );
+  Record( GlCallTrace::STENCIL_MASK, startTime, mask );
+}
+
+void GlCallRecorder::StencilMaskSeparate( GLenum face, GLuint mask )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::StencilMaskSeparate( face, mask );
+  Record( GlCallTrace::STENCIL_MASK_SEPARATE, startTime, face, mask );
+}
+
+void GlCallRecorder::StencilOp( GLenum fail, GLenum zfail, GLenum zpass )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::StencilOp( fail, zfail, zpass );
+  Record( GlCallTrace::STENCIL_OP, startTime, fail, zfail, zpass );
+}
+
+void GlCallRecorder::StencilOpSeparate( GLenum face, GLenum fail, GLenum zfail, GLenum zpass )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::StencilOpSeparate( face, fail, zfail, zpass );
+  Record( GlCallTrace::STENCIL_OP_SEPARATE, startTime, face, fail, zfail, zpass );
+}
+
+void GlCallRecorder::TexImage2D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TexImage2D( target, level, internalformat, width, height, border, format, type, pixels );
+  Record( GlCallTrace::TEX_IMAGE2D, startTime, target, level, internalformat, width, height, border, format, type, pixels );
+}
+
+void GlCallRecorder::TexParameterf( GLenum target, GLenum pname, GLfloat param )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TexParameterf( target, pname, param );
+  Record( GlCallTrace::TEX_PARAMETERF, startTime, target, pname, param );
+}
+
+void GlCallRecorder::TexParameterfv( GLenum target, GLenum pname, const GLfloat* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TexParameterfv( target, pname, params );
+  Record( GlCallTrace::TEX_PARAMETERFV, startTime, target, pname, GlCallTrace::MakeArray( params, 1 ) );
+}
+
+void GlCallRecorder::TexParameteri( GLenum target, GLenum pname, GLint param )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TexParameteri( target, pname, param );
+  Record( GlCallTrace::TEX_PARAMETERI, startTime, target, pname, param );
+}
+
+void GlCallRecorder::TexParameteriv( GLenum target, GLenum pname, const GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TexParameteriv( target, pname, params );
+  Record( GlCallTrace::TEX_PARAMETERIV, startTime, target, pname, GlCallTrace::MakeArray( params, 1 ) );
+}
+
+void GlCallRecorder::TexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TexSubImage2D( target, level, xoffset, yoffset, width, height, format, type, pixels );
+  Record( GlCallTrace::TEX_SUB_IMAGE2D, startTime, target, level, xoffset, yoffset, width, height, format, type, pixels );
+}
+
+void GlCallRecorder::Uniform1f( GLint location, GLfloat x )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform1f( location, x );
+  Record( GlCallTrace::UNIFORM1F, startTime, location, x );
+}
+
+void GlCallRecorder::Uniform1fv( GLint location, GLsizei count, const GLfloat* v )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform1fv( location, count, v );
+  Record( GlCallTrace::UNIFORM1FV, startTime, location, GlCallTrace::MakeArray( v, count ) );
+}
+
+void GlCallRecorder::Uniform1i( GLint location, GLint x )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform1i( location, x );
+  Record( GlCallTrace::UNIFORM1I, startTime, location, x );
+}
+
+void GlCallRecorder::Uniform1iv( GLint location, GLsizei count, const GLint* v )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform1iv( location, count, v );
+  Record( GlCallTrace::UNIFORM1IV, startTime, location, GlCallTrace::MakeArray( v, count ) );
+}
+
+void GlCallRecorder::Uniform2f( GLint location, GLfloat x, GLfloat y )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform2f( location, x, y );
+  Record( GlCallTrace::UNIFORM2F, startTime, location, x, y );
+}
+
+void GlCallRecorder::Uniform2fv( GLint location, GLsizei count, const GLfloat* v )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform2fv( location, count, v );
+  Record( GlCallTrace::UNIFORM2FV, startTime, location, GlCallTrace::MakeArray( v, count * 2 ) );
+}
+
+void GlCallRecorder::Uniform2i( GLint location, GLint x, GLint y )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform2i( location, x, y );
+  Record( GlCallTrace::UNIFORM2I, startTime, location, x, y );
+}
+
+void GlCallRecorder::Uniform2iv( GLint location, GLsizei count, const GLint* v )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform2iv( location, count, v );
+  Record( GlCallTrace::UNIFORM2IV, startTime, location, GlCallTrace::MakeArray( v, count * 2 ) );
+}
+
+void GlCallRecorder::Uniform3f( GLint location, GLfloat x, GLfloat y, GLfloat z )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform3f( location, x, y, z );
+  Record( GlCallTrace::UNIFORM3F, startTime, location, x, y, z );
+}
+
+void GlCallRecorder::Uniform3fv( GLint location, GLsizei count, const GLfloat* v )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform3fv( location, count, v );
+  Record( GlCallTrace::UNIFORM3FV, startTime, location, GlCallTrace::MakeArray( v, count * 3 ) );
+}
+
+void GlCallRecorder::Uniform3i( GLint location, GLint x, GLint y, GLint z )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform3i( location, x, y, z );
+  Record( GlCallTrace::UNIFORM3I, startTime, location, x, y, z );
+}
+
+void GlCallRecorder::Uniform3iv( GLint location, GLsizei count, const GLint* v )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform3iv( location, count, v );
+  Record( GlCallTrace::UNIFORM3IV, startTime, location, GlCallTrace::MakeArray( v, count * 3 ) );
+}
+
+void GlCallRecorder::Uniform4f( GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform4f( location, x, y, z, w );
+  Record( GlCallTrace::UNIFORM4F, startTime, location, x, y, z, w );
+}
+
+void GlCallRecorder::Uniform4fv( GLint location, GLsizei count, const GLfloat* v )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform4fv( location, count, v );
+  Record( GlCallTrace::UNIFORM4FV, startTime, location, GlCallTrace::MakeArray( v, count * 4 ) );
+}
+
+void GlCallRecorder::Uniform4i( GLint location, GLint x, GLint y, GLint z, GLint w )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform4i( location, x, y, z, w );
+  Record( GlCallTrace::UNIFORM4I, startTime, location, x, y, z, w );
+}
+
+void GlCallRecorder::Uniform4iv( GLint location, GLsizei count, const GLint* v )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform4iv( location, count, v );
+  Record( GlCallTrace::UNIFORM4IV, startTime, location, GlCallTrace::MakeArray( v, count * 4 ) );
+}
+
+void GlCallRecorder::UniformMatrix2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UniformMatrix2fv( location, count, transpose, value );
+  Record( GlCallTrace::UNIFORM_MATRIX2FV, startTime, location, transpose, GlCallTrace::MakeArray( value, count * 4 ) );
+}
+
+void GlCallRecorder::UniformMatrix3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UniformMatrix3fv( location, count, transpose, value );
+  Record( GlCallTrace::UNIFORM_MATRIX3FV, startTime, location, transpose, GlCallTrace::MakeArray( value, count * 9 ) );
+}
+
+void GlCallRecorder::UniformMatrix4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UniformMatrix4fv( location, count, transpose, value );
+  Record( GlCallTrace::UNIFORM_MATRIX4FV, startTime, location, transpose, GlCallTrace::MakeArray( value, count * 16 ) );
+}
+
+void GlCallRecorder::UseProgram( GLuint program )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UseProgram( program );
+  Record( GlCallTrace::USE_PROGRAM, startTime, program );
+}
+
+void GlCallRecorder::ValidateProgram( GLuint program )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ValidateProgram( program );
+  Record( GlCallTrace::VALIDATE_PROGRAM, startTime, program );
+}
+
+void GlCallRecorder::VertexAttrib1f( GLuint indx, GLfloat x )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttrib1f( indx, x );
+  Record( GlCallTrace::VERTEX_ATTRIB1F, startTime, indx, x );
+}
+
+void GlCallRecorder::VertexAttrib1fv( GLuint indx, const GLfloat* values )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttrib1fv( indx, values );
+  Record( GlCallTrace::VERTEX_ATTRIB1FV, startTime, indx, GlCallTrace::MakeArray( values, 1 ) );
+}
+
+void GlCallRecorder::VertexAttrib2f( GLuint indx, GLfloat x, GLfloat y )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttrib2f( indx, x, y );
+  Record( GlCallTrace::VERTEX_ATTRIB2F, startTime, indx, x, y );
+}
+
+void GlCallRecorder::VertexAttrib2fv( GLuint indx, const GLfloat* values )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttrib2fv( indx, values );
+  Record( GlCallTrace::VERTEX_ATTRIB2FV, startTime, indx, GlCallTrace::MakeArray( values, 2 ) );
+}
+
+void GlCallRecorder::VertexAttrib3f( GLuint indx, GLfloat x, GLfloat y, GLfloat z )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttrib3f( indx, x, y, z );
+  Record( GlCallTrace::VERTEX_ATTRIB3F, startTime, indx, x, y, z );
+}
+
+void GlCallRecorder::VertexAttrib3fv( GLuint indx, const GLfloat* values )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttrib3fv( indx, values );
+  Record( GlCallTrace::VERTEX_ATTRIB3FV, startTime, indx, GlCallTrace::MakeArray( values, 3 ) );
+}
+
+void GlCallRecorder::VertexAttrib4f( GLuint indx, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttrib4f( indx, x, y, z, w );
+  Record( GlCallTrace::VERTEX_ATTRIB4F, startTime, indx, x, y, z, w );
+}
+
+void GlCallRecorder::VertexAttrib4fv( GLuint indx, const GLfloat* values )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttrib4fv( indx, values );
+  Record( GlCallTrace::VERTEX_ATTRIB4FV, startTime, indx, GlCallTrace::MakeArray( values, 4 ) );
+}
+
+void GlCallRecorder::VertexAttribPointer( GLuint indx, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* ptr )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttribPointer( indx, size, type, normalized, stride, ptr );
+  Record( GlCallTrace::VERTEX_ATTRIB_POINTER, startTime, indx, size, type, normalized, stride, ptr );
+}
+
+void GlCallRecorder::Viewport( GLint x, GLint y, GLsizei width, GLsizei height )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Viewport( x, y, width, height );
+  Record( GlCallTrace::VIEWPORT, startTime, x, y, width, height );
+}
+
+/* OpenGL ES 3.0 */
+
+void GlCallRecorder::ReadBuffer( GLenum mode )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ReadBuffer( mode );
+  Record( GlCallTrace::READ_BUFFER, startTime, mode );
+}
+
+void GlCallRecorder::DrawRangeElements( GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const GLvoid* indices )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DrawRangeElements( mode, startTime, end, count, type, indices );
+  Record( GlCallTrace::DRAW_RANGE_ELEMENTS, startTime, mode, start, end, count, type, indices );
+}
+
+void GlCallRecorder::TexImage3D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid* pixels )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TexImage3D( target, level, internalformat, width, height, depth, border, format, type, pixels );
+  Record( GlCallTrace::TEX_IMAGE3D, startTime, target, level, internalformat, width, height, depth, border, format, type, pixels );
+}
+
+void GlCallRecorder::TexSubImage3D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid* pixels )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TexSubImage3D( target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels );
+  Record( GlCallTrace::TEX_SUB_IMAGE3D, startTime, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels );
+}
+
+void GlCallRecorder::CopyTexSubImage3D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::CopyTexSubImage3D( target, level, xoffset, yoffset, zoffset, x, y, width, height );
+  Record( GlCallTrace::COPY_TEX_SUB_IMAGE3D, startTime, target, level, xoffset, yoffset, zoffset, x, y, width, height );
+}
+
+void GlCallRecorder::CompressedTexImage3D( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid* data )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::CompressedTexImage3D( target, level, internalformat, width, height, depth, border, imageSize, data );
+  Record( GlCallTrace::COMPRESSED_TEX_IMAGE3D, startTime, target, level, internalformat, width, height, depth, border, imageSize, data );
+}
+
+void GlCallRecorder::CompressedTexSubImage3D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const GLvoid* data )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::CompressedTexSubImage3D( target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data );
+  Record( GlCallTrace::COMPRESSED_TEX_SUB_IMAGE3D, startTime, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data );
+}
+
+void GlCallRecorder::GenQueries( GLsizei n, GLuint* ids )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GenQueries( n, ids );
+  Record( GlCallTrace::GEN_QUERIES, startTime, GlCallTrace::MakeArray( ids, n ) );
+}
+
+void GlCallRecorder::DeleteQueries( GLsizei n, const GLuint* ids )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteQueries( n, ids );
+  Record( GlCallTrace::DELETE_QUERIES, startTime, GlCallTrace::MakeArray( ids, n ) );
+}
+
+GLboolean GlCallRecorder::IsQuery( GLuint id )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsQuery( id );
+  Record( GlCallTrace::IS_QUERY, startTime, id );
+  return result;
+}
+
+void GlCallRecorder::BeginQuery( GLenum target, GLuint id )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BeginQuery( target, id );
+  Record( GlCallTrace::BEGIN_QUERY, startTime, target, id );
+}
+
+void GlCallRecorder::EndQuery( GLenum target )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::EndQuery( target );
+  Record( GlCallTrace::END_QUERY, startTime, target );
+}
+
+void GlCallRecorder::GetQueryiv( GLenum target, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetQueryiv( target, pname, params );
+  Record( GlCallTrace::GET_QUERYIV, startTime, target, pname );
+}
+
+void GlCallRecorder::GetQueryObjectuiv( GLuint id, GLenum pname, GLuint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetQueryObjectuiv( id, pname, params );
+  Record( GlCallTrace::GET_QUERY_OBJECTUIV, startTime, id, pname );
+}
+
+GLboolean GlCallRecorder::UnmapBuffer( GLenum target )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::UnmapBuffer( target );
+  Record( GlCallTrace::UNMAP_BUFFER, startTime, target );
+  return result;
+}
+
+void GlCallRecorder::GetBufferPointerv( GLenum target, GLenum pname, GLvoid** params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetBufferPointerv( target, pname, params );
+  Record( GlCallTrace::GET_BUFFER_POINTERV, startTime, target, pname );
+}
+
+void GlCallRecorder::DrawBuffers( GLsizei n, const GLenum* bufs )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DrawBuffers( n, bufs );
+  Record( GlCallTrace::DRAW_BUFFERS, startTime, GlCallTrace::MakeArray( bufs, n ) );
+}
+
+void GlCallRecorder::UniformMatrix2x3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UniformMatrix2x3fv( location, count, transpose, value );
+  Record( GlCallTrace::UNIFORM_MATRIX2X3FV, startTime, location, transpose, GlCallTrace::MakeArray( value, count * 6 ) );
+}
+
+void GlCallRecorder::UniformMatrix3x2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UniformMatrix3x2fv( location, count, transpose, value );
+  Record( GlCallTrace::UNIFORM_MATRIX3X2FV, startTime, location, transpose, GlCallTrace::MakeArray( value, count * 6 ) );
+}
+
+void GlCallRecorder::UniformMatrix2x4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UniformMatrix2x4fv( location, count, transpose, value );
+  Record( GlCallTrace::UNIFORM_MATRIX2X4FV, startTime, location, transpose, GlCallTrace::MakeArray( value, count * 8 ) );
+}
+
+void GlCallRecorder::UniformMatrix4x2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UniformMatrix4x2fv( location, count, transpose, value );
+  Record( GlCallTrace::UNIFORM_MATRIX4X2FV, startTime, location, transpose, GlCallTrace::MakeArray( value, count * 8 ) );
+}
+
+void GlCallRecorder::UniformMatrix3x4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UniformMatrix3x4fv( location, count, transpose, value );
+  Record( GlCallTrace::UNIFORM_MATRIX3X4FV, startTime, location, transpose, GlCallTrace::MakeArray( value, count * 12 ) );
+}
+
+void GlCallRecorder::UniformMatrix4x3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UniformMatrix4x3fv( location, count, transpose, value );
+  Record( GlCallTrace::UNIFORM_MATRIX4X3FV, startTime, location, transpose, GlCallTrace::MakeArray( value, count * 12 ) );
+}
+
+void GlCallRecorder::BlitFramebuffer( GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BlitFramebuffer( srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
+  Record( GlCallTrace::BLIT_FRAMEBUFFER, startTime, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
+}
+
+void GlCallRecorder::RenderbufferStorageMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::RenderbufferStorageMultisample( target, samples, internalformat, width, height );
+  Record( GlCallTrace::RENDERBUFFER_STORAGE_MULTISAMPLE, startTime, target, samples, internalformat, width, height );
+}
+
+void GlCallRecorder::FramebufferTextureLayer( GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::FramebufferTextureLayer( target, attachment, texture, level, layer );
+  Record( GlCallTrace::FRAMEBUFFER_TEXTURE_LAYER, startTime, target, attachment, texture, level, layer );
+}
+
+GLvoid* GlCallRecorder::MapBufferRange( GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access )
+{
+  const uint64_t startTime = GetTime();
+  GLvoid* result = GlImplementation::MapBufferRange( target, offset, length, access );
+  Record( GlCallTrace::MAP_BUFFER_RANGE, startTime, target, static_cast<int64_t>( offset ), static_cast<int64_t>( length ), access );
+  return result;
+}
+
+void GlCallRecorder::FlushMappedBufferRange( GLenum target, GLintptr offset, GLsizeiptr length )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::FlushMappedBufferRange( target, offset, length );
+  Record( GlCallTrace::FLUSH_MAPPED_BUFFER_RANGE, startTime, target, static_cast<int64_t>( offset ), static_cast<int64_t>( length ) );
+}
+
+void GlCallRecorder::BindVertexArray( GLuint array )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BindVertexArray( array );
+  Record( GlCallTrace::BIND_VERTEX_ARRAY, startTime, array );
+}
+
+void GlCallRecorder::DeleteVertexArrays( GLsizei n, const GLuint* arrays )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteVertexArrays( n, arrays );
+  Record( GlCallTrace::DELETE_VERTEX_ARRAYS, startTime, GlCallTrace::MakeArray( arrays, n ) );
+}
+
+void GlCallRecorder::GenVertexArrays( GLsizei n, GLuint* arrays )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GenVertexArrays( n, arrays );
+  Record( GlCallTrace::GEN_VERTEX_ARRAYS, startTime, GlCallTrace::MakeArray( arrays, n ) );
+}
+
+GLboolean GlCallRecorder::IsVertexArray( GLuint array )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsVertexArray( array );
+  Record( GlCallTrace::IS_VERTEX_ARRAY, startTime, array );
+  return result;
+}
+
+void GlCallRecorder::GetIntegeri_v( GLenum target, GLuint index, GLint* data )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetIntegeri_v( target, index, data );
+  Record( GlCallTrace::GET_INTEGERI_V, startTime, target, index );
+}
+
+void GlCallRecorder::BeginTransformFeedback( GLenum primitiveMode )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BeginTransformFeedback( primitiveMode );
+  Record( GlCallTrace::BEGIN_TRANSFORM_FEEDBACK, startTime, primitiveMode );
+}
+
+void GlCallRecorder::EndTransformFeedback()
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::EndTransformFeedback();
+  Record( GlCallTrace::END_TRANSFORM_FEEDBACK, startTime );
+}
+
+void GlCallRecorder::BindBufferRange( GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BindBufferRange( target, index, buffer, offset, size );
+  Record( GlCallTrace::BIND_BUFFER_RANGE, startTime, target, index, buffer, static_cast<int64_t>( offset ), static_cast<int64_t>( size ) );
+}
+
+void GlCallRecorder::BindBufferBase( GLenum target, GLuint index, GLuint buffer )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BindBufferBase( target, index, buffer );
+  Record( GlCallTrace::BIND_BUFFER_BASE, startTime, target, index, buffer );
+}
+
+void GlCallRecorder::TransformFeedbackVaryings( GLuint program, GLsizei count, const GLchar* const* varyings, GLenum bufferMode )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TransformFeedbackVaryings( program, count, varyings, bufferMode );
+  Record( GlCallTrace::TRANSFORM_FEEDBACK_VARYINGS, startTime, program, GlCallTrace::StringList( varyings, count ), bufferMode );
+}
+
+void GlCallRecorder::GetTransformFeedbackVarying( GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLsizei* size, GLenum* type, GLchar* name )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetTransformFeedbackVarying( program, index, bufSize, length, size, type, name );
+  Record( GlCallTrace::GET_TRANSFORM_FEEDBACK_VARYING, startTime, program, index, bufSize );
+}
+
+void GlCallRecorder::VertexAttribIPointer( GLuint index, GLint size, GLenum type, GLsizei stride, const GLvoid* pointer )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttribIPointer( index, size, type, stride, pointer );
+  Record( GlCallTrace::VERTEX_ATTRIB_IPOINTER, startTime, index, size, type, stride, pointer );
+}
+
+void GlCallRecorder::GetVertexAttribIiv( GLuint index, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetVertexAttribIiv( index, pname, params );
+  Record( GlCallTrace::GET_VERTEX_ATTRIB_IIV, startTime, index, pname );
+}
+
+void GlCallRecorder::GetVertexAttribIuiv( GLuint index, GLenum pname, GLuint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetVertexAttribIuiv( index, pname, params );
+  Record( GlCallTrace::GET_VERTEX_ATTRIB_IUIV, startTime, index, pname );
+}
+
+void GlCallRecorder::VertexAttribI4i( GLuint index, GLint x, GLint y, GLint z, GLint w )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttribI4i( index, x, y, z, w );
+  Record( GlCallTrace::VERTEX_ATTRIB_I4I, startTime, index, x, y, z, w );
+}
+
+void GlCallRecorder::VertexAttribI4ui( GLuint index, GLuint x, GLuint y, GLuint z, GLuint w )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttribI4ui( index, x, y, z, w );
+  Record( GlCallTrace::VERTEX_ATTRIB_I4UI, startTime, index, x, y, z, w );
+}
+
+void GlCallRecorder::VertexAttribI4iv( GLuint index, const GLint* v )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttribI4iv( index, v );
+  Record( GlCallTrace::VERTEX_ATTRIB_I4IV, startTime, index, GlCallTrace::MakeArray( v, 4 ) );
+}
+
+void GlCallRecorder::VertexAttribI4uiv( GLuint index, const GLuint* v )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttribI4uiv( index, v );
+  Record( GlCallTrace::VERTEX_ATTRIB_I4UIV, startTime, index, GlCallTrace::MakeArray( v, 4 ) );
+}
+
+void GlCallRecorder::GetUniformuiv( GLuint program, GLint location, GLuint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetUniformuiv( program, location, params );
+  Record( GlCallTrace::GET_UNIFORMUIV, startTime, program, location );
+}
+
+GLint GlCallRecorder::GetFragDataLocation( GLuint program, const GLchar* name )
+{
+  const uint64_t startTime = GetTime();
+  const GLint result = GlImplementation::GetFragDataLocation( program, name );
+  Record( GlCallTrace::GET_FRAG_DATA_LOCATION, startTime, program, GlCallTrace::String( name ), result );
+  return result;
+}
+
+void GlCallRecorder::Uniform1ui( GLint location, GLuint v0 )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform1ui( location, v0 );
+  Record( GlCallTrace::UNIFORM1UI, startTime, location, v0 );
+}
+
+void GlCallRecorder::Uniform2ui( GLint location, GLuint v0, GLuint v1 )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform2ui( location, v0, v1 );
+  Record( GlCallTrace::UNIFORM2UI, startTime, location, v0, v1 );
+}
+
+void GlCallRecorder::Uniform3ui( GLint location, GLuint v0, GLuint v1, GLuint v2 )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform3ui( location, v0, v1, v2 );
+  Record( GlCallTrace::UNIFORM3UI, startTime, location, v0, v1, v2 );
+}
+
+void GlCallRecorder::Uniform4ui( GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3 )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform4ui( location, v0, v1, v2, v3 );
+  Record( GlCallTrace::UNIFORM4UI, startTime, location, v0, v1, v2, v3 );
+}
+
+void GlCallRecorder::Uniform1uiv( GLint location, GLsizei count, const GLuint* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform1uiv( location, count, value );
+  Record( GlCallTrace::UNIFORM1UIV, startTime, location, GlCallTrace::MakeArray( value, count ) );
+}
+
+void GlCallRecorder::Uniform2uiv( GLint location, GLsizei count, const GLuint* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform2uiv( location, count, value );
+  Record( GlCallTrace::UNIFORM2UIV, startTime, location, GlCallTrace::MakeArray( value, count * 2 ) );
+}
+
+void GlCallRecorder::Uniform3uiv( GLint location, GLsizei count, const GLuint* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform3uiv( location, count, value );
+  Record( GlCallTrace::UNIFORM3UIV, startTime, location, GlCallTrace::MakeArray( value, count * 3 ) );
+}
+
+void GlCallRecorder::Uniform4uiv( GLint location, GLsizei count, const GLuint* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::Uniform4uiv( location, count, value );
+  Record( GlCallTrace::UNIFORM4UIV, startTime, location, GlCallTrace::MakeArray( value, count * 4 ) );
+}
+
+void GlCallRecorder::ClearBufferiv( GLenum buffer, GLint drawbuffer, const GLint* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ClearBufferiv( buffer, drawbuffer, value );
+  Record( GlCallTrace::CLEAR_BUFFERIV, startTime, buffer, drawbuffer, GlCallTrace::MakeArray( value, ( buffer == GL_COLOR ) ? 4 : 1 ) );
+}
+
+void GlCallRecorder::ClearBufferuiv( GLenum buffer, GLint drawbuffer, const GLuint* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ClearBufferuiv( buffer, drawbuffer, value );
+  Record( GlCallTrace::CLEAR_BUFFERUIV, startTime, buffer, drawbuffer, GlCallTrace::MakeArray( value, ( buffer == GL_COLOR ) ? 4 : 1 ) );
+}
+
+void GlCallRecorder::ClearBufferfv( GLenum buffer, GLint drawbuffer, const GLfloat* value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ClearBufferfv( buffer, drawbuffer, value );
+  Record( GlCallTrace::CLEAR_BUFFERFV, startTime, buffer, drawbuffer, GlCallTrace::MakeArray( value, ( buffer == GL_COLOR ) ? 4 : 1 ) );
+}
+
+void GlCallRecorder::ClearBufferfi( GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ClearBufferfi( buffer, drawbuffer, depth, stencil );
+  Record( GlCallTrace::CLEAR_BUFFERFI, startTime, buffer, drawbuffer, depth, stencil );
+}
+
+const GLubyte* GlCallRecorder::GetStringi( GLenum name, GLuint index )
+{
+  const uint64_t startTime = GetTime();
+  const GLubyte* result = GlImplementation::GetStringi( name, index );
+  Record( GlCallTrace::GET_STRINGI, startTime, name, index );
+  return result;
+}
+
+void GlCallRecorder::CopyBufferSubData( GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::CopyBufferSubData( readTarget, writeTarget, readOffset, writeOffset, size );
+  Record( GlCallTrace::COPY_BUFFER_SUB_DATA, startTime, readTarget, writeTarget, static_cast<int64_t>( readOffset ), static_cast<int64_t>( writeOffset ), static_cast<int64_t>( size ) );
+}
+
+void GlCallRecorder::GetUniformIndices( GLuint program, GLsizei uniformCount, const GLchar* const* uniformNames, GLuint* uniformIndices )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetUniformIndices( program, uniformCount, uniformNames, uniformIndices );
+  Record( GlCallTrace::GET_UNIFORM_INDICES, startTime, program, GlCallTrace::StringList( uniformNames, uniformCount ) );
+}
+
+void GlCallRecorder::GetActiveUniformsiv( GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetActiveUniformsiv( program, uniformCount, uniformIndices, pname, params );
+  Record( GlCallTrace::GET_ACTIVE_UNIFORMSIV, startTime, program, GlCallTrace::MakeArray( uniformIndices, uniformCount ), pname );
+}
+
+GLuint GlCallRecorder::GetUniformBlockIndex( GLuint program, const GLchar* uniformBlockName )
+{
+  const uint64_t startTime = GetTime();
+  const GLuint result = GlImplementation::GetUniformBlockIndex( program, uniformBlockName );
+  Record( GlCallTrace::GET_UNIFORM_BLOCK_INDEX, startTime, program, GlCallTrace::String( uniformBlockName ), result );
+  return result;
+}
+
+void GlCallRecorder::GetActiveUniformBlockiv( GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetActiveUniformBlockiv( program, uniformBlockIndex, pname, params );
+  Record( GlCallTrace::GET_ACTIVE_UNIFORM_BLOCKIV, startTime, program, uniformBlockIndex, pname );
+}
+
+void GlCallRecorder::GetActiveUniformBlockName( GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetActiveUniformBlockName( program, uniformBlockIndex, bufSize, length, uniformBlockName );
+  Record( GlCallTrace::GET_ACTIVE_UNIFORM_BLOCK_NAME, startTime, program, uniformBlockIndex, bufSize );
+}
+
+void GlCallRecorder::UniformBlockBinding( GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::UniformBlockBinding( program, uniformBlockIndex, uniformBlockBinding );
+  Record( GlCallTrace::UNIFORM_BLOCK_BINDING, startTime, program, uniformBlockIndex, uniformBlockBinding );
+}
+
+void GlCallRecorder::DrawArraysInstanced( GLenum mode, GLint first, GLsizei count, GLsizei instanceCount )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DrawArraysInstanced( mode, first, count, instanceCount );
+  Record( GlCallTrace::DRAW_ARRAYS_INSTANCED, startTime, mode, first, count, instanceCount );
+}
+
+void GlCallRecorder::DrawElementsInstanced( GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLsizei instanceCount )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DrawElementsInstanced( mode, count, type, indices, instanceCount );
+  Record( GlCallTrace::DRAW_ELEMENTS_INSTANCED, startTime, mode, count, type, indices, instanceCount );
+}
+
+GLsync GlCallRecorder::FenceSync( GLenum condition, GLbitfield flags )
+{
+  const uint64_t startTime = GetTime();
+  const GLsync result = GlImplementation::FenceSync( condition, flags );
+  Record( GlCallTrace::FENCE_SYNC, startTime, condition, flags, result );
+  return result;
+}
+
+GLboolean GlCallRecorder::IsSync( GLsync sync )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsSync( sync );
+  Record( GlCallTrace::IS_SYNC, startTime, sync );
+  return result;
+}
+
+void GlCallRecorder::DeleteSync( GLsync sync )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteSync( sync );
+  Record( GlCallTrace::DELETE_SYNC, startTime, sync );
+}
+
+GLenum GlCallRecorder::ClientWaitSync( GLsync sync, GLbitfield flags, GLuint64 timeout )
+{
+  const uint64_t startTime = GetTime();
+  const GLenum result = GlImplementation::ClientWaitSync( sync, flags, timeout );
+  Record( GlCallTrace::CLIENT_WAIT_SYNC, startTime, sync, flags, timeout );
+  return result;
+}
+
+void GlCallRecorder::WaitSync( GLsync sync, GLbitfield flags, GLuint64 timeout )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::WaitSync( sync, flags, timeout );
+  Record( GlCallTrace::WAIT_SYNC, startTime, sync, flags, timeout );
+}
+
+void GlCallRecorder::GetInteger64v( GLenum pname, GLint64* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetInteger64v( pname, params );
+  Record( GlCallTrace::GET_INTEGER64V, startTime, pname );
+}
+
+void GlCallRecorder::GetSynciv( GLsync sync, GLenum pname, GLsizei bufSize, GLsizei* length, GLint* values )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetSynciv( sync, pname, bufSize, length, values );
+  Record( GlCallTrace::GET_SYNCIV, startTime, sync, pname, bufSize );
+}
+
+void GlCallRecorder::GetInteger64i_v( GLenum target, GLuint index, GLint64* data )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetInteger64i_v( target, index, data );
+  Record( GlCallTrace::GET_INTEGER64I_V, startTime, target, index );
+}
+
+void GlCallRecorder::GetBufferParameteri64v( GLenum target, GLenum pname, GLint64* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetBufferParameteri64v( target, pname, params );
+  Record( GlCallTrace::GET_BUFFER_PARAMETERI64V, startTime, target, pname );
+}
+
+void GlCallRecorder::GenSamplers( GLsizei count, GLuint* samplers )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GenSamplers( count, samplers );
+  Record( GlCallTrace::GEN_SAMPLERS, startTime, GlCallTrace::MakeArray( samplers, count ) );
+}
+
+void GlCallRecorder::DeleteSamplers( GLsizei count, const GLuint* samplers )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteSamplers( count, samplers );
+  Record( GlCallTrace::DELETE_SAMPLERS, startTime, GlCallTrace::MakeArray( samplers, count ) );
+}
+
+GLboolean GlCallRecorder::IsSampler( GLuint sampler )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsSampler( sampler );
+  Record( GlCallTrace::IS_SAMPLER, startTime, sampler );
+  return result;
+}
+
+void GlCallRecorder::BindSampler( GLuint unit, GLuint sampler )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BindSampler( unit, sampler );
+  Record( GlCallTrace::BIND_SAMPLER, startTime, unit, sampler );
+}
+
+void GlCallRecorder::SamplerParameteri( GLuint sampler, GLenum pname, GLint param )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::SamplerParameteri( sampler, pname, param );
+  Record( GlCallTrace::SAMPLER_PARAMETERI, startTime, sampler, pname, param );
+}
+
+void GlCallRecorder::SamplerParameteriv( GLuint sampler, GLenum pname, const GLint* param )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::SamplerParameteriv( sampler, pname, param );
+  Record( GlCallTrace::SAMPLER_PARAMETERIV, startTime, sampler, pname, GlCallTrace::MakeArray( param, 1 ) );
+}
+
+void GlCallRecorder::SamplerParameterf( GLuint sampler, GLenum pname, GLfloat param )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::SamplerParameterf( sampler, pname, param );
+  Record( GlCallTrace::SAMPLER_PARAMETERF, startTime, sampler, pname, param );
+}
+
+void GlCallRecorder::SamplerParameterfv( GLuint sampler, GLenum pname, const GLfloat* param )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::SamplerParameterfv( sampler, pname, param );
+  Record( GlCallTrace::SAMPLER_PARAMETERFV, startTime, sampler, pname, GlCallTrace::MakeArray( param, 1 ) );
+}
+
+void GlCallRecorder::GetSamplerParameteriv( GLuint sampler, GLenum pname, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetSamplerParameteriv( sampler, pname, params );
+  Record( GlCallTrace::GET_SAMPLER_PARAMETERIV, startTime, sampler, pname );
+}
+
+void GlCallRecorder::GetSamplerParameterfv( GLuint sampler, GLenum pname, GLfloat* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetSamplerParameterfv( sampler, pname, params );
+  Record( GlCallTrace::GET_SAMPLER_PARAMETERFV, startTime, sampler, pname );
+}
+
+void GlCallRecorder::VertexAttribDivisor( GLuint index, GLuint divisor )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::VertexAttribDivisor( index, divisor );
+  Record( GlCallTrace::VERTEX_ATTRIB_DIVISOR, startTime, index, divisor );
+}
+
+void GlCallRecorder::BindTransformFeedback( GLenum target, GLuint id )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::BindTransformFeedback( target, id );
+  Record( GlCallTrace::BIND_TRANSFORM_FEEDBACK, startTime, target, id );
+}
+
+void GlCallRecorder::DeleteTransformFeedbacks( GLsizei n, const GLuint* ids )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::DeleteTransformFeedbacks( n, ids );
+  Record( GlCallTrace::DELETE_TRANSFORM_FEEDBACKS, startTime, GlCallTrace::MakeArray( ids, n ) );
+}
+
+void GlCallRecorder::GenTransformFeedbacks( GLsizei n, GLuint* ids )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GenTransformFeedbacks( n, ids );
+  Record( GlCallTrace::GEN_TRANSFORM_FEEDBACKS, startTime, GlCallTrace::MakeArray( ids, n ) );
+}
+
+GLboolean GlCallRecorder::IsTransformFeedback( GLuint id )
+{
+  const uint64_t startTime = GetTime();
+  const GLboolean result = GlImplementation::IsTransformFeedback( id );
+  Record( GlCallTrace::IS_TRANSFORM_FEEDBACK, startTime, id );
+  return result;
+}
+
+void GlCallRecorder::PauseTransformFeedback()
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::PauseTransformFeedback();
+  Record( GlCallTrace::PAUSE_TRANSFORM_FEEDBACK, startTime );
+}
+
+void GlCallRecorder::ResumeTransformFeedback()
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ResumeTransformFeedback();
+  Record( GlCallTrace::RESUME_TRANSFORM_FEEDBACK, startTime );
+}
+
+void GlCallRecorder::GetProgramBinary( GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, GLvoid* binary )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetProgramBinary( program, bufSize, length, binaryFormat, binary );
+  Record( GlCallTrace::GET_PROGRAM_BINARY, startTime, program, bufSize );
+}
+
+void GlCallRecorder::ProgramBinary( GLuint program, GLenum binaryFormat, const GLvoid* binary, GLsizei length )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ProgramBinary( program, binaryFormat, binary, length );
+  Record( GlCallTrace::PROGRAM_BINARY, startTime, program, binaryFormat, binary, length );
+}
+
+void GlCallRecorder::ProgramParameteri( GLuint program, GLenum pname, GLint value )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::ProgramParameteri( program, pname, value );
+  Record( GlCallTrace::PROGRAM_PARAMETERI, startTime, program, pname, value );
+}
+
+void GlCallRecorder::InvalidateFramebuffer( GLenum target, GLsizei numAttachments, const GLenum* attachments )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::InvalidateFramebuffer( target, numAttachments, attachments );
+  Record( GlCallTrace::INVALIDATE_FRAMEBUFFER, startTime, target, GlCallTrace::MakeArray( attachments, numAttachments ) );
+}
+
+void GlCallRecorder::InvalidateSubFramebuffer( GLenum target, GLsizei numAttachments, const GLenum* attachments, GLint x, GLint y, GLsizei width, GLsizei height )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::InvalidateSubFramebuffer( target, numAttachments, attachments, x, y, width, height );
+  Record( GlCallTrace::INVALIDATE_SUB_FRAMEBUFFER, startTime, target, GlCallTrace::MakeArray( attachments, numAttachments ), x, y, width, height );
+}
+
+void GlCallRecorder::TexStorage2D( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TexStorage2D( target, levels, internalformat, width, height );
+  Record( GlCallTrace::TEX_STORAGE2D, startTime, target, levels, internalformat, width, height );
+}
+
+void GlCallRecorder::TexStorage3D( GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::TexStorage3D( target, levels, internalformat, width, height, depth );
+  Record( GlCallTrace::TEX_STORAGE3D, startTime, target, levels, internalformat, width, height, depth );
+}
+
+void GlCallRecorder::GetInternalformativ( GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint* params )
+{
+  const uint64_t startTime = GetTime();
+  GlImplementation::GetInternalformativ( target, internalformat, pname, bufSize, params );
+  Record( GlCallTrace::GET_INTERNALFORMATIV, startTime, target, internalformat, pname, bufSize );
+}
+
+uint64_t GlCallRecorder::GetTime() const
+{
+  uint64_t time;
+  TimeService::GetNanoseconds( time );
+  return time;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/graphics/gles/gl-call-trace-reader.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+GlCallTraceReader::GlCallTraceReader( const std::string& traceFile )
+: mFile( fopen( traceFile.c_str(), "rb" ) )
+{
+  if( mFile )
+  {
+    GlCallTrace::FileHeader header;
+    if( ( fread( &header, sizeof( header ), 1u, mFile ) != 1u ) ||
+        ( memcmp( header.identifier, GlCallTrace::FILE_IDENTIFIER, sizeof( GlCallTrace::FILE_IDENTIFIER ) ) != 0 ) ||
+        ( header.version != GlCallTrace::FILE_VERSION ) )
+    {
+      fclose( mFile );
+      mFile = NULL;
+    }
+  }
+}
+
+GlCallTraceReader::~GlCallTraceReader()
+{
+  if( mFile )
+  {
+    fclose( mFile );
+  }
+}
+
+bool GlCallTraceReader::IsValid() const
+{
+  return mFile != NULL;
+}
+
+bool GlCallTraceReader::ReadRecord( GlCallTrace::RecordHeader& header, std::vector< uint8_t >& arguments )
+{
+  if( !mFile || ( fread( &header, sizeof( header ), 1u, mFile ) != 1u ) )
+  {
+    return false;
+  }
+
+  arguments.resize( header.size );
+  return ( header.size == 0u ) || ( fread( arguments.data(), header.size, 1u, mFile ) == 1u );
+}
+
+GlCallTraceArguments::GlCallTraceArguments( const std::vector< uint8_t >& bytes )
+: mBytes( bytes ),
+  mOffset( 0u )
+{
+}
+
+std::string GlCallTraceArguments::ReadString()
+{
+  std::vector< char > characters;
+  ReadArray( characters );
+  return std::string( characters.begin(), characters.end() );
+}
+
+std::size_t GlCallTraceArguments::GetRemainingSize() const
+{
+  return ( mOffset < mBytes.size() ) ? mBytes.size() - mOffset : 0u;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
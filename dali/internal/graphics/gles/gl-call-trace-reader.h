@@ -0,0 +1,154 @@
+#ifndef DALI_INTERNAL_GL_CALL_TRACE_READER_H
+#define DALI_INTERNAL_GL_CALL_TRACE_READER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/graphics/gles/gl-call-trace.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+/**
+ * Reads the records of a trace of GLES calls written by the GlCallTraceWriter.
+ *
+ * Only depends on the format, so the offline tools can be built without the adaptor.
+ */
+class GlCallTraceReader
+{
+public:
+
+  /**
+   * Constructor, reads the file header.
+   * @param[in] traceFile The trace
+   */
+  GlCallTraceReader( const std::string& traceFile );
+
+  /**
+   * Destructor
+   */
+  ~GlCallTraceReader();
+
+  /**
+   * @return Whether the file was opened and is a trace of the current version
+   */
+  bool IsValid() const;
+
+  /**
+   * Reads the next record.
+   * The end of a trace which is still being written, i.e. a partial record, is ignored.
+   * @param[out] header The header of the record
+   * @param[out] arguments The arguments of the record
+   * @return Whether a record was read
+   */
+  bool ReadRecord( GlCallTrace::RecordHeader& header, std::vector< uint8_t >& arguments );
+
+private:
+
+  // Undefined copy constructor.
+  GlCallTraceReader( const GlCallTraceReader& );
+
+  // Undefined assignment operator.
+  GlCallTraceReader& operator=( const GlCallTraceReader& );
+
+private: // Data
+
+  FILE* mFile;        ///< The trace, NULL if it's not valid
+};
+
+/**
+ * Reads the arguments of a record, in the order they were written.
+ * Reading past the end of the arguments gives zeros.
+ */
+class GlCallTraceArguments
+{
+public:
+
+  /**
+   * Constructor
+   * @param[in] bytes The arguments of the record, must outlive this object
+   */
+  GlCallTraceArguments( const std::vector< uint8_t >& bytes );
+
+  /**
+   * @return The next scalar argument
+   */
+  template< typename T >
+  T Read()
+  {
+    T value = T();
+    if( mOffset + sizeof( T ) <= mBytes.size() )
+    {
+      memcpy( &value, &mBytes[mOffset], sizeof( T ) );
+    }
+    mOffset += sizeof( T );
+    return value;
+  }
+
+  /**
+   * Reads the next array argument.
+   * @param[out] values The elements stored in the record
+   * @return The number of elements passed to the call
+   */
+  template< typename T >
+  uint32_t ReadArray( std::vector< T >& values )
+  {
+    const uint32_t count = Read< uint32_t >();
+    const uint32_t stored = Read< uint32_t >();
+    values.resize( std::min< std::size_t >( stored, GetRemainingSize() / sizeof( T ) ) );
+    for( auto& value : values )
+    {
+      value = Read< T >();
+    }
+    return count;
+  }
+
+  /**
+   * @return The part of the next string argument stored in the record
+   */
+  std::string ReadString();
+
+  /**
+   * @return The number of bytes not read yet
+   */
+  std::size_t GetRemainingSize() const;
+
+private: // Data
+
+  const std::vector< uint8_t >& mBytes;   ///< The arguments
+  std::size_t mOffset;                    ///< The offset of the next argument
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_GL_CALL_TRACE_READER_H
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/graphics/gles/gl-call-trace-writer.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+namespace
+{
+const uint32_t TRAILING_ARGUMENTS_SIZE = 64u;       ///< The space kept in a record for the scalars after its arrays.
+}
+
+GlCallTraceWriter::GlCallTraceWriter( const std::string& traceFile )
+: mFile( fopen( traceFile.c_str(), "wb" ) ),
+  mFrame(),
+  mRecord( 0u )
+{
+  if( mFile )
+  {
+    GlCallTrace::FileHeader header;
+    memset( &header, 0, sizeof( header ) );
+    memcpy( header.identifier, GlCallTrace::FILE_IDENTIFIER, sizeof( GlCallTrace::FILE_IDENTIFIER ) );
+    header.version = GlCallTrace::FILE_VERSION;
+
+    if( fwrite( &header, sizeof( header ), 1u, mFile ) != 1u )
+    {
+      fclose( mFile );
+      mFile = NULL;
+    }
+  }
+
+  if( mFile )
+  {
+    mFrame.reserve( FLUSH_SIZE + GlCallTrace::MAXIMUM_RECORD_SIZE + sizeof( GlCallTrace::RecordHeader ) );
+  }
+  else
+  {
+    DALI_LOG_ERROR( "Cannot record the GLES calls to %s\n", traceFile.c_str() );
+  }
+}
+
+GlCallTraceWriter::~GlCallTraceWriter()
+{
+  WriteFrame();
+
+  if( mFile )
+  {
+    fclose( mFile );
+  }
+}
+
+bool GlCallTraceWriter::IsOpen() const
+{
+  return mFile != NULL;
+}
+
+void GlCallTraceWriter::WriteArguments()
+{
+}
+
+void GlCallTraceWriter::Write( uint8_t value )
+{
+  WriteBytes( &value, sizeof( value ) );
+}
+
+void GlCallTraceWriter::Write( int32_t value )
+{
+  WriteBytes( &value, sizeof( value ) );
+}
+
+void GlCallTraceWriter::Write( uint32_t value )
+{
+  WriteBytes( &value, sizeof( value ) );
+}
+
+void GlCallTraceWriter::Write( int64_t value )
+{
+  WriteBytes( &value, sizeof( value ) );
+}
+
+void GlCallTraceWriter::Write( uint64_t value )
+{
+  WriteBytes( &value, sizeof( value ) );
+}
+
+void GlCallTraceWriter::Write( float value )
+{
+  WriteBytes( &value, sizeof( value ) );
+}
+
+void GlCallTraceWriter::Write( const void* pointer )
+{
+  Write( static_cast< uint64_t >( reinterpret_cast< uintptr_t >( pointer ) ) );
+}
+
+void GlCallTraceWriter::Write( const GlCallTrace::String& string )
+{
+  WriteString( string, 0u );
+}
+
+void GlCallTraceWriter::Write( const GlCallTrace::StringList& strings )
+{
+  const uint32_t countsSize = 2u * sizeof( uint32_t );
+  const uint32_t stored = std::min( strings.count, GetAvailableSize( 0u ) / countsSize );
+  Write( strings.count );
+  Write( stored );
+
+  for( uint32_t index = 0u; index < stored; ++index )
+  {
+    // Keeps the space for the counts of the next strings.
+    const GlCallTrace::String string( strings.strings[index], strings.lengths ? strings.lengths[index] : -1 );
+    WriteString( string, ( stored - index - 1u ) * countsSize );
+  }
+}
+
+void GlCallTraceWriter::WriteString( const GlCallTrace::String& string, uint32_t reserved )
+{
+  const uint32_t stored = std::min( string.length, GetAvailableSize( reserved ) );
+  Write( string.length );
+  Write( stored );
+  WriteBytes( string.text, stored );
+}
+
+void GlCallTraceWriter::WriteBytes( const void* bytes, std::size_t size )
+{
+  const uint8_t* begin = static_cast< const uint8_t* >( bytes );
+  mFrame.insert( mFrame.end(), begin, begin + size );
+}
+
+uint32_t GlCallTraceWriter::GetAvailableSize( uint32_t reserved ) const
+{
+  // The counts of the array or string being written are part of the record already.
+  const std::size_t used = mFrame.size() - mRecord - sizeof( GlCallTrace::RecordHeader ) + 2u * sizeof( uint32_t ) + reserved;
+  const std::size_t maximum = GlCallTrace::MAXIMUM_RECORD_SIZE - TRAILING_ARGUMENTS_SIZE;
+  return ( used < maximum ) ? static_cast< uint32_t >( maximum - used ) : 0u;
+}
+
+void GlCallTraceWriter::WriteFrame()
+{
+  if( mFile && !mFrame.empty() )
+  {
+    if( ( fwrite( mFrame.data(), 1u, mFrame.size(), mFile ) != mFrame.size() ) || ( fflush( mFile ) != 0 ) )
+    {
+      DALI_LOG_ERROR( "Cannot write the GLES calls, recording stopped\n" );
+      fclose( mFile );
+      mFile = NULL;
+    }
+  }
+  mFrame.clear();
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
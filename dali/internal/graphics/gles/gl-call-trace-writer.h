@@ -0,0 +1,182 @@
+#ifndef DALI_INTERNAL_GL_CALL_TRACE_WRITER_H
+#define DALI_INTERNAL_GL_CALL_TRACE_WRITER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/graphics/gles/gl-call-trace.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+/**
+ * Writes the records of a trace of GLES calls, see GlCallTrace for the format.
+ *
+ * The records are kept in memory until WriteFrame() is called, or they take FLUSH_SIZE bytes.
+ * If the file can't be written, the records are dropped.
+ */
+class GlCallTraceWriter
+{
+public:
+
+  static const std::size_t FLUSH_SIZE = 1024u * 1024u;   ///< The records are written once they take this size, e.g. when there's no frame yet.
+
+  /**
+   * Constructor, writes the file header.
+   * @param[in] traceFile The file to write the trace to. It's replaced if it exists.
+   */
+  GlCallTraceWriter( const std::string& traceFile );
+
+  /**
+   * Destructor, writes the records left.
+   */
+  ~GlCallTraceWriter();
+
+  /**
+   * @return Whether the trace is being written
+   */
+  bool IsOpen() const;
+
+  /**
+   * Adds a record of a call.
+   * @param[in] call The call
+   * @param[in] duration The time spent in the call, in nanoseconds
+   * @param[in] arguments The arguments to record
+   */
+  template< typename... Arguments >
+  void Record( GlCallTrace::Call call, uint64_t duration, const Arguments&... arguments );
+
+  /**
+   * Writes the records to the file.
+   */
+  void WriteFrame();
+
+private: // Helpers
+
+  void WriteArguments();
+
+  template< typename Argument, typename... Arguments >
+  void WriteArguments( const Argument& argument, const Arguments&... arguments );
+
+  void Write( uint8_t value );
+  void Write( int32_t value );
+  void Write( uint32_t value );
+  void Write( int64_t value );
+  void Write( uint64_t value );
+  void Write( float value );
+  void Write( const void* pointer );
+  void Write( const GlCallTrace::String& string );
+  void Write( const GlCallTrace::StringList& strings );
+
+  template< typename T >
+  void Write( const GlCallTrace::Array< T >& array );
+
+  /**
+   * Writes as much of a string as fits in the current record.
+   * @param[in] string The string
+   * @param[in] reserved The space to keep for the arguments written after it
+   */
+  void WriteString( const GlCallTrace::String& string, uint32_t reserved );
+
+  /**
+   * Appends bytes to the current record.
+   * @param[in] bytes The bytes
+   * @param[in] size The number of bytes
+   */
+  void WriteBytes( const void* bytes, std::size_t size );
+
+  /**
+   * @param[in] reserved The space to keep for the arguments written after the array or string
+   * @return The space left in the current record for the elements of an array or string, after their counts
+   */
+  uint32_t GetAvailableSize( uint32_t reserved ) const;
+
+  // Undefined copy constructor.
+  GlCallTraceWriter( const GlCallTraceWriter& );
+
+  // Undefined assignment operator.
+  GlCallTraceWriter& operator=( const GlCallTraceWriter& );
+
+private: // Data
+
+  FILE* mFile;                       ///< The trace, NULL if it can't be written
+  std::vector< uint8_t > mFrame;     ///< The records not written yet
+  std::size_t mRecord;               ///< The offset of the current record in mFrame
+};
+
+template< typename... Arguments >
+void GlCallTraceWriter::Record( GlCallTrace::Call call, uint64_t duration, const Arguments&... arguments )
+{
+  if( !mFile )
+  {
+    return;
+  }
+
+  GlCallTrace::RecordHeader header;
+  header.call = static_cast< uint16_t >( call );
+  header.size = 0u;
+  header.duration = static_cast< uint32_t >( std::min< uint64_t >( duration, UINT32_MAX ) );
+
+  mRecord = mFrame.size();
+  WriteBytes( &header, sizeof( header ) );
+  WriteArguments( arguments... );
+
+  // The arguments always fit, as the arrays and strings are only stored partially otherwise.
+  header.size = static_cast< uint16_t >( mFrame.size() - mRecord - sizeof( header ) );
+  memcpy( &mFrame[mRecord], &header, sizeof( header ) );
+
+  if( mFrame.size() >= FLUSH_SIZE )
+  {
+    WriteFrame();
+  }
+}
+
+template< typename Argument, typename... Arguments >
+void GlCallTraceWriter::WriteArguments( const Argument& argument, const Arguments&... arguments )
+{
+  Write( argument );
+  WriteArguments( arguments... );
+}
+
+template< typename T >
+void GlCallTraceWriter::Write( const GlCallTrace::Array< T >& array )
+{
+  const uint32_t stored = std::min( array.count, GetAvailableSize( 0u ) / static_cast< uint32_t >( sizeof( T ) ) );
+  Write( array.count );
+  Write( stored );
+  WriteBytes( array.values, stored * sizeof( T ) );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_GL_CALL_TRACE_WRITER_H
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/graphics/gles/gl-call-trace.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace GlCallTrace
+{
+
+namespace
+{
+
+const char* const CALL_NAMES[] =
+{
+  "PreRender",
+  "PostRender",
+
+  "ActiveTexture",
+  "AttachShader",
+  "BindAttribLocation",
+  "BindBuffer",
+  "BindFramebuffer",
+  "BindRenderbuffer",
+  "BindTexture",
+  "BlendColor",
+  "BlendEquation",
+  "BlendEquationSeparate",
+  "BlendFunc",
+  "BlendFuncSeparate",
+  "BufferData",
+  "BufferSubData",
+  "CheckFramebufferStatus",
+  "Clear",
+  "ClearColor",
+  "ClearDepthf",
+  "ClearStencil",
+  "ColorMask",
+  "CompileShader",
+  "CompressedTexImage2D",
+  "CompressedTexSubImage2D",
+  "CopyTexImage2D",
+  "CopyTexSubImage2D",
+  "CreateProgram",
+  "CreateShader",
+  "CullFace",
+  "DeleteBuffers",
+  "DeleteFramebuffers",
+  "DeleteProgram",
+  "DeleteRenderbuffers",
+  "DeleteShader",
+  "DeleteTextures",
+  "DepthFunc",
+  "DepthMask",
+  "DepthRangef",
+  "DetachShader",
+  "Disable",
+  "DisableVertexAttribArray",
+  "DrawArrays",
+  "DrawElements",
+  "Enable",
+  "EnableVertexAttribArray",
+  "Finish",
+  "Flush",
+  "FramebufferRenderbuffer",
+  "FramebufferTexture2D",
+  "FrontFace",
+  "GenBuffers",
+  "GenerateMipmap",
+  "GenFramebuffers",
+  "GenRenderbuffers",
+  "GenTextures",
+  "GetActiveAttrib",
+  "GetActiveUniform",
+  "GetAttachedShaders",
+  "GetAttribLocation",
+  "GetBooleanv",
+  "GetBufferParameteriv",
+  "GetError",
+  "GetFloatv",
+  "GetFramebufferAttachmentParameteriv",
+  "GetIntegerv",
+  "GetProgramiv",
+  "GetProgramInfoLog",
+  "GetRenderbufferParameteriv",
+  "GetShaderiv",
+  "GetShaderInfoLog",
+  "GetShaderPrecisionFormat",
+  "GetShaderSource",
+  "GetString",
+  "GetTexParameterfv",
+  "GetTexParameteriv",
+  "GetUniformfv",
+  "GetUniformiv",
+  "GetUniformLocation",
+  "GetVertexAttribfv",
+  "GetVertexAttribiv",
+  "GetVertexAttribPointerv",
+  "Hint",
+  "IsBuffer",
+  "IsEnabled",
+  "IsFramebuffer",
+  "IsProgram",
+  "IsRenderbuffer",
+  "IsShader",
+  "IsTexture",
+  "LineWidth",
+  "LinkProgram",
+  "PixelStorei",
+  "PolygonOffset",
+  "ReadPixels",
+  "ReleaseShaderCompiler",
+  "RenderbufferStorage",
+  "SampleCoverage",
+  "Scissor",
+  "ShaderBinary",
+  "ShaderSource",
+  "StencilFunc",
+  "StencilFuncSeparate",
+  "StencilMask",
+  "StencilMaskSeparate",
+  "StencilOp",
+  "StencilOpSeparate",
+  "TexImage2D",
+  "TexParameterf",
+  "TexParameterfv",
+  "TexParameteri",
+  "TexParameteriv",
+  "TexSubImage2D",
+  "Uniform1f",
+  "Uniform1fv",
+  "Uniform1i",
+  "Uniform1iv",
+  "Uniform2f",
+  "Uniform2fv",
+  "Uniform2i",
+  "Uniform2iv",
+  "Uniform3f",
+  "Uniform3fv",
+  "Uniform3i",
+  "Uniform3iv",
+  "Uniform4f",
+  "Uniform4fv",
+  "Uniform4i",
+  "Uniform4iv",
+  "UniformMatrix2fv",
+  "UniformMatrix3fv",
+  "UniformMatrix4fv",
+  "UseProgram",
+  "ValidateProgram",
+  "VertexAttrib1f",
+  "VertexAttrib1fv",
+  "VertexAttrib2f",
+  "VertexAttrib2fv",
+  "VertexAttrib3f",
+  "VertexAttrib3fv",
+  "VertexAttrib4f",
+  "VertexAttrib4fv",
+  "VertexAttribPointer",
+  "Viewport",
+  "ReadBuffer",
+  "DrawRangeElements",
+  "TexImage3D",
+  "TexSubImage3D",
+  "CopyTexSubImage3D",
+  "CompressedTexImage3D",
+  "CompressedTexSubImage3D",
+  "GenQueries",
+  "DeleteQueries",
+  "IsQuery",
+  "BeginQuery",
+  "EndQuery",
+  "GetQueryiv",
+  "GetQueryObjectuiv",
+  "UnmapBuffer",
+  "GetBufferPointerv",
+  "DrawBuffers",
+  "UniformMatrix2x3fv",
+  "UniformMatrix3x2fv",
+  "UniformMatrix2x4fv",
+  "UniformMatrix4x2fv",
+  "UniformMatrix3x4fv",
+  "UniformMatrix4x3fv",
+  "BlitFramebuffer",
+  "RenderbufferStorageMultisample",
+  "FramebufferTextureLayer",
+  "MapBufferRange",
+  "FlushMappedBufferRange",
+  "BindVertexArray",
+  "DeleteVertexArrays",
+  "GenVertexArrays",
+  "IsVertexArray",
+  "GetIntegeri_v",
+  "BeginTransformFeedback",
+  "EndTransformFeedback",
+  "BindBufferRange",
+  "BindBufferBase",
+  "TransformFeedbackVaryings",
+  "GetTransformFeedbackVarying",
+  "VertexAttribIPointer",
+  "GetVertexAttribIiv",
+  "GetVertexAttribIuiv",
+  "VertexAttribI4i",
+  "VertexAttribI4ui",
+  "VertexAttribI4iv",
+  "VertexAttribI4uiv",
+  "GetUniformuiv",
+  "GetFragDataLocation",
+  "Uniform1ui",
+  "Uniform2ui",
+  "Uniform3ui",
+  "Uniform4ui",
+  "Uniform1uiv",
+  "Uniform2uiv",
+  "Uniform3uiv",
+  "Uniform4uiv",
+  "ClearBufferiv",
+  "ClearBufferuiv",
+  "ClearBufferfv",
+  "ClearBufferfi",
+  "GetStringi",
+  "CopyBufferSubData",
+  "GetUniformIndices",
+  "GetActiveUniformsiv",
+  "GetUniformBlockIndex",
+  "GetActiveUniformBlockiv",
+  "GetActiveUniformBlockName",
+  "UniformBlockBinding",
+  "DrawArraysInstanced",
+  "DrawElementsInstanced",
+  "FenceSync",
+  "IsSync",
+  "DeleteSync",
+  "ClientWaitSync",
+  "WaitSync",
+  "GetInteger64v",
+  "GetSynciv",
+  "GetInteger64i_v",
+  "GetBufferParameteri64v",
+  "GenSamplers",
+  "DeleteSamplers",
+  "IsSampler",
+  "BindSampler",
+  "SamplerParameteri",
+  "SamplerParameteriv",
+  "SamplerParameterf",
+  "SamplerParameterfv",
+  "GetSamplerParameteriv",
+  "GetSamplerParameterfv",
+  "VertexAttribDivisor",
+  "BindTransformFeedback",
+  "DeleteTransformFeedbacks",
+  "GenTransformFeedbacks",
+  "IsTransformFeedback",
+  "PauseTransformFeedback",
+  "ResumeTransformFeedback",
+  "GetProgramBinary",
+  "ProgramBinary",
+  "ProgramParameteri",
+  "InvalidateFramebuffer",
+  "InvalidateSubFramebuffer",
+  "TexStorage2D",
+  "TexStorage3D",
+  "GetInternalformativ",
+};
+
+static_assert( sizeof( CALL_NAMES ) / sizeof( CALL_NAMES[0] ) == NUMBER_OF_CALLS, "A call has no name" );
+
+} // unnamed namespace
+
+String::String( const char* text, int length )
+: text( text ),
+  length( text ? static_cast< uint32_t >( length < 0 ? strlen( text ) : length ) : 0u )
+{
+}
+
+StringList::StringList( const char* const* strings, int count, const int* lengths )
+: strings( strings ),
+  count( strings ? static_cast< uint32_t >( count > 0 ? count : 0 ) : 0u ),
+  lengths( lengths )
+{
+}
+
+const char* GetCallName( Call call )
+{
+  return ( call < NUMBER_OF_CALLS ) ? CALL_NAMES[call] : "Unknown";
+}
+
+} // namespace GlCallTrace
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
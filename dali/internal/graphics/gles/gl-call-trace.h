@@ -0,0 +1,398 @@
+#ifndef DALI_INTERNAL_GL_CALL_TRACE_H
+#define DALI_INTERNAL_GL_CALL_TRACE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * The format of the traces of GLES calls written by the GlCallRecorder.
+ *
+ * A trace is a FileHeader followed by one record per call. A record is a RecordHeader followed by the
+ * arguments of the call, in the order of its parameters, then its results (the generated names, the
+ * created object or the location). The arguments are written in the byte order of the device:
+ * - The scalars with their own size, the booleans on a byte and the sizes and offsets on 64 bits.
+ * - The pointers to data the call doesn't read, e.g. pixels and offsets in buffers, as their 64 bit address.
+ * - The arrays as their number of elements and the number of elements stored, then the stored elements.
+ *   Only the elements which fit in the record are stored, e.g. the names and the uniform values.
+ * - The strings as arrays of characters, without the terminating null character.
+ * - The lists of strings as their number of strings followed by the strings.
+ *
+ * The calls of each frame are between a FRAME_BEGIN and a FRAME_END record, which hold the time they're made at.
+ */
+namespace GlCallTrace
+{
+
+const char FILE_IDENTIFIER[] = "DALIGLT";           ///< The first bytes of a trace.
+const uint32_t FILE_VERSION = 1u;                   ///< Increased whenever the format or the calls change other than by adding calls.
+const uint32_t MAXIMUM_RECORD_SIZE = 0xFFFFu;       ///< The maximum size of the arguments of a record.
+
+/**
+ * The calls, in the order of the GlAbstraction. New calls are only added at the end.
+ */
+enum Call
+{
+  FRAME_BEGIN,  ///< GlAbstraction::PreRender()
+  FRAME_END,    ///< GlAbstraction::PostRender()
+
+  /* OpenGL ES 2.0 and 3.0 */
+  ACTIVE_TEXTURE,
+  ATTACH_SHADER,
+  BIND_ATTRIB_LOCATION,
+  BIND_BUFFER,
+  BIND_FRAMEBUFFER,
+  BIND_RENDERBUFFER,
+  BIND_TEXTURE,
+  BLEND_COLOR,
+  BLEND_EQUATION,
+  BLEND_EQUATION_SEPARATE,
+  BLEND_FUNC,
+  BLEND_FUNC_SEPARATE,
+  BUFFER_DATA,
+  BUFFER_SUB_DATA,
+  CHECK_FRAMEBUFFER_STATUS,
+  CLEAR,
+  CLEAR_COLOR,
+  CLEAR_DEPTHF,
+  CLEAR_STENCIL,
+  COLOR_MASK,
+  COMPILE_SHADER,
+  COMPRESSED_TEX_IMAGE2D,
+  COMPRESSED_TEX_SUB_IMAGE2D,
+  COPY_TEX_IMAGE2D,
+  COPY_TEX_SUB_IMAGE2D,
+  CREATE_PROGRAM,
+  CREATE_SHADER,
+  CULL_FACE,
+  DELETE_BUFFERS,
+  DELETE_FRAMEBUFFERS,
+  DELETE_PROGRAM,
+  DELETE_RENDERBUFFERS,
+  DELETE_SHADER,
+  DELETE_TEXTURES,
+  DEPTH_FUNC,
+  DEPTH_MASK,
+  DEPTH_RANGEF,
+  DETACH_SHADER,
+  DISABLE,
+  DISABLE_VERTEX_ATTRIB_ARRAY,
+  DRAW_ARRAYS,
+  DRAW_ELEMENTS,
+  ENABLE,
+  ENABLE_VERTEX_ATTRIB_ARRAY,
+  FINISH,
+  FLUSH,
+  FRAMEBUFFER_RENDERBUFFER,
+  FRAMEBUFFER_TEXTURE2D,
+  FRONT_FACE,
+  GEN_BUFFERS,
+  GENERATE_MIPMAP,
+  GEN_FRAMEBUFFERS,
+  GEN_RENDERBUFFERS,
+  GEN_TEXTURES,
+  GET_ACTIVE_ATTRIB,
+  GET_ACTIVE_UNIFORM,
+  GET_ATTACHED_SHADERS,
+  GET_ATTRIB_LOCATION,
+  GET_BOOLEANV,
+  GET_BUFFER_PARAMETERIV,
+  GET_ERROR,
+  GET_FLOATV,
+  GET_FRAMEBUFFER_ATTACHMENT_PARAMETERIV,
+  GET_INTEGERV,
+  GET_PROGRAMIV,
+  GET_PROGRAM_INFO_LOG,
+  GET_RENDERBUFFER_PARAMETERIV,
+  GET_SHADERIV,
+  GET_SHADER_INFO_LOG,
+  GET_SHADER_PRECISION_FORMAT,
+  GET_SHADER_SOURCE,
+  GET_STRING,
+  GET_TEX_PARAMETERFV,
+  GET_TEX_PARAMETERIV,
+  GET_UNIFORMFV,
+  GET_UNIFORMIV,
+  GET_UNIFORM_LOCATION,
+  GET_VERTEX_ATTRIBFV,
+  GET_VERTEX_ATTRIBIV,
+  GET_VERTEX_ATTRIB_POINTERV,
+  HINT,
+  IS_BUFFER,
+  IS_ENABLED,
+  IS_FRAMEBUFFER,
+  IS_PROGRAM,
+  IS_RENDERBUFFER,
+  IS_SHADER,
+  IS_TEXTURE,
+  LINE_WIDTH,
+  LINK_PROGRAM,
+  PIXEL_STOREI,
+  POLYGON_OFFSET,
+  READ_PIXELS,
+  RELEASE_SHADER_COMPILER,
+  RENDERBUFFER_STORAGE,
+  SAMPLE_COVERAGE,
+  SCISSOR,
+  SHADER_BINARY,
+  SHADER_SOURCE,
+  STENCIL_FUNC,
+  STENCIL_FUNC_SEPARATE,
+  STENCIL_MASK,
+  STENCIL_MASK_SEPARATE,
+  STENCIL_OP,
+  STENCIL_OP_SEPARATE,
+  TEX_IMAGE2D,
+  TEX_PARAMETERF,
+  TEX_PARAMETERFV,
+  TEX_PARAMETERI,
+  TEX_PARAMETERIV,
+  TEX_SUB_IMAGE2D,
+  UNIFORM1F,
+  UNIFORM1FV,
+  UNIFORM1I,
+  UNIFORM1IV,
+  UNIFORM2F,
+  UNIFORM2FV,
+  UNIFORM2I,
+  UNIFORM2IV,
+  UNIFORM3F,
+  UNIFORM3FV,
+  UNIFORM3I,
+  UNIFORM3IV,
+  UNIFORM4F,
+  UNIFORM4FV,
+  UNIFORM4I,
+  UNIFORM4IV,
+  UNIFORM_MATRIX2FV,
+  UNIFORM_MATRIX3FV,
+  UNIFORM_MATRIX4FV,
+  USE_PROGRAM,
+  VALIDATE_PROGRAM,
+  VERTEX_ATTRIB1F,
+  VERTEX_ATTRIB1FV,
+  VERTEX_ATTRIB2F,
+  VERTEX_ATTRIB2FV,
+  VERTEX_ATTRIB3F,
+  VERTEX_ATTRIB3FV,
+  VERTEX_ATTRIB4F,
+  VERTEX_ATTRIB4FV,
+  VERTEX_ATTRIB_POINTER,
+  VIEWPORT,
+  READ_BUFFER,
+  DRAW_RANGE_ELEMENTS,
+  TEX_IMAGE3D,
+  TEX_SUB_IMAGE3D,
+  COPY_TEX_SUB_IMAGE3D,
+  COMPRESSED_TEX_IMAGE3D,
+  COMPRESSED_TEX_SUB_IMAGE3D,
+  GEN_QUERIES,
+  DELETE_QUERIES,
+  IS_QUERY,
+  BEGIN_QUERY,
+  END_QUERY,
+  GET_QUERYIV,
+  GET_QUERY_OBJECTUIV,
+  UNMAP_BUFFER,
+  GET_BUFFER_POINTERV,
+  DRAW_BUFFERS,
+  UNIFORM_MATRIX2X3FV,
+  UNIFORM_MATRIX3X2FV,
+  UNIFORM_MATRIX2X4FV,
+  UNIFORM_MATRIX4X2FV,
+  UNIFORM_MATRIX3X4FV,
+  UNIFORM_MATRIX4X3FV,
+  BLIT_FRAMEBUFFER,
+  RENDERBUFFER_STORAGE_MULTISAMPLE,
+  FRAMEBUFFER_TEXTURE_LAYER,
+  MAP_BUFFER_RANGE,
+  FLUSH_MAPPED_BUFFER_RANGE,
+  BIND_VERTEX_ARRAY,
+  DELETE_VERTEX_ARRAYS,
+  GEN_VERTEX_ARRAYS,
+  IS_VERTEX_ARRAY,
+  GET_INTEGERI_V,
+  BEGIN_TRANSFORM_FEEDBACK,
+  END_TRANSFORM_FEEDBACK,
+  BIND_BUFFER_RANGE,
+  BIND_BUFFER_BASE,
+  TRANSFORM_FEEDBACK_VARYINGS,
+  GET_TRANSFORM_FEEDBACK_VARYING,
+  VERTEX_ATTRIB_IPOINTER,
+  GET_VERTEX_ATTRIB_IIV,
+  GET_VERTEX_ATTRIB_IUIV,
+  VERTEX_ATTRIB_I4I,
+  VERTEX_ATTRIB_I4UI,
+  VERTEX_ATTRIB_I4IV,
+  VERTEX_ATTRIB_I4UIV,
+  GET_UNIFORMUIV,
+  GET_FRAG_DATA_LOCATION,
+  UNIFORM1UI,
+  UNIFORM2UI,
+  UNIFORM3UI,
+  UNIFORM4UI,
+  UNIFORM1UIV,
+  UNIFORM2UIV,
+  UNIFORM3UIV,
+  UNIFORM4UIV,
+  CLEAR_BUFFERIV,
+  CLEAR_BUFFERUIV,
+  CLEAR_BUFFERFV,
+  CLEAR_BUFFERFI,
+  GET_STRINGI,
+  COPY_BUFFER_SUB_DATA,
+  GET_UNIFORM_INDICES,
+  GET_ACTIVE_UNIFORMSIV,
+  GET_UNIFORM_BLOCK_INDEX,
+  GET_ACTIVE_UNIFORM_BLOCKIV,
+  GET_ACTIVE_UNIFORM_BLOCK_NAME,
+  UNIFORM_BLOCK_BINDING,
+  DRAW_ARRAYS_INSTANCED,
+  DRAW_ELEMENTS_INSTANCED,
+  FENCE_SYNC,
+  IS_SYNC,
+  DELETE_SYNC,
+  CLIENT_WAIT_SYNC,
+  WAIT_SYNC,
+  GET_INTEGER64V,
+  GET_SYNCIV,
+  GET_INTEGER64I_V,
+  GET_BUFFER_PARAMETERI64V,
+  GEN_SAMPLERS,
+  DELETE_SAMPLERS,
+  IS_SAMPLER,
+  BIND_SAMPLER,
+  SAMPLER_PARAMETERI,
+  SAMPLER_PARAMETERIV,
+  SAMPLER_PARAMETERF,
+  SAMPLER_PARAMETERFV,
+  GET_SAMPLER_PARAMETERIV,
+  GET_SAMPLER_PARAMETERFV,
+  VERTEX_ATTRIB_DIVISOR,
+  BIND_TRANSFORM_FEEDBACK,
+  DELETE_TRANSFORM_FEEDBACKS,
+  GEN_TRANSFORM_FEEDBACKS,
+  IS_TRANSFORM_FEEDBACK,
+  PAUSE_TRANSFORM_FEEDBACK,
+  RESUME_TRANSFORM_FEEDBACK,
+  GET_PROGRAM_BINARY,
+  PROGRAM_BINARY,
+  PROGRAM_PARAMETERI,
+  INVALIDATE_FRAMEBUFFER,
+  INVALIDATE_SUB_FRAMEBUFFER,
+  TEX_STORAGE2D,
+  TEX_STORAGE3D,
+  GET_INTERNALFORMATIV,
+
+  NUMBER_OF_CALLS
+};
+
+struct FileHeader
+{
+  char identifier[8];       ///< FILE_IDENTIFIER
+  uint32_t version;         ///< FILE_VERSION
+  uint32_t reserved;
+};
+
+struct RecordHeader
+{
+  uint16_t call;            ///< The Call
+  uint16_t size;            ///< The size of the arguments following the header
+  uint32_t duration;        ///< The time spent in the call, in nanoseconds
+};
+
+/**
+ * An array argument.
+ */
+template< typename T >
+struct Array
+{
+  const T* values;
+  uint32_t count;
+};
+
+/**
+ * Makes an array argument.
+ * @param[in] values The elements, or NULL
+ * @param[in] count The number of elements
+ * @return The argument
+ */
+template< typename T >
+Array< T > MakeArray( const T* values, int count )
+{
+  return Array< T >{ values, values ? static_cast< uint32_t >( count > 0 ? count : 0 ) : 0u };
+}
+
+/**
+ * A string argument.
+ */
+struct String
+{
+  /**
+   * Constructor
+   * @param[in] text The string, or NULL
+   * @param[in] length The length of the string, or a negative value if it's null terminated
+   */
+  String( const char* text, int length = -1 );
+
+  const char* text;
+  uint32_t length;
+};
+
+/**
+ * A list of strings argument.
+ */
+struct StringList
+{
+  /**
+   * Constructor
+   * @param[in] strings The strings, or NULL
+   * @param[in] count The number of strings
+   * @param[in] lengths The length of each string, NULL if they're null terminated
+   */
+  StringList( const char* const* strings, int count, const int* lengths = nullptr );
+
+  const char* const* strings;
+  uint32_t count;
+  const int* lengths;
+};
+
+/**
+ * @param[in] call The call
+ * @return The name of the call, e.g. "BindTexture"
+ */
+const char* GetCallName( Call call );
+
+} // namespace GlCallTrace
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_GL_CALL_TRACE_H
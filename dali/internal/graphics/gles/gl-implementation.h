@@ -21,6 +21,7 @@
 // EXTERNAL INCLUDES
 #include <memory>
 #include <cstdlib>
+#include <string>
 #include <GLES2/gl2.h>
 #include <dali/integration-api/gl-abstraction.h>
 #include <dali/devel-api/threading/conditional-wait.h>
@@ -29,6 +30,7 @@
 #include <dali/internal/graphics/gles/gles-abstraction.h>
 #include <dali/internal/graphics/gles/gles2-implementation.h>
 #include <dali/internal/graphics/gles/gles3-implementation.h>
+#include <dali/internal/graphics/gles/gl-texture-stager.h>
 
 namespace Dali
 {
@@ -53,7 +55,8 @@ public:
       mIsSurfacelessContextSupported( false ),
       mIsContextCreated( false ),
       mContextCreatedWaitCondition(),
-      mMaxTextureSize( 0 )
+      mMaxTextureSize( 0 ),
+      mTextureStager( NULL )
   {
     mImpl.reset( new Gles3Implementation() );
   }
@@ -67,13 +70,22 @@ public:
 
   void PostRender() override
   {
-    /* Do nothing in main implementation */
+    if( mTextureStager )
+    {
+      mTextureStager->FrameEnded();
+    }
   }
 
-  void ContextCreated()
+  virtual void ContextCreated()
   {
     glGetIntegerv( GL_MAX_TEXTURE_SIZE, &mMaxTextureSize );
 
+    if( mTextureStager )
+    {
+      // The buffers of a previous context are lost
+      mTextureStager->Release( false );
+    }
+
     if( !mIsContextCreated )
     {
       mContextCreatedWaitCondition.Notify();
@@ -81,6 +93,39 @@ public:
     mIsContextCreated = true;
   }
 
+  /**
+   * Called by the EGL implementation when a context is made current, as the GL state is per context.
+   * @param[in] context The current context, or NULL if there's none
+   */
+  virtual void ContextMadeCurrent( const void* context )
+  {
+    if( mTextureStager )
+    {
+      mTextureStager->ContextMadeCurrent( context );
+    }
+  }
+
+  /**
+   * Called by the EGL implementation when a context is destroyed.
+   * @param[in] context The context
+   */
+  virtual void ContextDestroyed( const void* context )
+  {
+    if( mTextureStager )
+    {
+      mTextureStager->ContextDestroyed( context );
+    }
+  }
+
+  /**
+   * Sets the stager the texture uploads are staged through when OpenGL ES 3.0 is used.
+   * @param[in] textureStager The stager, or NULL to upload directly
+   */
+  void SetTextureStager( GlTextureStager* textureStager )
+  {
+    mTextureStager = textureStager;
+  }
+
   void SetGlesVersion( const int32_t glesVersion )
   {
     if( mGlesVersion != glesVersion )
@@ -127,6 +172,21 @@ public:
     return mMaxTextureSize;
   }
 
+  /**
+   * Retrieves the renderer and version of the driver, which the program binaries depend on.
+   * Called by the render thread once the context is created.
+   */
+  std::string GetGraphicsDriver() const
+  {
+    const GLubyte* renderer = glGetString( GL_RENDERER );
+    const GLubyte* version = glGetString( GL_VERSION );
+
+    std::string driver( renderer ? reinterpret_cast<const char*>( renderer ) : "" );
+    driver += " / ";
+    driver += version ? reinterpret_cast<const char*>( version ) : "";
+    return driver;
+  }
+
   /* OpenGL ES 2.0 */
 
   void ActiveTexture( GLenum texture ) override
@@ -146,6 +206,10 @@ public:
 
   void BindBuffer( GLenum target, GLuint buffer ) override
   {
+    if( mTextureStager )
+    {
+      mTextureStager->BindBuffer( target, buffer );
+    }
     glBindBuffer( target, buffer );
   }
 
@@ -236,11 +300,19 @@ public:
 
   void CompressedTexImage2D( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data ) override
   {
+    if( IsTextureStagerUsed() && mTextureStager->CompressedTexImage2D( target, level, internalformat, width, height, border, imageSize, data ) )
+    {
+      return;
+    }
     glCompressedTexImage2D( target, level, internalformat, width, height, border, imageSize, data );
   }
 
   void CompressedTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data ) override
   {
+    if( IsTextureStagerUsed() && mTextureStager->CompressedTexSubImage2D( target, level, xoffset, yoffset, width, height, format, imageSize, data ) )
+    {
+      return;
+    }
     glCompressedTexSubImage2D( target, level, xoffset, yoffset, width, height, format, imageSize, data );
   }
 
@@ -581,6 +653,10 @@ public:
 
   void PixelStorei( GLenum pname, GLint param ) override
   {
+    if( mTextureStager )
+    {
+      mTextureStager->PixelStorei( pname, param );
+    }
     glPixelStorei( pname, param );
   }
 
@@ -656,6 +732,10 @@ public:
 
   void TexImage2D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels ) override
   {
+    if( IsTextureStagerUsed() && mTextureStager->TexImage2D( target, level, internalformat, width, height, border, format, type, pixels ) )
+    {
+      return;
+    }
     glTexImage2D( target, level, internalformat, width, height, border, format, type, pixels );
   }
 
@@ -681,6 +761,10 @@ public:
 
   void TexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels ) override
   {
+    if( IsTextureStagerUsed() && mTextureStager->TexSubImage2D( target, level, xoffset, yoffset, width, height, format, type, pixels ) )
+    {
+      return;
+    }
     glTexSubImage2D( target, level, xoffset, yoffset, width, height, format, type, pixels );
   }
 
@@ -1361,6 +1445,16 @@ public:
     mImpl->GetInternalformativ( target, internalformat, pname, bufSize, params );
   }
 
+private:
+
+  /**
+   * @return Whether the texture uploads are staged, which requires OpenGL ES 3.0
+   */
+  bool IsTextureStagerUsed() const
+  {
+    return mTextureStager && ( mGlesVersion >= 30 );
+  }
+
 private:
   int32_t mGlesVersion;
   bool mIsSurfacelessContextSupported;
@@ -1368,6 +1462,7 @@ private:
   ConditionalWait mContextCreatedWaitCondition;
   GLint mMaxTextureSize;
   std::unique_ptr<GlesAbstraction> mImpl;
+  GlTextureStager* mTextureStager;    ///< Not owned
 };
 
 } // namespace Adaptor
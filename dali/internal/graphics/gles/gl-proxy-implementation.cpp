@@ -130,6 +130,11 @@ uint64_t Sampler::GetCount() const
   return mAccumulated;
 }
 
+unsigned int Sampler::GetCurrentCount() const
+{
+  return mCurrentFrameCount;
+}
+
 ObjectCounter::ObjectCounter( const char* description )
 : mDescription( description ),
   mCount( 0 ),
@@ -191,6 +196,8 @@ void GlProxyImplementation::PreRender()
 
 void GlProxyImplementation::PostRender()
 {
+  GlImplementation::PostRender();
+
   // Accumulate counts in each sampler
   AccumulateSamples();
 
@@ -87,6 +87,11 @@ public:
    */
   uint64_t GetCount() const;
 
+  /**
+   * @return the count for this frame
+   */
+  unsigned int GetCurrentCount() const;
+
 private: // Data
 
   const char* mDescription;
@@ -0,0 +1,846 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/graphics/gles/gl-state-cache-implementation.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+#include <GLES2/gl2ext.h>
+
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/environment-options.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_GL_STATE_CACHE" );
+#endif
+
+const int NUM_FRAMES_PER_SECOND( 60 );
+
+const GLuint UNKNOWN = 0xFFFFFFFF;                ///< Neither a name nor an enum the state can be set to
+
+const GLint MAXIMUM_UNIFORM_LOCATIONS = 1024;     ///< The uniforms at the locations above are not shadowed
+
+const GLenum TEXTURE_TARGETS[] =
+{
+  GL_TEXTURE_2D,
+  GL_TEXTURE_CUBE_MAP,
+  GL_TEXTURE_EXTERNAL_OES,
+  GL_TEXTURE_3D,
+  GL_TEXTURE_2D_ARRAY
+};
+
+const GLenum CAPABILITIES[] =
+{
+  GL_BLEND,
+  GL_CULL_FACE,
+  GL_DEPTH_TEST,
+  GL_DITHER,
+  GL_POLYGON_OFFSET_FILL,
+  GL_SAMPLE_ALPHA_TO_COVERAGE,
+  GL_SAMPLE_COVERAGE,
+  GL_SCISSOR_TEST,
+  GL_STENCIL_TEST,
+  GL_RASTERIZER_DISCARD,
+  GL_PRIMITIVE_RESTART_FIXED_INDEX
+};
+
+/**
+ * @return The index of a texture target, or -1 if its bindings are not shadowed
+ */
+int GetTextureTargetIndex( GLenum target )
+{
+  for( unsigned int index = 0; index < sizeof( TEXTURE_TARGETS ) / sizeof( TEXTURE_TARGETS[0] ); ++index )
+  {
+    if( TEXTURE_TARGETS[index] == target )
+    {
+      return index;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @return The index of a capability, or -1 if it's not shadowed
+ */
+int GetCapabilityIndex( GLenum cap )
+{
+  for( unsigned int index = 0; index < sizeof( CAPABILITIES ) / sizeof( CAPABILITIES[0] ); ++index )
+  {
+    if( CAPABILITIES[index] == cap )
+    {
+      return index;
+    }
+  }
+  return -1;
+}
+
+} // unnamed namespace
+
+GlStateCacheImplementation::ContextState::ContextState()
+{
+  Reset();
+}
+
+void GlStateCacheImplementation::ContextState::Reset()
+{
+  activeTexture = UNKNOWN;
+  std::fill( &textures[0][0], &textures[0][0] + MAXIMUM_TEXTURE_UNITS * NUMBER_OF_TEXTURE_TARGETS, UNKNOWN );
+  arrayBuffer = UNKNOWN;
+  elementArrayBuffer = UNKNOWN;
+  drawFramebuffer = UNKNOWN;
+  readFramebuffer = UNKNOWN;
+  renderbuffer = UNKNOWN;
+  vertexArray = UNKNOWN;
+  program = UNKNOWN;
+  std::fill( blendFunc, blendFunc + 4, UNKNOWN );
+  std::fill( blendEquation, blendEquation + 2, UNKNOWN );
+  std::fill( capabilities, capabilities + NUMBER_OF_CAPABILITIES, UNKNOWN );
+}
+
+GlStateCacheImplementation::GlStateCacheImplementation( EnvironmentOptions& environmentOptions )
+: mEnvironmentOptions( environmentOptions ),
+  mContextStates(),
+  mUniforms(),
+  mState( NULL ),
+  mCurrentContext( NULL ),
+  mShadowedSampler( "Shadowed calls" ),
+  mFilteredSampler( "Filtered calls" ),
+  mCurrentFrameCount( 0 ),
+  mTotalFrameCount( 0 )
+{
+  static_assert( sizeof( TEXTURE_TARGETS ) / sizeof( TEXTURE_TARGETS[0] ) == NUMBER_OF_TEXTURE_TARGETS, "Texture target table mismatch" );
+  static_assert( sizeof( CAPABILITIES ) / sizeof( CAPABILITIES[0] ) == NUMBER_OF_CAPABILITIES, "Capability table mismatch" );
+
+  mState = &mContextStates[ mCurrentContext ];
+}
+
+GlStateCacheImplementation::~GlStateCacheImplementation()
+{
+}
+
+void GlStateCacheImplementation::PostRender()
+{
+  GlImplementation::PostRender();
+
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "GlStateCacheImplementation::PostRender: %u calls filtered\n", mFilteredSampler.GetCurrentCount() );
+
+  mShadowedSampler.Accumulate();
+  mFilteredSampler.Accumulate();
+
+  mTotalFrameCount++;
+  mCurrentFrameCount++;
+
+  if( ( mEnvironmentOptions.GetGlesCallTime() > 0 ) &&
+      ( mCurrentFrameCount >= mEnvironmentOptions.GetGlesCallTime() * NUM_FRAMES_PER_SECOND ) )
+  {
+    mCurrentFrameCount = 0;
+    LogResults();
+
+    if( !mEnvironmentOptions.GetGlesCallAccumulate() )
+    {
+      mShadowedSampler.Reset();
+      mFilteredSampler.Reset();
+    }
+  }
+}
+
+void GlStateCacheImplementation::ContextCreated()
+{
+  GlImplementation::ContextCreated();
+
+  // The objects of the previous context are lost
+  ResetState();
+}
+
+void GlStateCacheImplementation::ContextMadeCurrent( const void* context )
+{
+  GlImplementation::ContextMadeCurrent( context );
+
+  mCurrentContext = context;
+  mState = &mContextStates[ context ];
+
+  if( !context )
+  {
+    // The calls made without a context are ignored, so there's nothing to shadow
+    mState->Reset();
+  }
+}
+
+void GlStateCacheImplementation::ContextDestroyed( const void* context )
+{
+  GlImplementation::ContextDestroyed( context );
+
+  mContextStates.erase( context );
+
+  // Erasing from the map doesn't move the other states
+  if( context == mCurrentContext )
+  {
+    ContextMadeCurrent( NULL );
+  }
+}
+
+void GlStateCacheImplementation::ActiveTexture( GLenum texture )
+{
+  const GLuint unit = texture - GL_TEXTURE0;
+  if( unit >= MAXIMUM_TEXTURE_UNITS )
+  {
+    mState->activeTexture = UNKNOWN;
+    GlImplementation::ActiveTexture( texture );
+  }
+  else if( Update( mState->activeTexture, unit ) )
+  {
+    GlImplementation::ActiveTexture( texture );
+  }
+}
+
+void GlStateCacheImplementation::BindBuffer( GLenum target, GLuint buffer )
+{
+  bool changed = true;
+  if( target == GL_ARRAY_BUFFER )
+  {
+    changed = Update( mState->arrayBuffer, buffer );
+  }
+  else if( target == GL_ELEMENT_ARRAY_BUFFER )
+  {
+    changed = Update( mState->elementArrayBuffer, buffer );
+  }
+
+  if( changed )
+  {
+    GlImplementation::BindBuffer( target, buffer );
+  }
+}
+
+void GlStateCacheImplementation::BindFramebuffer( GLenum target, GLuint framebuffer )
+{
+  bool changed = true;
+  if( target == GL_FRAMEBUFFER )
+  {
+    mShadowedSampler.Increment();
+    if( mState->drawFramebuffer == framebuffer && mState->readFramebuffer == framebuffer )
+    {
+      mFilteredSampler.Increment();
+      changed = false;
+    }
+    mState->drawFramebuffer = framebuffer;
+    mState->readFramebuffer = framebuffer;
+  }
+  else if( target == GL_DRAW_FRAMEBUFFER )
+  {
+    changed = Update( mState->drawFramebuffer, framebuffer );
+  }
+  else if( target == GL_READ_FRAMEBUFFER )
+  {
+    changed = Update( mState->readFramebuffer, framebuffer );
+  }
+
+  if( changed )
+  {
+    GlImplementation::BindFramebuffer( target, framebuffer );
+  }
+}
+
+void GlStateCacheImplementation::BindRenderbuffer( GLenum target, GLuint renderbuffer )
+{
+  if( target != GL_RENDERBUFFER || Update( mState->renderbuffer, renderbuffer ) )
+  {
+    GlImplementation::BindRenderbuffer( target, renderbuffer );
+  }
+}
+
+void GlStateCacheImplementation::BindTexture( GLenum target, GLuint texture )
+{
+  const int targetIndex = GetTextureTargetIndex( target );
+  if( targetIndex < 0 || mState->activeTexture == UNKNOWN )
+  {
+    if( targetIndex >= 0 )
+    {
+      // The binding of the unit which is active is unknown
+      for( auto& unit : mState->textures )
+      {
+        unit[targetIndex] = UNKNOWN;
+      }
+    }
+    GlImplementation::BindTexture( target, texture );
+  }
+  else if( Update( mState->textures[ mState->activeTexture ][ targetIndex ], texture ) )
+  {
+    GlImplementation::BindTexture( target, texture );
+  }
+}
+
+void GlStateCacheImplementation::BlendEquation( GLenum mode )
+{
+  mShadowedSampler.Increment();
+  if( mState->blendEquation[0] == mode && mState->blendEquation[1] == mode )
+  {
+    mFilteredSampler.Increment();
+    return;
+  }
+
+  mState->blendEquation[0] = mode;
+  mState->blendEquation[1] = mode;
+  GlImplementation::BlendEquation( mode );
+}
+
+void GlStateCacheImplementation::BlendEquationSeparate( GLenum modeRGB, GLenum modeAlpha )
+{
+  mShadowedSampler.Increment();
+  if( mState->blendEquation[0] == modeRGB && mState->blendEquation[1] == modeAlpha )
+  {
+    mFilteredSampler.Increment();
+    return;
+  }
+
+  mState->blendEquation[0] = modeRGB;
+  mState->blendEquation[1] = modeAlpha;
+  GlImplementation::BlendEquationSeparate( modeRGB, modeAlpha );
+}
+
+void GlStateCacheImplementation::BlendFunc( GLenum sfactor, GLenum dfactor )
+{
+  mShadowedSampler.Increment();
+  if( mState->blendFunc[0] == sfactor && mState->blendFunc[1] == dfactor &&
+      mState->blendFunc[2] == sfactor && mState->blendFunc[3] == dfactor )
+  {
+    mFilteredSampler.Increment();
+    return;
+  }
+
+  mState->blendFunc[0] = sfactor;
+  mState->blendFunc[1] = dfactor;
+  mState->blendFunc[2] = sfactor;
+  mState->blendFunc[3] = dfactor;
+  GlImplementation::BlendFunc( sfactor, dfactor );
+}
+
+void GlStateCacheImplementation::BlendFuncSeparate( GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha )
+{
+  mShadowedSampler.Increment();
+  if( mState->blendFunc[0] == srcRGB && mState->blendFunc[1] == dstRGB &&
+      mState->blendFunc[2] == srcAlpha && mState->blendFunc[3] == dstAlpha )
+  {
+    mFilteredSampler.Increment();
+    return;
+  }
+
+  mState->blendFunc[0] = srcRGB;
+  mState->blendFunc[1] = dstRGB;
+  mState->blendFunc[2] = srcAlpha;
+  mState->blendFunc[3] = dstAlpha;
+  GlImplementation::BlendFuncSeparate( srcRGB, dstRGB, srcAlpha, dstAlpha );
+}
+
+void GlStateCacheImplementation::Enable( GLenum cap )
+{
+  if( UpdateCapability( cap, GL_TRUE ) )
+  {
+    GlImplementation::Enable( cap );
+  }
+}
+
+void GlStateCacheImplementation::Disable( GLenum cap )
+{
+  if( UpdateCapability( cap, GL_FALSE ) )
+  {
+    GlImplementation::Disable( cap );
+  }
+}
+
+void GlStateCacheImplementation::UseProgram( GLuint program )
+{
+  if( Update( mState->program, program ) )
+  {
+    GlImplementation::UseProgram( program );
+  }
+}
+
+void GlStateCacheImplementation::DeleteBuffers( GLsizei n, const GLuint* buffers )
+{
+  UnbindDeleted( n, buffers, &ContextState::arrayBuffer );
+  UnbindDeleted( n, buffers, &ContextState::elementArrayBuffer );
+  GlImplementation::DeleteBuffers( n, buffers );
+}
+
+void GlStateCacheImplementation::DeleteFramebuffers( GLsizei n, const GLuint* framebuffers )
+{
+  UnbindDeleted( n, framebuffers, &ContextState::drawFramebuffer );
+  UnbindDeleted( n, framebuffers, &ContextState::readFramebuffer );
+  GlImplementation::DeleteFramebuffers( n, framebuffers );
+}
+
+void GlStateCacheImplementation::DeleteProgram( GLuint program )
+{
+  mUniforms.erase( program );
+  UnbindDeleted( 1, &program, &ContextState::program );
+  GlImplementation::DeleteProgram( program );
+}
+
+void GlStateCacheImplementation::DeleteRenderbuffers( GLsizei n, const GLuint* renderbuffers )
+{
+  UnbindDeleted( n, renderbuffers, &ContextState::renderbuffer );
+  GlImplementation::DeleteRenderbuffers( n, renderbuffers );
+}
+
+void GlStateCacheImplementation::DeleteTextures( GLsizei n, const GLuint* textures )
+{
+  if( textures )
+  {
+    for( auto& contextState : mContextStates )
+    {
+      for( auto& unit : contextState.second.textures )
+      {
+        for( auto& binding : unit )
+        {
+          if( std::find( textures, textures + n, binding ) != textures + n )
+          {
+            binding = UNKNOWN;
+          }
+        }
+      }
+    }
+  }
+  GlImplementation::DeleteTextures( n, textures );
+}
+
+void GlStateCacheImplementation::LinkProgram( GLuint program )
+{
+  // Linking sets the uniforms to their default values
+  mUniforms.erase( program );
+  GlImplementation::LinkProgram( program );
+}
+
+void GlStateCacheImplementation::Uniform1f( GLint location, GLfloat x )
+{
+  if( UpdateUniform( location, 1, &x, sizeof( GLfloat ) ) )
+  {
+    GlImplementation::Uniform1f( location, x );
+  }
+}
+
+void GlStateCacheImplementation::Uniform1fv( GLint location, GLsizei count, const GLfloat* v )
+{
+  if( UpdateUniform( location, count, v, sizeof( GLfloat ) ) )
+  {
+    GlImplementation::Uniform1fv( location, count, v );
+  }
+}
+
+void GlStateCacheImplementation::Uniform1i( GLint location, GLint x )
+{
+  if( UpdateUniform( location, 1, &x, sizeof( GLint ) ) )
+  {
+    GlImplementation::Uniform1i( location, x );
+  }
+}
+
+void GlStateCacheImplementation::Uniform1iv( GLint location, GLsizei count, const GLint* v )
+{
+  if( UpdateUniform( location, count, v, sizeof( GLint ) ) )
+  {
+    GlImplementation::Uniform1iv( location, count, v );
+  }
+}
+
+void GlStateCacheImplementation::Uniform2f( GLint location, GLfloat x, GLfloat y )
+{
+  const GLfloat value[] = { x, y };
+  if( UpdateUniform( location, 1, value, sizeof( value ) ) )
+  {
+    GlImplementation::Uniform2f( location, x, y );
+  }
+}
+
+void GlStateCacheImplementation::Uniform2fv( GLint location, GLsizei count, const GLfloat* v )
+{
+  if( UpdateUniform( location, count, v, 2 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::Uniform2fv( location, count, v );
+  }
+}
+
+void GlStateCacheImplementation::Uniform2i( GLint location, GLint x, GLint y )
+{
+  const GLint value[] = { x, y };
+  if( UpdateUniform( location, 1, value, sizeof( value ) ) )
+  {
+    GlImplementation::Uniform2i( location, x, y );
+  }
+}
+
+void GlStateCacheImplementation::Uniform2iv( GLint location, GLsizei count, const GLint* v )
+{
+  if( UpdateUniform( location, count, v, 2 * sizeof( GLint ) ) )
+  {
+    GlImplementation::Uniform2iv( location, count, v );
+  }
+}
+
+void GlStateCacheImplementation::Uniform3f( GLint location, GLfloat x, GLfloat y, GLfloat z )
+{
+  const GLfloat value[] = { x, y, z };
+  if( UpdateUniform( location, 1, value, sizeof( value ) ) )
+  {
+    GlImplementation::Uniform3f( location, x, y, z );
+  }
+}
+
+void GlStateCacheImplementation::Uniform3fv( GLint location, GLsizei count, const GLfloat* v )
+{
+  if( UpdateUniform( location, count, v, 3 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::Uniform3fv( location, count, v );
+  }
+}
+
+void GlStateCacheImplementation::Uniform3i( GLint location, GLint x, GLint y, GLint z )
+{
+  const GLint value[] = { x, y, z };
+  if( UpdateUniform( location, 1, value, sizeof( value ) ) )
+  {
+    GlImplementation::Uniform3i( location, x, y, z );
+  }
+}
+
+void GlStateCacheImplementation::Uniform3iv( GLint location, GLsizei count, const GLint* v )
+{
+  if( UpdateUniform( location, count, v, 3 * sizeof( GLint ) ) )
+  {
+    GlImplementation::Uniform3iv( location, count, v );
+  }
+}
+
+void GlStateCacheImplementation::Uniform4f( GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w )
+{
+  const GLfloat value[] = { x, y, z, w };
+  if( UpdateUniform( location, 1, value, sizeof( value ) ) )
+  {
+    GlImplementation::Uniform4f( location, x, y, z, w );
+  }
+}
+
+void GlStateCacheImplementation::Uniform4fv( GLint location, GLsizei count, const GLfloat* v )
+{
+  if( UpdateUniform( location, count, v, 4 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::Uniform4fv( location, count, v );
+  }
+}
+
+void GlStateCacheImplementation::Uniform4i( GLint location, GLint x, GLint y, GLint z, GLint w )
+{
+  const GLint value[] = { x, y, z, w };
+  if( UpdateUniform( location, 1, value, sizeof( value ) ) )
+  {
+    GlImplementation::Uniform4i( location, x, y, z, w );
+  }
+}
+
+void GlStateCacheImplementation::Uniform4iv( GLint location, GLsizei count, const GLint* v )
+{
+  if( UpdateUniform( location, count, v, 4 * sizeof( GLint ) ) )
+  {
+    GlImplementation::Uniform4iv( location, count, v );
+  }
+}
+
+void GlStateCacheImplementation::UniformMatrix2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  // The transposed matrices are not shadowed, as the same value transposed or not sets different uniforms
+  if( transpose || UpdateUniform( location, count, value, 4 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::UniformMatrix2fv( location, count, transpose, value );
+  }
+}
+
+void GlStateCacheImplementation::UniformMatrix3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  if( transpose || UpdateUniform( location, count, value, 9 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::UniformMatrix3fv( location, count, transpose, value );
+  }
+}
+
+void GlStateCacheImplementation::UniformMatrix4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  if( transpose || UpdateUniform( location, count, value, 16 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::UniformMatrix4fv( location, count, transpose, value );
+  }
+}
+
+void GlStateCacheImplementation::BindVertexArray( GLuint array )
+{
+  if( Update( mState->vertexArray, array ) )
+  {
+    // The element array buffer binding is part of the vertex array state
+    mState->elementArrayBuffer = UNKNOWN;
+    GlImplementation::BindVertexArray( array );
+  }
+}
+
+void GlStateCacheImplementation::DeleteVertexArrays( GLsizei n, const GLuint* arrays )
+{
+  if( arrays )
+  {
+    for( auto& contextState : mContextStates )
+    {
+      if( std::find( arrays, arrays + n, contextState.second.vertexArray ) != arrays + n )
+      {
+        contextState.second.vertexArray = UNKNOWN;
+        contextState.second.elementArrayBuffer = UNKNOWN;
+      }
+    }
+  }
+  GlImplementation::DeleteVertexArrays( n, arrays );
+}
+
+void GlStateCacheImplementation::ProgramBinary( GLuint program, GLenum binaryFormat, const GLvoid* binary, GLsizei length )
+{
+  mUniforms.erase( program );
+  GlImplementation::ProgramBinary( program, binaryFormat, binary, length );
+}
+
+void GlStateCacheImplementation::Uniform1ui( GLint location, GLuint v0 )
+{
+  if( UpdateUniform( location, 1, &v0, sizeof( GLuint ) ) )
+  {
+    GlImplementation::Uniform1ui( location, v0 );
+  }
+}
+
+void GlStateCacheImplementation::Uniform2ui( GLint location, GLuint v0, GLuint v1 )
+{
+  const GLuint value[] = { v0, v1 };
+  if( UpdateUniform( location, 1, value, sizeof( value ) ) )
+  {
+    GlImplementation::Uniform2ui( location, v0, v1 );
+  }
+}
+
+void GlStateCacheImplementation::Uniform3ui( GLint location, GLuint v0, GLuint v1, GLuint v2 )
+{
+  const GLuint value[] = { v0, v1, v2 };
+  if( UpdateUniform( location, 1, value, sizeof( value ) ) )
+  {
+    GlImplementation::Uniform3ui( location, v0, v1, v2 );
+  }
+}
+
+void GlStateCacheImplementation::Uniform4ui( GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3 )
+{
+  const GLuint value[] = { v0, v1, v2, v3 };
+  if( UpdateUniform( location, 1, value, sizeof( value ) ) )
+  {
+    GlImplementation::Uniform4ui( location, v0, v1, v2, v3 );
+  }
+}
+
+void GlStateCacheImplementation::Uniform1uiv( GLint location, GLsizei count, const GLuint* value )
+{
+  if( UpdateUniform( location, count, value, sizeof( GLuint ) ) )
+  {
+    GlImplementation::Uniform1uiv( location, count, value );
+  }
+}
+
+void GlStateCacheImplementation::Uniform2uiv( GLint location, GLsizei count, const GLuint* value )
+{
+  if( UpdateUniform( location, count, value, 2 * sizeof( GLuint ) ) )
+  {
+    GlImplementation::Uniform2uiv( location, count, value );
+  }
+}
+
+void GlStateCacheImplementation::Uniform3uiv( GLint location, GLsizei count, const GLuint* value )
+{
+  if( UpdateUniform( location, count, value, 3 * sizeof( GLuint ) ) )
+  {
+    GlImplementation::Uniform3uiv( location, count, value );
+  }
+}
+
+void GlStateCacheImplementation::Uniform4uiv( GLint location, GLsizei count, const GLuint* value )
+{
+  if( UpdateUniform( location, count, value, 4 * sizeof( GLuint ) ) )
+  {
+    GlImplementation::Uniform4uiv( location, count, value );
+  }
+}
+
+void GlStateCacheImplementation::UniformMatrix2x3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  if( transpose || UpdateUniform( location, count, value, 6 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::UniformMatrix2x3fv( location, count, transpose, value );
+  }
+}
+
+void GlStateCacheImplementation::UniformMatrix3x2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  if( transpose || UpdateUniform( location, count, value, 6 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::UniformMatrix3x2fv( location, count, transpose, value );
+  }
+}
+
+void GlStateCacheImplementation::UniformMatrix2x4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  if( transpose || UpdateUniform( location, count, value, 8 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::UniformMatrix2x4fv( location, count, transpose, value );
+  }
+}
+
+void GlStateCacheImplementation::UniformMatrix4x2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  if( transpose || UpdateUniform( location, count, value, 8 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::UniformMatrix4x2fv( location, count, transpose, value );
+  }
+}
+
+void GlStateCacheImplementation::UniformMatrix3x4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  if( transpose || UpdateUniform( location, count, value, 12 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::UniformMatrix3x4fv( location, count, transpose, value );
+  }
+}
+
+void GlStateCacheImplementation::UniformMatrix4x3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value )
+{
+  if( transpose || UpdateUniform( location, count, value, 12 * sizeof( GLfloat ) ) )
+  {
+    GlImplementation::UniformMatrix4x3fv( location, count, transpose, value );
+  }
+}
+
+bool GlStateCacheImplementation::Update( GLuint& state, GLuint value )
+{
+  mShadowedSampler.Increment();
+  if( state == value )
+  {
+    mFilteredSampler.Increment();
+    return false;
+  }
+
+  state = value;
+  return true;
+}
+
+bool GlStateCacheImplementation::UpdateUniform( GLint location, GLsizei count, const void* value, uint32_t size )
+{
+  const GLuint program = mState->program;
+  if( program == UNKNOWN || program == 0 || location < 0 || location >= MAXIMUM_UNIFORM_LOCATIONS )
+  {
+    return true;
+  }
+
+  if( count != 1 || size > MAXIMUM_UNIFORM_SIZE || !value )
+  {
+    // The array elements may be at the following locations, so none of the values of the program are known anymore
+    mUniforms.erase( program );
+    return true;
+  }
+
+  UniformValues& uniforms = mUniforms[ program ];
+  if( static_cast<GLint>( uniforms.size() ) <= location )
+  {
+    UniformValue unknown;
+    unknown.size = 0;
+    uniforms.resize( location + 1, unknown );
+  }
+
+  mShadowedSampler.Increment();
+
+  UniformValue& uniform = uniforms[ location ];
+  if( uniform.size == size && memcmp( uniform.data, value, size ) == 0 )
+  {
+    mFilteredSampler.Increment();
+    return false;
+  }
+
+  uniform.size = size;
+  memcpy( uniform.data, value, size );
+  return true;
+}
+
+bool GlStateCacheImplementation::UpdateCapability( GLenum cap, GLuint enabled )
+{
+  const int index = GetCapabilityIndex( cap );
+  return index < 0 || Update( mState->capabilities[ index ], enabled );
+}
+
+void GlStateCacheImplementation::UnbindDeleted( GLsizei n, const GLuint* names, GLuint ContextState::*member )
+{
+  if( !names )
+  {
+    return;
+  }
+
+  for( auto& contextState : mContextStates )
+  {
+    GLuint& binding = contextState.second.*member;
+    if( std::find( names, names + n, binding ) != names + n )
+    {
+      binding = UNKNOWN;
+    }
+  }
+}
+
+void GlStateCacheImplementation::ResetState()
+{
+  mUniforms.clear();
+  for( auto& contextState : mContextStates )
+  {
+    contextState.second.Reset();
+  }
+}
+
+void GlStateCacheImplementation::LogResults()
+{
+  Debug::LogMessage( Debug::DebugInfo, "OpenGL ES state cache sampled over %d frames) operations per frame:\n", mTotalFrameCount );
+
+  const Sampler* samplers[] = { &mShadowedSampler, &mFilteredSampler };
+  for( const Sampler* sampler : samplers )
+  {
+    Debug::LogMessage( Debug::DebugInfo, "  %s : Mean %5.2f  (Min:%5.2f, Max:%5.2f, StdDev:%5.2f, Actual:%u)\n",
+                       sampler->GetDescription(),
+                       sampler->GetMeanValue(), sampler->GetMin(), sampler->GetMax(),
+                       sampler->GetStandardDeviation(),
+                       static_cast<unsigned int>( sampler->GetCount() ) );
+  }
+}
+
+} // namespace Adaptor
+} // namespace Internal
+} // namespace Dali
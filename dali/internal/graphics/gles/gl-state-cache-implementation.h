@@ -0,0 +1,259 @@
+#ifndef DALI_INTERNAL_GL_STATE_CACHE_IMPLEMENTATION_H
+#define DALI_INTERNAL_GL_STATE_CACHE_IMPLEMENTATION_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/graphics/gles/gl-implementation.h>
+#include <dali/internal/graphics/gles/gl-proxy-implementation.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+class EnvironmentOptions;
+
+/**
+ * GlStateCacheImplementation is a wrapper for the concrete implementation of GlAbstraction which
+ * shadows the GL state and drops the calls setting it to the value it already has.
+ *
+ * The bound objects, the blending, the enabled capabilities and the active texture unit are shadowed
+ * per context, as told by the EGL implementation. The uniform values are shadowed per program, as they
+ * are shared by the contexts. A state is unknown until it's set, and becomes unknown again when the
+ * object it refers to is deleted, so the calls are only dropped when the value is known to be set.
+ *
+ * The number of calls dropped per frame is logged at the same interval as the GLES call statistics.
+ */
+class GlStateCacheImplementation : public GlImplementation
+{
+public:
+
+  /**
+   * Constructor
+   * @param environmentOptions to check how often to log results
+   */
+  GlStateCacheImplementation( EnvironmentOptions& environmentOptions );
+
+  /**
+   * Virtual destructor
+   */
+  virtual ~GlStateCacheImplementation();
+
+  /**
+   * @copydoc GlAbstraction::PostRender();
+   */
+  void PostRender() override;
+
+  /**
+   * @copydoc GlImplementation::ContextCreated();
+   */
+  void ContextCreated() override;
+
+  /**
+   * @copydoc GlImplementation::ContextMadeCurrent();
+   */
+  void ContextMadeCurrent( const void* context ) override;
+
+  /**
+   * @copydoc GlImplementation::ContextDestroyed();
+   */
+  void ContextDestroyed( const void* context ) override;
+
+  /* OpenGL ES 2.0 API */
+  void ActiveTexture( GLenum texture ) override;
+  void BindBuffer( GLenum target, GLuint buffer ) override;
+  void BindFramebuffer( GLenum target, GLuint framebuffer ) override;
+  void BindRenderbuffer( GLenum target, GLuint renderbuffer ) override;
+  void BindTexture( GLenum target, GLuint texture ) override;
+  void BlendEquation( GLenum mode ) override;
+  void BlendEquationSeparate( GLenum modeRGB, GLenum modeAlpha ) override;
+  void BlendFunc( GLenum sfactor, GLenum dfactor ) override;
+  void BlendFuncSeparate( GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha ) override;
+  void Enable( GLenum cap ) override;
+  void Disable( GLenum cap ) override;
+  void UseProgram( GLuint program ) override;
+
+  void DeleteBuffers( GLsizei n, const GLuint* buffers ) override;
+  void DeleteFramebuffers( GLsizei n, const GLuint* framebuffers ) override;
+  void DeleteProgram( GLuint program ) override;
+  void DeleteRenderbuffers( GLsizei n, const GLuint* renderbuffers ) override;
+  void DeleteTextures( GLsizei n, const GLuint* textures ) override;
+  void LinkProgram( GLuint program ) override;
+
+  void Uniform1f ( GLint location, GLfloat x ) override;
+  void Uniform1fv( GLint location, GLsizei count, const GLfloat* v ) override;
+  void Uniform1i ( GLint location, GLint x ) override;
+  void Uniform1iv( GLint location, GLsizei count, const GLint* v ) override;
+  void Uniform2f ( GLint location, GLfloat x, GLfloat y ) override;
+  void Uniform2fv( GLint location, GLsizei count, const GLfloat* v ) override;
+  void Uniform2i ( GLint location, GLint x, GLint y ) override;
+  void Uniform2iv( GLint location, GLsizei count, const GLint* v ) override;
+  void Uniform3f ( GLint location, GLfloat x, GLfloat y, GLfloat z ) override;
+  void Uniform3fv( GLint location, GLsizei count, const GLfloat* v ) override;
+  void Uniform3i ( GLint location, GLint x, GLint y, GLint z ) override;
+  void Uniform3iv( GLint location, GLsizei count, const GLint* v ) override;
+  void Uniform4f ( GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w ) override;
+  void Uniform4fv( GLint location, GLsizei count, const GLfloat* v ) override;
+  void Uniform4i ( GLint location, GLint x, GLint y, GLint z, GLint w ) override;
+  void Uniform4iv( GLint location, GLsizei count, const GLint* v ) override;
+  void UniformMatrix2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value ) override;
+  void UniformMatrix3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value ) override;
+  void UniformMatrix4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value ) override;
+
+  /* OpenGL ES 3.0 API */
+  void BindVertexArray( GLuint array ) override;
+  void DeleteVertexArrays( GLsizei n, const GLuint* arrays ) override;
+  void ProgramBinary( GLuint program, GLenum binaryFormat, const GLvoid* binary, GLsizei length ) override;
+
+  void Uniform1ui( GLint location, GLuint v0 ) override;
+  void Uniform2ui( GLint location, GLuint v0, GLuint v1 ) override;
+  void Uniform3ui( GLint location, GLuint v0, GLuint v1, GLuint v2 ) override;
+  void Uniform4ui( GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3 ) override;
+  void Uniform1uiv( GLint location, GLsizei count, const GLuint* value ) override;
+  void Uniform2uiv( GLint location, GLsizei count, const GLuint* value ) override;
+  void Uniform3uiv( GLint location, GLsizei count, const GLuint* value ) override;
+  void Uniform4uiv( GLint location, GLsizei count, const GLuint* value ) override;
+  void UniformMatrix2x3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value ) override;
+  void UniformMatrix3x2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value ) override;
+  void UniformMatrix2x4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value ) override;
+  void UniformMatrix4x2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value ) override;
+  void UniformMatrix3x4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value ) override;
+  void UniformMatrix4x3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat* value ) override;
+
+private:
+
+  enum
+  {
+    MAXIMUM_TEXTURE_UNITS = 32,      ///< The texture bindings of the units above are not shadowed
+    NUMBER_OF_TEXTURE_TARGETS = 5,
+    NUMBER_OF_CAPABILITIES = 11,
+    MAXIMUM_UNIFORM_SIZE = 64        ///< A 4x4 matrix. Arrays are not shadowed
+  };
+
+  /**
+   * The shadowed state of a context.
+   */
+  struct ContextState
+  {
+    ContextState();
+
+    /**
+     * Makes all the state unknown.
+     */
+    void Reset();
+
+    GLuint activeTexture;                                                        ///< The index of the active texture unit
+    GLuint textures[ MAXIMUM_TEXTURE_UNITS ][ NUMBER_OF_TEXTURE_TARGETS ];
+    GLuint arrayBuffer;
+    GLuint elementArrayBuffer;                                                   ///< Part of the vertex array state
+    GLuint drawFramebuffer;
+    GLuint readFramebuffer;
+    GLuint renderbuffer;
+    GLuint vertexArray;
+    GLuint program;
+    GLuint blendFunc[ 4 ];
+    GLuint blendEquation[ 2 ];
+    GLuint capabilities[ NUMBER_OF_CAPABILITIES ];                               ///< GL_TRUE, GL_FALSE or unknown
+  };
+
+  /**
+   * The value of a uniform.
+   */
+  struct UniformValue
+  {
+    uint32_t size;                                                               ///< 0 if the value is unknown
+    uint8_t data[ MAXIMUM_UNIFORM_SIZE ];
+  };
+
+  typedef std::vector< UniformValue > UniformValues;                             ///< Indexed by location
+
+  /**
+   * Sets a shadowed state.
+   * @param[in,out] state The shadowed state
+   * @param[in] value The value to set
+   * @return Whether the value is different, i.e. the call has to be made
+   */
+  bool Update( GLuint& state, GLuint value );
+
+  /**
+   * Sets the shadowed value of a uniform of the current program.
+   * @param[in] location The location of the uniform
+   * @param[in] count The number of elements set
+   * @param[in] value The value of the elements
+   * @param[in] size The size of an element
+   * @return Whether the value is different or unknown, i.e. the call has to be made
+   */
+  bool UpdateUniform( GLint location, GLsizei count, const void* value, uint32_t size );
+
+  /**
+   * Sets whether a capability is enabled.
+   * @param[in] cap The capability
+   * @param[in] enabled Whether it's enabled
+   * @return Whether the call has to be made
+   */
+  bool UpdateCapability( GLenum cap, GLuint enabled );
+
+  /**
+   * Makes the bindings to deleted objects unknown in all the contexts.
+   * @param[in] n The number of objects
+   * @param[in] names The names of the objects
+   * @param[in] member The binding, which is set to a default object when the bound object is deleted
+   */
+  void UnbindDeleted( GLsizei n, const GLuint* names, GLuint ContextState::*member );
+
+  /**
+   * Makes all the state unknown.
+   */
+  void ResetState();
+
+  /**
+   * Log the filtered calls
+   */
+  void LogResults();
+
+  // Undefined copy constructor.
+  GlStateCacheImplementation( const GlStateCacheImplementation& );
+
+  // Undefined assignment operator.
+  GlStateCacheImplementation& operator=( const GlStateCacheImplementation& );
+
+private: // Data
+
+  EnvironmentOptions& mEnvironmentOptions;
+  std::unordered_map< const void*, ContextState > mContextStates;                ///< The state of each context
+  std::unordered_map< GLuint, UniformValues > mUniforms;                         ///< The uniform values of each program
+  ContextState* mState;                                                          ///< The state of the current context
+  const void* mCurrentContext;
+  Sampler mShadowedSampler;                                                      ///< The calls checked against the state
+  Sampler mFilteredSampler;                                                      ///< The calls dropped
+  int mCurrentFrameCount;
+  int mTotalFrameCount;
+};
+
+} // namespace Adaptor
+} // namespace Internal
+} // namespace Dali
+
+#endif // DALI_INTERNAL_GL_STATE_CACHE_IMPLEMENTATION_H
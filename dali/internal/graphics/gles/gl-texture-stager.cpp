@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/graphics/gles/gl-texture-stager.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <GLES2/gl2ext.h>
+
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gLogFilter = Debug::Filter::New( Debug::NoLogging, false, "LOG_GL_TEXTURE_STAGER" );
+#endif
+
+const uint32_t MINIMUM_STAGED_SIZE = 16 * 1024;   ///< The smaller uploads are quicker to copy than to stage
+const uint32_t STAGING_ALIGNMENT = 16;            ///< Aligns the pixels in the buffer for any type
+
+/**
+ * @return The number of components of a pixel format, or 0 if it's not known
+ */
+uint32_t GetComponents( GLenum format )
+{
+  switch( format )
+  {
+    case GL_ALPHA:
+    case GL_LUMINANCE:
+    case GL_RED:
+    case GL_RED_INTEGER:
+    {
+      return 1;
+    }
+    case GL_LUMINANCE_ALPHA:
+    case GL_RG:
+    case GL_RG_INTEGER:
+    {
+      return 2;
+    }
+    case GL_RGB:
+    case GL_RGB_INTEGER:
+    {
+      return 3;
+    }
+    case GL_RGBA:
+    case GL_RGBA_INTEGER:
+    case GL_BGRA_EXT:
+    {
+      return 4;
+    }
+    default:
+    {
+      return 0;
+    }
+  }
+}
+
+/**
+ * @return The size of a pixel, or 0 if it's not known
+ */
+uint32_t GetPixelSize( GLenum format, GLenum type )
+{
+  switch( type )
+  {
+    case GL_UNSIGNED_BYTE:
+    case GL_BYTE:
+    {
+      return GetComponents( format );
+    }
+    case GL_UNSIGNED_SHORT:
+    case GL_SHORT:
+    case GL_HALF_FLOAT:
+    case GL_HALF_FLOAT_OES:
+    {
+      return 2 * GetComponents( format );
+    }
+    case GL_UNSIGNED_INT:
+    case GL_INT:
+    case GL_FLOAT:
+    {
+      return 4 * GetComponents( format );
+    }
+    case GL_UNSIGNED_SHORT_5_6_5:
+    case GL_UNSIGNED_SHORT_4_4_4_4:
+    case GL_UNSIGNED_SHORT_5_5_5_1:
+    {
+      return 2;
+    }
+    case GL_UNSIGNED_INT_2_10_10_10_REV:
+    case GL_UNSIGNED_INT_10F_11F_11F_REV:
+    case GL_UNSIGNED_INT_5_9_9_9_REV:
+    {
+      return 4;
+    }
+    default:
+    {
+      return 0;
+    }
+  }
+}
+
+/**
+ * @return The bit of an unpack parameter other than the alignment, or 0 if it's not one
+ */
+uint32_t GetUnpackParameterBit( GLenum pname )
+{
+  switch( pname )
+  {
+    case GL_UNPACK_ROW_LENGTH:
+    {
+      return 1u << 0;
+    }
+    case GL_UNPACK_IMAGE_HEIGHT:
+    {
+      return 1u << 1;
+    }
+    case GL_UNPACK_SKIP_ROWS:
+    {
+      return 1u << 2;
+    }
+    case GL_UNPACK_SKIP_PIXELS:
+    {
+      return 1u << 3;
+    }
+    case GL_UNPACK_SKIP_IMAGES:
+    {
+      return 1u << 4;
+    }
+    default:
+    {
+      return 0u;
+    }
+  }
+}
+
+} // unnamed namespace
+
+GlTextureStager::GlTextureStager( Integration::GlAbstraction& gl, uint32_t frameBudget )
+: mGl( gl ),
+  mContext( NULL ),
+  mCurrentContext( NULL ),
+  mFrameBudget( frameBudget ),
+  mFrameSize( 0 ),
+  mCurrentBuffer( 0 ),
+  mUnpackAlignment( 4 ),
+  mUnpackParameters( 0 ),
+  mUnpackBufferBound( false )
+{
+  for( auto& buffer : mBuffers )
+  {
+    buffer.name = 0;
+    buffer.fence = NULL;
+  }
+}
+
+GlTextureStager::~GlTextureStager()
+{
+  // The buffers are deleted with the context
+  Release( false );
+}
+
+template< typename Upload >
+bool GlTextureStager::Stage( const void* data, uint32_t size, Upload upload )
+{
+  if( !data || mUnpackBufferBound || size < MINIMUM_STAGED_SIZE )
+  {
+    return false;
+  }
+
+  const uint32_t offset = ( mFrameSize + STAGING_ALIGNMENT - 1 ) & ~( STAGING_ALIGNMENT - 1 );
+  if( static_cast< uint64_t >( offset ) + size > mFrameBudget )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "GlTextureStager::Stage: %u bytes over the frame budget\n", size );
+    return false;
+  }
+
+  Buffer& buffer = mBuffers[ mCurrentBuffer ];
+  if( buffer.fence )
+  {
+    // The driver may still be reading the buffer, and waiting for it would block the frame
+    DALI_LOG_INFO( gLogFilter, Debug::General, "GlTextureStager::Stage: buffer %u still in use\n", mCurrentBuffer );
+    return false;
+  }
+
+  if( buffer.name == 0 )
+  {
+    if( !mCurrentContext )
+    {
+      return false;
+    }
+    if( !mContext )
+    {
+      mContext = mCurrentContext;
+    }
+
+    mGl.GenBuffers( 1, &buffer.name );
+    mGl.BindBuffer( GL_PIXEL_UNPACK_BUFFER, buffer.name );
+    mGl.BufferData( GL_PIXEL_UNPACK_BUFFER, mFrameBudget, NULL, GL_STREAM_DRAW );
+  }
+  else
+  {
+    mGl.BindBuffer( GL_PIXEL_UNPACK_BUFFER, buffer.name );
+  }
+
+  // The fence guarantees the driver is not reading this buffer anymore
+  void* mapping = mGl.MapBufferRange( GL_PIXEL_UNPACK_BUFFER, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT );
+  if( !mapping )
+  {
+    mGl.BindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+    return false;
+  }
+
+  memcpy( mapping, data, size );
+
+  if( mGl.UnmapBuffer( GL_PIXEL_UNPACK_BUFFER ) == GL_FALSE )
+  {
+    // The content of the buffer has been lost
+    mGl.BindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+    return false;
+  }
+
+  upload( reinterpret_cast< const void* >( static_cast< uintptr_t >( offset ) ) );
+  mGl.BindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+
+  mFrameSize = offset + size;
+  return true;
+}
+
+bool GlTextureStager::TexImage2D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels )
+{
+  return Stage( pixels, GetPixelsSize( width, height, format, type ), [&]( const void* stagedPixels )
+  {
+    mGl.TexImage2D( target, level, internalformat, width, height, border, format, type, stagedPixels );
+  } );
+}
+
+bool GlTextureStager::TexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels )
+{
+  return Stage( pixels, GetPixelsSize( width, height, format, type ), [&]( const void* stagedPixels )
+  {
+    mGl.TexSubImage2D( target, level, xoffset, yoffset, width, height, format, type, stagedPixels );
+  } );
+}
+
+bool GlTextureStager::CompressedTexImage2D( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data )
+{
+  return Stage( data, ( imageSize > 0 ) ? imageSize : 0, [&]( const void* stagedData )
+  {
+    mGl.CompressedTexImage2D( target, level, internalformat, width, height, border, imageSize, stagedData );
+  } );
+}
+
+bool GlTextureStager::CompressedTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data )
+{
+  return Stage( data, ( imageSize > 0 ) ? imageSize : 0, [&]( const void* stagedData )
+  {
+    mGl.CompressedTexSubImage2D( target, level, xoffset, yoffset, width, height, format, imageSize, stagedData );
+  } );
+}
+
+void GlTextureStager::PixelStorei( GLenum pname, GLint param )
+{
+  if( pname == GL_UNPACK_ALIGNMENT )
+  {
+    mUnpackAlignment = param;
+  }
+  else
+  {
+    const uint32_t bit = GetUnpackParameterBit( pname );
+    mUnpackParameters = ( param != 0 ) ? ( mUnpackParameters | bit ) : ( mUnpackParameters & ~bit );
+  }
+}
+
+void GlTextureStager::BindBuffer( GLenum target, GLuint buffer )
+{
+  if( target == GL_PIXEL_UNPACK_BUFFER )
+  {
+    mUnpackBufferBound = ( buffer != 0 );
+  }
+}
+
+void GlTextureStager::FrameEnded()
+{
+  // The fences are polled once per frame, without waiting
+  for( auto& buffer : mBuffers )
+  {
+    if( buffer.fence )
+    {
+      const GLenum status = mGl.ClientWaitSync( buffer.fence, 0, 0 );
+      if( status == GL_TIMEOUT_EXPIRED )
+      {
+        continue;
+      }
+      if( status == GL_WAIT_FAILED )
+      {
+        // The buffer can't be known to be free, so another one is created instead
+        DALI_LOG_ERROR( "GlTextureStager::FrameEnded: waiting for the fence failed\n" );
+        mGl.DeleteBuffers( 1, &buffer.name );
+        buffer.name = 0;
+      }
+      mGl.DeleteSync( buffer.fence );
+      buffer.fence = NULL;
+    }
+  }
+
+  if( mFrameSize > 0 )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "GlTextureStager::FrameEnded: %u bytes staged in buffer %u\n", mFrameSize, mCurrentBuffer );
+
+    mBuffers[ mCurrentBuffer ].fence = mGl.FenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+    mCurrentBuffer = ( mCurrentBuffer + 1 ) % NUMBER_OF_BUFFERS;
+    mFrameSize = 0;
+  }
+}
+
+void GlTextureStager::ContextMadeCurrent( const void* context )
+{
+  mCurrentContext = context;
+}
+
+void GlTextureStager::ContextDestroyed( const void* context )
+{
+  if( context == mContext )
+  {
+    // The contexts share their objects, so any current context can delete them
+    Release( mCurrentContext != NULL );
+  }
+
+  if( context == mCurrentContext )
+  {
+    mCurrentContext = NULL;
+  }
+}
+
+void GlTextureStager::Release( bool deleteBuffers )
+{
+  for( auto& buffer : mBuffers )
+  {
+    if( deleteBuffers && buffer.name != 0 )
+    {
+      mGl.DeleteBuffers( 1, &buffer.name );
+    }
+    buffer.name = 0;
+
+    if( deleteBuffers && buffer.fence )
+    {
+      mGl.DeleteSync( buffer.fence );
+    }
+    buffer.fence = NULL;
+  }
+
+  mContext = NULL;
+  mFrameSize = 0;
+  mUnpackBufferBound = false;
+}
+
+uint32_t GlTextureStager::GetPixelsSize( GLsizei width, GLsizei height, GLenum format, GLenum type ) const
+{
+  const uint32_t pixelSize = GetPixelSize( format, type );
+  if( pixelSize == 0 || mUnpackParameters != 0 || width <= 0 || height <= 0 || mUnpackAlignment <= 0 )
+  {
+    return 0;
+  }
+
+  // Each row starts at the unpack alignment, except that the last one ends at its last pixel
+  const uint64_t rowSize = static_cast< uint64_t >( width ) * pixelSize;
+  const uint64_t alignment = static_cast< uint64_t >( mUnpackAlignment );
+  const uint64_t rowStride = ( rowSize + alignment - 1 ) / alignment * alignment;
+  const uint64_t size = rowStride * ( height - 1 ) + rowSize;
+
+  return ( size <= mFrameBudget ) ? static_cast< uint32_t >( size ) : 0;
+}
+
+} // namespace Adaptor
+} // namespace Internal
+} // namespace Dali
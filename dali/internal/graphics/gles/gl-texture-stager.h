@@ -0,0 +1,179 @@
+#ifndef DALI_INTERNAL_GL_TEXTURE_STAGER_H
+#define DALI_INTERNAL_GL_TEXTURE_STAGER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <GLES3/gl3.h>
+#include <dali/integration-api/gl-abstraction.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+/**
+ * Stages the large texture uploads through a ring of pixel unpack buffers (PBO).
+ *
+ * The pixels are copied into a buffer on the render thread, when the upload is made, and the upload is made from
+ * the buffer, so the texture is ready for the draws of the frame as before. The upload isn't asynchronous: the
+ * copy of the client memory is made by the stager instead of the driver, into memory the driver can transfer to the
+ * texture later, e.g. with DMA, rather than having to copy the pixels before the call returns.
+ *
+ * The uploads of a frame are copied into one buffer, up to the per frame budget. A fence is inserted
+ * once the frame is rendered, and the buffer is only written again once the fence is signalled, so
+ * the driver may still be reading the previous frames' buffers. The uploads which don't fit, or made
+ * while the next buffer is still in use, are made directly from the client memory as before.
+ *
+ * Requires OpenGL ES 3.0. Used by the render thread only.
+ */
+class GlTextureStager
+{
+public:
+
+  /**
+   * Constructor
+   * @param[in] gl The GL calls of the stager are made through, which must not stage them again
+   * @param[in] frameBudget The maximum number of bytes staged per frame, i.e. the size of each buffer
+   */
+  GlTextureStager( Integration::GlAbstraction& gl, uint32_t frameBudget );
+
+  /**
+   * Destructor
+   */
+  ~GlTextureStager();
+
+  /**
+   * Stages the pixels of glTexImage2D.
+   * @return Whether the call has been made from a buffer, otherwise it has to be made with the pixels
+   */
+  bool TexImage2D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels );
+
+  /**
+   * Stages the pixels of glTexSubImage2D.
+   * @return Whether the call has been made from a buffer, otherwise it has to be made with the pixels
+   */
+  bool TexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels );
+
+  /**
+   * Stages the data of glCompressedTexImage2D.
+   * @return Whether the call has been made from a buffer, otherwise it has to be made with the data
+   */
+  bool CompressedTexImage2D( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data );
+
+  /**
+   * Stages the data of glCompressedTexSubImage2D.
+   * @return Whether the call has been made from a buffer, otherwise it has to be made with the data
+   */
+  bool CompressedTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data );
+
+  /**
+   * Tracks the unpack parameters the size of the pixels depends on.
+   */
+  void PixelStorei( GLenum pname, GLint param );
+
+  /**
+   * Tracks whether the caller has bound its own pixel unpack buffer, as the pixels are then an offset in it.
+   */
+  void BindBuffer( GLenum target, GLuint buffer );
+
+  /**
+   * Fences the buffer used in the frame and moves to the next one. Called once the frame is rendered.
+   */
+  void FrameEnded();
+
+  /**
+   * Tracks the current context, the buffers are created in.
+   * @param[in] context The current context, or NULL if there's none
+   */
+  void ContextMadeCurrent( const void* context );
+
+  /**
+   * Releases the buffers and the fences if they were created in the destroyed context.
+   * They are deleted if a context is still current, otherwise they are lost with the contexts.
+   * @param[in] context The context
+   */
+  void ContextDestroyed( const void* context );
+
+  /**
+   * Releases the buffers and the fences. Called when a context is created, as the previous context and
+   * its buffers are lost, or their context is destroyed. They are created again when needed.
+   * @param[in] deleteBuffers Whether the buffers and the fences are deleted, i.e. a context sharing them is current
+   */
+  void Release( bool deleteBuffers );
+
+private:
+
+  /**
+   * Copies data into the current buffer and makes an upload from it.
+   * @param[in] data The data to stage
+   * @param[in] size The size of the data
+   * @param[in] upload Makes the GL call with the given data pointer
+   * @return Whether the data has been staged and the upload made
+   */
+  template< typename Upload >
+  bool Stage( const void* data, uint32_t size, Upload upload );
+
+  /**
+   * Calculates the size of uncompressed pixels.
+   * @return The size in bytes, or 0 if it's not known, e.g. for an unusual format or unpack parameters, or over the budget
+   */
+  uint32_t GetPixelsSize( GLsizei width, GLsizei height, GLenum format, GLenum type ) const;
+
+  // Undefined copy constructor.
+  GlTextureStager( const GlTextureStager& );
+
+  // Undefined assignment operator.
+  GlTextureStager& operator=( const GlTextureStager& );
+
+private:
+
+  enum
+  {
+    NUMBER_OF_BUFFERS = 3    ///< As many frames as the driver may be behind
+  };
+
+  /**
+   * A staging buffer.
+   */
+  struct Buffer
+  {
+    GLuint name;      ///< 0 until created
+    GLsync fence;     ///< Until signalled, the driver may be reading the buffer
+  };
+
+  Integration::GlAbstraction& mGl;
+  Buffer mBuffers[ NUMBER_OF_BUFFERS ];
+  const void* mContext;                   ///< The context the buffers were created in, or NULL
+  const void* mCurrentContext;            ///< The current context, or NULL
+  const uint32_t mFrameBudget;
+  uint32_t mFrameSize;                    ///< The bytes staged in the current frame
+  unsigned int mCurrentBuffer;
+  GLint mUnpackAlignment;
+  uint32_t mUnpackParameters;             ///< A bit set for each other unpack parameter which doesn't have its default value
+  bool mUnpackBufferBound;                ///< Whether the caller has bound a pixel unpack buffer
+};
+
+} // namespace Adaptor
+} // namespace Internal
+} // namespace Dali
+
+#endif // DALI_INTERNAL_GL_TEXTURE_STAGER_H
@@ -0,0 +1,598 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/graphics/gles/shader-binary-cache.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/signals/callback.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/thread/common/worker-thread-pool-impl.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Integration::Log::Filter* gLogFilter = Integration::Log::Filter::New( Debug::NoLogging, false, "LOG_SHADER_BINARY_CACHE" );
+#endif
+
+const char ARCHIVE_MAGIC[8] = { 'D', 'A', 'L', 'I', 'S', 'B', 'C', '\0' };
+const uint32_t ARCHIVE_VERSION = 1u;
+const uint32_t RECORD_MAGIC = 0x52425344u;              ///< "DSBR"
+const uint64_t MINIMUM_COMPACTION_SIZE = 64u * 1024u;   ///< The archive isn't compacted for less than this number of bytes.
+
+/**
+ * The header of the archive.
+ */
+struct ArchiveHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t reserved;
+};
+
+/**
+ * The header of a record, followed by the name and the binary.
+ */
+struct RecordHeader
+{
+  uint32_t magic;
+  uint32_t checksum;    ///< Of the rest of the header, the name and the binary.
+  uint64_t driver;
+  uint32_t nameSize;
+  uint32_t dataSize;
+};
+
+const uint64_t ARCHIVE_HEADER_SIZE = sizeof( ArchiveHeader );
+const uint64_t RECORD_HEADER_SIZE = sizeof( RecordHeader );
+
+/**
+ * FNV-1a, 32 bits.
+ */
+uint32_t Checksum( const unsigned char* data, uint64_t size, uint32_t hash = 2166136261u )
+{
+  for( uint64_t index = 0u; index < size; ++index )
+  {
+    hash = ( hash ^ data[index] ) * 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * FNV-1a, 64 bits.
+ */
+uint64_t HashDriver( const std::string& driver )
+{
+  uint64_t hash = 14695981039346656037ull;
+  for( const char character : driver )
+  {
+    hash = ( hash ^ static_cast<unsigned char>( character ) ) * 1099511628211ull;
+  }
+  return hash;
+}
+
+uint32_t GetRecordChecksum( const RecordHeader& header, const unsigned char* name, const unsigned char* data )
+{
+  const unsigned char* fields = reinterpret_cast<const unsigned char*>( &header.driver );
+  uint32_t checksum = Checksum( fields, RECORD_HEADER_SIZE - offsetof( RecordHeader, driver ) );
+  checksum = Checksum( name, header.nameSize, checksum );
+  return Checksum( data, header.dataSize, checksum );
+}
+
+bool WriteAll( int fileDescriptor, const void* data, uint64_t size )
+{
+  const char* bytes = static_cast<const char*>( data );
+  while( size > 0u )
+  {
+    const ssize_t written = write( fileDescriptor, bytes, size );
+    if( written <= 0 )
+    {
+      return false;
+    }
+    bytes += written;
+    size -= written;
+  }
+  return true;
+}
+
+bool ReadAll( int fileDescriptor, void* data, uint64_t size, uint64_t offset )
+{
+  char* bytes = static_cast<char*>( data );
+  while( size > 0u )
+  {
+    const ssize_t bytesRead = pread( fileDescriptor, bytes, size, offset );
+    if( bytesRead <= 0 )
+    {
+      return false;
+    }
+    bytes += bytesRead;
+    size -= bytesRead;
+    offset += bytesRead;
+  }
+  return true;
+}
+
+} // unnamed namespace
+
+ShaderBinaryCache::ShaderBinaryCache( const std::string& path, WorkerThreadPool& workerThreadPool )
+: mPath( path ),
+  mWorkerThreadPool( workerThreadPool ),
+  mMutex(),
+  mIndex(),
+  mMapping( NULL ),
+  mMappingSize( 0u ),
+  mFileSize( 0u ),
+  mValidSize( 0u ),
+  mDriver( 0u ),
+  mFileDescriptor( -1 ),
+  mOpened( false ),
+  mDriverSet( false ),
+  mCompacting( false )
+{
+  // The binaries used last time are read before the first shader is created.
+  mWorkerThreadPool.AddTask( MakeCallback( this, &ShaderBinaryCache::OnOpen ), Dali::WorkerThreadPool::PREFETCH );
+}
+
+ShaderBinaryCache::~ShaderBinaryCache()
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  Close();
+}
+
+void ShaderBinaryCache::SetGraphicsDriver( const std::string& driver )
+{
+  const uint64_t hash = HashDriver( driver );
+
+  std::lock_guard<std::mutex> lock( mMutex );
+  mDriverSet = true;
+  if( hash == mDriver )
+  {
+    return;
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "ShaderBinaryCache::SetGraphicsDriver. The binaries of the previous driver are discarded : %s\n", driver.c_str() );
+
+  mDriver = hash;
+  mValidSize = 0u;
+  for( const auto& iter : mIndex )
+  {
+    if( iter.second.driver == mDriver )
+    {
+      mValidSize += iter.second.size;
+    }
+  }
+
+  RequestCompaction();
+}
+
+bool ShaderBinaryCache::Load( const std::string& name, Dali::Vector<unsigned char>& buffer )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  Open();
+
+  auto iter = mIndex.find( name );
+  if( ( iter == mIndex.end() ) || ( iter->second.driver != mDriver ) )
+  {
+    return false;
+  }
+
+  const Entry& entry = iter->second;
+  if( entry.offset + entry.size > mMappingSize )
+  {
+    // Saved since the archive was mapped.
+    munmap( const_cast<unsigned char*>( mMapping ), mMappingSize );
+    mMappingSize = 0u;
+    void* mapping = mmap( NULL, mFileSize, PROT_READ, MAP_SHARED, mFileDescriptor, 0 );
+    if( MAP_FAILED == mapping )
+    {
+      mMapping = NULL;
+      return false;
+    }
+    mMapping = static_cast<const unsigned char*>( mapping );
+    mMappingSize = mFileSize;
+  }
+
+  buffer.Resize( entry.dataSize );
+  memcpy( buffer.Begin(), mMapping + entry.offset + entry.size - entry.dataSize, entry.dataSize );
+
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "ShaderBinaryCache::Load. %s : %u bytes\n", name.c_str(), entry.dataSize );
+  return true;
+}
+
+bool ShaderBinaryCache::Save( const std::string& name, const unsigned char* buffer, unsigned int numBytes )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  if( !mDriverSet )
+  {
+    // The binary would be recorded as built by the driver which saved the last binary.
+    DALI_LOG_INFO( gLogFilter, Debug::General, "ShaderBinaryCache::Save. The graphics driver is not set, %s is not saved\n", name.c_str() );
+    return false;
+  }
+
+  Open();
+
+  if( mFileDescriptor < 0 )
+  {
+    return false;
+  }
+
+  RecordHeader header;
+  header.magic = RECORD_MAGIC;
+  header.driver = mDriver;
+  header.nameSize = static_cast<uint32_t>( name.size() );
+  header.dataSize = numBytes;
+  header.checksum = GetRecordChecksum( header, reinterpret_cast<const unsigned char*>( name.data() ), buffer );
+
+  std::vector<unsigned char> record( RECORD_HEADER_SIZE + header.nameSize + header.dataSize );
+  memcpy( record.data(), &header, RECORD_HEADER_SIZE );
+  memcpy( record.data() + RECORD_HEADER_SIZE, name.data(), header.nameSize );
+  memcpy( record.data() + RECORD_HEADER_SIZE + header.nameSize, buffer, header.dataSize );
+
+  // A single write, so a crash leaves at most one incomplete record at the end of the archive.
+  const ssize_t written = write( mFileDescriptor, record.data(), record.size() );
+  if( written != static_cast<ssize_t>( record.size() ) )
+  {
+    DALI_LOG_ERROR( "ShaderBinaryCache::Save. Unable to write %s\n", mPath.c_str() );
+    if( ( written > 0 ) && ( 0 != ftruncate( mFileDescriptor, mFileSize ) ) )
+    {
+      // The incomplete record would be followed by the next ones.
+      Close();
+    }
+    return false;
+  }
+
+  Entry& entry = mIndex[name];
+  if( ( entry.size != 0u ) && ( entry.driver == mDriver ) )
+  {
+    mValidSize -= entry.size;
+  }
+  entry.offset = mFileSize;
+  entry.size = static_cast<uint32_t>( record.size() );
+  entry.dataSize = header.dataSize;
+  entry.driver = mDriver;
+
+  mFileSize += record.size();
+  mValidSize += record.size();
+
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "ShaderBinaryCache::Save. %s : %u bytes\n", name.c_str(), numBytes );
+  return true;
+}
+
+bool ShaderBinaryCache::Contains( const std::string& name )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  Open();
+
+  auto iter = mIndex.find( name );
+  return ( iter != mIndex.end() ) && ( iter->second.driver == mDriver );
+}
+
+std::vector<std::string> ShaderBinaryCache::GetNames()
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  Open();
+
+  std::vector<std::string> names;
+  for( const auto& iter : mIndex )
+  {
+    if( iter.second.driver == mDriver )
+    {
+      names.push_back( iter.first );
+    }
+  }
+  return names;
+}
+
+void ShaderBinaryCache::OnOpen()
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  Open();
+}
+
+void ShaderBinaryCache::Open()
+{
+  if( mOpened )
+  {
+    return;
+  }
+  mOpened = true;
+
+  mFileDescriptor = open( mPath.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0600 );
+  if( mFileDescriptor < 0 )
+  {
+    DALI_LOG_ERROR( "ShaderBinaryCache::Open. Unable to open %s\n", mPath.c_str() );
+    return;
+  }
+
+  if( !ReadIndex() && !CreateArchive() )
+  {
+    DALI_LOG_ERROR( "ShaderBinaryCache::Open. Unable to create %s\n", mPath.c_str() );
+    Close();
+    return;
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "ShaderBinaryCache::Open. %s : %u binaries, %llu bytes, %llu bytes valid\n",
+                 mPath.c_str(), static_cast<unsigned int>( mIndex.size() ), static_cast<unsigned long long>( mFileSize ), static_cast<unsigned long long>( mValidSize ) );
+
+  RequestCompaction();
+}
+
+bool ShaderBinaryCache::ReadIndex()
+{
+  mIndex.clear();
+  mFileSize = 0u;
+  mValidSize = 0u;
+
+  struct stat fileStat;
+  if( ( 0 != fstat( mFileDescriptor, &fileStat ) ) || ( static_cast<uint64_t>( fileStat.st_size ) < ARCHIVE_HEADER_SIZE ) )
+  {
+    return false;
+  }
+  const uint64_t fileSize = fileStat.st_size;
+
+  void* mapping = mmap( NULL, fileSize, PROT_READ, MAP_SHARED, mFileDescriptor, 0 );
+  if( MAP_FAILED == mapping )
+  {
+    return false;
+  }
+  mMapping = static_cast<const unsigned char*>( mapping );
+  mMappingSize = fileSize;
+
+  // The whole archive is read in one go rather than a page at a time while the records are scanned.
+  madvise( mapping, fileSize, MADV_WILLNEED );
+
+  ArchiveHeader archiveHeader;
+  memcpy( &archiveHeader, mMapping, ARCHIVE_HEADER_SIZE );
+  if( ( 0 != memcmp( archiveHeader.magic, ARCHIVE_MAGIC, sizeof( ARCHIVE_MAGIC ) ) ) || ( archiveHeader.version != ARCHIVE_VERSION ) )
+  {
+    return false;
+  }
+
+  uint64_t offset = ARCHIVE_HEADER_SIZE;
+  uint64_t lastDriver = mDriver;
+  while( offset + RECORD_HEADER_SIZE <= fileSize )
+  {
+    RecordHeader header;
+    memcpy( &header, mMapping + offset, RECORD_HEADER_SIZE );
+
+    const uint64_t size = RECORD_HEADER_SIZE + header.nameSize + header.dataSize;
+    if( ( header.magic != RECORD_MAGIC ) || ( offset + size > fileSize ) )
+    {
+      break;
+    }
+
+    const unsigned char* name = mMapping + offset + RECORD_HEADER_SIZE;
+    if( header.checksum != GetRecordChecksum( header, name, name + header.nameSize ) )
+    {
+      break;
+    }
+
+    // The latest record of a binary supersedes the previous ones.
+    Entry& entry = mIndex[std::string( reinterpret_cast<const char*>( name ), header.nameSize )];
+    entry.offset = offset;
+    entry.size = static_cast<uint32_t>( size );
+    entry.dataSize = header.dataSize;
+    entry.driver = header.driver;
+
+    lastDriver = header.driver;
+    offset += size;
+  }
+
+  if( offset < fileSize )
+  {
+    DALI_LOG_ERROR( "ShaderBinaryCache::ReadIndex. %llu bytes of %s are invalid and discarded\n", static_cast<unsigned long long>( fileSize - offset ), mPath.c_str() );
+    if( 0 != ftruncate( mFileDescriptor, offset ) )
+    {
+      return false;
+    }
+  }
+  mFileSize = offset;
+
+  if( !mDriverSet )
+  {
+    // Until the render thread knows the driver, it's the one which saved the last binary.
+    mDriver = lastDriver;
+  }
+
+  for( const auto& iter : mIndex )
+  {
+    if( iter.second.driver == mDriver )
+    {
+      mValidSize += iter.second.size;
+    }
+  }
+
+  return true;
+}
+
+bool ShaderBinaryCache::CreateArchive()
+{
+  if( mMapping )
+  {
+    munmap( const_cast<unsigned char*>( mMapping ), mMappingSize );
+    mMapping = NULL;
+    mMappingSize = 0u;
+  }
+
+  ArchiveHeader header;
+  memcpy( header.magic, ARCHIVE_MAGIC, sizeof( ARCHIVE_MAGIC ) );
+  header.version = ARCHIVE_VERSION;
+  header.reserved = 0u;
+
+  if( ( 0 != ftruncate( mFileDescriptor, 0 ) ) || !WriteAll( mFileDescriptor, &header, ARCHIVE_HEADER_SIZE ) )
+  {
+    return false;
+  }
+
+  mIndex.clear();
+  mFileSize = ARCHIVE_HEADER_SIZE;
+  mValidSize = 0u;
+  return true;
+}
+
+void ShaderBinaryCache::Close()
+{
+  if( mMapping )
+  {
+    munmap( const_cast<unsigned char*>( mMapping ), mMappingSize );
+    mMapping = NULL;
+    mMappingSize = 0u;
+  }
+
+  if( mFileDescriptor >= 0 )
+  {
+    close( mFileDescriptor );
+    mFileDescriptor = -1;
+  }
+
+  mIndex.clear();
+}
+
+void ShaderBinaryCache::RequestCompaction()
+{
+  if( mCompacting || ( mFileDescriptor < 0 ) )
+  {
+    return;
+  }
+
+  const uint64_t unusedSize = mFileSize - ARCHIVE_HEADER_SIZE - mValidSize;
+  if( ( unusedSize >= MINIMUM_COMPACTION_SIZE ) && ( unusedSize > mValidSize ) )
+  {
+    mCompacting = true;
+    mWorkerThreadPool.AddTask( MakeCallback( this, &ShaderBinaryCache::Compact ), Dali::WorkerThreadPool::BACKGROUND );
+  }
+}
+
+void ShaderBinaryCache::Compact()
+{
+  std::vector<Entry> entries;
+  uint64_t compactedSize = 0u;
+  int input = -1;
+  {
+    std::lock_guard<std::mutex> lock( mMutex );
+    if( mFileDescriptor < 0 )
+    {
+      return;
+    }
+
+    for( const auto& iter : mIndex )
+    {
+      if( iter.second.driver == mDriver )
+      {
+        entries.push_back( iter.second );
+      }
+    }
+    compactedSize = mFileSize;
+
+    // Opened while locked, so it's the archive being compacted even if it's replaced.
+    input = open( mPath.c_str(), O_RDONLY | O_CLOEXEC );
+    if( input < 0 )
+    {
+      return;
+    }
+  }
+
+  // The records keep their order, which is the order the binaries were first used in.
+  std::sort( entries.begin(), entries.end(), []( const Entry& first, const Entry& second ) { return first.offset < second.offset; } );
+
+  const std::string temporaryPath = mPath + ".tmp";
+  int output = open( temporaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600 );
+  bool success = ( output >= 0 );
+
+  ArchiveHeader header;
+  memcpy( header.magic, ARCHIVE_MAGIC, sizeof( ARCHIVE_MAGIC ) );
+  header.version = ARCHIVE_VERSION;
+  header.reserved = 0u;
+  success = success && WriteAll( output, &header, ARCHIVE_HEADER_SIZE );
+
+  // Copied without the lock, so the event thread isn't blocked.
+  std::vector<unsigned char> record;
+  for( auto iter = entries.begin(); success && ( iter != entries.end() ); ++iter )
+  {
+    record.resize( iter->size );
+    success = ReadAll( input, record.data(), iter->size, iter->offset ) && WriteAll( output, record.data(), iter->size );
+  }
+
+  std::lock_guard<std::mutex> lock( mMutex );
+
+  if( success && ( mFileDescriptor >= 0 ) )
+  {
+    // The binaries saved while compacting.
+    if( mFileSize > compactedSize )
+    {
+      record.resize( mFileSize - compactedSize );
+      success = ReadAll( input, record.data(), record.size(), compactedSize ) && WriteAll( output, record.data(), record.size() );
+    }
+
+    // The data is on the disk before the archive is replaced, so it's either the old or the new archive after a crash.
+    success = success && ( 0 == fdatasync( output ) ) && ( 0 == rename( temporaryPath.c_str(), mPath.c_str() ) );
+  }
+
+  if( output >= 0 )
+  {
+    close( output );
+  }
+  close( input );
+
+  if( !success )
+  {
+    // Not tried again until the next run.
+    DALI_LOG_ERROR( "ShaderBinaryCache::Compact. Unable to compact %s\n", mPath.c_str() );
+    unlink( temporaryPath.c_str() );
+    return;
+  }
+
+  Close();
+  mFileDescriptor = open( mPath.c_str(), O_RDWR | O_APPEND | O_CLOEXEC );
+  if( ( mFileDescriptor < 0 ) || !ReadIndex() )
+  {
+    DALI_LOG_ERROR( "ShaderBinaryCache::Compact. Unable to open %s\n", mPath.c_str() );
+    Close();
+    return;
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "ShaderBinaryCache::Compact. %s : %llu bytes, was %llu bytes\n",
+                 mPath.c_str(), static_cast<unsigned long long>( mFileSize ), static_cast<unsigned long long>( compactedSize ) );
+
+  mCompacting = false;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,192 @@
+#ifndef DALI_INTERNAL_SHADER_BINARY_CACHE_H
+#define DALI_INTERNAL_SHADER_BINARY_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <dali/public-api/common/dali-vector.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class WorkerThreadPool;
+
+/**
+ * A cache of the shader program binaries stored in a single archive file.
+ *
+ * The archive is a header followed by records, each holding a binary with its name, which contains
+ * the hash of the shader sources, and the graphics driver (GL renderer and version) that built it.
+ * The binaries built by another driver are not loaded, as the driver would reject them.
+ *
+ * The archive is opened on a worker thread: it's mapped and read sequentially to build the index,
+ * so the binaries the application used last time are in memory before they're loaded.
+ *
+ * The binaries are appended to the archive with a single write each. A record that is incomplete after
+ * a crash fails its checksum and the archive is truncated before it when opened. Once the superseded and
+ * stale records take more space than the others, the archive is compacted on a worker thread into a new
+ * file which replaces it atomically.
+ *
+ * Can be used from any thread.
+ */
+class ShaderBinaryCache
+{
+public:
+
+  /**
+   * Constructor. Opens the archive on a worker thread.
+   * @param[in] path The path of the archive. It's created if it doesn't exist.
+   * @param[in] workerThreadPool The worker threads the archive is opened and compacted on.
+   */
+  ShaderBinaryCache( const std::string& path, WorkerThreadPool& workerThreadPool );
+
+  /**
+   * Destructor. The worker threads must not be running a task of the cache.
+   */
+  ~ShaderBinaryCache();
+
+  /**
+   * Sets the graphics driver the binaries are loaded for and saved with. Until it's set, it's the driver which saved the
+   * last binary. Called by the render thread once the context is created.
+   * @param[in] driver The GL renderer and version.
+   */
+  void SetGraphicsDriver( const std::string& driver );
+
+  /**
+   * Loads a binary built by the current graphics driver.
+   * @param[in] name The name of the binary.
+   * @param[out] buffer The binary.
+   * @return Whether the binary is in the cache.
+   */
+  bool Load( const std::string& name, Dali::Vector<unsigned char>& buffer );
+
+  /**
+   * Saves a binary built by the current graphics driver, replacing any binary of the same name.
+   * Refused until the graphics driver is set, as the driver which built the binary is not known.
+   * @param[in] name The name of the binary.
+   * @param[in] buffer The binary.
+   * @param[in] numBytes The size of the binary.
+   * @return Whether the binary has been written to the archive.
+   */
+  bool Save( const std::string& name, const unsigned char* buffer, unsigned int numBytes );
+
+  /**
+   * Checks whether there's a binary built by the current graphics driver.
+   * @param[in] name The name of the binary.
+   * @return Whether the binary is in the cache.
+   */
+  bool Contains( const std::string& name );
+
+  /**
+   * Retrieves the names of the binaries built by the current graphics driver.
+   * @return The names, in the order of the index.
+   */
+  std::vector<std::string> GetNames();
+
+private:
+
+  /**
+   * The location of a binary in the archive.
+   */
+  struct Entry
+  {
+    uint64_t offset;       ///< The offset of the record.
+    uint32_t size;         ///< The size of the record.
+    uint32_t dataSize;     ///< The size of the binary, which ends the record.
+    uint64_t driver;       ///< The hash of the driver which built the binary.
+  };
+
+  /**
+   * Opens the archive on a worker thread.
+   */
+  void OnOpen();
+
+  /**
+   * Opens the archive if it's not open. Called with mMutex locked.
+   */
+  void Open();
+
+  /**
+   * Maps the archive and builds the index. Called with mMutex locked.
+   * @return Whether the archive is valid.
+   */
+  bool ReadIndex();
+
+  /**
+   * Creates an empty archive. Called with mMutex locked.
+   * @return Whether the archive has been created.
+   */
+  bool CreateArchive();
+
+  /**
+   * Unmaps and closes the archive. Called with mMutex locked.
+   */
+  void Close();
+
+  /**
+   * Compacts the archive if enough of it is superseded or stale. Called with mMutex locked.
+   */
+  void RequestCompaction();
+
+  /**
+   * Writes the valid records to a new archive and replaces the current one by it. Runs on a worker thread.
+   */
+  void Compact();
+
+  // Undefined copy constructor.
+  ShaderBinaryCache( const ShaderBinaryCache& );
+
+  // Undefined assignment operator.
+  ShaderBinaryCache& operator=( const ShaderBinaryCache& );
+
+private:
+
+  using Index = std::unordered_map<std::string, Entry>;
+
+  const std::string mPath;
+  WorkerThreadPool& mWorkerThreadPool;
+  std::mutex mMutex;                     ///< Protects the members below.
+  Index mIndex;                          ///< The latest record of each binary.
+  const unsigned char* mMapping;         ///< The archive, mapped up to mMappingSize.
+  uint64_t mMappingSize;
+  uint64_t mFileSize;
+  uint64_t mValidSize;                   ///< The size of the records in the index built by the current driver.
+  uint64_t mDriver;                      ///< The hash of the current driver.
+  int mFileDescriptor;                   ///< Opened for appending, -1 if the archive can't be used.
+  bool mOpened;                          ///< Whether the archive has been opened, successfully or not.
+  bool mDriverSet;                       ///< Whether the render thread has set the driver.
+  bool mCompacting;                      ///< Whether a compaction is queued or running.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SHADER_BINARY_CACHE_H
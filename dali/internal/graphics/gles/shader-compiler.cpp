@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/graphics/gles/shader-compiler.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <unordered_set>
+#include <EGL/egl.h>
+#include <dali/devel-api/common/hash.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/dali-core-version.h>
+#include <dali/public-api/signals/callback.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/graphics/gles/egl-implementation.h>
+#include <dali/internal/graphics/gles/gl-implementation.h>
+#include <dali/internal/graphics/gles/shader-binary-cache.h>
+#include <dali/internal/thread/common/worker-thread-pool-impl.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Integration::Log::Filter* gLogFilter = Integration::Log::Filter::New( Debug::NoLogging, false, "LOG_SHADER_COMPILER" );
+#endif
+
+const GLuint ALL_COMPILER_THREADS = 0xFFFFFFFFu;        ///< Lets the driver choose the number of compiler threads.
+
+using MaxShaderCompilerThreadsFunction = void (GL_APIENTRY*)( GLuint count );
+
+/**
+ * An EGL context sharing the objects of the render thread's resource context.
+ */
+class EglSharedContext : public ShaderCompiler::Context
+{
+public:
+
+  EglSharedContext( EGLDisplay eglDisplay, EGLContext eglContext )
+  : mEglDisplay( eglDisplay ),
+    mEglContext( eglContext ),
+    mGlImplementation()
+  {
+  }
+
+  ~EglSharedContext() override
+  {
+    eglDestroyContext( mEglDisplay, mEglContext );
+  }
+
+  bool MakeCurrent() override
+  {
+    return eglMakeCurrent( mEglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, mEglContext ) == EGL_TRUE;
+  }
+
+  void ReleaseCurrent() override
+  {
+    eglMakeCurrent( mEglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+  }
+
+  void EnableParallelCompilation() override
+  {
+    const char* extensions = reinterpret_cast<const char*>( mGlImplementation.GetString( GL_EXTENSIONS ) );
+    if( extensions && strstr( extensions, "GL_KHR_parallel_shader_compile" ) )
+    {
+      MaxShaderCompilerThreadsFunction maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsFunction>( eglGetProcAddress( "glMaxShaderCompilerThreadsKHR" ) );
+      if( maxShaderCompilerThreads )
+      {
+        maxShaderCompilerThreads( ALL_COMPILER_THREADS );
+        DALI_LOG_INFO( gLogFilter, Debug::General, "EglSharedContext::EnableParallelCompilation. Parallel shader compilation enabled\n" );
+      }
+    }
+  }
+
+  Integration::GlAbstraction& GetGlAbstraction() override
+  {
+    return mGlImplementation;
+  }
+
+private:
+
+  EGLDisplay mEglDisplay;
+  EGLContext mEglContext;
+  GlImplementation mGlImplementation;     ///< Makes the calls directly to the driver, without the wrappers of the render thread.
+};
+
+} // unnamed namespace
+
+std::string ShaderCompiler::GetBinaryName( const std::string& vertexSource, const std::string& fragmentSource )
+{
+  std::ostringstream name;
+  name << CORE_MAJOR_VERSION << '-' << CORE_MINOR_VERSION << '-' << CORE_MICRO_VERSION << '-'
+       << CalculateHash( vertexSource, fragmentSource ) << ".dali-bin";
+  return name.str();
+}
+
+ShaderCompiler::ShaderCompiler( ShaderBinaryCache& shaderBinaryCache, WorkerThreadPool& workerThreadPool )
+: mShaderBinaryCache( shaderBinaryCache ),
+  mWorkerThreadPool( workerThreadPool ),
+  mMutex(),
+  mCondition(),
+  mRequests(),
+  mContext(),
+  mBinaryFormat( GL_NONE ),
+  mStarted( false ),
+  mPrepared( false ),
+  mTaskQueued( false ),
+  mTaskRunning( false )
+{
+}
+
+ShaderCompiler::~ShaderCompiler()
+{
+}
+
+bool ShaderCompiler::Start( EglImplementation& eglImplementation )
+{
+  if( eglImplementation.GetGlesVersion() < 30 )
+  {
+    // The binaries can't be retrieved
+    return false;
+  }
+
+  EGLContext eglContext = eglImplementation.CreateSharedContext();
+  if( eglContext == EGL_NO_CONTEXT )
+  {
+    DALI_LOG_ERROR( "ShaderCompiler::Start. The shared context can't be created\n" );
+    return false;
+  }
+
+  return Start( std::unique_ptr<Context>( new EglSharedContext( eglImplementation.GetDisplay(), eglContext ) ) );
+}
+
+bool ShaderCompiler::Start( std::unique_ptr<Context> context )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  if( mStarted || !context )
+  {
+    return false;
+  }
+
+  mContext = std::move( context );
+  mStarted = true;
+  mPrepared = false;
+
+  // A task deleted by the pool while the compiler was stopped never ran
+  mTaskQueued = false;
+  if( !mRequests.empty() )
+  {
+    QueueTask();
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "ShaderCompiler::Start. %u requests\n", static_cast<unsigned int>( mRequests.size() ) );
+  return true;
+}
+
+void ShaderCompiler::Stop()
+{
+  std::unique_lock<std::mutex> lock( mMutex );
+  if( !mStarted )
+  {
+    return;
+  }
+
+  mStarted = false;
+  mCondition.wait( lock, [this]{ return !mTaskRunning; } );
+
+  mContext.reset();
+}
+
+void ShaderCompiler::Compile( const std::string& name, const std::string& vertexSource, const std::string& fragmentSource )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  mRequests.push_back( Request{ name, vertexSource, fragmentSource } );
+
+  if( mStarted )
+  {
+    QueueTask();
+  }
+}
+
+void ShaderCompiler::QueueTask()
+{
+  if( !mTaskQueued )
+  {
+    mTaskQueued = true;
+    mWorkerThreadPool.AddTask( MakeCallback( this, &ShaderCompiler::Run ), Dali::WorkerThreadPool::PREFETCH );
+  }
+}
+
+void ShaderCompiler::Run()
+{
+  std::unique_lock<std::mutex> lock( mMutex );
+  mTaskQueued = false;
+  if( !mStarted || mTaskRunning )
+  {
+    return;
+  }
+  mTaskRunning = true;
+
+  // The context is only destroyed once the task has stopped running
+  Context& context = *mContext;
+  Integration::GlAbstraction& gl = context.GetGlAbstraction();
+
+  bool current = false;
+  std::vector<Request> requests;
+  while( mStarted && !mRequests.empty() )
+  {
+    requests.swap( mRequests );
+    lock.unlock();
+
+    if( !current )
+    {
+      current = context.MakeCurrent();
+      if( current && !mPrepared )
+      {
+        Prepare( gl );
+        context.EnableParallelCompilation();
+      }
+    }
+
+    if( current && mBinaryFormat != GL_NONE )
+    {
+      CompileBatch( gl, requests );
+    }
+    else
+    {
+      DALI_LOG_ERROR( "ShaderCompiler::Run. The shared context can't be used, %u requests dropped\n", static_cast<unsigned int>( requests.size() ) );
+    }
+
+    requests.clear();
+    lock.lock();
+  }
+
+  // Released with the lock held, so a request made meanwhile queues a task which can run
+  if( current )
+  {
+    context.ReleaseCurrent();
+  }
+
+  mTaskRunning = false;
+  mCondition.notify_all();
+}
+
+void ShaderCompiler::Prepare( Integration::GlAbstraction& gl )
+{
+  mPrepared = true;
+
+  // The render thread loads the binaries with the first format, so the others are not saved
+  GLint numberOfFormats = 0;
+  gl.GetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &numberOfFormats );
+  if( numberOfFormats > 0 )
+  {
+    std::vector<GLint> formats( numberOfFormats );
+    gl.GetIntegerv( GL_PROGRAM_BINARY_FORMATS, formats.data() );
+    mBinaryFormat = static_cast<GLenum>( formats[0] );
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "ShaderCompiler::Prepare. Binary format : 0x%x\n", mBinaryFormat );
+}
+
+void ShaderCompiler::CompileBatch( Integration::GlAbstraction& gl, const std::vector<Request>& requests )
+{
+  std::unordered_set<std::string> names;
+  std::vector<Program> programs;
+  programs.reserve( requests.size() );
+
+  for( const auto& request : requests )
+  {
+    if( !names.insert( request.name ).second || mShaderBinaryCache.Contains( request.name ) )
+    {
+      continue;
+    }
+
+    Program program;
+    program.request = &request;
+    program.vertexShader = CreateShader( gl, GL_VERTEX_SHADER, request.vertexSource );
+    program.fragmentShader = CreateShader( gl, GL_FRAGMENT_SHADER, request.fragmentSource );
+    program.program = gl.CreateProgram();
+    gl.AttachShader( program.program, program.vertexShader );
+    gl.AttachShader( program.program, program.fragmentShader );
+    gl.ProgramParameteri( program.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+    gl.LinkProgram( program.program );
+    programs.push_back( program );
+  }
+
+  // Querying the status waits for the compilation, so it's done once they're all started
+  for( const auto& program : programs )
+  {
+    GLint linked = GL_FALSE;
+    gl.GetProgramiv( program.program, GL_LINK_STATUS, &linked );
+    if( linked == GL_TRUE )
+    {
+      SaveBinary( gl, program );
+    }
+    else
+    {
+      DALI_LOG_ERROR( "ShaderCompiler::CompileBatch. %s failed to link\n", program.request->name.c_str() );
+    }
+
+    gl.DeleteShader( program.vertexShader );
+    gl.DeleteShader( program.fragmentShader );
+    gl.DeleteProgram( program.program );
+  }
+}
+
+GLuint ShaderCompiler::CreateShader( Integration::GlAbstraction& gl, GLenum type, const std::string& source )
+{
+  GLuint shader = gl.CreateShader( type );
+  const GLchar* sourceString = source.c_str();
+  const GLint sourceLength = static_cast<GLint>( source.size() );
+  gl.ShaderSource( shader, 1, &sourceString, &sourceLength );
+  gl.CompileShader( shader );
+  return shader;
+}
+
+void ShaderCompiler::SaveBinary( Integration::GlAbstraction& gl, const Program& program )
+{
+  GLint length = 0;
+  gl.GetProgramiv( program.program, GL_PROGRAM_BINARY_LENGTH, &length );
+  if( length <= 0 )
+  {
+    return;
+  }
+
+  std::vector<unsigned char> binary( length );
+  GLsizei written = 0;
+  GLenum format = GL_NONE;
+  gl.GetProgramBinary( program.program, length, &written, &format, binary.data() );
+  if( written <= 0 || format != mBinaryFormat )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::General, "ShaderCompiler::SaveBinary. %s has no binary in the format 0x%x\n", program.request->name.c_str(), mBinaryFormat );
+    return;
+  }
+
+  mShaderBinaryCache.Save( program.request->name, binary.data(), static_cast<unsigned int>( written ) );
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "ShaderCompiler::SaveBinary. %s : %d bytes\n", program.request->name.c_str(), written );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
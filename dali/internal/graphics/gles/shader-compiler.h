@@ -0,0 +1,232 @@
+#ifndef DALI_INTERNAL_SHADER_COMPILER_H
+#define DALI_INTERNAL_SHADER_COMPILER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <GLES3/gl3.h>
+#include <dali/integration-api/gl-abstraction.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class EglImplementation;
+class ShaderBinaryCache;
+class WorkerThreadPool;
+
+/**
+ * Compiles shader programs on a worker thread, with an EGL context sharing the objects of the render thread's
+ * resource context, and saves their binaries in the shader binary cache.
+ *
+ * The programs are saved under the name the render thread looks them up with, so it loads the binary instead of
+ * compiling the sources when it first needs the program. The programs which are already in the cache are skipped.
+ * The programs themselves are deleted once their binaries are saved, as core creates its own programs.
+ *
+ * The shaders of a batch are all compiled and linked before their status is queried, so a driver supporting
+ * GL_KHR_parallel_shader_compile compiles them on its own threads.
+ *
+ * Requires OpenGL ES 3.0 and a surfaceless resource context. Compile() can be called from any thread.
+ */
+class ShaderCompiler
+{
+public:
+
+  /**
+   * The context the programs are compiled in, sharing the objects of the render thread's resource context.
+   */
+  class Context
+  {
+  public:
+
+    /**
+     * Virtual destructor. Destroys the context.
+     */
+    virtual ~Context() {}
+
+    /**
+     * Makes the context current on the calling thread.
+     * @return Whether the context is current.
+     */
+    virtual bool MakeCurrent() = 0;
+
+    /**
+     * Releases the context from the calling thread.
+     */
+    virtual void ReleaseCurrent() = 0;
+
+    /**
+     * Lets the driver compile the shaders on its own threads, if it supports GL_KHR_parallel_shader_compile.
+     * Called the first time the context is current.
+     */
+    virtual void EnableParallelCompilation() = 0;
+
+    /**
+     * @return The GL calls are made through while the context is current.
+     */
+    virtual Integration::GlAbstraction& GetGlAbstraction() = 0;
+  };
+
+  /**
+   * Builds the name core loads the binary of a program with, e.g. "2-0-1-1234567890.dali-bin".
+   * @param[in] vertexSource The source of the vertex shader.
+   * @param[in] fragmentSource The source of the fragment shader.
+   * @return The version of core followed by the hash of the sources.
+   */
+  static std::string GetBinaryName( const std::string& vertexSource, const std::string& fragmentSource );
+
+  /**
+   * Constructor
+   * @param[in] shaderBinaryCache The cache the binaries are saved in.
+   * @param[in] workerThreadPool The worker threads the programs are compiled on.
+   */
+  ShaderCompiler( ShaderBinaryCache& shaderBinaryCache, WorkerThreadPool& workerThreadPool );
+
+  /**
+   * Destructor. Must be stopped.
+   */
+  ~ShaderCompiler();
+
+  /**
+   * Creates the shared context and starts compiling. Called by the render thread once its resource context is
+   * created and the graphics driver is set in the cache.
+   * @param[in] eglImplementation The EGL implementation of the render thread.
+   * @return Whether the compiler has started.
+   */
+  bool Start( EglImplementation& eglImplementation );
+
+  /**
+   * Starts compiling in the given context.
+   * @param[in] context The context, destroyed once stopped.
+   * @return Whether the compiler has started.
+   */
+  bool Start( std::unique_ptr<Context> context );
+
+  /**
+   * Waits for the running batch and destroys the shared context. Called by the render thread before EGL is terminated.
+   */
+  void Stop();
+
+  /**
+   * Requests a program to be compiled. The requests made before the compiler is started are kept until then.
+   * @param[in] name The name the binary is saved under.
+   * @param[in] vertexSource The source of the vertex shader.
+   * @param[in] fragmentSource The source of the fragment shader.
+   */
+  void Compile( const std::string& name, const std::string& vertexSource, const std::string& fragmentSource );
+
+private:
+
+  /**
+   * A program to compile.
+   */
+  struct Request
+  {
+    std::string name;
+    std::string vertexSource;
+    std::string fragmentSource;
+  };
+
+  /**
+   * A program being compiled.
+   */
+  struct Program
+  {
+    const Request* request;
+    GLuint vertexShader;
+    GLuint fragmentShader;
+    GLuint program;
+  };
+
+  /**
+   * Queues the task if it's not queued. Called with mMutex locked.
+   */
+  void QueueTask();
+
+  /**
+   * Compiles the requests until there are none left. Runs on a worker thread.
+   */
+  void Run();
+
+  /**
+   * Queries the binary format and enables the parallel compilation. Called the first time the context is current.
+   * @param[in] gl The GL implementation of the context.
+   */
+  void Prepare( Integration::GlAbstraction& gl );
+
+  /**
+   * Compiles a batch of requests and saves the binaries.
+   * @param[in] gl The GL implementation of the context.
+   * @param[in] requests The requests.
+   */
+  void CompileBatch( Integration::GlAbstraction& gl, const std::vector<Request>& requests );
+
+  /**
+   * Creates a shader and starts compiling it.
+   * @param[in] gl The GL implementation of the context.
+   * @param[in] type The type of the shader.
+   * @param[in] source The source of the shader.
+   * @return The shader.
+   */
+  GLuint CreateShader( Integration::GlAbstraction& gl, GLenum type, const std::string& source );
+
+  /**
+   * Saves the binary of a linked program.
+   * @param[in] gl The GL implementation of the context.
+   * @param[in] program The program.
+   */
+  void SaveBinary( Integration::GlAbstraction& gl, const Program& program );
+
+  // Undefined copy constructor.
+  ShaderCompiler( const ShaderCompiler& );
+
+  // Undefined assignment operator.
+  ShaderCompiler& operator=( const ShaderCompiler& );
+
+private:
+
+  ShaderBinaryCache& mShaderBinaryCache;
+  WorkerThreadPool& mWorkerThreadPool;
+  std::mutex mMutex;                          ///< Protects the members below.
+  std::condition_variable mCondition;         ///< Signalled when the task stops running.
+  std::vector<Request> mRequests;             ///< The programs waiting to be compiled.
+  std::unique_ptr<Context> mContext;          ///< Shares the objects of the resource context, current in the task only.
+  GLenum mBinaryFormat;                       ///< The format the render thread loads the binaries with, GL_NONE until queried.
+  bool mStarted;
+  bool mPrepared;                             ///< Whether Prepare() has been called.
+  bool mTaskQueued;
+  bool mTaskRunning;
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SHADER_COMPILER_H
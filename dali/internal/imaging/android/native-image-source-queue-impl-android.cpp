@@ -76,6 +76,25 @@ void NativeImageSourceQueueAndroid::IgnoreSourceImage()
 {
 }
 
+bool NativeImageSourceQueueAndroid::DequeueBuffer( uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride, Pixel::Format& pixelFormat )
+{
+  return false;
+}
+
+bool NativeImageSourceQueueAndroid::EnqueueBuffer( uint8_t* buffer )
+{
+  return false;
+}
+
+void NativeImageSourceQueueAndroid::CancelDequeuedBuffer( uint8_t* buffer )
+{
+}
+
+Dali::NativeImageSourceQueue::BufferStatistics NativeImageSourceQueueAndroid::GetBufferStatistics() const
+{
+  return Dali::NativeImageSourceQueue::BufferStatistics{ 0u, 0u, 0u, 0u, 0u };
+}
+
 bool NativeImageSourceQueueAndroid::CreateResource()
 {
   return true;
@@ -68,6 +68,26 @@ public:
    */
   void IgnoreSourceImage() override;
 
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::DequeueBuffer
+   */
+  bool DequeueBuffer( uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride, Pixel::Format& pixelFormat ) override;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::EnqueueBuffer
+   */
+  bool EnqueueBuffer( uint8_t* buffer ) override;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::CancelDequeuedBuffer
+   */
+  void CancelDequeuedBuffer( uint8_t* buffer ) override;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::GetBufferStatistics
+   */
+  Dali::NativeImageSourceQueue::BufferStatistics GetBufferStatistics() const override;
+
   /**
    * destructor
    */
@@ -31,6 +31,7 @@
 #include <dali/devel-api/adaptor-framework/image-loader-input.h>
 #include <dali/internal/imaging/common/image-loader-plugin-proxy.h>
 #include <dali/internal/system/common/file-reader.h>
+#include <dali/integration-api/trace.h>
 
 using namespace Dali::Integration;
 
@@ -45,6 +46,8 @@ namespace
 Integration::Log::Filter* gLogFilter = Debug::Filter::New( Debug::Concise, false, "LOG_IMAGE_LOADING" );
 #endif
 
+DALI_INIT_TRACE_FILTER( gTraceFilter, DALI_TRACE_IMAGE_LOADING, false );
+
 static unsigned int gMaxTextureSize = 4096;
 
 static bool gMaxTextureSizeUpdated = false;
@@ -254,6 +257,7 @@ namespace ImageLoader
 bool ConvertStreamToBitmap( const BitmapResourceType& resource, std::string path, FILE * const fp, Dali::Devel::PixelBuffer& pixelBuffer )
 {
   DALI_LOG_TRACE_METHOD( gLogFilter );
+  DALI_TRACE_SCOPE( gTraceFilter, "DALI_IMAGE_LOADING" );
 
   bool result = false;
 
@@ -57,6 +57,26 @@ public:
    */
   virtual void IgnoreSourceImage() = 0;
 
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::DequeueBuffer
+   */
+  virtual bool DequeueBuffer( uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride, Pixel::Format& pixelFormat ) = 0;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::EnqueueBuffer
+   */
+  virtual bool EnqueueBuffer( uint8_t* buffer ) = 0;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::CancelDequeuedBuffer
+   */
+  virtual void CancelDequeuedBuffer( uint8_t* buffer ) = 0;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::GetBufferStatistics
+   */
+  virtual Dali::NativeImageSourceQueue::BufferStatistics GetBufferStatistics() const = 0;
+
   /**
    * destructor
    */
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/shared-buffer-queue.h>
+
+// EXTERNAL INCLUDES
+#include <stdlib.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Integration::Log::Filter* gLogFilter = Integration::Log::Filter::New( Debug::NoLogging, false, "LOG_SHARED_BUFFER_QUEUE" );
+#endif
+
+const uint32_t MINIMUM_NUMBER_OF_BUFFERS = 2u;  ///< One buffer read by the consumer while another is written.
+const uint32_t ROW_ALIGNMENT = 4u;              ///< The default unpack alignment of GL.
+const uint32_t REPORT_INTERVAL = 600u;          ///< The number of buffers consumed between reports.
+
+} // unnamed namespace
+
+SharedBufferQueue::SharedBufferQueue( uint32_t numberOfBuffers )
+: mMutex(),
+  mBuffers( ( numberOfBuffers > MINIMUM_NUMBER_OF_BUFFERS ) ? numberOfBuffers : MINIMUM_NUMBER_OF_BUFFERS ),
+  mStatistics{ 0u, 0u, 0u, 0u, 0u },
+  mWidth( 0u ),
+  mHeight( 0u ),
+  mStride( 0u ),
+  mSequence( 0u )
+{
+  for( auto& buffer : mBuffers )
+  {
+    buffer = Buffer{ NULL, 0u, 0u, 0u, 0u, 0u, FREE };
+  }
+}
+
+SharedBufferQueue::~SharedBufferQueue()
+{
+  for( auto& buffer : mBuffers )
+  {
+    Free( buffer );
+  }
+
+  if( 0u != mStatistics.enqueuedBuffers )
+  {
+    OutputReport();
+  }
+}
+
+void SharedBufferQueue::SetSize( uint32_t width, uint32_t height, uint32_t bytesPerPixel )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+
+  mWidth = width;
+  mHeight = height;
+  mStride = ( width * bytesPerPixel + ROW_ALIGNMENT - 1u ) & ~( ROW_ALIGNMENT - 1u );
+
+  for( auto& buffer : mBuffers )
+  {
+    if( buffer.state == QUEUED )
+    {
+      ++mStatistics.droppedBuffers;
+      buffer.state = FREE;
+    }
+
+    // The buffers in use are reallocated when they're returned
+    if( buffer.state == FREE )
+    {
+      Free( buffer );
+    }
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "SharedBufferQueue::SetSize. %u x %u, stride : %u\n", mWidth, mHeight, mStride );
+}
+
+bool SharedBufferQueue::Dequeue( uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+
+  Buffer* freeBuffer = Find( NULL, FREE );
+  if( !freeBuffer )
+  {
+    // The consumer hasn't caught up, so the oldest frame is never shown
+    freeBuffer = FindOldestQueued();
+    if( freeBuffer )
+    {
+      ++mStatistics.droppedBuffers;
+      freeBuffer->state = FREE;
+    }
+  }
+
+  if( !freeBuffer || ( 0u == freeBuffer->size && !Allocate( *freeBuffer ) ) )
+  {
+    ++mStatistics.dequeueFailures;
+    return false;
+  }
+
+  freeBuffer->state = DEQUEUED;
+  buffer = freeBuffer->data;
+  width = freeBuffer->width;
+  height = freeBuffer->height;
+  stride = freeBuffer->stride;
+  return true;
+}
+
+bool SharedBufferQueue::Enqueue( uint8_t* data )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+
+  Buffer* buffer = Find( data, DEQUEUED );
+  if( !buffer )
+  {
+    DALI_LOG_ERROR( "SharedBufferQueue::Enqueue. %p is not a dequeued buffer\n", data );
+    return false;
+  }
+
+  if( buffer->width != mWidth || buffer->height != mHeight )
+  {
+    // Written before the size changed
+    Recycle( *buffer );
+    return false;
+  }
+
+  buffer->state = QUEUED;
+  buffer->sequence = mSequence++;
+  ++mStatistics.enqueuedBuffers;
+  return true;
+}
+
+void SharedBufferQueue::CancelDequeue( uint8_t* data )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+
+  Buffer* buffer = Find( data, DEQUEUED );
+  if( buffer )
+  {
+    Recycle( *buffer );
+  }
+}
+
+const uint8_t* SharedBufferQueue::Acquire( uint32_t& width, uint32_t& height, uint32_t& stride )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+
+  // The sequence wraps around, so the buffers are compared by their distance from the next sequence
+  Buffer* latest = NULL;
+  for( auto& buffer : mBuffers )
+  {
+    if( buffer.state != QUEUED )
+    {
+      continue;
+    }
+
+    if( !latest || mSequence - buffer.sequence < mSequence - latest->sequence )
+    {
+      if( latest )
+      {
+        ++mStatistics.droppedBuffers;
+        latest->state = FREE;
+      }
+      latest = &buffer;
+    }
+    else
+    {
+      ++mStatistics.droppedBuffers;
+      buffer.state = FREE;
+    }
+  }
+
+  if( !latest )
+  {
+    return NULL;
+  }
+
+  latest->state = ACQUIRED;
+  width = latest->width;
+  height = latest->height;
+  stride = latest->stride;
+
+  ++mStatistics.consumedBuffers;
+  if( 0u == mStatistics.consumedBuffers % REPORT_INTERVAL )
+  {
+    OutputReport();
+  }
+
+  return latest->data;
+}
+
+void SharedBufferQueue::Release( const uint8_t* data )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+
+  Buffer* buffer = Find( data, ACQUIRED );
+  if( buffer )
+  {
+    Recycle( *buffer );
+  }
+}
+
+void SharedBufferQueue::DropOldest()
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+
+  Buffer* buffer = FindOldestQueued();
+  if( buffer )
+  {
+    ++mStatistics.droppedBuffers;
+    buffer->state = FREE;
+  }
+}
+
+Dali::NativeImageSourceQueue::BufferStatistics SharedBufferQueue::GetStatistics() const
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+
+  Dali::NativeImageSourceQueue::BufferStatistics statistics = mStatistics;
+  statistics.queueDepth = 0u;
+  for( const auto& buffer : mBuffers )
+  {
+    if( buffer.state == QUEUED )
+    {
+      ++statistics.queueDepth;
+    }
+  }
+  return statistics;
+}
+
+bool SharedBufferQueue::Allocate( Buffer& buffer )
+{
+  const size_t size = static_cast<size_t>( mStride ) * mHeight;
+  if( 0u == size )
+  {
+    return false;
+  }
+
+  uint8_t* data = static_cast<uint8_t*>( malloc( size ) );
+  if( !data )
+  {
+    DALI_LOG_ERROR( "SharedBufferQueue::Allocate. %zu bytes can't be allocated\n", size );
+    return false;
+  }
+
+  buffer.data = data;
+  buffer.size = size;
+  buffer.width = mWidth;
+  buffer.height = mHeight;
+  buffer.stride = mStride;
+  return true;
+}
+
+void SharedBufferQueue::Free( Buffer& buffer )
+{
+  free( buffer.data );
+
+  buffer.data = NULL;
+  buffer.size = 0u;
+}
+
+void SharedBufferQueue::Recycle( Buffer& buffer )
+{
+  buffer.state = FREE;
+  if( buffer.width != mWidth || buffer.height != mHeight || buffer.stride != mStride )
+  {
+    // Allocated again in the current size when it's dequeued
+    Free( buffer );
+  }
+}
+
+SharedBufferQueue::Buffer* SharedBufferQueue::Find( const uint8_t* data, State state )
+{
+  for( auto& buffer : mBuffers )
+  {
+    if( buffer.state == state && ( !data || buffer.data == data ) )
+    {
+      return &buffer;
+    }
+  }
+  return NULL;
+}
+
+SharedBufferQueue::Buffer* SharedBufferQueue::FindOldestQueued()
+{
+  Buffer* oldest = NULL;
+  for( auto& buffer : mBuffers )
+  {
+    if( buffer.state == QUEUED && ( !oldest || mSequence - buffer.sequence > mSequence - oldest->sequence ) )
+    {
+      oldest = &buffer;
+    }
+  }
+  return oldest;
+}
+
+void SharedBufferQueue::OutputReport() const
+{
+  DALI_LOG_INFO( gLogFilter, Debug::General, "SharedBufferQueue: enqueued %u, consumed %u, dropped %u, dequeue failures %u\n",
+                 mStatistics.enqueuedBuffers, mStatistics.consumedBuffers, mStatistics.droppedBuffers, mStatistics.dequeueFailures );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,198 @@
+#ifndef DALI_INTERNAL_SHARED_BUFFER_QUEUE_H
+#define DALI_INTERNAL_SHARED_BUFFER_QUEUE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/native-image-source-queue.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * A fixed pool of buffers in CPU memory, passed from a producer writing them to a consumer reading them.
+ *
+ * A buffer is free, dequeued by the producer, queued, or acquired by the consumer. The producer dequeues a free
+ * buffer, writes it and enqueues it. The consumer acquires the latest queued buffer, reads it and releases it,
+ * so the buffer is only handed to the producer again once the consumer has finished reading it. The older queued
+ * buffers are dropped when a newer one is acquired, so the consumer doesn't fall behind the producer. When no
+ * buffer is free, the oldest queued buffer is dropped to be dequeued again, so the producer only fails to dequeue
+ * while all the buffers are dequeued or acquired.
+ *
+ * The buffers are allocated in the process, as the producers are its own threads. The rows of the buffers are
+ * aligned to 4 bytes, the default unpack alignment of GL.
+ *
+ * Can be used from any thread.
+ */
+class SharedBufferQueue
+{
+public:
+
+  /**
+   * Constructor. The buffers are allocated once the size is set.
+   * @param[in] numberOfBuffers The number of buffers of the pool, at least two.
+   */
+  SharedBufferQueue( uint32_t numberOfBuffers );
+
+  /**
+   * Destructor. Releases the memory of the buffers, even the dequeued and acquired ones.
+   */
+  ~SharedBufferQueue();
+
+  /**
+   * Sets the size of the buffers. The queued buffers are dropped, and the buffers in use are reallocated once
+   * they are returned. The buffers of the previous size can't be enqueued.
+   * @param[in] width The width of the buffers in pixels.
+   * @param[in] height The height of the buffers in pixels.
+   * @param[in] bytesPerPixel The number of bytes of a pixel.
+   */
+  void SetSize( uint32_t width, uint32_t height, uint32_t bytesPerPixel );
+
+  /**
+   * Dequeues a free buffer, to be written and then enqueued.
+   * @param[out] buffer The pixels of the buffer.
+   * @param[out] width The width of the buffer.
+   * @param[out] height The height of the buffer.
+   * @param[out] stride The number of bytes of a row of the buffer.
+   * @return Whether a buffer is dequeued.
+   */
+  bool Dequeue( uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride );
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::EnqueueBuffer
+   */
+  bool Enqueue( uint8_t* buffer );
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::CancelDequeuedBuffer
+   */
+  void CancelDequeue( uint8_t* buffer );
+
+  /**
+   * Acquires the latest queued buffer, dropping the older ones.
+   * @param[out] width The width of the buffer.
+   * @param[out] height The height of the buffer.
+   * @param[out] stride The number of bytes of a row of the buffer.
+   * @return The pixels of the buffer, or NULL if no buffer is queued.
+   */
+  const uint8_t* Acquire( uint32_t& width, uint32_t& height, uint32_t& stride );
+
+  /**
+   * Releases an acquired buffer, which can be dequeued again.
+   * @param[in] buffer The pixels of the buffer.
+   */
+  void Release( const uint8_t* buffer );
+
+  /**
+   * Drops the oldest queued buffer, if any.
+   */
+  void DropOldest();
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::GetBufferStatistics
+   */
+  Dali::NativeImageSourceQueue::BufferStatistics GetStatistics() const;
+
+private:
+
+  enum State
+  {
+    FREE,
+    DEQUEUED,
+    QUEUED,
+    ACQUIRED
+  };
+
+  struct Buffer
+  {
+    uint8_t* data;
+    size_t size;              ///< The size of the memory, zero if not allocated.
+    uint32_t width;
+    uint32_t height;
+    uint32_t stride;
+    uint32_t sequence;        ///< The order the buffer was enqueued in.
+    State state;
+  };
+
+  /**
+   * Allocates the memory of a buffer for the current size.
+   * @return Whether the buffer has been allocated.
+   */
+  bool Allocate( Buffer& buffer );
+
+  /**
+   * Frees the memory of a buffer.
+   */
+  void Free( Buffer& buffer );
+
+  /**
+   * Frees a buffer returned in the wrong size, and reallocates it.
+   */
+  void Recycle( Buffer& buffer );
+
+  /**
+   * @return The buffer in the given state whose memory starts at the given address, or NULL.
+   */
+  Buffer* Find( const uint8_t* data, State state );
+
+  /**
+   * @return The queued buffer enqueued first, or NULL.
+   */
+  Buffer* FindOldestQueued();
+
+  /**
+   * Output the counts of the buffers.
+   */
+  void OutputReport() const;
+
+  // Undefined copy constructor.
+  SharedBufferQueue( const SharedBufferQueue& );
+
+  // Undefined assignment operator.
+  SharedBufferQueue& operator=( const SharedBufferQueue& );
+
+private:
+
+  mutable std::mutex mMutex;                                    ///< Protects the members below.
+  std::vector<Buffer> mBuffers;
+  Dali::NativeImageSourceQueue::BufferStatistics mStatistics;
+  uint32_t mWidth;
+  uint32_t mHeight;
+  uint32_t mStride;
+  uint32_t mSequence;                                           ///< The order of the next enqueued buffer.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SHARED_BUFFER_QUEUE_H
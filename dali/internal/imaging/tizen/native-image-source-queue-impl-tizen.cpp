@@ -58,6 +58,45 @@ int FORMATS_BLENDING_REQUIRED[] = {
 
 const int NUM_FORMATS_BLENDING_REQUIRED = 18;
 
+/**
+ * @return The layout of the pixels of a tbm format, which names the channels from the most significant bits of a
+ * little endian word, or Pixel::INVALID if there's no such Pixel::Format.
+ */
+Pixel::Format GetPixelFormat( tbm_format format )
+{
+  switch( format )
+  {
+    case TBM_FORMAT_ARGB8888:
+    {
+      return Pixel::BGRA8888;
+    }
+    case TBM_FORMAT_XRGB8888:
+    {
+      return Pixel::BGR8888;
+    }
+    case TBM_FORMAT_ABGR8888:
+    {
+      return Pixel::RGBA8888;
+    }
+    case TBM_FORMAT_XBGR8888:
+    {
+      return Pixel::RGB8888;
+    }
+    case TBM_FORMAT_BGR888:
+    {
+      return Pixel::RGB888;
+    }
+    case TBM_FORMAT_RGB565:
+    {
+      return Pixel::RGB565;
+    }
+    default:
+    {
+      return Pixel::INVALID;
+    }
+  }
+}
+
 }
 
 NativeImageSourceQueueTizen* NativeImageSourceQueueTizen::New( uint32_t width, uint32_t height, Dali::NativeImageSourceQueue::ColorDepth depth, Any nativeImageSourceQueue )
@@ -80,6 +119,8 @@ NativeImageSourceQueueTizen::NativeImageSourceQueueTizen( uint32_t width, uint32
   mTbmQueue( NULL ),
   mConsumeSurface( NULL ),
   mEglImages(),
+  mBuffers(),
+  mStatistics{ 0u, 0u, 0u, 0u, 0u },
   mEglGraphics( NULL ),
   mEglImageExtensions( NULL ),
   mOwnTbmQueue( false ),
@@ -102,6 +143,13 @@ NativeImageSourceQueueTizen::NativeImageSourceQueueTizen( uint32_t width, uint32
 
 NativeImageSourceQueueTizen::~NativeImageSourceQueueTizen()
 {
+  for( auto&& iter : mBuffers )
+  {
+    tbm_surface_unmap( iter.first );
+    tbm_surface_queue_cancel_dequeue( mTbmQueue, iter.first );
+  }
+  mBuffers.clear();
+
   if( mOwnTbmQueue )
   {
     if( mTbmQueue != NULL )
@@ -181,6 +229,13 @@ void NativeImageSourceQueueTizen::SetSize( uint32_t width, uint32_t height )
 {
   Dali::Mutex::ScopedLock lock( mMutex );
 
+  // The dequeued surfaces are invalidated by the reset, so they can't be enqueued
+  for( auto&& iter : mBuffers )
+  {
+    tbm_surface_unmap( iter.first );
+  }
+  mBuffers.clear();
+
   tbm_surface_queue_reset( mTbmQueue, width, height, tbm_surface_queue_get_format( mTbmQueue ) );
 
   mWidth = width;
@@ -206,9 +261,93 @@ void NativeImageSourceQueueTizen::IgnoreSourceImage()
     {
       tbm_surface_queue_release( mTbmQueue, surface );
     }
+
+    ++mStatistics.droppedBuffers;
   }
 }
 
+bool NativeImageSourceQueueTizen::DequeueBuffer( uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride, Pixel::Format& pixelFormat )
+{
+  Dali::Mutex::ScopedLock lock( mMutex );
+
+  if( mTbmQueue == NULL )
+  {
+    DALI_LOG_ERROR( "NativeImageSourceQueueTizen::DequeueBuffer: TbmQueue is NULL\n" );
+    return false;
+  }
+
+  // Doesn't wait for the consumer to release a surface
+  tbm_surface_h surface = NULL;
+  if( !tbm_surface_queue_can_dequeue( mTbmQueue, 0 ) ||
+      tbm_surface_queue_dequeue( mTbmQueue, &surface ) != TBM_SURFACE_QUEUE_ERROR_NONE || surface == NULL )
+  {
+    ++mStatistics.dequeueFailures;
+    return false;
+  }
+
+  tbm_surface_info_s info;
+  if( tbm_surface_map( surface, TBM_SURF_OPTION_WRITE, &info ) != TBM_SURFACE_ERROR_NONE )
+  {
+    DALI_LOG_ERROR( "NativeImageSourceQueueTizen::DequeueBuffer: Failed to map a tbm_surface\n" );
+    tbm_surface_queue_cancel_dequeue( mTbmQueue, surface );
+    ++mStatistics.dequeueFailures;
+    return false;
+  }
+
+  buffer = info.planes[0].ptr;
+  width = info.width;
+  height = info.height;
+  stride = info.planes[0].stride;
+  pixelFormat = GetPixelFormat( info.format );
+
+  mBuffers.push_back( BufferPair( surface, buffer ) );
+  return true;
+}
+
+bool NativeImageSourceQueueTizen::EnqueueBuffer( uint8_t* buffer )
+{
+  Dali::Mutex::ScopedLock lock( mMutex );
+
+  tbm_surface_h surface = RemoveDequeuedSurface( buffer );
+  if( surface == NULL )
+  {
+    DALI_LOG_ERROR( "NativeImageSourceQueueTizen::EnqueueBuffer: %p is not a dequeued buffer\n", buffer );
+    return false;
+  }
+
+  if( tbm_surface_queue_enqueue( mTbmQueue, surface ) != TBM_SURFACE_QUEUE_ERROR_NONE )
+  {
+    DALI_LOG_ERROR( "NativeImageSourceQueueTizen::EnqueueBuffer: Failed to enqueue a tbm_surface\n" );
+    tbm_surface_queue_cancel_dequeue( mTbmQueue, surface );
+    return false;
+  }
+
+  ++mStatistics.enqueuedBuffers;
+  return true;
+}
+
+void NativeImageSourceQueueTizen::CancelDequeuedBuffer( uint8_t* buffer )
+{
+  Dali::Mutex::ScopedLock lock( mMutex );
+
+  tbm_surface_h surface = RemoveDequeuedSurface( buffer );
+  if( surface != NULL )
+  {
+    tbm_surface_queue_cancel_dequeue( mTbmQueue, surface );
+  }
+}
+
+Dali::NativeImageSourceQueue::BufferStatistics NativeImageSourceQueueTizen::GetBufferStatistics() const
+{
+  Dali::Mutex::ScopedLock lock( mMutex );
+
+  // The surfaces enqueued by another producer of the queue are not counted
+  Dali::NativeImageSourceQueue::BufferStatistics statistics = mStatistics;
+  const uint32_t removedBuffers = statistics.consumedBuffers + statistics.droppedBuffers;
+  statistics.queueDepth = ( statistics.enqueuedBuffers > removedBuffers ) ? statistics.enqueuedBuffers - removedBuffers : 0u;
+  return statistics;
+}
+
 bool NativeImageSourceQueueTizen::CreateResource()
 {
   mEglImageExtensions = mEglGraphics->GetImageExtensions();
@@ -243,6 +382,8 @@ void NativeImageSourceQueueTizen::PrepareTexture()
       return;
     }
 
+    ++mStatistics.consumedBuffers;
+
     if( oldSurface )
     {
       if( tbm_surface_internal_is_valid( oldSurface ) )
@@ -326,6 +467,22 @@ void NativeImageSourceQueueTizen::ResetEglImageList()
   mEglImages.clear();
 }
 
+tbm_surface_h NativeImageSourceQueueTizen::RemoveDequeuedSurface( uint8_t* buffer )
+{
+  for( auto iter = mBuffers.begin(); iter != mBuffers.end(); ++iter )
+  {
+    if( iter->second == buffer )
+    {
+      tbm_surface_h surface = iter->first;
+      tbm_surface_unmap( surface );
+      mBuffers.erase( iter );
+      return surface;
+    }
+  }
+
+  return NULL;
+}
+
 bool NativeImageSourceQueueTizen::CheckBlending( int format )
 {
   for( int i = 0; i < NUM_FORMATS_BLENDING_REQUIRED; ++i )
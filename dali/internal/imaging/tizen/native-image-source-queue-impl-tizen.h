@@ -72,6 +72,26 @@ public:
    */
   void IgnoreSourceImage() override;
 
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::DequeueBuffer
+   */
+  bool DequeueBuffer( uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride, Pixel::Format& pixelFormat ) override;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::EnqueueBuffer
+   */
+  bool EnqueueBuffer( uint8_t* buffer ) override;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::CancelDequeuedBuffer
+   */
+  void CancelDequeuedBuffer( uint8_t* buffer ) override;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::GetBufferStatistics
+   */
+  Dali::NativeImageSourceQueue::BufferStatistics GetBufferStatistics() const override;
+
   /**
    * destructor
    */
@@ -173,16 +193,26 @@ private:
 
   bool CheckBlending( int format );
 
+  /**
+   * Removes a surface from the dequeued surfaces and unmaps it.
+   * @param[in] buffer The pixels of the surface.
+   * @return The surface, or NULL if the buffer is not a dequeued surface.
+   */
+  tbm_surface_h RemoveDequeuedSurface( uint8_t* buffer );
+
 private:
 
   typedef std::pair< tbm_surface_h, void* > EglImagePair;
+  typedef std::pair< tbm_surface_h, uint8_t* > BufferPair;
 
-  Dali::Mutex                      mMutex;                ///< Mutex
+  mutable Dali::Mutex              mMutex;                ///< Mutex
   uint32_t                         mWidth;                ///< image width
   uint32_t                         mHeight;               ///< image height
   tbm_surface_queue_h              mTbmQueue;             ///< Tbm surface queue handle
   tbm_surface_h                    mConsumeSurface;       ///< The current tbm surface
   std::vector< EglImagePair >      mEglImages;            ///< EGL Image vector
+  std::vector< BufferPair >        mBuffers;              ///< The surfaces dequeued by DequeueBuffer(), mapped for writing
+  Dali::NativeImageSourceQueue::BufferStatistics mStatistics; ///< The counts of the buffers, the queue depth computed from the others
   EglGraphics*                     mEglGraphics;          ///< EGL Graphics
   EglImageExtensions*              mEglImageExtensions;   ///< The EGL Image Extensions
   bool                             mOwnTbmQueue;          ///< Whether we created tbm queue
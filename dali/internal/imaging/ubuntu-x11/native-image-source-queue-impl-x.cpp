@@ -23,8 +23,8 @@
 #include <dali/integration-api/gl-defines.h>
 
 // INTERNAL INCLUDES
-#include <dali/internal/graphics/common/egl-image-extensions.h>
 #include <dali/internal/graphics/gles/egl-graphics.h>
+#include <dali/internal/graphics/gles/gl-implementation.h>
 #include <dali/internal/adaptor/common/adaptor-impl.h>
 
 namespace Dali
@@ -38,7 +38,7 @@ namespace Adaptor
 
 namespace
 {
-#define TBM_SURFACE_QUEUE_SIZE  3
+const uint32_t NUMBER_OF_BUFFERS = 3u;      ///< One buffer uploaded, one queued and one written.
 
 const char* FRAGMENT_PREFIX = "\n";
 const char* SAMPLER_TYPE = "sampler2D";
@@ -52,10 +52,27 @@ NativeImageSourceQueueX* NativeImageSourceQueueX::New( uint32_t width, uint32_t
 }
 
 NativeImageSourceQueueX::NativeImageSourceQueueX( uint32_t width, uint32_t height, Dali::NativeImageSourceQueue::ColorDepth depth, Any nativeImageSourceQueue )
-: mWidth( width ),
-  mHeight( height )
+: mQueue( NUMBER_OF_BUFFERS ),
+  mEglGraphics( NULL ),
+  mWidth( width ),
+  mHeight( height ),
+  mTextureWidth( 0u ),
+  mTextureHeight( 0u ),
+  mPixelFormat( GL_RGBA ),
+  mBlendingRequired( true )
 {
-  DALI_LOG_ERROR( "NativeImageSourceQueueX::NativeImageSourceQueueX: Not supported\n" );
+  if( !nativeImageSourceQueue.Empty() )
+  {
+    DALI_LOG_ERROR( "NativeImageSourceQueueX::NativeImageSourceQueueX: An external queue is not supported\n" );
+  }
+
+  if( depth == Dali::NativeImageSourceQueue::COLOR_DEPTH_24 )
+  {
+    mPixelFormat = GL_RGB;
+    mBlendingRequired = false;
+  }
+
+  mQueue.SetSize( mWidth, mHeight, ( mPixelFormat == GL_RGB ) ? 3u : 4u );
 }
 
 NativeImageSourceQueueX::~NativeImageSourceQueueX()
@@ -71,28 +88,99 @@ void NativeImageSourceQueueX::SetSize( uint32_t width, uint32_t height )
 {
   mWidth = width;
   mHeight = height;
+
+  mQueue.SetSize( mWidth, mHeight, ( mPixelFormat == GL_RGB ) ? 3u : 4u );
 }
 
 void NativeImageSourceQueueX::IgnoreSourceImage()
 {
+  mQueue.DropOldest();
+}
+
+bool NativeImageSourceQueueX::DequeueBuffer( uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride, Pixel::Format& pixelFormat )
+{
+  pixelFormat = ( mPixelFormat == GL_RGB ) ? Pixel::RGB888 : Pixel::RGBA8888;
+  return mQueue.Dequeue( buffer, width, height, stride );
+}
+
+bool NativeImageSourceQueueX::EnqueueBuffer( uint8_t* buffer )
+{
+  return mQueue.Enqueue( buffer );
+}
+
+void NativeImageSourceQueueX::CancelDequeuedBuffer( uint8_t* buffer )
+{
+  mQueue.CancelDequeue( buffer );
+}
+
+Dali::NativeImageSourceQueue::BufferStatistics NativeImageSourceQueueX::GetBufferStatistics() const
+{
+  return mQueue.GetStatistics();
 }
 
 bool NativeImageSourceQueueX::CreateResource()
 {
+  DALI_ASSERT_ALWAYS( Adaptor::IsAvailable() );
+
+  GraphicsInterface* graphics = &( Adaptor::GetImplementation( Adaptor::Get() ).GetGraphicsInterface() );
+  mEglGraphics = static_cast<EglGraphics *>( graphics );
+
   return true;
 }
 
 void NativeImageSourceQueueX::DestroyResource()
 {
+  // The texture is deleted by its owner
+  mTextureWidth = 0u;
+  mTextureHeight = 0u;
 }
 
 uint32_t NativeImageSourceQueueX::TargetTexture()
 {
+  // The storage is allocated, so the texture is complete before a buffer is enqueued
+  if( mWidth > 0u && mHeight > 0u )
+  {
+    mEglGraphics->GetGlesInterface().TexImage2D( GL_TEXTURE_2D, 0, mPixelFormat, mWidth, mHeight, 0, mPixelFormat, GL_UNSIGNED_BYTE, NULL );
+    mTextureWidth = mWidth;
+    mTextureHeight = mHeight;
+  }
+
+  UploadBuffer();
+
   return 0;
 }
 
 void NativeImageSourceQueueX::PrepareTexture()
 {
+  UploadBuffer();
+}
+
+void NativeImageSourceQueueX::UploadBuffer()
+{
+  uint32_t width = 0u;
+  uint32_t height = 0u;
+  uint32_t stride = 0u;
+  const uint8_t* pixels = mQueue.Acquire( width, height, stride );
+  if( !pixels )
+  {
+    // The texture keeps showing the last buffer
+    return;
+  }
+
+  // The pixels are copied before the calls return, so the buffer can be written again once it's released
+  Integration::GlAbstraction& gl = mEglGraphics->GetGlesInterface();
+  if( width != mTextureWidth || height != mTextureHeight )
+  {
+    gl.TexImage2D( GL_TEXTURE_2D, 0, mPixelFormat, width, height, 0, mPixelFormat, GL_UNSIGNED_BYTE, pixels );
+    mTextureWidth = width;
+    mTextureHeight = height;
+  }
+  else
+  {
+    gl.TexSubImage2D( GL_TEXTURE_2D, 0, 0, 0, width, height, mPixelFormat, GL_UNSIGNED_BYTE, pixels );
+  }
+
+  mQueue.Release( pixels );
 }
 
 const char* NativeImageSourceQueueX::GetCustomFragmentPrefix() const
@@ -107,7 +195,7 @@ const char* NativeImageSourceQueueX::GetCustomSamplerTypename() const
 
 int NativeImageSourceQueueX::GetTextureTarget() const
 {
-  return 0;
+  return GL_TEXTURE_2D;
 }
 
 Any NativeImageSourceQueueX::GetNativeImageHandle() const
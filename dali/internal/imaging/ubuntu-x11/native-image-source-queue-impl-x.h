@@ -22,6 +22,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/internal/imaging/common/native-image-source-queue-impl.h>
+#include <dali/internal/imaging/common/shared-buffer-queue.h>
 
 namespace Dali
 {
@@ -37,6 +38,9 @@ class EglImageExtensions;
 
 /**
  * Dali internal NativeImageSourceQueue.
+ *
+ * The buffers are in CPU memory, written by the producer's threads and uploaded to a texture when the image is rendered,
+ * so the queue doesn't need the native buffers of a GPU.
  */
 class NativeImageSourceQueueX: public Internal::Adaptor::NativeImageSourceQueue
 {
@@ -48,7 +52,7 @@ public:
    * @param[in] width The width of the image.
    * @param[in] height The height of the image.
    * @param[in] depth color depth of the image.
-   * @param[in] nativeImageSourceQueue contains tbm_surface_queue_h or is empty
+   * @param[in] nativeImageSourceQueue Not supported, must be empty
    * @return A smart-pointer to a newly allocated image.
    */
   static NativeImageSourceQueueX* New( uint32_t width, uint32_t height, Dali::NativeImageSourceQueue::ColorDepth depth, Any nativeImageSourceQueue );
@@ -68,6 +72,26 @@ public:
    */
   void IgnoreSourceImage() override;
 
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::DequeueBuffer
+   */
+  bool DequeueBuffer( uint8_t*& buffer, uint32_t& width, uint32_t& height, uint32_t& stride, Pixel::Format& pixelFormat ) override;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::EnqueueBuffer
+   */
+  bool EnqueueBuffer( uint8_t* buffer ) override;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::CancelDequeuedBuffer
+   */
+  void CancelDequeuedBuffer( uint8_t* buffer ) override;
+
+  /**
+   * @copydoc Dali::NativeImageSourceQueue::GetBufferStatistics
+   */
+  Dali::NativeImageSourceQueue::BufferStatistics GetBufferStatistics() const override;
+
   /**
    * destructor
    */
@@ -114,7 +138,7 @@ public:
    */
   bool RequiresBlending() const override
   {
-    return true;
+    return mBlendingRequired;
   }
 
   /**
@@ -157,14 +181,25 @@ private:
    * @param[in] width The width of the image.
    * @param[in] height The height of the image.
    * @param[in] colour depth of the image.
-   * @param[in] nativeImageSourceQueue contains tbm_surface_queue_h or is empty
+   * @param[in] nativeImageSourceQueue Not supported, must be empty
    */
   NativeImageSourceQueueX( uint32_t width, uint32_t height, Dali::NativeImageSourceQueue::ColorDepth depth, Any nativeImageSourceQueue );
 
+  /**
+   * Uploads the latest enqueued buffer to the texture bound.
+   */
+  void UploadBuffer();
+
 private:
 
-  uint32_t    mWidth;                ///< image width
-  uint32_t    mHeight;               ///< image height
+  SharedBufferQueue   mQueue;                ///< The buffers written by the producer
+  EglGraphics*        mEglGraphics;          ///< EGL Graphics
+  uint32_t            mWidth;                ///< image width
+  uint32_t            mHeight;               ///< image height
+  uint32_t            mTextureWidth;         ///< The width of the texture storage, zero if not allocated
+  uint32_t            mTextureHeight;        ///< The height of the texture storage
+  uint32_t            mPixelFormat;          ///< The GL format of the buffers
+  bool                mBlendingRequired;     ///< Whether blending is required
 
 };
 
@@ -29,6 +29,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/internal/adaptor/common/adaptor-impl.h>
+#include <dali/internal/graphics/gles/shader-binary-cache.h>
 #include <dali/internal/imaging/common/image-loader.h>
 #include <dali/internal/system/common/file-reader.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
@@ -72,9 +73,9 @@ uint32_t TizenPlatformAbstraction::TimerCallback::sNextTimerId = 0;
 
 TizenPlatformAbstraction::TizenPlatformAbstraction()
 : mDataStoragePath( "" ),
+  mShaderBinaryCache( nullptr ),
   mTimerPairsWaiting(),
   mTimerPairsSpent()
-
 {
 }
 
@@ -150,18 +151,17 @@ bool TizenPlatformAbstraction::LoadShaderBinaryFile( const std::string& filename
   bool result = false;
 
 #ifdef SHADERBIN_CACHE_ENABLED
-  std::string path;
-
-  // First check the system location where shaders are stored at install time:
-  path = DALI_SHADERBIN_DIR;
-  path += filename;
-  result = LoadFile( path, buffer );
-
-  // Fallback to the cache of shaders stored after previous runtime compilations:
+  // First check the cache of shaders stored after previous runtime compilations, which is read at startup:
   // On desktop this looks in the current working directory that the app was launched from.
-  if( mResourceLoader && result == false )
+  if( mShaderBinaryCache )
+  {
+    result = mShaderBinaryCache->Load( filename, buffer );
+  }
+
+  // Fallback to the system location where shaders are stored at install time:
+  if( result == false )
   {
-    path = mDataStoragePath;
+    std::string path = DALI_SHADERBIN_DIR;
     path += filename;
     result = LoadFile( path, buffer );
   }
@@ -178,9 +178,10 @@ bool TizenPlatformAbstraction::SaveShaderBinaryFile( const std::string& filename
 
   // Use the cache of shaders stored after previous runtime compilations:
   // On desktop this looks in the current working directory that the app was launched from.
-  std::string path = mDataStoragePath;
-  path += filename;
-  result = SaveFile( path, buffer, numBytes );
+  if( mShaderBinaryCache )
+  {
+    result = mShaderBinaryCache->Save( filename, buffer, numBytes );
+  }
 
 #endif
 
@@ -192,56 +193,47 @@ void TizenPlatformAbstraction::SetDataStoragePath( const std::string& path )
   mDataStoragePath = path;
 }
 
+void TizenPlatformAbstraction::SetShaderBinaryCache( Internal::Adaptor::ShaderBinaryCache* shaderBinaryCache )
+{
+  mShaderBinaryCache = shaderBinaryCache;
+}
+
 uint32_t TizenPlatformAbstraction::StartTimer( uint32_t milliseconds, CallbackBase* callback )
 {
   TimerCallback* timerCallbackPtr = new TimerCallback(this, callback, milliseconds);
 
-  // Stick it in the list
-  mTimerPairsWaiting.push_back( std::unique_ptr< TimerCallback >( timerCallbackPtr ) );
+  // Stick it in the map
+  mTimerPairsWaiting[ timerCallbackPtr->mIdNumber ] = std::unique_ptr< TimerCallback >( timerCallbackPtr );
 
   return timerCallbackPtr->mIdNumber;
 }
 
 void TizenPlatformAbstraction::CancelTimer ( uint32_t timerId )
 {
-  auto iter = std::remove_if(
-    mTimerPairsWaiting.begin(), mTimerPairsWaiting.end(),
-    [&timerId]( std::unique_ptr< TimerCallback >& timerCallbackPtr )
-    {
-      if( timerCallbackPtr->mIdNumber == timerId )
-      {
-        timerCallbackPtr->mTimer.Stop();
-        return true;
-      }
-      else
-      {
-        return false;
-      }
-    }
-  );
-
-  mTimerPairsWaiting.erase( iter, mTimerPairsWaiting.end() );
+  auto iter = mTimerPairsWaiting.find( timerId );
+  if( iter != mTimerPairsWaiting.end() )
+  {
+    iter->second->mTimer.Stop();
+    mTimerPairsWaiting.erase( iter );
+  }
 }
 
 void TizenPlatformAbstraction::RunTimerFunction(TimerCallback& timerPtr)
 {
-  CallbackBase::Execute( *timerPtr.mCallback );
-
-  std::vector< std::unique_ptr< TimerCallback > >::iterator timerIter = std::find_if( mTimerPairsWaiting.begin(), mTimerPairsWaiting.end(),
-                                                                                      [&]( std::unique_ptr< TimerCallback >& p )
-                                                                                      { return p.get() == &timerPtr;} );
-
-  if( timerIter == std::end(mTimerPairsWaiting) )
+  auto iter = mTimerPairsWaiting.find( timerPtr.mIdNumber );
+  if( iter == mTimerPairsWaiting.end() )
   {
     DALI_ASSERT_DEBUG(false);
+    return;
   }
 
-  // ...and move it
-  std::move(timerIter, timerIter+1, std::back_inserter(mTimerPairsSpent));
+  // Moved before the callback runs, so it can cancel its own timer. It's deleted once the timer has returned
+  mTimerPairsSpent.push_back( std::move( iter->second ) );
+  mTimerPairsWaiting.erase( iter );
 
-  mTimerPairsWaiting.erase(timerIter, timerIter+1);
+  CallbackBase::Execute( *timerPtr.mCallback );
 
-  Dali::Adaptor::Get().AddIdle( MakeCallback( this, &TizenPlatformAbstraction::CleanupTimers ), false );
+  Internal::Adaptor::Adaptor::GetImplementation( Dali::Adaptor::Get() ).AddIdle( MakeCallback( this, &TizenPlatformAbstraction::CleanupTimers ), false, false, Internal::Adaptor::IdleScheduler::LOW );
 }
 
 
@@ -256,6 +248,35 @@ TizenPlatformAbstraction* CreatePlatformAbstraction()
   return new TizenPlatformAbstraction();
 }
 
+bool LoadFile( const std::string& filename, Dali::Vector< unsigned char >& buffer )
+{
+  DALI_ASSERT_DEBUG( 0 != filename.length());
+
+  bool result = false;
+
+  std::filebuf buf;
+  buf.open( filename.c_str(), std::ios::in | std::ios::binary );
+  if( buf.is_open() )
+  {
+    std::istream stream( &buf );
+
+    // determine data length
+    stream.seekg( 0, std::ios_base::end );
+    const std::streamoff length = stream.tellg();
+    stream.seekg( 0, std::ios_base::beg );
+
+    if( length > 0 )
+    {
+      // allocate a buffer and read the contents of the file into it
+      buffer.Resize( static_cast< size_t >( length ) );
+      stream.read( reinterpret_cast< char* >( buffer.Begin() ), length );
+      result = !stream.fail();
+    }
+  }
+
+  return result;
+}
+
 bool SaveFile( const std::string& filename, const unsigned char * buffer, unsigned int numBytes )
 {
   DALI_ASSERT_DEBUG( 0 != filename.length());
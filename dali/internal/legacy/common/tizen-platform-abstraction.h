@@ -27,6 +27,8 @@
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include <dali/integration-api/platform-abstraction.h>
 
 namespace Dali
@@ -34,6 +36,14 @@ namespace Dali
 
 class CallbackBase;
 
+namespace Internal
+{
+namespace Adaptor
+{
+class ShaderBinaryCache;
+} // namespace Adaptor
+} // namespace Internal
+
 namespace TizenPlatform
 {
 class ResourceLoader;
@@ -112,6 +122,12 @@ public: // PlatformAbstraction overrides
    */
   void SetDataStoragePath( const std::string& path );
 
+  /**
+   * Sets the cache the shader binaries compiled at runtime are loaded from and saved to.
+   * @param[in] shaderBinaryCache The cache, owned by the adaptor.
+   */
+  void SetShaderBinaryCache( Internal::Adaptor::ShaderBinaryCache* shaderBinaryCache );
+
   /**
    * Clears the timers that have completed
    */
@@ -130,8 +146,9 @@ private:
   TizenPlatformAbstraction& operator=( const TizenPlatformAbstraction& ); ///< Undefined
 
   std::string mDataStoragePath;
+  Internal::Adaptor::ShaderBinaryCache* mShaderBinaryCache;
 
-  std::vector< std::unique_ptr< TimerCallback > > mTimerPairsWaiting;
+  std::unordered_map< uint32_t, std::unique_ptr< TimerCallback > > mTimerPairsWaiting;   ///< The timers by id
   std::vector< std::unique_ptr< TimerCallback > > mTimerPairsSpent;
 };
 
@@ -141,6 +158,14 @@ private:
  */
 TizenPlatformAbstraction* CreatePlatformAbstraction();
 
+/**
+ * Load a file from disk
+ * @param filename to load
+ * @param buffer to fill with the contents of the file
+ * @return true if successful, false otherwise
+ */
+bool LoadFile( const std::string& filename, Dali::Vector< unsigned char >& buffer );
+
 /**
  * Save a file to disk
  * @param filename to create
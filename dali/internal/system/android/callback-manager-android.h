@@ -64,16 +64,6 @@ public:
      */
     void RemoveIdleCallback( CallbackBase* callback ) override;
 
-    /**
-     * @copydoc CallbackManager::ProcessIdle()
-     */
-    bool ProcessIdle() override;
-
-    /**
-     * @copydoc CallbackManager::ProcessIdle()
-     */
-    void ClearIdleCallbacks() override;
-
     /**
      * @copydoc CallbackManager::AddIdleEntererCallback()
      */
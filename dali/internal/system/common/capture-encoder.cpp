@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/capture-encoder.h>
+
+// EXTERNAL INCLUDES
+#include <iomanip>
+#include <sstream>
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
+#include <dali/integration-api/adaptor-framework/trigger-event-factory.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Integration::Log::Filter* gLogFilter = Integration::Log::Filter::New( Debug::NoLogging, false, "LOG_CAPTURE_ENCODER" );
+#endif
+
+const unsigned int FRAME_INDEX_WIDTH = 6u;        ///< The number of digits of the frame index in the file names of the streams.
+
+} // unnamed namespace
+
+CaptureEncoder::CaptureEncoder( CallbackBase* callback, uint32_t maximumFrames, Dali::WorkerThreadPool::Priority priority )
+: mTrigger( TriggerEventFactory::CreateTriggerEvent( callback, TriggerEventInterface::KEEP_ALIVE_AFTER_TRIGGER ) ),
+  mMutex(),
+  mCondition(),
+  mQueue(),
+  mEncoded(),
+  mMaximumFrames( ( maximumFrames > 0u ) ? maximumFrames : 1u ),
+  mEncodingFrames( 0u ),
+  mPriority( priority ),
+  mTaskQueued( false ),
+  mTaskRunning( false )
+{
+}
+
+CaptureEncoder::~CaptureEncoder()
+{
+  std::unique_lock<std::mutex> lock( mMutex );
+  mQueue.clear();
+
+  // A task added to the pool runs even if there's nothing left to encode, and must find the encoder,
+  // unless the pool has been deleted with the adaptor, which deletes the tasks without running them
+  mCondition.wait( lock, [this]{ return !mTaskRunning && ( !mTaskQueued || 0u == Dali::WorkerThreadPool::GetNumberOfThreads() ); } );
+}
+
+void CaptureEncoder::Configure( uint32_t maximumFrames, Dali::WorkerThreadPool::Priority priority )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  mMaximumFrames = ( maximumFrames > 0u ) ? maximumFrames : 1u;
+  mPriority = priority;
+}
+
+bool CaptureEncoder::IsFull() const
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  return mQueue.size() + mEncodingFrames >= mMaximumFrames;
+}
+
+bool CaptureEncoder::IsIdle() const
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  return mQueue.empty() && 0u == mEncodingFrames && mEncoded.empty();
+}
+
+bool CaptureEncoder::Encode( Frame& frame )
+{
+  {
+    std::lock_guard<std::mutex> lock( mMutex );
+    if( mQueue.size() + mEncodingFrames >= mMaximumFrames )
+    {
+      return false;
+    }
+
+    mQueue.push_back( Frame() );
+    Frame& queuedFrame = mQueue.back();
+    queuedFrame.pixels.swap( frame.pixels );
+    queuedFrame.path = frame.path;
+    queuedFrame.width = frame.width;
+    queuedFrame.height = frame.height;
+    queuedFrame.pixelFormat = frame.pixelFormat;
+    queuedFrame.quality = frame.quality;
+    queuedFrame.succeeded = false;
+
+    // A running task encodes the frame before it returns
+    if( mTaskQueued || mTaskRunning )
+    {
+      return true;
+    }
+
+    CallbackBase* task = MakeCallback( this, &CaptureEncoder::Run );
+    if( Dali::WorkerThreadPool::AddTask( task, mPriority ) )
+    {
+      mTaskQueued = true;
+      return true;
+    }
+
+    // Not taken by the pool
+    delete task;
+  }
+
+  // No adaptor on this thread, so it's encoded before returning
+  Run();
+  return true;
+}
+
+void CaptureEncoder::GetEncodedFrames( std::vector<Frame>& frames )
+{
+  std::lock_guard<std::mutex> lock( mMutex );
+  frames.swap( mEncoded );
+  mEncoded.clear();
+}
+
+std::string CaptureEncoder::GetFramePath( const std::string& path, uint32_t frameIndex )
+{
+  // The dots of the directories are not extensions
+  const std::size_t extension = path.rfind( '.' );
+  const std::size_t directory = path.rfind( '/' );
+  const std::size_t position = ( extension != std::string::npos && ( directory == std::string::npos || extension > directory ) ) ? extension : path.size();
+
+  std::ostringstream framePath;
+  framePath << path.substr( 0, position ) << '-' << std::setw( FRAME_INDEX_WIDTH ) << std::setfill( '0' ) << frameIndex << path.substr( position );
+  return framePath.str();
+}
+
+void CaptureEncoder::Run()
+{
+  std::unique_lock<std::mutex> lock( mMutex );
+  mTaskQueued = false;
+  mTaskRunning = true;
+
+  while( !mQueue.empty() )
+  {
+    Frame frame = std::move( mQueue.front() );
+    mQueue.pop_front();
+    mEncodingFrames = 1u;
+    lock.unlock();
+
+    if( !frame.pixels.empty() )
+    {
+      frame.succeeded = Dali::EncodeToFile( &frame.pixels[0], frame.path, frame.pixelFormat, frame.width, frame.height, frame.quality );
+    }
+    std::vector<uint8_t>().swap( frame.pixels );
+
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "CaptureEncoder::Run. %s %s\n", frame.path.c_str(), frame.succeeded ? "encoded" : "failed" );
+
+    lock.lock();
+    mEncodingFrames = 0u;
+    mEncoded.push_back( std::move( frame ) );
+
+    // Coalesced with the previous triggers if the event thread hasn't retrieved their frames yet
+    mTrigger->Trigger();
+  }
+
+  mTaskRunning = false;
+  mCondition.notify_all();
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
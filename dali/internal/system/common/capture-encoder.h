@@ -0,0 +1,157 @@
+#ifndef DALI_INTERNAL_CAPTURE_ENCODER_H
+#define DALI_INTERNAL_CAPTURE_ENCODER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <dali/public-api/images/pixel.h>
+#include <dali/public-api/signals/callback.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/worker-thread-pool.h>
+#include <dali/integration-api/adaptor-framework/trigger-event-interface.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * Encodes the captured frames into files on a worker thread, so the event thread only copies the pixels.
+ *
+ * The frames are encoded one at a time, in the order they are queued. The number of frames queued or being
+ * encoded is bounded, and the frames queued beyond it are refused, so a slow encoder doesn't hold an unbounded
+ * amount of memory. Once frames are encoded, a callback runs on the event thread, which retrieves them.
+ *
+ * Deleting the encoder drops the queued frames, and waits for the task to return.
+ */
+class CaptureEncoder
+{
+public:
+
+  /**
+   * A captured frame.
+   */
+  struct Frame
+  {
+    std::vector<uint8_t> pixels;    ///< Released once the frame is encoded.
+    std::string path;               ///< The file the frame is encoded into. The extension determines the format.
+    uint32_t width;
+    uint32_t height;
+    Pixel::Format pixelFormat;
+    uint32_t quality;               ///< The quality of the jpeg files.
+    bool succeeded;                 ///< Whether the file has been written, set once the frame is encoded.
+  };
+
+  /**
+   * Constructor
+   * @param[in] callback The callback run on the event thread when frames have been encoded. The ownership is taken.
+   * @param[in] maximumFrames The maximum number of frames queued or being encoded, at least one.
+   * @param[in] priority The priority of the task encoding the frames.
+   */
+  CaptureEncoder( CallbackBase* callback, uint32_t maximumFrames, Dali::WorkerThreadPool::Priority priority );
+
+  /**
+   * Destructor. Drops the queued frames, and waits for the frame being encoded and the task added to the pool, if any.
+   * Must be called on the event thread.
+   */
+  ~CaptureEncoder();
+
+  /**
+   * Sets the limits of the frames queued from now on.
+   * @param[in] maximumFrames The maximum number of frames queued or being encoded, at least one.
+   * @param[in] priority The priority of the task encoding the frames.
+   */
+  void Configure( uint32_t maximumFrames, Dali::WorkerThreadPool::Priority priority );
+
+  /**
+   * @return Whether a frame would be refused, as the maximum number of frames are queued or being encoded.
+   */
+  bool IsFull() const;
+
+  /**
+   * @return Whether no frame is queued, being encoded, or waiting to be retrieved.
+   */
+  bool IsIdle() const;
+
+  /**
+   * Queues a frame to encode.
+   * @param[in,out] frame The frame. Its pixels are taken if it's queued.
+   * @return Whether the frame is queued, false if the encoder is full.
+   */
+  bool Encode( Frame& frame );
+
+  /**
+   * Retrieves the frames which have been encoded, in the order they were queued.
+   * @param[out] frames The encoded frames, without their pixels.
+   */
+  void GetEncodedFrames( std::vector<Frame>& frames );
+
+  /**
+   * Inserts the index of a frame before the extension of a path, e.g. "capture-000012.png".
+   * @param[in] path The path of the files of a stream.
+   * @param[in] frameIndex The index of the frame.
+   * @return The path of the file of the frame.
+   */
+  static std::string GetFramePath( const std::string& path, uint32_t frameIndex );
+
+private:
+
+  /**
+   * Encodes the queued frames until there are none left. Runs on a worker thread.
+   */
+  void Run();
+
+  // Undefined copy constructor.
+  CaptureEncoder( const CaptureEncoder& );
+
+  // Undefined assignment operator.
+  CaptureEncoder& operator=( const CaptureEncoder& );
+
+private:
+
+  std::unique_ptr<TriggerEventInterface> mTrigger;   ///< Runs the callback on the event thread.
+  mutable std::mutex mMutex;                          ///< Protects the members below.
+  std::condition_variable mCondition;                 ///< Signalled when the task returns.
+  std::deque<Frame> mQueue;                           ///< The frames waiting to be encoded.
+  std::vector<Frame> mEncoded;                        ///< The frames encoded, waiting to be retrieved.
+  uint32_t mMaximumFrames;
+  uint32_t mEncodingFrames;                           ///< The number of frames being encoded.
+  Dali::WorkerThreadPool::Priority mPriority;
+  bool mTaskQueued;
+  bool mTaskRunning;
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_CAPTURE_ENCODER_H
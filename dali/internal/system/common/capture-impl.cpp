@@ -29,10 +29,12 @@
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/devel-api/adaptor-framework/native-image-source-devel.h>
 #include <dali/devel-api/adaptor-framework/window-devel.h>
+#include <dali/internal/system/common/capture-encoder.h>
 
 namespace
 {
 unsigned int TIME_OUT_DURATION = 1000;
+const unsigned int FRAMES_PER_SECOND = 60u;       ///< The frame rate the interval of the streams is counted at.
 }
 
 namespace Dali
@@ -47,9 +49,15 @@ namespace Adaptor
 Capture::Capture()
 : mQuality( DEFAULT_QUALITY ),
   mTimer(),
+  mStreamTimer(),
+  mEncoder(),
   mPath(),
   mNativeImageSourcePtr( NULL ),
-  mFileSave( false )
+  mStreamStatistics{ 0u, 0u, 0u },
+  mFrameIndex( 0u ),
+  mFileSave( false ),
+  mStreaming( false ),
+  mEncodingStream( false )
 {
 }
 
@@ -57,9 +65,15 @@ Capture::Capture( Dali::CameraActor cameraActor )
 : mQuality( DEFAULT_QUALITY ),
   mCameraActor( cameraActor ),
   mTimer(),
+  mStreamTimer(),
+  mEncoder(),
   mPath(),
   mNativeImageSourcePtr( NULL ),
-  mFileSave( false )
+  mStreamStatistics{ 0u, 0u, 0u },
+  mFrameIndex( 0u ),
+  mFileSave( false ),
+  mStreaming( false ),
+  mEncodingStream( false )
 {
 }
 
@@ -91,6 +105,13 @@ void Capture::Start( Dali::Actor source, const Dali::Vector2& position, const Da
 void Capture::Start( Dali::Actor source, const Dali::Vector2& position, const Dali::Vector2& size, const std::string &path, const Dali::Vector4& clearColor )
 {
   DALI_ASSERT_ALWAYS(path.size() > 4 && "Path is invalid.");
+  DALI_ASSERT_ALWAYS(source && "Source is NULL.");
+
+  if( !PrepareEncoder( 1u, Dali::WorkerThreadPool::PREFETCH ) )
+  {
+    DALI_LOG_ERROR( "The previous capture is not finished, Path[%s] is not captured\n", path.c_str() );
+    return;
+  }
 
   // Increase the reference count focely to avoid application mistake.
   Reference();
@@ -100,13 +121,66 @@ void Capture::Start( Dali::Actor source, const Dali::Vector2& position, const Da
   {
     mFileSave = true;
   }
+  mEncodingStream = false;
 
+  UnsetResources();
+  SetupResources( position, size, clearColor, source );
+}
+
+void Capture::StartStream( Dali::Actor source, const Dali::Vector2& position, const Dali::Vector2& size, const std::string& path, const Dali::Vector4& clearColor, uint32_t frameInterval, uint32_t maximumFrames )
+{
+  DALI_ASSERT_ALWAYS(path.size() > 4 && "Path is invalid.");
   DALI_ASSERT_ALWAYS(source && "Source is NULL.");
 
+  // The frames are encoded in the background, and dropped while the queue is full
+  if( !PrepareEncoder( maximumFrames, Dali::WorkerThreadPool::BACKGROUND ) )
+  {
+    DALI_LOG_ERROR( "The previous capture is not finished, the stream of Path[%s] is not started\n", path.c_str() );
+    return;
+  }
+
+  // Increase the reference count focely to avoid application mistake. It is decreased once the stream is stopped and encoded.
+  Reference();
+
+  mPath = path;
+  mFileSave = true;
+  mStreaming = true;
+  mEncodingStream = true;
+  mFrameIndex = 0u;
+  mStreamStatistics = Dali::DevelCapture::StreamStatistics{ 0u, 0u, 0u };
+
+  const unsigned int interval = ( frameInterval > 0u ? frameInterval : 1u ) * 1000u / FRAMES_PER_SECOND;
+  mStreamTimer = Dali::Timer::New( interval );
+  mStreamTimer.TickSignal().Connect( this, &Capture::OnStreamTimeOut );
+
   UnsetResources();
   SetupResources( position, size, clearColor, source );
 }
 
+void Capture::StopStream()
+{
+  if( !mStreaming )
+  {
+    return;
+  }
+
+  mStreaming = false;
+  mStreamTimer.Reset();
+
+  UnsetResources();
+
+  if( mEncoder->IsIdle() )
+  {
+    // Decrease the reference count forcely. It is increased at StartStream().
+    Unreference();
+  }
+}
+
+Dali::DevelCapture::StreamStatistics Capture::GetStreamStatistics() const
+{
+  return mStreamStatistics;
+}
+
 void Capture::SetImageQuality( uint32_t quality )
 {
   mQuality = quality;
@@ -245,6 +319,8 @@ bool Capture::IsRenderTaskSetup()
 
 void Capture::SetupResources( const Dali::Vector2& position, const Dali::Vector2& size, const Dali::Vector4& clearColor, Dali::Actor source )
 {
+  // The image of the previous capture is replaced
+  DeleteNativeImageSource();
   CreateNativeImageSource( size );
 
   CreateFrameBuffer();
@@ -271,22 +347,45 @@ void Capture::OnRenderFinished( Dali::RenderTask& task )
 
   mTimer.Stop();
 
+  if( mStreaming )
+  {
+    // The frame is counted as captured once it's encoded
+    if( !SaveFile( CaptureEncoder::GetFramePath( mPath, mFrameIndex ) ) )
+    {
+      ++mStreamStatistics.failedFrames;
+      DALI_LOG_ERROR( "Fail to Capture frame %u of Path[%s]", mFrameIndex, mPath.c_str() );
+    }
+    ++mFrameIndex;
+
+    mStreamTimer.Start();
+    return;
+  }
+
+  bool encoding = false;
   if( mFileSave )
   {
-    if( !SaveFile() )
+    encoding = SaveFile( mPath );
+    if( !encoding )
     {
       state = Dali::Capture::FinishState::FAILED;
       DALI_LOG_ERROR( "Fail to Capture Path[%s]", mPath.c_str() );
     }
   }
 
-  Dali::Capture handle( this );
-  mFinishedSignal.Emit( handle, state );
+  // Otherwise the signal is emitted once the file is encoded
+  if( !encoding )
+  {
+    Dali::Capture handle( this );
+    mFinishedSignal.Emit( handle, state );
+  }
 
   UnsetResources();
 
-  // Decrease the reference count forcely. It is increased at Start().
-  Unreference();
+  if( !encoding )
+  {
+    // Decrease the reference count forcely. It is increased at Start().
+    Unreference();
+  }
 }
 
 bool Capture::OnTimeOut()
@@ -296,6 +395,12 @@ bool Capture::OnTimeOut()
   Dali::Capture handle( this );
   mFinishedSignal.Emit( handle, state );
 
+  if( mStreaming )
+  {
+    StopStream();
+    return false;
+  }
+
   UnsetResources();
 
   // Decrease the reference count forcely. It is increased at Start().
@@ -304,11 +409,105 @@ bool Capture::OnTimeOut()
   return false;
 }
 
-bool Capture::SaveFile()
+bool Capture::OnStreamTimeOut()
+{
+  if( !mRenderTask )
+  {
+    return false;
+  }
+
+  if( mEncoder->IsFull() )
+  {
+    // The frame is dropped rather than waiting for the encoder, and not rendered
+    ++mStreamStatistics.droppedFrames;
+    ++mFrameIndex;
+    return true;
+  }
+
+  // Render the next frame of the stream, the timer is started again once it's captured
+  mRenderTask.SetRefreshRate( Dali::RenderTask::REFRESH_ONCE );
+  mTimer.Start();
+  return false;
+}
+
+void Capture::OnFramesEncoded()
+{
+  std::vector<CaptureEncoder::Frame> frames;
+  mEncoder->GetEncodedFrames( frames );
+  if( frames.empty() )
+  {
+    // Retrieved by a previous trigger
+    return;
+  }
+
+  Dali::Capture handle( this );
+  for( const auto& frame : frames )
+  {
+    Dali::Capture::FinishState state = Dali::Capture::FinishState::SUCCEEDED;
+    if( !frame.succeeded )
+    {
+      state = Dali::Capture::FinishState::FAILED;
+      DALI_LOG_ERROR( "Fail to Capture Path[%s]", frame.path.c_str() );
+    }
+
+    if( mEncodingStream && frame.succeeded )
+    {
+      ++mStreamStatistics.capturedFrames;
+    }
+    else if( mEncodingStream )
+    {
+      ++mStreamStatistics.failedFrames;
+    }
+
+    mFinishedSignal.Emit( handle, state );
+  }
+
+  if( !mStreaming && mEncoder->IsIdle() )
+  {
+    // Decrease the reference count forcely. It is increased at Start() or StartStream().
+    Unreference();
+  }
+}
+
+bool Capture::PrepareEncoder( uint32_t maximumFrames, Dali::WorkerThreadPool::Priority priority )
+{
+  // Restarting would drop the frames of the previous capture without their signal, and keep its reference
+  if( mStreaming || IsRenderTaskSetup() || ( mEncoder && !mEncoder->IsIdle() ) )
+  {
+    return false;
+  }
+
+  if( mEncoder )
+  {
+    mEncoder->Configure( maximumFrames, priority );
+  }
+  else
+  {
+    mEncoder.reset( new CaptureEncoder( MakeCallback( this, &Capture::OnFramesEncoded ), maximumFrames, priority ) );
+  }
+  return true;
+}
+
+bool Capture::SaveFile( const std::string& path )
 {
   DALI_ASSERT_ALWAYS(mNativeImageSourcePtr && "mNativeImageSourcePtr is NULL");
 
-  return Dali::DevelNativeImageSource::EncodeToFile( *mNativeImageSourcePtr, mPath, mQuality );
+  // The native image source is mapped and copied here, the encoding is done by a worker thread
+  CaptureEncoder::Frame frame;
+  unsigned int width = 0u;
+  unsigned int height = 0u;
+  if( !mNativeImageSourcePtr->GetPixels( frame.pixels, width, height, frame.pixelFormat ) )
+  {
+    return false;
+  }
+
+  frame.path = path;
+  frame.width = width;
+  frame.height = height;
+  frame.quality = mQuality;
+  frame.succeeded = false;
+
+  return mEncoder->Encode( frame );
 }
 
 }  // End of namespace Adaptor
@@ -32,6 +32,8 @@
 #include <dali/public-api/capture/capture.h>
 #include <dali/public-api/adaptor-framework/native-image-source.h>
 #include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/devel-api/adaptor-framework/capture-devel.h>
+#include <dali/devel-api/adaptor-framework/worker-thread-pool.h>
 
 namespace Dali
 {
@@ -42,6 +44,7 @@ namespace Internal
 namespace Adaptor
 {
 
+class CaptureEncoder;
 class Capture;
 typedef IntrusivePtr<Capture> CapturePtr;
 
@@ -78,6 +81,21 @@ public:
    */
   void Start( Dali::Actor source, const Dali::Vector2& position, const Dali::Vector2& size, const std::string &path, const Dali::Vector4& clearColor );
 
+  /**
+   * @copydoc Dali::DevelCapture::StartStream
+   */
+  void StartStream( Dali::Actor source, const Dali::Vector2& position, const Dali::Vector2& size, const std::string& path, const Dali::Vector4& clearColor, uint32_t frameInterval, uint32_t maximumFrames );
+
+  /**
+   * @copydoc Dali::DevelCapture::StopStream
+   */
+  void StopStream();
+
+  /**
+   * @copydoc Dali::DevelCapture::GetStreamStatistics
+   */
+  Dali::DevelCapture::StreamStatistics GetStreamStatistics() const;
+
   /**
    * @copydoc Dali::Capture::SetImageQuality
    */
@@ -189,11 +207,33 @@ private:
   bool OnTimeOut();
 
   /**
-   * @brief Save framebuffer.
+   * @brief Callback when the stream timer is finished.
+   *
+   * @return True if the frame is dropped, so the timer ticks again.
+   */
+  bool OnStreamTimeOut();
+
+  /**
+   * @brief Callback when frames have been encoded.
+   */
+  void OnFramesEncoded();
+
+  /**
+   * @brief Create the encoder, or set its limits if it's already created.
+   *
+   * @param[in] maximumFrames The maximum number of frames queued or being encoded.
+   * @param[in] priority The priority of the task encoding the frames.
+   * @return True if the capture can start, false if the previous capture is not finished.
+   */
+  bool PrepareEncoder( uint32_t maximumFrames, Dali::WorkerThreadPool::Priority priority );
+
+  /**
+   * @brief Copy the pixels of the native image source and queue them to be encoded on a worker thread.
    *
-   * @return True is success to save, false is fail.
+   * @param[in] path The file the pixels are encoded into.
+   * @return True is success to queue, false is fail.
    */
-  bool SaveFile();
+  bool SaveFile( const std::string& path );
 
 private:
 
@@ -211,10 +251,16 @@ private:
   Dali::Actor                                 mSource;
   Dali::CameraActor                           mCameraActor;
   Dali::Timer                                 mTimer;           ///< For timeout.
+  Dali::Timer                                 mStreamTimer;     ///< For the interval between the frames of a stream.
+  std::unique_ptr<CaptureEncoder>             mEncoder;         ///< Encodes the files on a worker thread.
   Dali::Capture::CaptureFinishedSignalType    mFinishedSignal;
   std::string                                 mPath;
   Dali::NativeImageSourcePtr                  mNativeImageSourcePtr;  ///< pointer to surface image
+  Dali::DevelCapture::StreamStatistics        mStreamStatistics;
+  uint32_t                                    mFrameIndex;      ///< The index of the next frame of the stream.
   bool                                        mFileSave;
+  bool                                        mStreaming;
+  bool                                        mEncodingStream;  ///< Whether the frames being encoded belong to a stream.
 };
 
 }  // End of namespace Adaptor
@@ -40,6 +40,7 @@ namespace Adaptor
 namespace
 {
 const unsigned int DEFAULT_STATISTICS_LOG_FREQUENCY = 2;
+const unsigned int DEFAULT_TRACE_FILE_SIZE = 64u * 1024u; ///< 64MB
 const int DEFAULT_MULTI_SAMPLING_LEVEL = -1;
 const bool DEFAULT_DEPTH_BUFFER_REQUIRED_SETTING = true;
 const bool DEFAULT_STENCIL_BUFFER_REQUIRED_SETTING = true;
@@ -200,6 +201,10 @@ EnvironmentOptions::EnvironmentOptions()
 : mLogFunction( NULL ),
   mWindowName(),
   mWindowClassName(),
+  mPerformanceStatsFile(),
+  mPerformanceTraceFile(),
+  mBenchmarkOutputFile(),
+  mGlesCallTraceFile(),
   mNetworkControl( 0 ),
   mFpsFrequency( 0 ),
   mUpdateStatusFrequency( 0 ),
@@ -207,12 +212,15 @@ EnvironmentOptions::EnvironmentOptions()
   mPerformanceStatsLevel( 0 ),
   mPerformanceStatsFrequency( DEFAULT_STATISTICS_LOG_FREQUENCY ),
   mPerformanceTimeStampOutput( 0 ),
+  mPerformanceTraceFileSize( DEFAULT_TRACE_FILE_SIZE ),
   mPanGestureLoggingLevel( 0 ),
   mWindowWidth( 0u ),
   mWindowHeight( 0u ),
   mRenderRefreshRate( 1u ),
   mMaxTextureSize( 0 ),
+  mTextureUploadBudget( 0u ),
   mRenderToFboInterval( 0u ),
+  mWorkerThreadCount( 0u ),
   mPanGesturePredictionMode( -1 ),
   mPanGesturePredictionAmount( -1 ), ///< only sets value in pan gesture if greater than 0
   mPanGestureMaxPredictionAmount( -1 ),
@@ -240,9 +248,12 @@ EnvironmentOptions::EnvironmentOptions()
   mMultiSamplingLevel( DEFAULT_MULTI_SAMPLING_LEVEL ),
   mThreadingMode( ThreadingMode::COMBINED_UPDATE_RENDER ),
   mGlesCallAccumulate( false ),
+  mGlesStateCacheEnabled( false ),
   mDepthBufferRequired( DEFAULT_DEPTH_BUFFER_REQUIRED_SETTING ),
   mStencilBufferRequired( DEFAULT_STENCIL_BUFFER_REQUIRED_SETTING ),
-  mPartialUpdateRequired( DEFAULT_PARTIAL_UPDATE_REQUIRED_SETTING )
+  mPartialUpdateRequired( DEFAULT_PARTIAL_UPDATE_REQUIRED_SETTING ),
+  mFramePacingEnabled( false ),
+  mDeferredPresentEnabled( false )
 {
   ParseEnvironmentOptions();
 }
@@ -306,11 +317,26 @@ unsigned int EnvironmentOptions::GetPerformanceStatsLoggingFrequency() const
 {
   return mPerformanceStatsFrequency;
 }
+
+const std::string& EnvironmentOptions::GetPerformanceStatsLoggingFile() const
+{
+  return mPerformanceStatsFile;
+}
 unsigned int EnvironmentOptions::GetPerformanceTimeStampOutput() const
 {
   return mPerformanceTimeStampOutput;
 }
 
+const std::string& EnvironmentOptions::GetPerformanceTraceFile() const
+{
+  return mPerformanceTraceFile;
+}
+
+unsigned int EnvironmentOptions::GetPerformanceTraceFileSize() const
+{
+  return mPerformanceTraceFileSize;
+}
+
 unsigned int EnvironmentOptions::GetPanGestureLoggingLevel() const
 {
   return mPanGestureLoggingLevel;
@@ -451,6 +477,16 @@ bool EnvironmentOptions::GetGlesCallAccumulate() const
   return mGlesCallAccumulate;
 }
 
+const std::string& EnvironmentOptions::GetGlesCallTraceFile() const
+{
+  return mGlesCallTraceFile;
+}
+
+bool EnvironmentOptions::GlesStateCacheEnabled() const
+{
+  return mGlesStateCacheEnabled;
+}
+
 const std::string& EnvironmentOptions::GetWindowName() const
 {
   return mWindowName;
@@ -481,15 +517,41 @@ unsigned int EnvironmentOptions::GetMaxTextureSize() const
   return mMaxTextureSize;
 }
 
+unsigned int EnvironmentOptions::GetTextureUploadBudget() const
+{
+  return mTextureUploadBudget;
+}
+
 unsigned int EnvironmentOptions::GetRenderToFboInterval() const
 {
   return mRenderToFboInterval;
 }
 
+bool EnvironmentOptions::FramePacingEnabled() const
+{
+  return mFramePacingEnabled;
+}
+
+bool EnvironmentOptions::DeferredPresentEnabled() const
+{
+  return mDeferredPresentEnabled;
+}
+
+const std::string& EnvironmentOptions::GetBenchmarkOutputFile() const
+{
+  return mBenchmarkOutputFile;
+}
+
+unsigned int EnvironmentOptions::GetWorkerThreadCount() const
+{
+  return mWorkerThreadCount;
+}
+
 bool EnvironmentOptions::PerformanceServerRequired() const
 {
   return ( ( GetPerformanceStatsLoggingOptions() > 0) ||
            ( GetPerformanceTimeStampOutput() > 0 ) ||
+           ( !GetPerformanceTraceFile().empty() ) ||
            ( GetNetworkControlMode() > 0) );
 }
 
@@ -516,7 +578,10 @@ void EnvironmentOptions::ParseEnvironmentOptions()
   mObjectProfilerInterval = GetEnvironmentVariable( DALI_ENV_OBJECT_PROFILER_INTERVAL, 0 );
   mPerformanceStatsLevel = GetEnvironmentVariable( DALI_ENV_LOG_PERFORMANCE_STATS, 0 );
   mPerformanceStatsFrequency = GetEnvironmentVariable( DALI_ENV_LOG_PERFORMANCE_STATS_FREQUENCY, 0 );
+  SetFromEnvironmentVariable(DALI_ENV_LOG_PERFORMANCE_STATS_FILE, mPerformanceStatsFile);
   mPerformanceTimeStampOutput = GetEnvironmentVariable( DALI_ENV_PERFORMANCE_TIMESTAMP_OUTPUT, 0 );
+  SetFromEnvironmentVariable(DALI_ENV_PERFORMANCE_TRACE_FILE, mPerformanceTraceFile);
+  mPerformanceTraceFileSize = GetEnvironmentVariable( DALI_ENV_PERFORMANCE_TRACE_FILE_SIZE, DEFAULT_TRACE_FILE_SIZE );
   mNetworkControl = GetEnvironmentVariable( DALI_ENV_NETWORK_CONTROL, 0 );
   mPanGestureLoggingLevel = GetEnvironmentVariable( DALI_ENV_LOG_PAN_GESTURE, 0 );
 
@@ -558,6 +623,8 @@ void EnvironmentOptions::ParseEnvironmentOptions()
 
   SetFromEnvironmentVariable(DALI_GLES_CALL_TIME, mGlesCallTime);
   SetFromEnvironmentVariable<int>(DALI_GLES_CALL_ACCUMULATE, [&](int glesCallAccumulate) { mGlesCallAccumulate = glesCallAccumulate != 0; });
+  SetFromEnvironmentVariable(DALI_GLES_CALL_TRACE, mGlesCallTraceFile);
+  SetFromEnvironmentVariable<int>(DALI_GLES_STATE_CACHE, [&](int glesStateCache) { mGlesStateCacheEnabled = glesStateCache != 0; });
 
   int windowWidth(0), windowHeight(0);
   if ( GetEnvironmentVariable( DALI_WINDOW_WIDTH, windowWidth ) && GetEnvironmentVariable( DALI_WINDOW_HEIGHT, windowHeight ) )
@@ -574,6 +641,7 @@ void EnvironmentOptions::ParseEnvironmentOptions()
                                     switch( threadingMode )
                                     {
                                       case ThreadingMode::COMBINED_UPDATE_RENDER:
+                                      case ThreadingMode::PIPELINED_UPDATE_RENDER:
                                       {
                                         mThreadingMode = static_cast< ThreadingMode::Type >( threadingMode );
                                         break;
@@ -587,8 +655,18 @@ void EnvironmentOptions::ParseEnvironmentOptions()
 
   SetFromEnvironmentVariable<int>(DALI_ENV_MAX_TEXTURE_SIZE, GreaterThan(mMaxTextureSize, 0));
 
+  SetFromEnvironmentVariable<int>(DALI_ENV_TEXTURE_UPLOAD_BUDGET, GreaterThan(mTextureUploadBudget, 0));
+
   mRenderToFboInterval = GetEnvironmentVariable( DALI_RENDER_TO_FBO, 0u );
 
+  SetFromEnvironmentVariable<int>(DALI_ENV_FRAME_PACING, [&](int framePacing) { mFramePacingEnabled = framePacing != 0; });
+
+  SetFromEnvironmentVariable<int>(DALI_ENV_DEFERRED_PRESENT, [&](int deferredPresent) { mDeferredPresentEnabled = deferredPresent != 0; });
+
+  SetFromEnvironmentVariable(DALI_ENV_BENCHMARK_OUTPUT, mBenchmarkOutputFile);
+
+  mWorkerThreadCount = GetEnvironmentVariable( DALI_ENV_WORKER_THREAD_COUNT, 0u );
+
   SetFromEnvironmentVariable<int>(DALI_ENV_DISABLE_DEPTH_BUFFER,
                                   [&](int depthBufferRequired)
                                   {
@@ -110,11 +110,26 @@ public:
    */
   unsigned int GetPerformanceStatsLoggingFrequency() const;
 
+  /**
+   * @return the file to write performance statistics to (empty == off)
+   */
+  const std::string& GetPerformanceStatsLoggingFile() const;
+
   /**
    * @return performance time stamp output ( 0 == off)
    */
   unsigned int GetPerformanceTimeStampOutput() const;
 
+  /**
+   * @return the file to write the time stamped events to in the Chrome trace event format (empty == off)
+   */
+  const std::string& GetPerformanceTraceFile() const;
+
+  /**
+   * @return the size in kilobytes the trace file is rotated at
+   */
+  unsigned int GetPerformanceTraceFileSize() const;
+
   /**
    * @return pan-gesture logging level ( 0 == off )
    */
@@ -264,6 +279,16 @@ public:
    */
   bool GetGlesCallAccumulate() const;
 
+  /**
+   * @return The file to record the GLES calls to, empty if they're not recorded
+   */
+  const std::string& GetGlesCallTraceFile() const;
+
+  /**
+   * @return Whether the GLES calls which set the state to its current value are dropped
+   */
+  bool GlesStateCacheEnabled() const;
+
   /**
    * @return true if performance server is required
    */
@@ -299,6 +324,11 @@ public:
    */
   unsigned int GetMaxTextureSize() const;
 
+  /**
+   * @return The size in kilobytes of the texture uploads staged per frame, 0 if they are not staged
+   */
+  unsigned int GetTextureUploadBudget() const;
+
   /**
    * @brief Retrieves the interval of frames to be rendered into the Frame Buffer Object and the Frame Buffer.
    *
@@ -306,6 +336,26 @@ public:
    */
   unsigned int GetRenderToFboInterval() const;
 
+  /**
+   * @return Whether the frames are paced with the measured display period and render cost.
+   */
+  bool FramePacingEnabled() const;
+
+  /**
+   * @return Whether the buffers of multiple windows are swapped once all the windows are rendered.
+   */
+  bool DeferredPresentEnabled() const;
+
+  /**
+   * @return The file the per-frame timings of the benchmark mode are written to (empty == off).
+   */
+  const std::string& GetBenchmarkOutputFile() const;
+
+  /**
+   * @return The number of threads of the worker thread pool (0 == one per CPU the process can run on, minus one).
+   */
+  unsigned int GetWorkerThreadCount() const;
+
   /**
    * @return Whether the depth buffer is required.
    */
@@ -346,6 +396,10 @@ private: // Data
   Dali::Integration::Log::LogFunction mLogFunction;
   std::string mWindowName;                        ///< name of the window
   std::string mWindowClassName;                   ///< name of the class the window belongs to
+  std::string mPerformanceStatsFile;              ///< file to write performance statistics to
+  std::string mPerformanceTraceFile;              ///< file to write the time stamped events to
+  std::string mBenchmarkOutputFile;               ///< file to write the per-frame timings of the benchmark mode to
+  std::string mGlesCallTraceFile;                 ///< file to record the GLES calls to
   unsigned int mNetworkControl;                   ///< whether network control is enabled
   unsigned int mFpsFrequency;                     ///< how often fps is logged out in seconds
   unsigned int mUpdateStatusFrequency;            ///< how often update status is logged out in frames
@@ -353,12 +407,15 @@ private: // Data
   unsigned int mPerformanceStatsLevel;            ///< performance statistics logging bitmask
   unsigned int mPerformanceStatsFrequency;        ///< performance statistics logging frequency (seconds)
   unsigned int mPerformanceTimeStampOutput;       ///< performance time stamp output ( bitmask)
+  unsigned int mPerformanceTraceFileSize;         ///< size in kilobytes the trace file is rotated at
   unsigned int mPanGestureLoggingLevel;           ///< pan-gesture log level
   unsigned int mWindowWidth;                      ///< width of the window
   unsigned int mWindowHeight;                     ///< height of the window
   unsigned int mRenderRefreshRate;                ///< render refresh rate
   unsigned int mMaxTextureSize;                   ///< The maximum texture size that GL can handle
+  unsigned int mTextureUploadBudget;              ///< The size in kilobytes of the texture uploads staged per frame
   unsigned int mRenderToFboInterval;              ///< The number of frames that are going to be rendered into the Frame Buffer Object but the last one which is going to be rendered into the Frame Buffer.
+  unsigned int mWorkerThreadCount;                ///< The number of threads of the worker thread pool
   int mPanGesturePredictionMode;                  ///< prediction mode for pan gestures
   int mPanGesturePredictionAmount;                ///< prediction amount for pan gestures
   int mPanGestureMaxPredictionAmount;             ///< maximum prediction amount for pan gestures
@@ -386,9 +443,12 @@ private: // Data
   int mMultiSamplingLevel;                        ///< The number of samples required in multisample buffers
   ThreadingMode::Type mThreadingMode;             ///< threading mode
   bool mGlesCallAccumulate;                       ///< Whether or not to accumulate gles call statistics
+  bool mGlesStateCacheEnabled;                    ///< Whether the redundant gles state changes are dropped
   bool mDepthBufferRequired;                      ///< Whether the depth buffer is required
   bool mStencilBufferRequired;                    ///< Whether the stencil buffer is required
   bool mPartialUpdateRequired;                    ///< Whether the partial update is required
+  bool mFramePacingEnabled;                       ///< Whether the adaptive frame pacing is enabled
+  bool mDeferredPresentEnabled;                   ///< Whether the swap of the window buffers is deferred until all the windows are rendered
   std::unique_ptr<TraceManager> mTraceManager;    ///< TraceManager
 };
 
@@ -38,6 +38,11 @@ namespace Adaptor
  */
 #define DALI_ENV_LOG_PERFORMANCE_STATS_FREQUENCY "DALI_LOG_PERFORMANCE_STATS_FREQ"
 
+/**
+ * The file the performance statistics are written to, one JSON object per line
+ */
+#define DALI_ENV_LOG_PERFORMANCE_STATS_FILE "DALI_LOG_PERFORMANCE_STATS_FILE"
+
 /**
  * Where timestamped events for update/render/event and custom events
  * are output.
@@ -45,6 +50,17 @@ namespace Adaptor
  */
 #define DALI_ENV_PERFORMANCE_TIMESTAMP_OUTPUT "DALI_PERFORMANCE_TIMESTAMP_OUTPUT"
 
+/**
+ * The file the timestamped events are written to in the Chrome trace event format,
+ * e.g. to be opened with chrome://tracing or the Perfetto UI
+ */
+#define DALI_ENV_PERFORMANCE_TRACE_FILE "DALI_PERFORMANCE_TRACE_FILE"
+
+/**
+ * The size in kilobytes the trace file is rotated at
+ */
+#define DALI_ENV_PERFORMANCE_TRACE_FILE_SIZE "DALI_PERFORMANCE_TRACE_FILE_SIZE"
+
 /**
  * Allow control and monitoring of DALi via the network
  */
@@ -102,6 +118,17 @@ namespace Adaptor
 
 #define DALI_GLES_CALL_ACCUMULATE "DALI_GLES_CALL_ACCUMULATE"
 
+/**
+ * File to record every GLES call of the render thread and its arguments to, frame by frame.
+ * The trace is read by the gl-call-trace-profiler tool.
+ */
+#define DALI_GLES_CALL_TRACE "DALI_GLES_CALL_TRACE"
+
+/**
+ * Whether the GLES calls which set the state to its current value are dropped
+ */
+#define DALI_GLES_STATE_CACHE "DALI_GLES_STATE_CACHE"
+
 #define DALI_WINDOW_WIDTH "DALI_WINDOW_WIDTH"
 
 #define DALI_WINDOW_HEIGHT "DALI_WINDOW_HEIGHT"
@@ -122,8 +149,34 @@ namespace Adaptor
 
 #define DALI_ENV_MAX_TEXTURE_SIZE "DALI_MAX_TEXTURE_SIZE"
 
+/**
+ * The size in kilobytes of the texture uploads staged in pixel unpack buffers per frame, 0 to upload directly
+ */
+#define DALI_ENV_TEXTURE_UPLOAD_BUDGET "DALI_TEXTURE_UPLOAD_BUDGET"
+
 #define DALI_RENDER_TO_FBO "DALI_RENDER_TO_FBO"
 
+/**
+ * Whether the Update/Render thread paces the frames with the present times instead of a fixed frame duration
+ */
+#define DALI_ENV_FRAME_PACING "DALI_FRAME_PACING"
+
+/**
+ * Whether the buffers of multiple windows are swapped after all the windows are rendered
+ */
+#define DALI_ENV_DEFERRED_PRESENT "DALI_DEFERRED_PRESENT"
+
+/**
+ * The file the per-frame timings are written to. When set, the frames are rendered as fast as possible
+ * with a virtual clock advancing by one frame duration per frame, so the animations are deterministic
+ */
+#define DALI_ENV_BENCHMARK_OUTPUT "DALI_BENCHMARK_OUTPUT"
+
+/**
+ * The number of threads of the worker thread pool. By default one per CPU the process can run on, minus one
+ */
+#define DALI_ENV_WORKER_THREAD_COUNT "DALI_WORKER_THREAD_COUNT"
+
 #define DALI_ENV_DISABLE_DEPTH_BUFFER "DALI_DISABLE_DEPTH_BUFFER"
 
 #define DALI_ENV_DISABLE_STENCIL_BUFFER "DALI_DISABLE_STENCIL_BUFFER"
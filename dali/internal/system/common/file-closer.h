@@ -45,18 +45,11 @@ protected: // prevent this class being directly instantiated
     DALI_ASSERT_DEBUG( filename != 0 && "Can't open a null filename." );
     DALI_ASSERT_DEBUG( mode != 0 && "Null mode is undefined behaviour in spec." );
 
-    Dali::FileLoader::FileType fileType = Dali::FileLoader::FileType::TEXT;
-
     const char* modeStr = mode;
     while( *modeStr )
     {
       switch ( *modeStr )
       {
-      case 'r':
-        break;
-      case 'b':
-        fileType = FileLoader::FileType::BINARY;
-        break;
       // Still has to use fopen for append and write modes
       case 'a':
       case 'w':
@@ -70,14 +63,15 @@ protected: // prevent this class being directly instantiated
       ++modeStr;
     }
 
-    std::streampos bufferSize = 0;
-    if( !Dali::FileLoader::ReadFile( filename, bufferSize, mFileBuffer, fileType ) )
+    // A large file is read in place from its mapping, which fmemopen doesn't write to in read mode,
+    // and a small one from the buffer of the MappedFile
+    if( !Dali::FileLoader::ReadFile( filename, mMappedFile ) )
     {
       mFile = nullptr;
     }
     else
     {
-      mFile = fmemopen( &mFileBuffer[0], bufferSize, mode );
+      mFile = fmemopen( const_cast<uint8_t*>( mMappedFile.GetData() ), mMappedFile.GetSize(), mode );
     }
   }
 
@@ -149,7 +143,7 @@ private:
 
 private:
   FILE* mFile;
-  Dali::Vector<char> mFileBuffer;
+  Dali::MappedFile mMappedFile;
 };
 
 } // namespace Platform
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/frame-benchmark.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstdio>
+#include <sys/resource.h>
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/environment-options.h>
+#include <dali/internal/system/common/time-service.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+const unsigned int INITIAL_FRAME_CAPACITY = 4096u;   ///< Frames are recorded without reallocation up to this number.
+const uint64_t NANOSECONDS_PER_MICROSECOND = 1000u;
+
+/**
+ * @return The current time in nanoseconds.
+ */
+uint64_t GetTime()
+{
+  uint64_t time = 0u;
+  TimeService::GetNanoseconds( time );
+  return time;
+}
+
+/**
+ * @return The maximum resident set size of the process, in kilobytes.
+ */
+unsigned int GetMaximumRss()
+{
+  struct rusage usage;
+  if( 0 == getrusage( RUSAGE_SELF, &usage ) )
+  {
+    return static_cast<unsigned int>( usage.ru_maxrss );
+  }
+  return 0u;
+}
+
+/**
+ * Writes the summary of one of the timings of the frames.
+ * @param[in] file The file to write to.
+ * @param[in] name The name of the timing.
+ * @param[in] values The timing of each frame, sorted in place.
+ */
+void WriteSummary( FILE* file, const char* const name, std::vector<unsigned int>& values )
+{
+  std::sort( values.begin(), values.end() );
+
+  uint64_t total = 0u;
+  for( auto&& value : values )
+  {
+    total += value;
+  }
+
+  const size_t count = values.size();
+  fprintf( file, "\"%s\":{\"avg\":%.1f,\"p50\":%u,\"p90\":%u,\"p99\":%u,\"max\":%u}",
+           name,
+           static_cast<double>( total ) / count,
+           values[ ( count - 1u ) * 50u / 100u ],
+           values[ ( count - 1u ) * 90u / 100u ],
+           values[ ( count - 1u ) * 99u / 100u ],
+           values.back() );
+}
+
+} // unnamed namespace
+
+FrameBenchmark::FrameBenchmark( const EnvironmentOptions& environmentOptions )
+: mFrames(),
+  mOutputFile( environmentOptions.GetBenchmarkOutputFile() ),
+  mFrameStartTime( 0u ),
+  mUpdateEndTime( 0u ),
+  mSwapStartTime( 0u ),
+  mSwapDuration( 0u ),
+  mFrameIndex( 0u ),
+  mEnabled( !mOutputFile.empty() )
+{
+  if( mEnabled )
+  {
+    mFrames.reserve( INITIAL_FRAME_CAPACITY );
+  }
+}
+
+FrameBenchmark::~FrameBenchmark()
+{
+}
+
+void FrameBenchmark::FrameStarted()
+{
+  if( mEnabled )
+  {
+    mFrameStartTime = GetTime();
+    mUpdateEndTime = mFrameStartTime;
+    mSwapDuration = 0u;
+  }
+}
+
+unsigned int FrameBenchmark::GetVirtualTime( unsigned int frameDuration ) const
+{
+  return mFrameIndex * frameDuration;
+}
+
+void FrameBenchmark::UpdateFinished()
+{
+  if( mEnabled )
+  {
+    mUpdateEndTime = GetTime();
+  }
+}
+
+void FrameBenchmark::SwapStarted()
+{
+  if( mEnabled )
+  {
+    mSwapStartTime = GetTime();
+  }
+}
+
+void FrameBenchmark::SwapFinished()
+{
+  if( mEnabled )
+  {
+    mSwapDuration += GetTime() - mSwapStartTime;
+  }
+}
+
+void FrameBenchmark::FrameFinished()
+{
+  if( !mEnabled )
+  {
+    return;
+  }
+
+  const uint64_t frameEndTime = GetTime();
+
+  Frame frame;
+  frame.update = static_cast<unsigned int>( ( mUpdateEndTime - mFrameStartTime ) / NANOSECONDS_PER_MICROSECOND );
+  frame.render = static_cast<unsigned int>( ( frameEndTime - mUpdateEndTime - mSwapDuration ) / NANOSECONDS_PER_MICROSECOND );
+  frame.swap = static_cast<unsigned int>( mSwapDuration / NANOSECONDS_PER_MICROSECOND );
+  frame.total = static_cast<unsigned int>( ( frameEndTime - mFrameStartTime ) / NANOSECONDS_PER_MICROSECOND );
+  frame.maximumRss = GetMaximumRss();
+  mFrames.push_back( frame );
+
+  ++mFrameIndex;
+}
+
+void FrameBenchmark::WriteReport()
+{
+  if( !mEnabled || mFrames.empty() )
+  {
+    return;
+  }
+
+  FILE* file = fopen( mOutputFile.c_str(), "w" );
+  if( !file )
+  {
+    DALI_LOG_ERROR( "Failed to open the benchmark output file %s\n", mOutputFile.c_str() );
+    return;
+  }
+
+  // Times in microseconds, memory in kilobytes
+  fprintf( file, "{\"frameCount\":%u,\"maximumRss\":%u,\n\"summary\":{", static_cast<unsigned int>( mFrames.size() ), mFrames.back().maximumRss );
+
+  std::vector<unsigned int> values( mFrames.size() );
+  unsigned int Frame::* const timings[] = { &Frame::update, &Frame::render, &Frame::swap, &Frame::total };
+  const char* const names[] = { "update", "render", "swap", "total" };
+  for( unsigned int timing = 0u; timing < sizeof( timings ) / sizeof( timings[0] ); ++timing )
+  {
+    for( size_t index = 0u; index < mFrames.size(); ++index )
+    {
+      values[index] = mFrames[index].*timings[timing];
+    }
+    fputs( ( 0u == timing ) ? "" : ",", file );
+    WriteSummary( file, names[timing], values );
+  }
+
+  fputs( "},\n\"frames\":[\n", file );
+  for( size_t index = 0u; index < mFrames.size(); ++index )
+  {
+    const Frame& frame = mFrames[index];
+    fprintf( file, "%s{\"update\":%u,\"render\":%u,\"swap\":%u,\"total\":%u,\"maximumRss\":%u}",
+             ( 0u == index ) ? "" : ",\n", frame.update, frame.render, frame.swap, frame.total, frame.maximumRss );
+  }
+  fputs( "\n]}\n", file );
+
+  fclose( file );
+
+  DALI_LOG_RELEASE_INFO( "FrameBenchmark: %u frames written to %s\n", static_cast<unsigned int>( mFrames.size() ), mOutputFile.c_str() );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,143 @@
+#ifndef DALI_INTERNAL_FRAME_BENCHMARK_H
+#define DALI_INTERNAL_FRAME_BENCHMARK_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class EnvironmentOptions;
+
+/**
+ * Records the timings of each frame of the Update/Render thread in the benchmark mode.
+ *
+ * In the benchmark mode the frames are rendered as fast as possible, and the time given to Core is a virtual clock
+ * advancing by one frame duration per frame, so the same scene produces the same frames whatever the speed of the device.
+ * The update, render and swap durations and the memory high-water mark of each frame are written as JSON
+ * when the Update/Render thread stops.
+ *
+ * Only used by the Update/Render thread.
+ */
+class FrameBenchmark
+{
+public:
+
+  /**
+   * Create the frame benchmark.
+   * @param[in] environmentOptions environment options
+   */
+  FrameBenchmark( const EnvironmentOptions& environmentOptions );
+
+  /**
+   * Non-virtual destructor; FrameBenchmark is not suitable as a base class.
+   */
+  ~FrameBenchmark();
+
+  /**
+   * @return Whether the benchmark mode is enabled.
+   */
+  bool Enabled() const
+  {
+    return mEnabled;
+  }
+
+  /**
+   * Called at the start of each frame.
+   */
+  void FrameStarted();
+
+  /**
+   * @param[in] frameDuration The duration of a frame in milliseconds.
+   * @return The virtual time of the current frame in milliseconds.
+   */
+  unsigned int GetVirtualTime( unsigned int frameDuration ) const;
+
+  /**
+   * Called once the update of the frame is done.
+   */
+  void UpdateFinished();
+
+  /**
+   * Called before the buffers of a window are swapped.
+   */
+  void SwapStarted();
+
+  /**
+   * Called after the buffers of a window are swapped.
+   */
+  void SwapFinished();
+
+  /**
+   * Called at the end of each frame.
+   */
+  void FrameFinished();
+
+  /**
+   * Writes the timings of the frames recorded so far.
+   */
+  void WriteReport();
+
+private:
+
+  /**
+   * The timings of a frame, in microseconds.
+   */
+  struct Frame
+  {
+    unsigned int update;     ///< The time spent updating.
+    unsigned int render;     ///< The time spent rendering, without the swaps.
+    unsigned int swap;       ///< The time spent swapping the buffers.
+    unsigned int total;      ///< The duration of the frame.
+    unsigned int maximumRss; ///< The memory high-water mark at the end of the frame, in kilobytes.
+  };
+
+  // Declared private and left undefined to avoid copies.
+  FrameBenchmark( const FrameBenchmark& );
+  // Declared private and left undefined to avoid copies.
+  FrameBenchmark& operator=( const FrameBenchmark& );
+
+private: // Data
+
+  std::vector<Frame> mFrames;  ///< The timings of the frames recorded so far.
+  std::string mOutputFile;     ///< The file the timings are written to.
+  uint64_t mFrameStartTime;    ///< The time the current frame started.
+  uint64_t mUpdateEndTime;     ///< The time the update of the current frame finished.
+  uint64_t mSwapStartTime;     ///< The time the current swap started.
+  uint64_t mSwapDuration;      ///< The time spent swapping the buffers in the current frame.
+  unsigned int mFrameIndex;    ///< The index of the current frame, which drives the virtual clock.
+  bool mEnabled;               ///< Whether the benchmark mode is enabled.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_FRAME_BENCHMARK_H
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/frame-pacer.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/environment-options.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Integration::Log::Filter* gLogFilter = Integration::Log::Filter::New( Debug::NoLogging, false, "LOG_FRAME_PACER" );
+#endif
+
+const double PERIOD_SMOOTHING = 1.0 / 16.0;          ///< The weight of a new sample of the display period.
+const double PHASE_SMOOTHING = 1.0 / 4.0;            ///< The weight of a new present time in the vsync phase.
+const double COST_SMOOTHING = 1.0 / 8.0;             ///< The weight of a new sample of the render cost.
+const double PERIOD_TOLERANCE = 0.25;                ///< How far, in periods, a present interval can be from a multiple of the period to be used to learn it.
+const double MINIMUM_PERIOD_RATIO = 0.5;             ///< The learnt display period is kept within these ratios of the default one.
+const double MAXIMUM_PERIOD_RATIO = 2.0;
+const double MINIMUM_SAFETY_MARGIN = 1000000.0;      ///< Wake up at least 1ms before the predicted render cost.
+const double UNDERLOAD_RATIO = 0.6;                  ///< The number of frames per render is decreased if the render cost fits this ratio of the shorter interval.
+const unsigned int MAXIMUM_PERIOD_MULTIPLE = 4u;     ///< Longer present intervals are not used to learn the display period.
+const unsigned int MAXIMUM_FRAMES_PER_RENDER = 4u;   ///< The number of frames per render is not increased over this one.
+const unsigned int ADAPTATION_WINDOW = 120u;         ///< The number of frames used to evaluate the number of frames per render.
+const unsigned int OVERLOAD_MISSED_DEADLINES = 30u;  ///< The number of frames per render is increased if this number of deadlines is missed within the window.
+const unsigned int REPORT_INTERVAL = 600u;           ///< The number of frames between reports.
+const double NANOSECONDS_TO_MILLISECONDS = 0.000001;
+
+} // unnamed namespace
+
+FramePacer::FramePacer( const EnvironmentOptions& environmentOptions, uint64_t defaultDisplayPeriod )
+: mDefaultDisplayPeriod( static_cast<double>( defaultDisplayPeriod ) ),
+  mDisplayPeriod( static_cast<double>( defaultDisplayPeriod ) ),
+  mVSyncTime( 0.0 ),
+  mRenderCost( 0.0 ),
+  mRenderCostDeviation( 0.0 ),
+  mDeadline( 0.0 ),
+  mJitter( 0.0 ),
+  mMaximumJitter( 0.0 ),
+  mFrameStartTime( 0u ),
+  mLastPresentTime( 0u ),
+  mFramesPerRender( 1u ),
+  mRequestedFramesPerRender( 1u ),
+  mWindowFrameCount( 0u ),
+  mWindowMissedDeadlines( 0u ),
+  mReportFrameCount( 0u ),
+  mReportMissedDeadlines( 0u ),
+  mTotalFrameCount( 0u ),
+  mTotalMissedDeadlines( 0u ),
+  mEnabled( environmentOptions.FramePacingEnabled() )
+{
+}
+
+FramePacer::~FramePacer()
+{
+  if( mEnabled )
+  {
+    DALI_LOG_RELEASE_INFO( "FramePacer: frames %u, missed deadlines %u, display period %.3fms\n", mTotalFrameCount, mTotalMissedDeadlines, mDisplayPeriod * NANOSECONDS_TO_MILLISECONDS );
+  }
+}
+
+bool FramePacer::Enabled() const
+{
+  return mEnabled;
+}
+
+void FramePacer::Reset()
+{
+  mLastPresentTime = 0u;
+  mDeadline = 0.0;
+}
+
+void FramePacer::FrameStarted( uint64_t frameStartTime )
+{
+  mFrameStartTime = frameStartTime;
+}
+
+void FramePacer::FramePresented( uint64_t swapTime, uint64_t presentTime )
+{
+  // Render cost
+  const double cost = static_cast<double>( swapTime - mFrameStartTime );
+  if( mRenderCost > 0.0 )
+  {
+    const double difference = cost - mRenderCost;
+    mRenderCost += difference * COST_SMOOTHING;
+    mRenderCostDeviation += ( std::abs( difference ) - mRenderCostDeviation ) * COST_SMOOTHING;
+  }
+  else
+  {
+    mRenderCost = cost;
+  }
+
+  // Display period. Only the intervals close to a multiple of the period are used, the others are not vsync aligned.
+  if( 0u != mLastPresentTime )
+  {
+    const double interval = static_cast<double>( presentTime - mLastPresentTime );
+    const double periods = interval / mDisplayPeriod;
+    const double multiple = std::round( periods );
+    if( ( multiple >= 1.0 ) && ( multiple <= MAXIMUM_PERIOD_MULTIPLE ) && ( std::abs( periods - multiple ) < PERIOD_TOLERANCE ) )
+    {
+      mDisplayPeriod += ( interval / multiple - mDisplayPeriod ) * PERIOD_SMOOTHING;
+      mDisplayPeriod = std::max( MINIMUM_PERIOD_RATIO * mDefaultDisplayPeriod, std::min( mDisplayPeriod, MAXIMUM_PERIOD_RATIO * mDefaultDisplayPeriod ) );
+    }
+
+    const double jitter = std::abs( interval - mFramesPerRender * mDisplayPeriod );
+    mJitter += jitter;
+    mMaximumJitter = std::max( mMaximumJitter, jitter );
+    ++mReportFrameCount;
+  }
+
+  // Missed deadlines. The frame is late if it's presented at a later vsync than the paced one, whether it was
+  // scheduled later or rendered too slowly. Each frame is counted once, here.
+  if( mDeadline > 0.0 )
+  {
+    if( static_cast<double>( presentTime ) > mDeadline + 0.5 * mDisplayPeriod )
+    {
+      ++mWindowMissedDeadlines;
+      ++mReportMissedDeadlines;
+      ++mTotalMissedDeadlines;
+    }
+    ++mWindowFrameCount;
+    ++mTotalFrameCount;
+  }
+
+  // Display phase
+  if( mVSyncTime > 0.0 )
+  {
+    const double predictedVSyncTime = mVSyncTime + std::round( ( presentTime - mVSyncTime ) / mDisplayPeriod ) * mDisplayPeriod;
+    mVSyncTime = predictedVSyncTime + ( presentTime - predictedVSyncTime ) * PHASE_SMOOTHING;
+  }
+  else
+  {
+    mVSyncTime = static_cast<double>( presentTime );
+  }
+
+  mLastPresentTime = presentTime;
+
+  if( mReportFrameCount >= REPORT_INTERVAL )
+  {
+    OutputReport();
+  }
+}
+
+bool FramePacer::UpdateFramesPerRender( unsigned int requestedFramesPerRender )
+{
+  if( requestedFramesPerRender != mRequestedFramesPerRender )
+  {
+    // The application changed the refresh rate.
+    mRequestedFramesPerRender = requestedFramesPerRender;
+    mFramesPerRender = requestedFramesPerRender;
+    mWindowFrameCount = 0u;
+    mWindowMissedDeadlines = 0u;
+    return true;
+  }
+
+  if( mWindowFrameCount < ADAPTATION_WINDOW )
+  {
+    return false;
+  }
+
+  const unsigned int previousFramesPerRender = mFramesPerRender;
+  const double predictedCost = mRenderCost + 2.0 * mRenderCostDeviation;
+
+  if( ( mWindowMissedDeadlines >= OVERLOAD_MISSED_DEADLINES ) && ( mFramesPerRender < MAXIMUM_FRAMES_PER_RENDER ) )
+  {
+    ++mFramesPerRender;
+  }
+  else if( ( 0u == mWindowMissedDeadlines ) && ( mFramesPerRender > mRequestedFramesPerRender ) &&
+           ( predictedCost < UNDERLOAD_RATIO * ( mFramesPerRender - 1u ) * mDisplayPeriod ) )
+  {
+    --mFramesPerRender;
+  }
+
+  mWindowFrameCount = 0u;
+  mWindowMissedDeadlines = 0u;
+
+  if( previousFramesPerRender != mFramesPerRender )
+  {
+    DALI_LOG_RELEASE_INFO( "FramePacer: frames per render %u -> %u, render cost %.3fms, display period %.3fms\n",
+                           previousFramesPerRender, mFramesPerRender, mRenderCost * NANOSECONDS_TO_MILLISECONDS, mDisplayPeriod * NANOSECONDS_TO_MILLISECONDS );
+    return true;
+  }
+
+  return false;
+}
+
+unsigned int FramePacer::GetFramesPerRender() const
+{
+  return mFramesPerRender;
+}
+
+unsigned int FramePacer::ScheduleNextFrame( uint64_t currentTime, uint64_t& wakeUpTime )
+{
+  if( mVSyncTime <= 0.0 )
+  {
+    // Nothing presented yet, the phase is unknown.
+    mDeadline = 0.0;
+    wakeUpTime = currentTime;
+    return 0u;
+  }
+
+  const double leadTime = mRenderCost + std::max( 2.0 * mRenderCostDeviation, MINIMUM_SAFETY_MARGIN );
+  const double now = static_cast<double>( currentTime );
+
+  const double pacedDeadline = mVSyncTime + mFramesPerRender * mDisplayPeriod;
+  double deadline = pacedDeadline;
+  unsigned int droppedPeriods = 0u;
+  if( deadline - leadTime < now )
+  {
+    // Too late for the paced vsync, aim at the first one that can be met. It's counted as missed once presented.
+    droppedPeriods = static_cast<unsigned int>( std::ceil( ( now + leadTime - deadline ) / mDisplayPeriod ) );
+    deadline += droppedPeriods * mDisplayPeriod;
+  }
+
+  mDeadline = ( 0u != mLastPresentTime ) ? pacedDeadline : deadline;
+  wakeUpTime = static_cast<uint64_t>( deadline - leadTime );
+
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "FramePacer::ScheduleNextFrame. cost : %.3fms, lead time : %.3fms, dropped periods : %u\n",
+                 mRenderCost * NANOSECONDS_TO_MILLISECONDS, leadTime * NANOSECONDS_TO_MILLISECONDS, droppedPeriods );
+
+  return droppedPeriods / mFramesPerRender;
+}
+
+void FramePacer::OutputReport()
+{
+  DALI_LOG_RELEASE_INFO( "FramePacer: frames %u, missed deadlines %u, mean jitter %.3fms, maximum jitter %.3fms, display period %.3fms, render cost %.3fms\n",
+                         mReportFrameCount, mReportMissedDeadlines,
+                         mJitter / mReportFrameCount * NANOSECONDS_TO_MILLISECONDS, mMaximumJitter * NANOSECONDS_TO_MILLISECONDS,
+                         mDisplayPeriod * NANOSECONDS_TO_MILLISECONDS, mRenderCost * NANOSECONDS_TO_MILLISECONDS );
+
+  mJitter = 0.0;
+  mMaximumJitter = 0.0;
+  mReportFrameCount = 0u;
+  mReportMissedDeadlines = 0u;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
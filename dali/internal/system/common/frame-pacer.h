@@ -0,0 +1,149 @@
+#ifndef DALI_INTERNAL_FRAME_PACER_H
+#define DALI_INTERNAL_FRAME_PACER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class EnvironmentOptions;
+
+/**
+ * Paces the frames of the Update/Render thread with the times the frames are presented.
+ *
+ * The swap of the buffers blocks until the display is ready, so the times the swaps return are aligned to the vsync.
+ * The pacer learns the display period and phase from these times and the render cost from the time spent
+ * until the buffers are swapped. The Update/Render thread then sleeps until the next vsync minus the predicted
+ * render cost, so frames start as late as possible without missing their vsync.
+ *
+ * If too many deadlines are missed, the number of frames per render is increased. It's decreased back to the
+ * requested one when the render cost fits in the shorter frame again.
+ *
+ * All the times are in nanoseconds. Only used by the Update/Render thread.
+ */
+class FramePacer
+{
+public:
+
+  /**
+   * Create the frame pacer.
+   * @param[in] environmentOptions environment options
+   * @param[in] defaultDisplayPeriod The display period assumed until it's measured.
+   */
+  FramePacer( const EnvironmentOptions& environmentOptions, uint64_t defaultDisplayPeriod );
+
+  /**
+   * Non-virtual destructor; FramePacer is not suitable as a base class.
+   */
+  ~FramePacer();
+
+  /**
+   * @return Whether frame pacing is enabled.
+   */
+  bool Enabled() const;
+
+  /**
+   * Called when the Update/Render thread resumes after waiting, so the next frame doesn't follow the previous one.
+   * The display period and phase learnt so far are kept.
+   */
+  void Reset();
+
+  /**
+   * Called at the start of each frame.
+   * @param[in] frameStartTime The time the frame starts.
+   */
+  void FrameStarted( uint64_t frameStartTime );
+
+  /**
+   * Called once the frame is presented.
+   * @param[in] swapTime The time the buffers started to be swapped, i.e. when the rendering finished.
+   * @param[in] presentTime The time the swap of the buffers returned, taken straight after the swap.
+   */
+  void FramePresented( uint64_t swapTime, uint64_t presentTime );
+
+  /**
+   * Adapts the number of frames per render to the missed deadlines of the last frames.
+   * @param[in] requestedFramesPerRender The number of frames per render requested by the application, the minimum one.
+   * @return Whether the number of frames per render has changed.
+   */
+  bool UpdateFramesPerRender( unsigned int requestedFramesPerRender );
+
+  /**
+   * @return The number of frames per render the frames are paced at.
+   */
+  unsigned int GetFramesPerRender() const;
+
+  /**
+   * Predicts the deadline of the next frame and the time the Update/Render thread should wake up to meet it.
+   * @param[in] currentTime The current time.
+   * @param[out] wakeUpTime The time to sleep until.
+   * @return The number of frames dropped because the next frame can't meet the first deadline.
+   */
+  unsigned int ScheduleNextFrame( uint64_t currentTime, uint64_t& wakeUpTime );
+
+private:
+
+  /**
+   * Output the jitter and the missed deadlines since the last report.
+   */
+  void OutputReport();
+
+  // Declared private and left undefined to avoid copies.
+  FramePacer( const FramePacer& );
+  // Declared private and left undefined to avoid copies.
+  FramePacer& operator=( const FramePacer& );
+
+private: // Data
+
+  double mDefaultDisplayPeriod;           ///< The display period assumed until it's measured.
+  double mDisplayPeriod;                  ///< The estimated display period.
+  double mVSyncTime;                      ///< The estimated time of the vsync the last frame was presented at. Zero if unknown.
+  double mRenderCost;                     ///< The smoothed time from the start of a frame to the swap of the buffers.
+  double mRenderCostDeviation;            ///< The smoothed deviation of the render cost.
+  double mDeadline;                       ///< The paced vsync of the scheduled frame, a later one if it doesn't follow the previous frame. Zero if none.
+  double mJitter;                         ///< The sum of the differences between the present intervals and the paced interval since the last report.
+  double mMaximumJitter;                  ///< The maximum difference between a present interval and the paced interval since the last report.
+  uint64_t mFrameStartTime;               ///< The time the current frame started.
+  uint64_t mLastPresentTime;              ///< The time the previous frame was presented. Zero if the current frame doesn't follow it.
+  unsigned int mFramesPerRender;          ///< The number of frames per render the frames are paced at.
+  unsigned int mRequestedFramesPerRender; ///< The number of frames per render requested by the application.
+  unsigned int mWindowFrameCount;         ///< The number of frames with a deadline since the number of frames per render was last evaluated.
+  unsigned int mWindowMissedDeadlines;    ///< The number of missed deadlines since the number of frames per render was last evaluated.
+  unsigned int mReportFrameCount;         ///< The number of contiguous frames since the last report.
+  unsigned int mReportMissedDeadlines;    ///< The number of missed deadlines since the last report.
+  unsigned int mTotalFrameCount;          ///< The number of frames with a deadline since the pacer was created.
+  unsigned int mTotalMissedDeadlines;     ///< The number of missed deadlines since the pacer was created.
+  bool mEnabled;                          ///< Whether frame pacing is enabled.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_FRAME_PACER_H
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/frame-time-histogram.h>
+
+// EXTERNAL INCLUDES
+#include <cmath>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+const unsigned int SUB_BUCKET_BITS = 5u;                                     ///< Each power of two range is split in 2^5 buckets.
+const unsigned int SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+const unsigned int MAXIMUM_DURATION = ( 1u << 26u ) - 1u;                    ///< ~67 seconds. Longer durations are clamped.
+
+/**
+ * @brief Retrieves the bucket of a duration.
+ * @param[in] microseconds The duration.
+ * @return The index of the bucket.
+ */
+unsigned int GetBucketIndex( unsigned int microseconds )
+{
+  if( microseconds < SUB_BUCKET_COUNT )
+  {
+    return microseconds;
+  }
+
+  if( microseconds > MAXIMUM_DURATION )
+  {
+    microseconds = MAXIMUM_DURATION;
+  }
+
+  // The position of the most significant bit selects the range, the next SUB_BUCKET_BITS bits the bucket within it.
+  const unsigned int range = ( 31u - __builtin_clz( microseconds ) ) - SUB_BUCKET_BITS;
+  return SUB_BUCKET_COUNT + range * SUB_BUCKET_COUNT + ( ( microseconds >> range ) & ( SUB_BUCKET_COUNT - 1u ) );
+}
+
+/**
+ * @brief Retrieves the highest duration recorded in a bucket.
+ * @param[in] index The index of the bucket.
+ * @return The duration in microseconds.
+ */
+unsigned int GetBucketUpperBound( unsigned int index )
+{
+  if( index < SUB_BUCKET_COUNT )
+  {
+    return index;
+  }
+
+  const unsigned int range = ( index - SUB_BUCKET_COUNT ) / SUB_BUCKET_COUNT;
+  const unsigned int subBucket = ( index - SUB_BUCKET_COUNT ) % SUB_BUCKET_COUNT;
+  return ( ( SUB_BUCKET_COUNT + subBucket + 1u ) << range ) - 1u;
+}
+
+} // unnamed namespace
+
+unsigned int FrameTimeHistogram::Snapshot::GetPercentile( float percentile ) const
+{
+  if( 0u == count )
+  {
+    return 0u;
+  }
+
+  unsigned int rank = static_cast<unsigned int>( std::ceil( percentile * 0.01f * count ) );
+  if( rank < 1u )
+  {
+    rank = 1u;
+  }
+
+  unsigned int accumulated = 0u;
+  for( unsigned int index = 0u; index < NUMBER_OF_BUCKETS; ++index )
+  {
+    accumulated += buckets[index];
+    if( accumulated >= rank )
+    {
+      return GetBucketUpperBound( index );
+    }
+  }
+
+  return GetBucketUpperBound( NUMBER_OF_BUCKETS - 1u );
+}
+
+FrameTimeHistogram::FrameTimeHistogram()
+{
+  for( auto& bucket : mBuckets )
+  {
+    bucket.store( 0u, std::memory_order_relaxed );
+  }
+}
+
+FrameTimeHistogram::~FrameTimeHistogram()
+{
+}
+
+void FrameTimeHistogram::Record( unsigned int microseconds )
+{
+  mBuckets[GetBucketIndex( microseconds )].fetch_add( 1u, std::memory_order_relaxed );
+}
+
+void FrameTimeHistogram::TakeSnapshot( Snapshot& snapshot )
+{
+  snapshot.count = 0u;
+  for( unsigned int index = 0u; index < NUMBER_OF_BUCKETS; ++index )
+  {
+    snapshot.buckets[index] = mBuckets[index].exchange( 0u, std::memory_order_relaxed );
+    snapshot.count += snapshot.buckets[index];
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,106 @@
+#ifndef DALI_INTERNAL_ADAPTOR_FRAME_TIME_HISTOGRAM_H
+#define DALI_INTERNAL_ADAPTOR_FRAME_TIME_HISTOGRAM_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * A histogram of durations in microseconds with log-linear buckets, as in HdrHistogram.
+ *
+ * The durations under 32 microseconds have a bucket each. Every power of two range over it is split in 32 buckets,
+ * so the percentiles are within ~3% of the recorded durations using constant memory.
+ * The durations over ~67 seconds are recorded in the last bucket.
+ *
+ * Recording is lock-free, so the durations can be recorded by one thread while another takes snapshots.
+ */
+class FrameTimeHistogram
+{
+public:
+
+  static const unsigned int NUMBER_OF_BUCKETS = 704u; ///< 32 buckets for each of the ranges [0,32), [32,64), ... [2^25,2^26).
+
+  /**
+   * The counts of the histogram at a point in time.
+   */
+  struct Snapshot
+  {
+    /**
+     * Retrieves the duration under which the given percentage of the durations are.
+     * @param[in] percentile The percentage, between 0 and 100.
+     * @return The highest duration of the bucket the percentile falls in, in microseconds. Zero if the snapshot is empty.
+     */
+    unsigned int GetPercentile( float percentile ) const;
+
+    unsigned int buckets[NUMBER_OF_BUCKETS]; ///< The number of durations in each bucket.
+    unsigned int count;                      ///< The total number of durations.
+  };
+
+  /**
+   * Constructor
+   */
+  FrameTimeHistogram();
+
+  /**
+   * Destructor, not intended as a base class
+   */
+  ~FrameTimeHistogram();
+
+  /**
+   * Records a duration.
+   * @param[in] microseconds The duration.
+   */
+  void Record( unsigned int microseconds );
+
+  /**
+   * Moves the durations recorded since the last snapshot to the given one and empties the histogram.
+   * A duration recorded while the snapshot is taken is either in this snapshot or in the next one.
+   * @param[out] snapshot The snapshot.
+   */
+  void TakeSnapshot( Snapshot& snapshot );
+
+private:
+
+  // Undefined copy constructor.
+  FrameTimeHistogram( const FrameTimeHistogram& );
+
+  // Undefined assignment operator.
+  FrameTimeHistogram& operator=( const FrameTimeHistogram& );
+
+private:
+
+  std::atomic<unsigned int> mBuckets[NUMBER_OF_BUCKETS]; ///< The number of durations in each bucket.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_FRAME_TIME_HISTOGRAM_H
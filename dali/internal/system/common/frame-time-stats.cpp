@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <cmath>
+#include <limits>
 
 namespace Dali
 {
@@ -32,16 +33,28 @@ namespace Adaptor
 
 namespace
 {
-const float EPSILON = 0.9f; // rolling average = (average * epsilon) + (current * epsilon)
 const float ONE_OVER_MICROSECONDS_TO_SECONDS = 1.f / 1000000.f; ///< microseconds per second
+const unsigned int NO_MINIMUM = std::numeric_limits<unsigned int>::max();
 }
 
 FrameTimeStats::FrameTimeStats()
-: mTotal( 0.f)
+: mHistogram(),
+  mSum( 0u ),
+  mSumOfSquares( 0u ),
+  mMin( NO_MINIMUM ),
+  mMax( 0u ),
+  mRunCount( 0u ),
+  mTotal( 0u ),
+  mSnapshot(),
+  mSnapshotSum( 0u ),
+  mSnapshotSumOfSquares( 0u ),
+  mSnapshotTotal( 0u ),
+  mSnapshotMin( 0u ),
+  mSnapshotMax( 0u ),
+  mSnapshotRunCount( 0u ),
+  mStart(),
+  mTimeState( WAITING_FOR_START_TIME )
 {
-  mSamples.Reserve( 16 );   // Fill out a little to avoid early reallocations
-
-  Reset();
 }
 
 FrameTimeStats::~FrameTimeStats()
@@ -53,7 +66,7 @@ void FrameTimeStats::StartTime( const FrameTimeStamp& timeStamp )
   // check to make sure we don't get 2 start times in a row
   if( mTimeState != WAITING_FOR_START_TIME )
   {
-    Reset();
+    ResetTimer();
   }
 
   mStart = timeStamp;
@@ -64,104 +77,90 @@ void FrameTimeStats::EndTime( const FrameTimeStamp& timeStamp )
 {
   if( mTimeState != WAITING_FOR_END_TIME )
   {
-    Reset();
+    ResetTimer();
     return;
   }
 
   mTimeState = WAITING_FOR_START_TIME;
-  mRunCount++;
 
-  // frame time in seconds
-  unsigned int elapsedTime = FrameTimeStamp::MicrosecondDiff( mStart, timeStamp);
+  // frame time in microseconds
+  const unsigned int elapsedTime = FrameTimeStamp::MicrosecondDiff( mStart, timeStamp );
 
-  mSamples.PushBack( elapsedTime );
+  mHistogram.Record( elapsedTime );
+  mSum.fetch_add( elapsedTime, std::memory_order_relaxed );
+  mSumOfSquares.fetch_add( uint64_t( elapsedTime ) * elapsedTime, std::memory_order_relaxed );
+  mTotal.fetch_add( elapsedTime, std::memory_order_relaxed );
+  mRunCount.fetch_add( 1u, std::memory_order_relaxed );
 
-  // if the min and max times haven't been set, do that now.
-  if( !mMinMaxTimeSet )
+  unsigned int minimum = mMin.load( std::memory_order_relaxed );
+  while( ( elapsedTime < minimum ) && !mMin.compare_exchange_weak( minimum, elapsedTime, std::memory_order_relaxed ) )
   {
-    mMin = elapsedTime;
-    mMax = elapsedTime;
-    mMinMaxTimeSet = true;
   }
-  else
+
+  unsigned int maximum = mMax.load( std::memory_order_relaxed );
+  while( ( elapsedTime > maximum ) && !mMax.compare_exchange_weak( maximum, elapsedTime, std::memory_order_relaxed ) )
   {
-    if (elapsedTime < mMin)
-    {
-      mMin= elapsedTime;
-    }
-    else if (elapsedTime > mMax)
-    {
-      mMax = elapsedTime;
-    }
   }
+}
 
-  mTotal += elapsedTime;
+void FrameTimeStats::TakeSnapshot()
+{
+  mHistogram.TakeSnapshot( mSnapshot );
+  mSnapshotSum = mSum.exchange( 0u, std::memory_order_relaxed );
+  mSnapshotSumOfSquares = mSumOfSquares.exchange( 0u, std::memory_order_relaxed );
+  mSnapshotRunCount = mRunCount.exchange( 0u, std::memory_order_relaxed );
+  mSnapshotMin = mMin.exchange( NO_MINIMUM, std::memory_order_relaxed );
+  mSnapshotMax = mMax.exchange( 0u, std::memory_order_relaxed );
+  mSnapshotTotal = mTotal.load( std::memory_order_relaxed );
+
+  if( NO_MINIMUM == mSnapshotMin )
+  {
+    mSnapshotMin = 0u;
+  }
 }
 
-void FrameTimeStats::Reset()
+void FrameTimeStats::ResetTimer()
 {
   mTimeState = WAITING_FOR_START_TIME;
-  mMinMaxTimeSet = false;
-  mMin = 0.f;
-  mMax = 0.f;
-  mRunCount = 0;
   mStart = FrameTimeStamp();
-  mSamples.Clear();
 }
 
 float FrameTimeStats::GetMaxTime() const
 {
-  return mMax * ONE_OVER_MICROSECONDS_TO_SECONDS;
+  return mSnapshotMax * ONE_OVER_MICROSECONDS_TO_SECONDS;
 }
 
 float FrameTimeStats::GetMinTime() const
 {
-  return mMin * ONE_OVER_MICROSECONDS_TO_SECONDS;
+  return mSnapshotMin * ONE_OVER_MICROSECONDS_TO_SECONDS;
 }
 
 float FrameTimeStats::GetTotalTime() const
 {
-  return mTotal * ONE_OVER_MICROSECONDS_TO_SECONDS;
+  return mSnapshotTotal * ONE_OVER_MICROSECONDS_TO_SECONDS;
 }
 
 unsigned int FrameTimeStats::GetRunCount() const
 {
-  return mRunCount;
+  return mSnapshotRunCount;
 }
 
 void FrameTimeStats::CalculateMean( float& meanOut, float& standardDeviationOut ) const
 {
-  if( mSamples.Size() > 0 )
+  if( mSnapshotRunCount > 0 )
   {
     // Mean
-    unsigned int sum = 0;
-    for( Samples::ConstIterator it = mSamples.Begin(), itEnd = mSamples.End(); it != itEnd; ++it )
-    {
-      unsigned int value = *it;
-
-      sum += value;
-    }
-
-    meanOut = static_cast<float>(sum) / mSamples.Size();
+    const double mean = static_cast<double>( mSnapshotSum ) / mSnapshotRunCount;
 
-    // Variance
-    float variance = 0.0f;
-    for( Samples::ConstIterator it = mSamples.Begin(), itEnd = mSamples.End(); it != itEnd; ++it )
+    // Variance, E[x^2] - E[x]^2
+    double variance = static_cast<double>( mSnapshotSumOfSquares ) / mSnapshotRunCount - mean * mean;
+    if( variance < 0.0 )
     {
-      unsigned int value = *it;
-
-      float difference = static_cast<float>(value) - meanOut;
-
-      variance += difference * difference;
+      variance = 0.0; // rounding error
     }
 
-    variance /= mSamples.Size();
-
-    // Standard deviation
-    standardDeviationOut = sqrtf( variance );
-
-    meanOut *= ONE_OVER_MICROSECONDS_TO_SECONDS;
-    standardDeviationOut *= ONE_OVER_MICROSECONDS_TO_SECONDS;
+    meanOut = static_cast<float>( mean ) * ONE_OVER_MICROSECONDS_TO_SECONDS;
+    standardDeviationOut = static_cast<float>( std::sqrt( variance ) ) * ONE_OVER_MICROSECONDS_TO_SECONDS;
   }
   else
   {
@@ -170,6 +169,19 @@ void FrameTimeStats::CalculateMean( float& meanOut, float& standardDeviationOut
   }
 }
 
+float FrameTimeStats::GetPercentile( float percentile ) const
+{
+  unsigned int microseconds = mSnapshot.GetPercentile( percentile );
+
+  // The bucket may go over the maximum recorded time
+  if( microseconds > mSnapshotMax )
+  {
+    microseconds = mSnapshotMax;
+  }
+
+  return microseconds * ONE_OVER_MICROSECONDS_TO_SECONDS;
+}
+
 
 } // namespace Adaptor
 
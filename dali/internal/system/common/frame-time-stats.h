@@ -18,9 +18,13 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <stdint.h>
+
 // INTERNAL INCLUDES
+#include <dali/internal/system/common/frame-time-histogram.h>
 #include <dali/internal/system/common/frame-time-stamp.h>
-#include <dali/public-api/common/dali-vector.h>
 
 
 namespace Dali
@@ -34,8 +38,11 @@ namespace Adaptor
 
 /**
  * Used to get statistics about time stamps over a period of time.
- * E.g. the min, max, total and average time spent inside two markers,
+ * E.g. the min, max, total, average and percentiles of the time spent inside two markers,
  * such as UPDATE_START and UPDATE_END
+ *
+ * The times are recorded lock-free and use constant memory. The thread recording the times
+ * doesn't block while another one takes a snapshot of the statistics.
  */
 struct FrameTimeStats
 {
@@ -62,9 +69,10 @@ struct FrameTimeStats
    void EndTime( const FrameTimeStamp& timeStamp );
 
    /**
-    * Reset all internal counters / state except total time.
+    * Moves the times recorded since the last snapshot to the snapshot read by the getters.
+    * Only the total time is kept from one snapshot to the next.
     */
-   void Reset();
+   void TakeSnapshot();
 
    /**
     * @return maximum time in seconds
@@ -94,8 +102,21 @@ struct FrameTimeStats
     */
    void CalculateMean( float& meanOut, float& standardDeviationOut ) const;
 
+   /**
+    * Get the time under which the given percentage of the times are
+    *
+    * @param[in] percentile The percentage, between 0 and 100
+    * @return the percentile in seconds
+    */
+   float GetPercentile( float percentile ) const;
+
 private:
 
+   /**
+    * Reset the timer state.
+    */
+   void ResetTimer();
+
    /**
     * internal time state.
     */
@@ -105,17 +126,26 @@ private:
      WAITING_FOR_END_TIME       ///< waiting for end time marker
    };
 
-   typedef Dali::Vector< unsigned int > Samples;
-   Samples mSamples;
+   // Recorded since the last snapshot.
+   FrameTimeHistogram mHistogram;               ///< histogram of the times in microseconds
+   std::atomic<uint64_t> mSum;                  ///< sum of the times in microseconds
+   std::atomic<uint64_t> mSumOfSquares;         ///< sum of the squares of the times, to calculate the standard deviation
+   std::atomic<unsigned int> mMin;              ///< current minimum value in microseconds
+   std::atomic<unsigned int> mMax;              ///< current maximum value in microseconds
+   std::atomic<unsigned int> mRunCount;         ///< how many times the timer has been start / stopped
+   std::atomic<uint64_t> mTotal;                ///< total since the creation in microseconds
+
+   // The last snapshot.
+   FrameTimeHistogram::Snapshot mSnapshot;      ///< histogram of the snapshot
+   uint64_t mSnapshotSum;                       ///< sum of the snapshot in microseconds
+   uint64_t mSnapshotSumOfSquares;              ///< sum of the squares of the snapshot
+   uint64_t mSnapshotTotal;                     ///< total at the time of the snapshot in microseconds
+   unsigned int mSnapshotMin;                   ///< minimum value of the snapshot in microseconds
+   unsigned int mSnapshotMax;                   ///< maximum value of the snapshot in microseconds
+   unsigned int mSnapshotRunCount;              ///< run count of the snapshot
 
-   unsigned int mMin;                  ///< current minimum value in microseconds
-   unsigned int mMax;                  ///< current maximum value in microseconds
-   unsigned int mTotal;                ///< current total in in microseconds
-   unsigned int mRunCount;      ///< how many times the timer has been start / stopped
    FrameTimeStamp mStart;       ///< start time stamp, to calculate the diff
-   TimeState mTimeState:1;      ///< time state
-   bool mMinMaxTimeSet:1;       ///< whether the min-max values have been configured
-
+   TimeState mTimeState;        ///< time state
 };
 
 } // namespace Adaptor
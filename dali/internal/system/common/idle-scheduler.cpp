@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/idle-scheduler.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/callback-manager.h>
+#include <dali/internal/system/common/time-service.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Integration::Log::Filter* gLogFilter = Integration::Log::Filter::New( Debug::NoLogging, false, "LOG_IDLE_SCHEDULER" );
+#endif
+
+const unsigned int REPORT_INTERVAL = 600u;           ///< The number of time slices between reports.
+const double NANOSECONDS_TO_MILLISECONDS = 0.000001;
+
+} // unnamed namespace
+
+IdleScheduler::IdleScheduler( CallbackManager& callbackManager, uint64_t timeSlice )
+: mCallbackManager( callbackManager ),
+  mIdleCallback( NULL ),
+  mRunningCallback( NULL ),
+  mTimeSlice( timeSlice ),
+  mTotalLatency( 0u ),
+  mMaximumLatency( 0u ),
+  mQueueDepth( 0u ),
+  mMaximumQueueDepth( 0u ),
+  mCallbackCount( 0u ),
+  mSliceCount( 0u ),
+  mYieldCount( 0u ),
+  mRunningCallbackRemoved( false ),
+  mYield( false )
+{
+}
+
+IdleScheduler::~IdleScheduler()
+{
+  Clear();
+
+  if( 0u != mSliceCount )
+  {
+    OutputReport();
+  }
+}
+
+bool IdleScheduler::AddIdle( CallbackBase* callback, bool hasReturnValue, Priority priority )
+{
+  if( !InstallIdle() )
+  {
+    return false;
+  }
+
+  uint64_t addTime = 0u;
+  TimeService::GetNanoseconds( addTime );
+
+  mTasks[priority].push_back( Task{ callback, addTime, hasReturnValue } );
+
+  ++mQueueDepth;
+  if( mQueueDepth > mMaximumQueueDepth )
+  {
+    mMaximumQueueDepth = mQueueDepth;
+  }
+
+  return true;
+}
+
+void IdleScheduler::RemoveIdle( CallbackBase* callback )
+{
+  if( callback == mRunningCallback )
+  {
+    // Deleted once it returns.
+    mRunningCallbackRemoved = true;
+    return;
+  }
+
+  for( auto& tasks : mTasks )
+  {
+    for( auto iter = tasks.begin(), endIter = tasks.end(); iter != endIter; ++iter )
+    {
+      if( iter->callback == callback )
+      {
+        delete callback;
+        tasks.erase( iter );
+        --mQueueDepth;
+        return;
+      }
+    }
+  }
+}
+
+bool IdleScheduler::Process()
+{
+  uint64_t startTime = 0u;
+  TimeService::GetNanoseconds( startTime );
+
+  mYield = false;
+  ++mSliceCount;
+
+  unsigned int callbacks = 0u;
+  uint64_t currentTime = startTime;
+  while( 0u != mQueueDepth )
+  {
+    unsigned int priority = 0u;
+    while( mTasks[priority].empty() )
+    {
+      ++priority;
+    }
+
+    Task task = mTasks[priority].front();
+    mTasks[priority].pop_front();
+    --mQueueDepth;
+
+    if( 0u != task.addTime )
+    {
+      const uint64_t latency = currentTime - task.addTime;
+      mTotalLatency += latency;
+      if( latency > mMaximumLatency )
+      {
+        mMaximumLatency = latency;
+      }
+      ++mCallbackCount;
+      task.addTime = 0u;
+    }
+
+    mRunningCallback = task.callback;
+    mRunningCallbackRemoved = false;
+
+    bool callAgain = false;
+    if( task.hasReturnValue )
+    {
+      callAgain = CallbackBase::ExecuteReturn< bool >( *task.callback );
+    }
+    else
+    {
+      CallbackBase::Execute( *task.callback );
+    }
+
+    mRunningCallback = NULL;
+    ++callbacks;
+
+    if( callAgain && !mRunningCallbackRemoved )
+    {
+      // After the other callbacks of the same priority.
+      mTasks[priority].push_back( task );
+      ++mQueueDepth;
+    }
+    else
+    {
+      delete task.callback;
+    }
+
+    if( mYield )
+    {
+      ++mYieldCount;
+      break;
+    }
+
+    TimeService::GetNanoseconds( currentTime );
+    if( currentTime - startTime >= mTimeSlice )
+    {
+      break;
+    }
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "IdleScheduler::Process. callbacks : %u, remaining : %u, time : %.3fms%s\n",
+                 callbacks, mQueueDepth, ( currentTime - startTime ) * NANOSECONDS_TO_MILLISECONDS, mYield ? ", yield" : "" );
+
+  if( mSliceCount >= REPORT_INTERVAL )
+  {
+    OutputReport();
+  }
+
+  return 0u != callbacks;
+}
+
+void IdleScheduler::Yield()
+{
+  mYield = true;
+}
+
+void IdleScheduler::SetTimeSlice( uint64_t timeSlice )
+{
+  mTimeSlice = timeSlice;
+}
+
+void IdleScheduler::Clear()
+{
+  for( auto& tasks : mTasks )
+  {
+    for( auto& task : tasks )
+    {
+      delete task.callback;
+    }
+    tasks.clear();
+  }
+  mQueueDepth = 0u;
+
+  if( mRunningCallback )
+  {
+    mRunningCallbackRemoved = true;
+  }
+
+  if( mIdleCallback )
+  {
+    mCallbackManager.RemoveIdleCallback( mIdleCallback );
+    mIdleCallback = NULL;
+  }
+}
+
+bool IdleScheduler::InstallIdle()
+{
+  if( !mIdleCallback )
+  {
+    CallbackBase* callback = MakeCallback( this, &IdleScheduler::OnIdle );
+    if( mCallbackManager.AddIdleCallback( callback, false ) )
+    {
+      mIdleCallback = callback;
+    }
+    else
+    {
+      delete callback;
+    }
+  }
+
+  return NULL != mIdleCallback;
+}
+
+void IdleScheduler::OnIdle()
+{
+  // The callback manager deletes the idle callback once it returns, so it's installed again for the remaining callbacks.
+  // It's installed after the other idle callbacks of the main loop, which run in between.
+  mIdleCallback = NULL;
+
+  Process();
+
+  if( 0u != mQueueDepth )
+  {
+    InstallIdle();
+  }
+}
+
+void IdleScheduler::OutputReport()
+{
+  DALI_LOG_INFO( gLogFilter, Debug::General, "IdleScheduler: slices %u, yields %u, callbacks %u, queue depth %u, maximum queue depth %u, mean latency %.3fms, maximum latency %.3fms\n",
+                 mSliceCount, mYieldCount, mCallbackCount, mQueueDepth, mMaximumQueueDepth,
+                 ( 0u != mCallbackCount ) ? mTotalLatency * NANOSECONDS_TO_MILLISECONDS / mCallbackCount : 0.0,
+                 mMaximumLatency * NANOSECONDS_TO_MILLISECONDS );
+
+  mTotalLatency = 0u;
+  mMaximumLatency = 0u;
+  mMaximumQueueDepth = mQueueDepth;
+  mCallbackCount = 0u;
+  mSliceCount = 0u;
+  mYieldCount = 0u;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,172 @@
+#ifndef DALI_INTERNAL_IDLE_SCHEDULER_H
+#define DALI_INTERNAL_IDLE_SCHEDULER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <deque>
+#include <stdint.h>
+#include <dali/public-api/signals/callback.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class CallbackManager;
+
+/**
+ * Runs the idle callbacks of the adaptor from a single idle callback of the main loop.
+ *
+ * The callbacks are queued by priority, in the order they are added. Each time the main loop is idle
+ * the scheduler runs them for a time slice, so the main loop keeps processing the other events while
+ * there are many idle callbacks. The callbacks returning true are queued again after the others of
+ * their priority.
+ *
+ * The slice also ends when a render is requested, so the events are processed and the frame
+ * starts without waiting for the remaining callbacks.
+ *
+ * Only used by the event thread.
+ */
+class IdleScheduler
+{
+public:
+
+  /**
+   * The priorities of the idle callbacks. The callbacks of a higher priority run first.
+   */
+  enum Priority
+  {
+    HIGH,           ///< e.g. quitting the main loop
+    NORMAL,         ///< The callbacks added by the application.
+    LOW,            ///< e.g. clean-ups
+    NUMBER_OF_PRIORITIES
+  };
+
+  /**
+   * Constructor
+   * @param[in] callbackManager The callback manager used to install the idle callback of the scheduler.
+   * @param[in] timeSlice The time the callbacks run for each time the main loop is idle, in nanoseconds.
+   */
+  IdleScheduler( CallbackManager& callbackManager, uint64_t timeSlice );
+
+  /**
+   * Destructor. Deletes the callbacks which didn't run.
+   */
+  ~IdleScheduler();
+
+  /**
+   * Adds a callback to run on idle.
+   * @param[in] callback The callback. The ownership is taken if it's added.
+   * @param[in] hasReturnValue Whether the callback returns whether it has to be called again.
+   * @param[in] priority The priority of the callback.
+   * @return Whether the callback is added, false if the callback manager is not running.
+   */
+  bool AddIdle( CallbackBase* callback, bool hasReturnValue, Priority priority );
+
+  /**
+   * Removes and deletes a callback. Does nothing if the callback has run or has not been added.
+   * @param[in] callback The callback.
+   */
+  void RemoveIdle( CallbackBase* callback );
+
+  /**
+   * Runs the callbacks for a time slice.
+   * @return Whether a callback has run.
+   */
+  bool Process();
+
+  /**
+   * Ends the current time slice after the running callback, e.g. when a render is requested.
+   */
+  void Yield();
+
+  /**
+   * Sets the time the callbacks run for each time the main loop is idle, e.g. when the render refresh rate changes.
+   * @param[in] timeSlice The time slice in nanoseconds.
+   */
+  void SetTimeSlice( uint64_t timeSlice );
+
+  /**
+   * Deletes all the callbacks and removes the idle callback of the scheduler.
+   */
+  void Clear();
+
+private:
+
+  /**
+   * A queued callback.
+   */
+  struct Task
+  {
+    CallbackBase* callback;
+    uint64_t addTime;       ///< The time the callback was added, in nanoseconds. Zero once it has run.
+    bool hasReturnValue;
+  };
+
+  /**
+   * Installs the idle callback of the scheduler in the main loop if it's not installed.
+   * @return Whether the idle callback is installed.
+   */
+  bool InstallIdle();
+
+  /**
+   * The idle callback of the scheduler. Runs a time slice and installs itself again if callbacks remain.
+   */
+  void OnIdle();
+
+  /**
+   * Output the queue depth and the latencies of the callbacks.
+   */
+  void OutputReport();
+
+  // Undefined copy constructor.
+  IdleScheduler( const IdleScheduler& );
+
+  // Undefined assignment operator.
+  IdleScheduler& operator=( const IdleScheduler& );
+
+private:
+
+  CallbackManager& mCallbackManager;
+  std::deque<Task> mTasks[NUMBER_OF_PRIORITIES]; ///< The queued callbacks of each priority, the next one to run first.
+  CallbackBase* mIdleCallback;                    ///< The idle callback of the scheduler if it's installed. Owned by the callback manager.
+  CallbackBase* mRunningCallback;                 ///< The callback running, if any.
+  uint64_t mTimeSlice;                            ///< The time the callbacks run for each time the main loop is idle, in nanoseconds.
+  uint64_t mTotalLatency;                         ///< The sum of the times from the callbacks being added to them running, in nanoseconds.
+  uint64_t mMaximumLatency;                       ///< The longest time from a callback being added to it running, in nanoseconds.
+  unsigned int mQueueDepth;                       ///< The number of queued callbacks.
+  unsigned int mMaximumQueueDepth;                ///< The maximum number of queued callbacks since the last report.
+  unsigned int mCallbackCount;                    ///< The number of callbacks run for the first time since the last report.
+  unsigned int mSliceCount;                       ///< The number of time slices since the last report.
+  unsigned int mYieldCount;                       ///< The number of time slices ended by a render request since the last report.
+  bool mRunningCallbackRemoved;                   ///< Whether the running callback has been removed by itself.
+  bool mYield;                                    ///< Whether the current time slice has to end.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_IDLE_SCHEDULER_H
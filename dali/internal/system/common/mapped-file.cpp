@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/mapped-file.h>
+
+// EXTERNAL INCLUDES
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+namespace
+{
+const size_t READ_SIZE = 64u * 1024u;          ///< The step the buffer grows by when a file isn't mapped
+const off_t MAPPING_THRESHOLD = 64u * 1024u;   ///< The smaller files are read, as a mapping and its page faults cost more than the copy
+
+/**
+ * Reads a file until its end.
+ * @return Whether the file has been read
+ */
+bool ReadAll( int fileDescriptor, Dali::Vector<uint8_t>& buffer )
+{
+  size_t size = 0u;
+  for( ;; )
+  {
+    buffer.ResizeUninitialized( size + READ_SIZE );
+    const ssize_t result = read( fileDescriptor, buffer.Begin() + size, READ_SIZE );
+    if( result > 0 )
+    {
+      size += static_cast<size_t>( result );
+    }
+    else if( result == 0 )
+    {
+      buffer.ResizeUninitialized( size );
+      return true;
+    }
+    else if( errno != EINTR )
+    {
+      return false;
+    }
+  }
+}
+
+} // unnamed namespace
+
+MappedFilePtr MappedFile::New( const std::string& filename )
+{
+  const int fileDescriptor = open( filename.c_str(), O_RDONLY | O_CLOEXEC );
+  if( fileDescriptor < 0 )
+  {
+    DALI_LOG_ERROR( "file open failed for: \"%s\"\n", filename.c_str() );
+    return MappedFilePtr();
+  }
+
+  MappedFilePtr mappedFile( new MappedFile() );
+
+  struct stat status;
+  if( fstat( fileDescriptor, &status ) == 0 && S_ISREG( status.st_mode ) && status.st_size >= MAPPING_THRESHOLD )
+  {
+    void* mapping = mmap( NULL, status.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+
+// MAP_FAILED is a macro with C cast
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+    if( mapping != MAP_FAILED )
+#pragma GCC diagnostic pop
+    {
+      // The content is usually parsed straight away, so the pages are read ahead rather than faulted one by one
+      madvise( mapping, status.st_size, MADV_WILLNEED );
+
+      mappedFile->mMapping = mapping;
+      mappedFile->mData = static_cast<const uint8_t*>( mapping );
+      mappedFile->mSize = static_cast<size_t>( status.st_size );
+    }
+  }
+
+  if( !mappedFile->mMapping )
+  {
+    // Not a regular file, small, or on a file system which can't be mapped
+    if( !ReadAll( fileDescriptor, mappedFile->mBuffer ) )
+    {
+      DALI_LOG_ERROR( "file read failed for: \"%s\"\n", filename.c_str() );
+      mappedFile.Reset();
+    }
+    else if( mappedFile->mBuffer.Count() > 0u )
+    {
+      mappedFile->mData = mappedFile->mBuffer.Begin();
+      mappedFile->mSize = mappedFile->mBuffer.Count();
+    }
+  }
+
+  close( fileDescriptor );
+  return mappedFile;
+}
+
+MappedFilePtr MappedFile::New( Dali::Vector<uint8_t>& buffer )
+{
+  MappedFilePtr mappedFile( new MappedFile() );
+  mappedFile->mBuffer.Swap( buffer );
+  if( mappedFile->mBuffer.Count() > 0u )
+  {
+    mappedFile->mData = mappedFile->mBuffer.Begin();
+    mappedFile->mSize = mappedFile->mBuffer.Count();
+  }
+  return mappedFile;
+}
+
+MappedFile::MappedFile()
+: mData( NULL ),
+  mSize( 0u ),
+  mMapping( NULL ),
+  mBuffer()
+{
+}
+
+MappedFile::~MappedFile()
+{
+  if( mMapping )
+  {
+    munmap( mMapping, mSize );
+  }
+}
+
+} // namespace Adaptor
+} // namespace Internal
+} // namespace Dali
@@ -0,0 +1,131 @@
+#ifndef DALI_INTERNAL_ADAPTOR_MAPPED_FILE_H
+#define DALI_INTERNAL_ADAPTOR_MAPPED_FILE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/object/base-object.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/mapped-file.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+class MappedFile;
+typedef IntrusivePtr<MappedFile> MappedFilePtr;
+
+/**
+ * The content of a file mapped read-only in memory, or read into a buffer where the file is small or can't be mapped.
+ * It's unmapped when the last reference is released.
+ */
+class MappedFile : public BaseObject
+{
+public:
+
+  /**
+   * Maps a file.
+   * @param[in] filename The path of the file
+   * @return The mapped file, or NULL if the file can't be opened
+   */
+  static MappedFilePtr New( const std::string& filename );
+
+  /**
+   * Wraps a buffer holding the content of a file, for the files which can't be mapped.
+   * @param[in,out] buffer The content, which is taken: the buffer is empty on return
+   * @return The mapped file
+   */
+  static MappedFilePtr New( Dali::Vector<uint8_t>& buffer );
+
+  /**
+   * @return The content, or NULL if it's empty
+   */
+  const uint8_t* GetData() const
+  {
+    return mData;
+  }
+
+  /**
+   * @return The size of the content
+   */
+  size_t GetSize() const
+  {
+    return mSize;
+  }
+
+private:
+
+  /**
+   * Constructor
+   */
+  MappedFile();
+
+  /**
+   * Destructor. Unmaps the file.
+   */
+  ~MappedFile() override;
+
+  // Undefined copy constructor.
+  MappedFile( const MappedFile& );
+
+  // Undefined assignment operator.
+  MappedFile& operator=( const MappedFile& );
+
+private:
+
+  const uint8_t* mData;              ///< The mapping or the buffer
+  size_t mSize;
+  void* mMapping;                    ///< NULL if the content is in the buffer
+  Dali::Vector<uint8_t> mBuffer;     ///< The content of the files which can't be mapped
+};
+
+} // namespace Adaptor
+} // namespace Internal
+
+// Helpers for public-api forwarding methods
+
+inline Internal::Adaptor::MappedFile& GetImplementation( Dali::MappedFile& handle )
+{
+  DALI_ASSERT_ALWAYS( handle && "MappedFile handle is empty" );
+
+  BaseObject& object = handle.GetBaseObject();
+
+  return static_cast<Internal::Adaptor::MappedFile&>( object );
+}
+
+inline const Internal::Adaptor::MappedFile& GetImplementation( const Dali::MappedFile& handle )
+{
+  DALI_ASSERT_ALWAYS( handle && "MappedFile handle is empty" );
+
+  const BaseObject& object = handle.GetBaseObject();
+
+  return static_cast<const Internal::Adaptor::MappedFile&>( object );
+}
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_MAPPED_FILE_H
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/performance-marker-buffer.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+PerformanceMarkerBuffer::PerformanceMarkerBuffer()
+: mHead( 0u ),
+  mTail( 0u ),
+  mDropped( 0u ),
+  mProducerExited( false )
+{
+}
+
+PerformanceMarkerBuffer::~PerformanceMarkerBuffer()
+{
+}
+
+bool PerformanceMarkerBuffer::Push( const Entry& entry )
+{
+  // The counters wrap around, the capacity being a power of two keeps the index and the size consistent.
+  const unsigned int head = mHead.load( std::memory_order_relaxed );
+  if( head - mTail.load( std::memory_order_acquire ) >= CAPACITY )
+  {
+    mDropped.fetch_add( 1u, std::memory_order_relaxed );
+    return false;
+  }
+
+  mEntries[head & ( CAPACITY - 1u )] = entry;
+
+  // Publish the entry to the consumer.
+  mHead.store( head + 1u, std::memory_order_release );
+  return true;
+}
+
+bool PerformanceMarkerBuffer::Pop( Entry& entry )
+{
+  const unsigned int tail = mTail.load( std::memory_order_relaxed );
+  if( tail == mHead.load( std::memory_order_acquire ) )
+  {
+    return false;
+  }
+
+  entry = mEntries[tail & ( CAPACITY - 1u )];
+
+  // Give the slot back to the producer.
+  mTail.store( tail + 1u, std::memory_order_release );
+  return true;
+}
+
+unsigned int PerformanceMarkerBuffer::GetSize() const
+{
+  return mHead.load( std::memory_order_acquire ) - mTail.load( std::memory_order_acquire );
+}
+
+unsigned int PerformanceMarkerBuffer::TakeDroppedCount()
+{
+  return mDropped.exchange( 0u, std::memory_order_relaxed );
+}
+
+void PerformanceMarkerBuffer::SetProducerExited()
+{
+  // Publishes the last markers pushed too.
+  mProducerExited.store( true, std::memory_order_release );
+}
+
+bool PerformanceMarkerBuffer::HasProducerExited() const
+{
+  return mProducerExited.load( std::memory_order_acquire );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
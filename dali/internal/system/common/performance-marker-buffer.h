@@ -0,0 +1,134 @@
+#ifndef DALI_INTERNAL_ADAPTOR_PERFORMANCE_MARKER_BUFFER_H
+#define DALI_INTERNAL_ADAPTOR_PERFORMANCE_MARKER_BUFFER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <stdint.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/performance-interface.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * A fixed size ring buffer of performance markers with a single producer and a single consumer.
+ *
+ * Each thread adding markers writes to its own buffer, so pushing a marker is lock-free and only
+ * costs a few stores. The markers are read back by the thread draining the buffers.
+ * When the buffer is full the new markers are dropped and counted.
+ */
+class PerformanceMarkerBuffer
+{
+public:
+
+  /**
+   * A marker added to the buffer.
+   */
+  struct Entry
+  {
+    uint64_t microseconds;                      ///< The time the marker was added.
+    PerformanceInterface::MarkerType type;      ///< The marker type.
+    unsigned int threadId;                      ///< The thread that added the marker.
+    PerformanceInterface::ContextId contextId;  ///< The custom context of the marker. Only valid if custom is set.
+    bool custom;                                ///< Whether it's a custom marker.
+  };
+
+  static const unsigned int CAPACITY = 1024u;  ///< The number of markers the buffer holds. A power of two.
+  static const unsigned int DRAIN_THRESHOLD = CAPACITY / 4u; ///< The number of markers over which the buffer has to be drained.
+
+  /**
+   * Constructor
+   */
+  PerformanceMarkerBuffer();
+
+  /**
+   * Destructor, not intended as a base class
+   */
+  ~PerformanceMarkerBuffer();
+
+  /**
+   * Adds a marker. Only called by the producer thread.
+   * @param[in] entry The marker.
+   * @return Whether the marker was added. False if the buffer is full.
+   */
+  bool Push( const Entry& entry );
+
+  /**
+   * Removes the oldest marker. Only called by the consumer thread.
+   * @param[out] entry The marker.
+   * @return Whether a marker was removed. False if the buffer is empty.
+   */
+  bool Pop( Entry& entry );
+
+  /**
+   * Retrieves the number of markers in the buffer. Only called by the producer or the consumer thread.
+   * The other thread may push or pop markers meanwhile.
+   * @return The number of markers.
+   */
+  unsigned int GetSize() const;
+
+  /**
+   * Retrieves the number of markers dropped since the last call and resets it.
+   * @return The number of markers dropped.
+   */
+  unsigned int TakeDroppedCount();
+
+  /**
+   * Called by the producer thread when it exits, or stops adding markers to this buffer. No marker is pushed after.
+   */
+  void SetProducerExited();
+
+  /**
+   * Checks whether the producer thread has exited. The markers it pushed before are visible once this returns true.
+   * @return Whether the producer thread has exited.
+   */
+  bool HasProducerExited() const;
+
+private:
+
+  // Undefined copy constructor.
+  PerformanceMarkerBuffer( const PerformanceMarkerBuffer& );
+
+  // Undefined assignment operator.
+  PerformanceMarkerBuffer& operator=( const PerformanceMarkerBuffer& );
+
+private:
+
+  Entry mEntries[CAPACITY];           ///< The markers.
+  std::atomic<unsigned int> mHead;    ///< The number of markers pushed. Only written by the producer.
+  std::atomic<unsigned int> mTail;    ///< The number of markers popped. Only written by the consumer.
+  std::atomic<unsigned int> mDropped; ///< The number of markers dropped since the last call to TakeDroppedCount().
+  std::atomic<bool> mProducerExited;  ///< Whether the producer thread has exited.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_PERFORMANCE_MARKER_BUFFER_H
@@ -19,6 +19,12 @@
 #include <dali/internal/system/common/performance-server.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <chrono>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <dali/integration-api/debug.h>
 #include <dali/integration-api/platform-abstraction.h>
 
 // INTERNAL INCLUDES
@@ -38,6 +44,36 @@ namespace
 {
 const unsigned int NANOSECONDS_PER_MICROSECOND = 1000u;
 const float        MICROSECONDS_TO_SECOND = 1e-6;
+const std::chrono::seconds MAXIMUM_DRAIN_INTERVAL( 1 ); ///< the longest a marker waits in a buffer which isn't filled past its threshold
+const unsigned int BYTES_PER_KILOBYTE = 1024u;
+const size_t THREAD_NAME_SIZE = 16u; ///< the maximum length of a thread name including the terminating null
+
+/**
+ * The marker buffer of a thread. Marks the buffer as exited when the thread exits, so the server frees it once drained.
+ */
+struct ThreadBuffer
+{
+  ~ThreadBuffer()
+  {
+    if( buffer )
+    {
+      buffer->SetProducerExited();
+    }
+  }
+
+  std::shared_ptr<PerformanceMarkerBuffer> buffer; ///< the buffer, shared with the server
+  unsigned int serverId = 0u;                      ///< the server the buffer belongs to
+};
+
+std::atomic<unsigned int> gNextServerId( 1u );              ///< a server created after another one doesn't reuse its buffers
+thread_local ThreadBuffer gThreadBuffer;                    ///< the buffer of this thread
+thread_local unsigned int gThreadId = 0u;                   ///< the id of this thread, as shown by the system tools
+
+bool EarlierMarker( const PerformanceMarkerBuffer::Entry& lhs, const PerformanceMarkerBuffer::Entry& rhs )
+{
+  return lhs.microseconds < rhs.microseconds;
+}
+
 } // unnamed namespace
 
 PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
@@ -46,6 +82,8 @@ PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
   mKernelTrace( adaptorServices.GetKernelTraceInterface() ),
   mSystemTrace( adaptorServices.GetSystemTraceInterface() ),
   mLogMutex(),
+  mStatisticsFile( NULL ),
+  mTraceWriter(),
 #if defined(NETWORK_LOGGING_ENABLED)
   mNetworkServer( adaptorServices, environmentOptions ),
   mNetworkControlEnabled( mEnvironmentOptions.GetNetworkControlMode()),
@@ -53,9 +91,36 @@ PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
   mStatContextManager( *this ),
   mStatisticsLogBitmask( 0 ),
   mPerformanceOutputBitmask( 0 ),
-  mLoggingEnabled( false ),
-  mLogFunctionInstalled( false )
+  mBuffers(),
+  mDrained(),
+  mNewThreads(),
+  mBufferMutex(),
+  mDrainThread(),
+  mId( gNextServerId.fetch_add( 1u, std::memory_order_relaxed ) ),
+  mDroppedMarkers( 0u ),
+  mDrainMutex(),
+  mDrainCondition(),
+  mDrainRequested( false ),
+  mMarkersEnabled( false ),
+  mStopDrainThread( false ),
+  mLoggingEnabled( false )
 {
+  const std::string& statisticsFile = mEnvironmentOptions.GetPerformanceStatsLoggingFile();
+  if( !statisticsFile.empty() )
+  {
+    mStatisticsFile = fopen( statisticsFile.c_str(), "w" );
+    if( !mStatisticsFile )
+    {
+      DALI_LOG_ERROR( "Failed to open the performance statistics file %s\n", statisticsFile.c_str() );
+    }
+  }
+
+  const std::string& traceFile = mEnvironmentOptions.GetPerformanceTraceFile();
+  if( !traceFile.empty() )
+  {
+    mTraceWriter.reset( new TraceEventWriter( traceFile, mEnvironmentOptions.GetPerformanceTraceFileSize() * BYTES_PER_KILOBYTE ) );
+  }
+
   SetLogging( mEnvironmentOptions.GetPerformanceStatsLoggingOptions(),
               mEnvironmentOptions.GetPerformanceTimeStampOutput(),
               mEnvironmentOptions.GetPerformanceStatsLoggingFrequency());
@@ -64,13 +129,26 @@ PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
   if( mNetworkControlEnabled )
   {
     mLoggingEnabled  = true;
+    mMarkersEnabled = true;
     mNetworkServer.Start();
   }
 #endif
+
+  mDrainThread = std::thread( &PerformanceServer::DrainThread, this );
 }
 
 PerformanceServer::~PerformanceServer()
 {
+  {
+    std::lock_guard<std::mutex> lock( mDrainMutex );
+    mStopDrainThread = true;
+  }
+  mDrainCondition.notify_one();
+  mDrainThread.join();
+
+  // the buffers of the threads still running are freed when they exit
+  mBuffers.clear();
+
 #if defined(NETWORK_LOGGING_ENABLED)
   if( mNetworkControlEnabled )
   {
@@ -78,9 +156,9 @@ PerformanceServer::~PerformanceServer()
   }
 #endif
 
-  if( mLogFunctionInstalled )
+  if( mStatisticsFile )
   {
-    mEnvironmentOptions.UnInstallLogFunction();
+    fclose( mStatisticsFile );
   }
 }
 
@@ -93,7 +171,7 @@ void PerformanceServer::SetLogging( unsigned int statisticsLogOptions,
 
   mStatContextManager.SetLoggingLevel( mStatisticsLogBitmask, logFrequency);
 
-  if( ( mStatisticsLogBitmask == 0) && ( mPerformanceOutputBitmask == 0 ))
+  if( ( mStatisticsLogBitmask == 0) && ( mPerformanceOutputBitmask == 0 ) && !mTraceWriter )
   {
     mLoggingEnabled = false;
   }
@@ -101,6 +179,15 @@ void PerformanceServer::SetLogging( unsigned int statisticsLogOptions,
   {
     mLoggingEnabled = true;
   }
+
+  {
+    std::lock_guard<std::mutex> lock( mDrainMutex );
+    mMarkersEnabled = mLoggingEnabled;
+
+    // drains the markers added before they were disabled
+    mDrainRequested = mDrainRequested || !mMarkersEnabled;
+  }
+  mDrainCondition.notify_one();
 }
 
 void PerformanceServer::SetLoggingFrequency( unsigned int logFrequency, ContextId contextId )
@@ -133,58 +220,196 @@ void PerformanceServer::AddMarker( MarkerType markerType, ContextId contextId )
     return;
   }
 
+  PushMarker( markerType, contextId, true );
+}
+
+void PerformanceServer::AddMarker( MarkerType markerType )
+{
+  // called only for internal markers
+
+  if( !mLoggingEnabled )
+  {
+    return;
+  }
+
+  PushMarker( markerType, 0u, false );
+}
+
+void PerformanceServer::PushMarker( MarkerType markerType, ContextId contextId, bool custom )
+{
   // Get the time stamp
   uint64_t timeStamp = 0;
   TimeService::GetNanoseconds( timeStamp );
   timeStamp /= NANOSECONDS_PER_MICROSECOND; // Convert to microseconds
 
-  // Create a marker
-  PerformanceMarker marker( markerType, FrameTimeStamp( 0, timeStamp ) );
+  PerformanceMarkerBuffer::Entry entry;
+  entry.microseconds = timeStamp;
+  entry.type = markerType;
+  entry.contextId = contextId;
+  entry.custom = custom;
 
-  // get the marker description for this context, e.g SIZE_NEGOTIATION_START
-  const char* const description = mStatContextManager.GetMarkerDescription( markerType, contextId );
+  // the thread id is known once the buffer of the thread is created
+  PerformanceMarkerBuffer& buffer = GetThreadBuffer();
+  entry.threadId = gThreadId;
 
-  // log it
-  LogMarker( marker, description );
+  // dropped markers are counted by the buffer and reported by the drain thread
+  if( buffer.Push( entry ) && ( buffer.GetSize() == PerformanceMarkerBuffer::DRAIN_THRESHOLD ) )
+  {
+    // only once per fill, as the size grows one marker at a time
+    RequestDrain();
+  }
 
-  // Add custom marker to statistics context manager
-  mStatContextManager.AddCustomMarker( marker, contextId );
+  if( mPerformanceOutputBitmask & ( OUTPUT_KERNEL_TRACE | OUTPUT_SYSTEM_TRACE ) )
+  {
+    PerformanceMarker marker( markerType, FrameTimeStamp( 0, timeStamp ) );
+
+    // get the marker description for this context, e.g SIZE_NEGOTIATION_START
+    const std::string description = custom ? mStatContextManager.GetMarkerDescription( markerType, contextId ) : std::string( marker.GetName() );
+
+    TraceMarker( marker, description.c_str() );
+  }
 }
 
-void PerformanceServer::AddMarker( MarkerType markerType )
+void PerformanceServer::RequestDrain()
 {
-  // called only for internal markers
+  {
+    std::lock_guard<std::mutex> lock( mDrainMutex );
+    mDrainRequested = true;
+  }
+  mDrainCondition.notify_one();
+}
 
-  if( !mLoggingEnabled )
+PerformanceMarkerBuffer& PerformanceServer::GetThreadBuffer()
+{
+  if( gThreadBuffer.serverId != mId )
   {
-    return;
+    // first marker added by this thread
+    char name[THREAD_NAME_SIZE] = { 0 };
+    pthread_getname_np( pthread_self(), name, THREAD_NAME_SIZE );
+
+    if( gThreadBuffer.buffer )
+    {
+      // the buffer of a previous server is no longer used
+      gThreadBuffer.buffer->SetProducerExited();
+    }
+
+    Mutex::ScopedLock lock( mBufferMutex );
+
+    gThreadBuffer.buffer = std::make_shared<PerformanceMarkerBuffer>();
+    gThreadBuffer.serverId = mId;
+    gThreadId = static_cast<unsigned int>( syscall( SYS_gettid ) );
+    mBuffers.push_back( gThreadBuffer.buffer );
+    mNewThreads.push_back( std::make_pair( gThreadId, std::string( name ) ) );
   }
 
-  if( markerType == VSYNC )
+  return *gThreadBuffer.buffer;
+}
+
+void PerformanceServer::DrainThread()
+{
+  // make sure the markers logged from this thread go to the DALi log
+  mEnvironmentOptions.InstallLogFunction();
+
+  std::unique_lock<std::mutex> lock( mDrainMutex );
+  while( !mStopDrainThread )
   {
-    // make sure log function is installed, note this will be called only from v-sync thread
-    // if the v-sync thread has already installed one, it won't make any difference.
-    if( ! mLogFunctionInstalled )
+    if( mMarkersEnabled )
+    {
+      mDrainCondition.wait_for( lock, MAXIMUM_DRAIN_INTERVAL, [this] { return mDrainRequested || mStopDrainThread; } );
+    }
+    else
     {
-      mEnvironmentOptions.InstallLogFunction();
-      mLogFunctionInstalled = true;
+      mDrainCondition.wait( lock, [this] { return mDrainRequested || mStopDrainThread || mMarkersEnabled; } );
     }
+    mDrainRequested = false;
+
+    lock.unlock();
+    DrainMarkers();
+    lock.lock();
   }
+  lock.unlock();
 
-  // Get the time
-  uint64_t timeStamp = 0;
-  TimeService::GetNanoseconds( timeStamp );
-  timeStamp /= NANOSECONDS_PER_MICROSECOND; // Convert to microseconds
+  // markers added before the server is destroyed
+  DrainMarkers();
+
+  mEnvironmentOptions.UnInstallLogFunction();
+}
+
+void PerformanceServer::DrainMarkers()
+{
+  mDrained.clear();
 
-  // Create a marker
-  PerformanceMarker marker( markerType, FrameTimeStamp( 0, timeStamp ) );
+  unsigned int dropped = 0u;
+  {
+    Mutex::ScopedLock lock( mBufferMutex );
+
+    if( mTraceWriter )
+    {
+      for( auto&& thread : mNewThreads )
+      {
+        mTraceWriter->AddThread( thread.first, thread.second );
+      }
+    }
+    mNewThreads.clear();
+
+    PerformanceMarkerBuffer::Entry entry;
+    for( auto it = mBuffers.begin(); it != mBuffers.end(); )
+    {
+      // checked first, so all the markers of an exited thread are drained below
+      const bool exited = ( *it )->HasProducerExited();
+
+      while( ( *it )->Pop( entry ) )
+      {
+        mDrained.push_back( entry );
+      }
+      dropped += ( *it )->TakeDroppedCount();
+
+      if( exited )
+      {
+        it = mBuffers.erase( it );
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
+  // the buffers are in time order, so the start and end markers of a context are matched across threads once merged
+  std::stable_sort( mDrained.begin(), mDrained.end(), EarlierMarker );
+
+  for( auto&& entry : mDrained )
+  {
+    PerformanceMarker marker( entry.type, FrameTimeStamp( 0, entry.microseconds ) );
+
+    if( entry.custom )
+    {
+      // copied, as the context may be removed by another thread
+      const std::string description = mStatContextManager.GetMarkerDescription( entry.type, entry.contextId );
+      LogMarker( marker, description.c_str(), entry.threadId );
+
+      // Add custom marker to statistics context manager
+      mStatContextManager.AddCustomMarker( marker, entry.contextId );
+    }
+    else
+    {
+      LogMarker( marker, marker.GetName(), entry.threadId );
 
-  // log it
-  LogMarker(marker, marker.GetName() );
+      // Add internal marker to statistics context manager
+      mStatContextManager.AddInternalMarker( marker );
+    }
+  }
 
-  // Add internal marker to statistics context manager
-  mStatContextManager.AddInternalMarker( marker );
+  if( dropped > 0u )
+  {
+    mDroppedMarkers += dropped;
+    DALI_LOG_ERROR( "%u performance markers dropped, %u in total\n", dropped, mDroppedMarkers );
+  }
 
+  if( mTraceWriter )
+  {
+    mTraceWriter->Flush();
+  }
 }
 
 void PerformanceServer::LogContextStatistics( const char* const text )
@@ -192,16 +417,28 @@ void PerformanceServer::LogContextStatistics( const char* const text )
   Integration::Log::LogMessage( Dali::Integration::Log::DebugInfo, text );
 }
 
-void PerformanceServer::LogMarker( const PerformanceMarker& marker, const char* const description )
+void PerformanceServer::DumpContextStatistics( const char* const text )
 {
-#if defined(NETWORK_LOGGING_ENABLED)
-  // log to the network ( this is thread safe )
-  if( mNetworkControlEnabled )
+  if( mTraceWriter )
   {
-    mNetworkServer.TransmitMarker( marker, description );
+    // the statistics are logged when the markers are drained
+    uint64_t timeStamp = 0;
+    TimeService::GetNanoseconds( timeStamp );
+    mTraceWriter->AddStatistics( text, timeStamp / NANOSECONDS_PER_MICROSECOND );
   }
-#endif
 
+  if( mStatisticsFile )
+  {
+    // Contexts may be logged from different threads
+    Mutex::ScopedLock lock( mLogMutex );
+
+    fputs( text, mStatisticsFile ); // ignore the error on purpose
+    fflush( mStatisticsFile );
+  }
+}
+
+void PerformanceServer::TraceMarker( const PerformanceMarker& marker, const char* const description )
+{
   // log to kernel trace
   if( mPerformanceOutputBitmask & OUTPUT_KERNEL_TRACE )
   {
@@ -219,6 +456,23 @@ void PerformanceServer::LogMarker( const PerformanceMarker& marker, const char*
 
     mSystemTrace.Trace( marker, description );
   }
+}
+
+void PerformanceServer::LogMarker( const PerformanceMarker& marker, const char* const description, unsigned int threadId )
+{
+  // log to the trace event file
+  if( mTraceWriter )
+  {
+    mTraceWriter->AddMarker( marker, description, threadId );
+  }
+
+#if defined(NETWORK_LOGGING_ENABLED)
+  // log to the network ( this is thread safe )
+  if( mNetworkControlEnabled )
+  {
+    mNetworkServer.TransmitMarker( marker, description );
+  }
+#endif
 
   // log to Dali log ( this is thread safe )
   if ( mPerformanceOutputBitmask & OUTPUT_DALI_LOG )
@@ -19,6 +19,14 @@
  */
 
 // EXTERNAL INCLDUES
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 #include <dali/public-api/common/dali-vector.h>
 #include <dali/devel-api/threading/mutex.h>
 
@@ -27,7 +35,9 @@
 #include <dali/internal/network/common/network-performance-server.h>
 #include <dali/internal/adaptor/common/adaptor-internal-services.h>
 #include <dali/internal/system/common/performance-marker.h>
+#include <dali/internal/system/common/performance-marker-buffer.h>
 #include <dali/internal/system/common/stat-context-manager.h>
+#include <dali/internal/system/common/trace-event-writer.h>
 
 namespace Dali
 {
@@ -44,6 +54,12 @@ class StatContext;
  * Concrete implementation of performance interface.
  * Adaptor classes should never include this file, they
  * just need to include the abstract class performance-interface.h
+ *
+ * Markers are added from the event, update and render threads. Each thread pushes its markers
+ * to its own lock-free buffer, freed once the thread has exited and the buffer is drained. A background thread drains the buffers to feed the statistics contexts,
+ * when a buffer fills past a threshold or at the latest every second. It sleeps while the markers are disabled.
+ * the network, the DALi log and the trace event file. The kernel and system traces take their own time stamps when
+ * written, so they are still written by the thread adding the marker.
  */
 class PerformanceServer : public PerformanceInterface, public StatContextLogInterface
 {
@@ -106,14 +122,61 @@ public: //StatLogInterface
    */
   void LogContextStatistics( const char* const text ) override;
 
+  /**
+   * @copydoc StatLogInterface::DumpContextStatistics()
+   */
+  void DumpContextStatistics( const char* const text ) override;
+
 private:
 
   /**
-   * @brief log the marker out to kernel/ DALi log
+   * @brief Adds a marker to the buffer of the calling thread.
+   * @param[in] markerType The marker type.
+   * @param[in] contextId The custom context of the marker.
+   * @param[in] custom Whether it's a custom marker.
+   */
+  void PushMarker( MarkerType markerType, ContextId contextId, bool custom );
+
+  /**
+   * @brief Wakes the drain thread up to drain the buffers now.
+   */
+  void RequestDrain();
+
+  /**
+   * @brief Retrieves the marker buffer of the calling thread. Creates it the first time a thread adds a marker.
+   * The buffer is shared with the thread, which marks it as exited when it exits.
+   * @return The buffer.
+   */
+  PerformanceMarkerBuffer& GetThreadBuffer();
+
+  /**
+   * @brief log the marker out to kernel / system trace. Called by the thread adding the marker.
    * @param[in] marker performance marker
    * @param[in] description marker description
    */
-  void LogMarker( const PerformanceMarker& marker, const char* const description );
+  void TraceMarker( const PerformanceMarker& marker, const char* const description );
+
+  /**
+   * @brief log the marker out to network / DALi log / trace event file. Called by the drain thread.
+   * @param[in] marker performance marker
+   * @param[in] description marker description
+   */
+  void LogMarker( const PerformanceMarker& marker, const char* const description, unsigned int threadId );
+
+  /**
+   * @brief The main loop of the drain thread.
+   */
+  void DrainThread();
+
+  /**
+   * @brief Moves the markers out of all the buffers and passes them to the statistics and the sinks in time order.
+   */
+  void DrainMarkers();
+
+  // Declared private and left undefined to avoid copies.
+  PerformanceServer( const PerformanceServer& );
+  // Declared private and left undefined to avoid copies.
+  PerformanceServer& operator=( const PerformanceServer& );
 
 private:
 
@@ -121,6 +184,8 @@ private:
   TraceInterface& mKernelTrace;                           ///< kernel trace interface
   TraceInterface& mSystemTrace;                           ///< system trace interface
   Dali::Mutex mLogMutex;                                  ///< mutex
+  FILE* mStatisticsFile;                                  ///< file the statistics are dumped to, if any
+  std::unique_ptr<TraceEventWriter> mTraceWriter;         ///< writes the markers to a trace event file, if any. Only used by the drain thread
 
 #if defined(NETWORK_LOGGING_ENABLED)
   NetworkPerformanceServer mNetworkServer;                ///< network server
@@ -131,8 +196,20 @@ private:
   unsigned int mStatisticsLogBitmask;                     ///< statistics log level
   unsigned int mPerformanceOutputBitmask;                 ///< performance marker output
 
+  std::vector< std::shared_ptr<PerformanceMarkerBuffer> > mBuffers; ///< the marker buffers of the threads adding markers
+  std::vector<PerformanceMarkerBuffer::Entry> mDrained;   ///< the markers moved out of the buffers, only used by the drain thread
+  std::vector< std::pair< unsigned int, std::string > > mNewThreads; ///< the threads which added their first marker since the last drain
+  Dali::Mutex mBufferMutex;                               ///< protects mBuffers and mNewThreads
+  std::thread mDrainThread;                               ///< the thread draining the marker buffers
+  const unsigned int mId;                                 ///< identifies this server in the thread local buffer cache
+  unsigned int mDroppedMarkers;                           ///< the number of markers dropped because a buffer was full
+  std::mutex mDrainMutex;                                 ///< protects the drain requests, the markers enabled flag and the stop flag
+  std::condition_variable mDrainCondition;                ///< signalled on a drain request, when the markers are enabled and on destruction
+  bool mDrainRequested;                                   ///< whether a buffer filled past its threshold since the last drain
+  bool mMarkersEnabled;                                   ///< whether markers are added, so the drain thread has to wake up periodically
+  bool mStopDrainThread;                                  ///< whether the drain thread has to stop
+
   bool mLoggingEnabled:1;                                 ///< whether logging update / render to a log is enabled
-  bool mLogFunctionInstalled:1;                           ///< whether the log function is installed
 };
 
 
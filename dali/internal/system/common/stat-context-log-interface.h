@@ -40,6 +40,12 @@ public:
    */
   virtual void LogContextStatistics( const char* const text) = 0;
 
+  /**
+   * @brief Used to write statistics out in a machine-readable format
+   * @param[in] text the statistics, one JSON object per line
+   */
+  virtual void DumpContextStatistics( const char* const text ) = 0;
+
 
 protected:
 
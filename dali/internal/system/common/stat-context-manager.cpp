@@ -35,6 +35,7 @@ namespace
 const char* const UPDATE_CONTEXT_NAME = "Update";
 const char* const RENDER_CONTEXT_NAME = "Render";
 const char* const EVENT_CONTEXT_NAME = "Event";
+const char* const SWAP_CONTEXT_NAME = "Swap";
 const unsigned int DEFAULT_LOG_FREQUENCY = 2;
 }
 
@@ -45,12 +46,13 @@ StatContextManager::StatContextManager( StatContextLogInterface& logInterface )
   mLogFrequency( DEFAULT_LOG_FREQUENCY )
 {
 
-  mStatContexts.Reserve(4); // intially reserve enough for 3 internal + 1 custom
+  mStatContexts.Reserve(5); // intially reserve enough for 4 internal + 1 custom
 
   // Add defaults
   mUpdateStats = AddContext( UPDATE_CONTEXT_NAME, PerformanceMarker::UPDATE );
   mRenderStats = AddContext( RENDER_CONTEXT_NAME, PerformanceMarker::RENDER );
   mEventStats = AddContext( EVENT_CONTEXT_NAME,   PerformanceMarker::EVENT_PROCESS );
+  mSwapStats = AddContext( SWAP_CONTEXT_NAME,     PerformanceMarker::SWAP_BUFFERS );
 
 }
 
@@ -66,6 +68,9 @@ StatContextManager::~StatContextManager()
 PerformanceInterface::ContextId StatContextManager::AddContext( const char* const name,
                                                                 PerformanceMarker::MarkerFilter type  )
 {
+  // the contexts are read by the thread draining the markers
+  Mutex::ScopedLock lock( mDataMutex );
+
   unsigned int contextId = mNextContextId++;
 
   DALI_ASSERT_DEBUG( NULL == GetContext( contextId ) );
@@ -87,7 +92,7 @@ PerformanceInterface::ContextId StatContextManager::AddContext( const char* cons
 void StatContextManager::AddInternalMarker( const PerformanceMarker& marker )
 {
   // log to the stat contexts, can be called from multiple threads so we
-  // protect the data
+  // protect the data, i.e. the list of contexts modified by AddContext() and RemoveContext()
   Mutex::ScopedLock lock( mDataMutex );
   for( StatContexts::Iterator it = mStatContexts.Begin(), itEnd = mStatContexts.End(); it != itEnd; ++it )
   {
@@ -110,6 +115,7 @@ void StatContextManager::AddCustomMarker( const PerformanceMarker& marker, Perfo
 
 void StatContextManager::RemoveContext(PerformanceInterface::ContextId contextId )
 {
+  Mutex::ScopedLock lock( mDataMutex );
   for( StatContexts::Iterator it = mStatContexts.Begin(), itEnd = mStatContexts.End(); it != itEnd; ++it )
   {
     StatContext* context = *it;
@@ -126,6 +132,7 @@ void StatContextManager::RemoveContext(PerformanceInterface::ContextId contextId
 
 void StatContextManager::EnableLogging( bool enable, PerformanceInterface::ContextId contextId )
 {
+  Mutex::ScopedLock lock( mDataMutex );
   StatContext* context = GetContext( contextId );
   if( context )
   {
@@ -152,8 +159,10 @@ void StatContextManager::SetLoggingLevel(  unsigned int statisticsLogOptions, un
   }
   EnableLogging( mStatisticsLogBitmask & PerformanceInterface::LOG_UPDATE_RENDER, mUpdateStats );
   EnableLogging( mStatisticsLogBitmask & PerformanceInterface::LOG_UPDATE_RENDER, mRenderStats );
+  EnableLogging( mStatisticsLogBitmask & PerformanceInterface::LOG_UPDATE_RENDER, mSwapStats );
   EnableLogging( mStatisticsLogBitmask & PerformanceInterface::LOG_EVENT_PROCESS, mEventStats );
 
+  Mutex::ScopedLock lock( mDataMutex );
   for( StatContexts::Iterator it = mStatContexts.Begin(), itEnd = mStatContexts.End(); it != itEnd; ++it )
   {
      StatContext* context = *it;
@@ -164,6 +173,7 @@ void StatContextManager::SetLoggingLevel(  unsigned int statisticsLogOptions, un
 void StatContextManager::SetLoggingFrequency( unsigned int logFrequency,
                                               PerformanceInterface::ContextId contextId  )
 {
+  Mutex::ScopedLock lock( mDataMutex );
   StatContext* context = GetContext( contextId );
   if( context )
   {
@@ -176,6 +186,7 @@ void StatContextManager::SetLoggingFrequency( unsigned int logFrequency,
 }
 const char* StatContextManager::GetContextName(PerformanceInterface::ContextId contextId) const
 {
+  Mutex::ScopedLock lock( mDataMutex );
   StatContext* context = GetContext(contextId);
   if( context )
   {
@@ -184,8 +195,9 @@ const char* StatContextManager::GetContextName(PerformanceInterface::ContextId c
   return "context not found";
 }
 
-const char* StatContextManager::GetMarkerDescription( PerformanceInterface::MarkerType type, PerformanceInterface::ContextId contextId ) const
+std::string StatContextManager::GetMarkerDescription( PerformanceInterface::MarkerType type, PerformanceInterface::ContextId contextId ) const
 {
+  Mutex::ScopedLock lock( mDataMutex );
   StatContext* context = GetContext(contextId);
   if( context )
   {
@@ -19,6 +19,7 @@
  */
 
 // EXTERNAL INCLUDES
+#include <string>
 #include <dali/devel-api/threading/mutex.h>
 
 // INTERNAL INCLUDES
@@ -104,9 +105,9 @@ public:
      * @brief Get the full description of a marker for this context
      * @param[in] type marker type, for a customer marker this will be either START or END
      * @param[in] contextId id of the context to get the name
-     * @return marker description in relation to this context
+     * @return marker description in relation to this context, a copy as the context may be removed by another thread
      */
-    const char* GetMarkerDescription( PerformanceInterface::MarkerType type, PerformanceInterface::ContextId contextId ) const;
+    std::string GetMarkerDescription( PerformanceInterface::MarkerType type, PerformanceInterface::ContextId contextId ) const;
 
 
     /**
@@ -138,13 +139,13 @@ public:
     typedef Dali::Vector< StatContext* > StatContexts;
 
     /**
-     * @brief helper
+     * @brief helper, called with mDataMutex locked
      * @param[in] contextId the context to get
      * @return context
      */
     StatContext* GetContext( PerformanceInterface::ContextId contextId ) const;
 
-    Dali::Mutex mDataMutex;                            ///< mutex
+    mutable Dali::Mutex mDataMutex;                    ///< protects the list of contexts, which is read by the thread draining the markers
     StatContexts mStatContexts;                        ///< The list of stat contexts
     StatContextLogInterface& mLogInterface;            ///< Log interface
 
@@ -154,6 +155,7 @@ public:
     PerformanceInterface::ContextId mUpdateStats;    ///< update time statistics
     PerformanceInterface::ContextId mRenderStats;    ///< render time statistics
     PerformanceInterface::ContextId mEventStats;     ///< event time statistics
+    PerformanceInterface::ContextId mSwapStats;      ///< swap buffers time statistics
 
     unsigned int mStatisticsLogBitmask;              ///< statistics log bitmask
     unsigned int mLogFrequency;                      ///< log frequency
@@ -20,6 +20,7 @@
 #include <dali/internal/system/common/stat-context.h>
 
 // EXTERNAL INCLUDES
+#include <cstdarg>
 #include <cstdio>
 
 // INTERNAL INCLUDES
@@ -42,7 +43,37 @@ namespace
 const unsigned int MILLISECONDS_PER_SECOND = 1000;    ///< 1000 milliseconds per second
 const char* const UNKNOWN_CONTEXT_NAME = "UNKNOWN_CONTEXT_NAME";
 const unsigned int MICROSECONDS_PER_SECOND = 1000000; ///< 1000000 microseconds per second
-const unsigned int CONTEXT_LOG_SIZE = 120;
+const unsigned int CONTEXT_LOG_SIZE = 256;             ///< The initial size of the log buffer, grown for longer logs
+
+/**
+ * Escapes a string to be written in a JSON string.
+ * @param[in] text The string.
+ * @return The escaped string.
+ */
+std::string EscapeJsonString( const char* text )
+{
+  std::string escaped;
+  for( ; *text; ++text )
+  {
+    const unsigned char character = static_cast<unsigned char>( *text );
+    if( ( character == '"' ) || ( character == '\\' ) )
+    {
+      escaped += '\\';
+      escaped += *text;
+    }
+    else if( character < 0x20 )
+    {
+      char code[7];
+      snprintf( code, sizeof( code ), "\\u%04x", character );
+      escaped += code;
+    }
+    else
+    {
+      escaped += *text;
+    }
+  }
+  return escaped;
+}
 
 }
 
@@ -53,21 +84,21 @@ StatContext::StatContext( unsigned int id,
                           StatContextLogInterface& logInterface )
 : mInitialMarker(PerformanceInterface::VSYNC),
   mName( contextName ),
+  mTempLogBuffer( CONTEXT_LOG_SIZE ),
   mLogInterface( logInterface ),
   mNamePlusStart( std::string(contextName) + "_START" ),
   mNamePlusEnd( std::string(contextName) + "_END" ),
+  mJsonName( EscapeJsonString( contextName ? contextName : UNKNOWN_CONTEXT_NAME ) ),
   mId( id ),
   mLogFrequencyMicroseconds( logFrequencySeconds * MICROSECONDS_PER_SECOND ),
   mFilterType( contextType ),
   mLoggingEnabled( true ),
   mInitialMarkerSet( false )
 {
-  mTempLogBuffer = new char[ CONTEXT_LOG_SIZE ];
 }
 
 StatContext::~StatContext()
 {
-  delete []mTempLogBuffer;
 }
 unsigned int StatContext::GetId() const
 {
@@ -152,11 +183,12 @@ void StatContext::FrameTick( const PerformanceMarker& marker )
     return;
   }
 
+  mStats.TakeSnapshot();      // move the data for statistics to the snapshot
+
   if( mLoggingEnabled )
   {
     LogMarker();
   }
-  mStats.Reset();             // reset data for statistics
   mInitialMarkerSet = false;  // need to restart the timer
 
 }
@@ -166,16 +198,62 @@ void StatContext::LogMarker()
   float mean, standardDeviation;
   mStats.CalculateMean( mean, standardDeviation );
 
-  snprintf( mTempLogBuffer, CONTEXT_LOG_SIZE, "%s, min " TIME_FMT ", max " TIME_FMT ", total (" TOTAL_TIME_FMT "), avg " TIME_FMT ", std dev " TIME_FMT "\n",
+  const float p50 = mStats.GetPercentile( 50.0f ) * MILLISECONDS_PER_SECOND;
+  const float p90 = mStats.GetPercentile( 90.0f ) * MILLISECONDS_PER_SECOND;
+  const float p99 = mStats.GetPercentile( 99.0f ) * MILLISECONDS_PER_SECOND;
+  const float p999 = mStats.GetPercentile( 99.9f ) * MILLISECONDS_PER_SECOND;
+
+  const char* log = FormatLog( "%s, min " TIME_FMT ", max " TIME_FMT ", total (" TOTAL_TIME_FMT "), avg " TIME_FMT ", std dev " TIME_FMT
+     ", p50 " TIME_FMT ", p90 " TIME_FMT ", p99 " TIME_FMT ", p99.9 " TIME_FMT "\n",
      mName ? mName : UNKNOWN_CONTEXT_NAME,
      mStats.GetMinTime() * MILLISECONDS_PER_SECOND,
      mStats.GetMaxTime() * MILLISECONDS_PER_SECOND,
      mStats.GetTotalTime(),
      mean * MILLISECONDS_PER_SECOND,
-     standardDeviation * MILLISECONDS_PER_SECOND );
+     standardDeviation * MILLISECONDS_PER_SECOND,
+     p50, p90, p99, p999 );
+
+    mLogInterface.LogContextStatistics( log );
+
+  // One JSON object per line, times in milliseconds
+  log = FormatLog( "{\"context\":\"%s\",\"count\":%u,\"min\":%.3f,\"max\":%.3f,\"avg\":%.3f,\"stddev\":%.3f,"
+     "\"p50\":%.3f,\"p90\":%.3f,\"p99\":%.3f,\"p99.9\":%.3f}\n",
+     mJsonName.c_str(),
+     mStats.GetRunCount(),
+     mStats.GetMinTime() * MILLISECONDS_PER_SECOND,
+     mStats.GetMaxTime() * MILLISECONDS_PER_SECOND,
+     mean * MILLISECONDS_PER_SECOND,
+     standardDeviation * MILLISECONDS_PER_SECOND,
+     p50, p90, p99, p999 );
+
+    mLogInterface.DumpContextStatistics( log );
+
+}
+
+const char* StatContext::FormatLog( const char* format, ... )
+{
+  va_list arguments;
+  va_start( arguments, format );
+
+  va_list retryArguments;
+  va_copy( retryArguments, arguments );
+
+  // The buffer is grown when the log doesn't fit, so it's never truncated
+  const int length = vsnprintf( mTempLogBuffer.data(), mTempLogBuffer.size(), format, arguments );
+  if( ( length >= 0 ) && ( static_cast<size_t>( length ) >= mTempLogBuffer.size() ) )
+  {
+    mTempLogBuffer.resize( length + 1u );
+    vsnprintf( mTempLogBuffer.data(), mTempLogBuffer.size(), format, retryArguments );
+  }
+  else if( length < 0 )
+  {
+    mTempLogBuffer[0] = '\0';
+  }
 
-    mLogInterface.LogContextStatistics( mTempLogBuffer );
+  va_end( retryArguments );
+  va_end( arguments );
 
+  return mTempLogBuffer.data();
 }
 
 
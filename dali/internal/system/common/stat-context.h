@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <string>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/internal/system/common/performance-marker.h>
@@ -134,6 +135,13 @@ public:
      */
     void LogMarker();
 
+    /**
+     * @brief Formats a log in the temporary log buffer, grown to fit the whole log
+     * @param[in] format printf format of the log
+     * @return the log
+     */
+    const char* FormatLog( const char* format, ... );
+
 
   private:
 
@@ -148,10 +156,11 @@ public:
     PerformanceMarker mInitialMarker;             ///< Used to store initial time
     FrameTimeStats mStats;                        ///< Frame time stats to accumulate
     const char* const mName;                      ///< Name of the context
-    char* mTempLogBuffer;                         ///< Temporary log buffer
+    std::vector<char> mTempLogBuffer;             ///< Temporary log buffer
     StatContextLogInterface& mLogInterface;       ///< Log interface
     const std::string mNamePlusStart;             ///< Name of the context + _START
     const std::string mNamePlusEnd;                ///< Name of the context + _END
+    const std::string mJsonName;                  ///< Name of the context escaped for the JSON statistics
     unsigned int mId;                             ///< The ID of the context
     unsigned int mLogFrequencyMicroseconds;       ///< if logging is enabled, what frequency to log out at in micro-seconds
     PerformanceMarker::MarkerFilter mFilterType;  ///< type of events the context is filtering
@@ -38,6 +38,7 @@ ThreadController::ThreadController( AdaptorInternalServices& adaptorInterfaces,
   switch( environmentOptions.GetThreadingMode() )
   {
     case ThreadingMode::COMBINED_UPDATE_RENDER:
+    case ThreadingMode::PIPELINED_UPDATE_RENDER:
     {
       mThreadControllerInterface = new CombinedUpdateRenderController( adaptorInterfaces, environmentOptions, threadMode );
       break;
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/timer-wheel.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Integration::Log::Filter* gLogFilter = Integration::Log::Filter::New( Debug::NoLogging, false, "LOG_TIMER_WHEEL" );
+#endif
+
+const unsigned int SLOT_BITS = 6u;            ///< 64 slots per level, one bit each in the pending slots.
+const unsigned int SLOT_MASK = ( 1u << SLOT_BITS ) - 1u;
+const unsigned int LEVEL_SHIFT = 3u;          ///< Each level's slots last 8 times as long as the previous level's.
+const uint32_t REPORT_INTERVAL = 600u;        ///< The number of wakeups between reports.
+const uint32_t TOLERANCE_DIVISOR = 8u;        ///< A timer may expire late by an eighth of its interval.
+
+/**
+ * @return The number of bits the time is shifted by to get the slots of a level.
+ */
+inline unsigned int GetShift( unsigned int level )
+{
+  return level * LEVEL_SHIFT;
+}
+
+/**
+ * @return The number of slots of a level from the slot of the current time to the slot of the expiry.
+ */
+inline uint64_t GetSlotDistance( uint64_t currentTime, uint64_t expiry, unsigned int level )
+{
+  return ( expiry >> GetShift( level ) ) - ( currentTime >> GetShift( level ) );
+}
+
+/**
+ * @return The duration of the slots of a level, in milliseconds.
+ */
+inline uint64_t GetSlotDuration( unsigned int level )
+{
+  return static_cast<uint64_t>( 1u ) << GetShift( level );
+}
+
+/**
+ * @return The time a timer may expire late by, in milliseconds.
+ */
+inline uint32_t GetTolerance( uint32_t interval )
+{
+  return ( interval >= TOLERANCE_DIVISOR ) ? interval / TOLERANCE_DIVISOR : 1u;
+}
+
+/**
+ * @return The index of the lowest bit set, which must not be zero.
+ */
+inline unsigned int GetLowestBit( uint64_t bits )
+{
+#if defined(__GNUC__)
+  return static_cast<unsigned int>( __builtin_ctzll( bits ) );
+#else
+  unsigned int index = 0u;
+  while( 0u == ( bits & 1u ) )
+  {
+    bits >>= 1;
+    ++index;
+  }
+  return index;
+#endif
+}
+
+} // unnamed namespace
+
+TimerWheel::Entry::Entry( CallbackBase* callback )
+: callback( callback ),
+  expiry( 0u ),
+  interval( 0u ),
+  tolerance( 1u ),
+  slot( 0u ),
+  next( NULL ),
+  previous( NULL )
+{
+}
+
+TimerWheel::TimerWheel()
+: mExpired( NULL ),
+  mRunningEntry( NULL ),
+  mTime( 0u ),
+  mEntryCount( 0u ),
+  mStatistics{ 0u, 0u, 0u },
+  mRunningEntryStopped( false )
+{
+  for( auto& slot : mSlots )
+  {
+    slot = NULL;
+  }
+  for( auto& pendingSlots : mPendingSlots )
+  {
+    pendingSlots = 0u;
+  }
+}
+
+TimerWheel::~TimerWheel()
+{
+  // The timers are deleted by their owners, which don't use the wheel once the timers are unlinked
+  for( unsigned int slot = 0u; slot <= EXPIRED_SLOT; ++slot )
+  {
+    Entry* entry = ( slot < EXPIRED_SLOT ) ? mSlots[slot] : mExpired;
+    while( entry )
+    {
+      Entry* next = entry->next;
+      entry->next = NULL;
+      entry->previous = NULL;
+      entry = next;
+    }
+  }
+
+  if( 0u != mStatistics.wakeups )
+  {
+    OutputReport();
+  }
+}
+
+void TimerWheel::Start( Entry& entry, uint64_t currentTime, uint32_t delay, uint32_t interval )
+{
+  Stop( entry );
+
+  // Until the next slot is reached, the wheel can move to the current time without moving any timer
+  uint64_t nextExpiry = 0u;
+  if( currentTime > mTime && ( !GetNextExpiry( nextExpiry ) || nextExpiry > currentTime ) )
+  {
+    mTime = currentTime;
+  }
+
+  entry.expiry = currentTime + ( ( delay > 0u ) ? delay : 1u );
+  entry.interval = interval;
+  entry.tolerance = GetTolerance( delay );
+  Add( entry );
+}
+
+void TimerWheel::Stop( Entry& entry )
+{
+  if( entry.previous )
+  {
+    Remove( entry );
+  }
+
+  if( &entry == mRunningEntry )
+  {
+    mRunningEntryStopped = true;
+  }
+}
+
+bool TimerWheel::GetNextExpiry( uint64_t& expiry ) const
+{
+  if( mExpired )
+  {
+    expiry = mTime;
+    return true;
+  }
+
+  bool found = false;
+  for( unsigned int level = 0u; level < NUMBER_OF_LEVELS; ++level )
+  {
+    const uint64_t pendingSlots = mPendingSlots[level];
+    if( 0u == pendingSlots )
+    {
+      continue;
+    }
+
+    // The slots of the level are searched from the next one to end, wrapping around
+    const unsigned int shift = GetShift( level );
+    const uint64_t nextSlot = ( mTime >> shift ) + 1u;
+    const unsigned int start = static_cast<unsigned int>( nextSlot & SLOT_MASK );
+    const uint64_t rotatedSlots = ( 0u == start ) ? pendingSlots : ( pendingSlots >> start ) | ( pendingSlots << ( SLOTS_PER_LEVEL - start ) );
+    const uint64_t levelExpiry = ( nextSlot + GetLowestBit( rotatedSlots ) ) << shift;
+
+    if( !found || levelExpiry < expiry )
+    {
+      expiry = levelExpiry;
+      found = true;
+    }
+  }
+
+  return found;
+}
+
+void TimerWheel::Expire( uint64_t currentTime )
+{
+  ++mStatistics.wakeups;
+
+  // Jumps from a slot with timers to the next, as the slots in between are empty
+  uint32_t expirations = 0u;
+  uint64_t nextExpiry = 0u;
+  while( GetNextExpiry( nextExpiry ) && nextExpiry <= currentTime )
+  {
+    mTime = nextExpiry;
+    Collect();
+
+    while( mExpired )
+    {
+      Entry& entry = *mExpired;
+      Remove( entry );
+
+      if( entry.expiry > mTime )
+      {
+        // Moves to the level of its remaining delay, within its tolerance
+        Add( entry );
+        continue;
+      }
+
+      ++expirations;
+
+      mRunningEntry = &entry;
+      mRunningEntryStopped = false;
+
+      const bool keepRunning = CallbackBase::ExecuteReturn< bool >( *entry.callback );
+
+      mRunningEntry = NULL;
+
+      // Unless the callback has stopped or started the timer itself
+      if( keepRunning && !mRunningEntryStopped && !entry.previous )
+      {
+        // At the interval from the last expiry, unless it's already passed
+        const uint64_t expiry = entry.expiry + entry.interval;
+        entry.expiry = ( expiry > currentTime ) ? expiry : currentTime + ( ( entry.interval > 0u ) ? entry.interval : 1u );
+        entry.tolerance = GetTolerance( entry.interval );
+        Add( entry );
+      }
+    }
+  }
+
+  if( currentTime > mTime )
+  {
+    mTime = currentTime;
+  }
+
+  mStatistics.expirations += expirations;
+  if( 0u == expirations )
+  {
+    ++mStatistics.spuriousWakeups;
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "TimerWheel::Expire. time : %llu, expirations : %u, timers : %u\n",
+                 static_cast<unsigned long long>( mTime ), expirations, mEntryCount );
+
+  if( 0u == mStatistics.wakeups % REPORT_INTERVAL )
+  {
+    OutputReport();
+  }
+}
+
+const TimerWheel::Statistics& TimerWheel::GetStatistics() const
+{
+  return mStatistics;
+}
+
+void TimerWheel::Add( Entry& entry )
+{
+  // The timers expire after the current time, as the slot of the current time has already expired
+  const uint64_t expiry = ( entry.expiry > mTime ) ? entry.expiry : mTime + 1u;
+  entry.expiry = expiry;
+
+  // The first level reaching the expiry, or the coarsest slots within the tolerance so the timers nearby share a slot
+  unsigned int level = 0u;
+  while( level < NUMBER_OF_LEVELS - 1u &&
+         ( GetSlotDistance( mTime, expiry, level ) >= SLOTS_PER_LEVEL || GetSlotDuration( level + 1u ) <= entry.tolerance ) )
+  {
+    ++level;
+  }
+
+  const unsigned int shift = GetShift( level );
+  uint64_t levelSlot = 0u;
+  if( GetSlotDistance( mTime, expiry, level ) >= SLOTS_PER_LEVEL )
+  {
+    // Put in the last slot of the wheel, and inserted again once it is reached
+    levelSlot = ( mTime >> shift ) + SLOT_MASK;
+  }
+  else if( GetSlotDuration( level ) <= entry.tolerance )
+  {
+    // Rounded up to the end of the slot, where the timer expires late by less than its tolerance
+    levelSlot = ( expiry + GetSlotDuration( level ) - 1u ) >> shift;
+  }
+  else
+  {
+    // Rounded down to the start of the slot, where the timer moves to a lower level
+    levelSlot = expiry >> shift;
+  }
+  const unsigned int index = static_cast<unsigned int>( levelSlot & SLOT_MASK );
+
+  entry.slot = level * SLOTS_PER_LEVEL + index;
+  entry.next = mSlots[entry.slot];
+  entry.previous = &mSlots[entry.slot];
+  if( entry.next )
+  {
+    entry.next->previous = &entry.next;
+  }
+  mSlots[entry.slot] = &entry;
+  mPendingSlots[level] |= static_cast<uint64_t>( 1u ) << index;
+
+  ++mEntryCount;
+}
+
+void TimerWheel::Remove( Entry& entry )
+{
+  *entry.previous = entry.next;
+  if( entry.next )
+  {
+    entry.next->previous = entry.previous;
+  }
+
+  if( entry.slot < EXPIRED_SLOT && !mSlots[entry.slot] )
+  {
+    mPendingSlots[entry.slot / SLOTS_PER_LEVEL] &= ~( static_cast<uint64_t>( 1u ) << ( entry.slot & SLOT_MASK ) );
+  }
+
+  entry.next = NULL;
+  entry.previous = NULL;
+
+  --mEntryCount;
+}
+
+void TimerWheel::Collect()
+{
+  for( unsigned int level = 0u; level < NUMBER_OF_LEVELS; ++level )
+  {
+    // The slots of a level start when the time is a multiple of their duration
+    const unsigned int shift = GetShift( level );
+    if( 0u != ( mTime & ( ( static_cast<uint64_t>( 1u ) << shift ) - 1u ) ) )
+    {
+      break;
+    }
+
+    const unsigned int index = static_cast<unsigned int>( ( mTime >> shift ) & SLOT_MASK );
+    const unsigned int slot = level * SLOTS_PER_LEVEL + index;
+
+    Entry* entry = mSlots[slot];
+    while( entry )
+    {
+      Entry* next = entry->next;
+
+      entry->slot = EXPIRED_SLOT;
+      entry->next = mExpired;
+      entry->previous = &mExpired;
+      if( mExpired )
+      {
+        mExpired->previous = &entry->next;
+      }
+      mExpired = entry;
+
+      entry = next;
+    }
+
+    mSlots[slot] = NULL;
+    mPendingSlots[level] &= ~( static_cast<uint64_t>( 1u ) << index );
+  }
+}
+
+void TimerWheel::OutputReport()
+{
+  DALI_LOG_INFO( gLogFilter, Debug::General, "TimerWheel: wakeups %u, spurious wakeups %u, expirations %u, timers %u\n",
+                 mStatistics.wakeups, mStatistics.spuriousWakeups, mStatistics.expirations, mEntryCount );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
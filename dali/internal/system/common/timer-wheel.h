@@ -0,0 +1,190 @@
+#ifndef DALI_INTERNAL_TIMER_WHEEL_H
+#define DALI_INTERNAL_TIMER_WHEEL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+#include <dali/public-api/signals/callback.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * A hierarchical timer wheel, so many timers are driven by a single timer of the main loop.
+ *
+ * The time is counted in milliseconds. The wheel has levels of 64 slots, each slot of a level lasting 8 times
+ * as long as a slot of the previous level. Each timer has a tolerance, an eighth of its interval, which it may
+ * expire late by. A timer is put in the first level which reaches its expiry and whose slots don't last longer
+ * than its tolerance, in the slot ending at or after its expiry, so the timers nearby expire by a single wakeup.
+ *
+ * A timer too far for the slots of its tolerance is put in the slot starting before its expiry. When the start of
+ * that slot is reached, it moves down to the level of its remaining delay, which is then within its tolerance,
+ * so it moves down at most once.
+ *
+ * Starting and stopping a timer are constant time, as the timers are linked in their slot, and a bit is set for
+ * each slot which isn't empty. The timers further than the last level are put in its last slot, and inserted
+ * again once it's reached.
+ *
+ * The wheel doesn't own a timer of the main loop. Its owner arms one for GetNextExpiry() and calls Expire()
+ * when it fires.
+ *
+ * Only used by the event thread.
+ */
+class TimerWheel
+{
+public:
+
+  /**
+   * A timer of the wheel. Owned by the user of the wheel, which must stop it before deleting it.
+   */
+  struct Entry
+  {
+    /**
+     * Constructor
+     * @param[in] callback The callback run when the timer expires. It returns whether the timer has to be started again. Not owned.
+     */
+    Entry( CallbackBase* callback );
+
+    CallbackBase* callback;
+    uint64_t expiry;        ///< The time the timer expires, in milliseconds.
+    uint32_t interval;      ///< The interval the timer is started again with, in milliseconds.
+    uint32_t tolerance;     ///< The time the timer may expire late by, so it's coalesced with the timers nearby, in milliseconds.
+    uint32_t slot;          ///< The slot the timer is linked in.
+    Entry* next;
+    Entry** previous;       ///< The pointer to this entry in the list it's linked in, NULL if it's not linked.
+  };
+
+  /**
+   * The counts since the wheel has been created.
+   */
+  struct Statistics
+  {
+    uint32_t wakeups;           ///< The number of times Expire() has been called.
+    uint32_t spuriousWakeups;   ///< The number of wakeups which didn't expire any timer.
+    uint32_t expirations;       ///< The number of timers expired.
+  };
+
+  /**
+   * Constructor
+   */
+  TimerWheel();
+
+  /**
+   * Destructor. Unlinks the timers which are still running.
+   */
+  ~TimerWheel();
+
+  /**
+   * Starts a timer, or starts it again if it's running.
+   * The timer may expire late by an eighth of its delay, and then of its interval.
+   * @param[in] entry The timer.
+   * @param[in] currentTime The current time, in milliseconds.
+   * @param[in] delay The time from now the timer expires in, in milliseconds. At least 1ms.
+   * @param[in] interval The interval the timer is started again with, in milliseconds.
+   */
+  void Start( Entry& entry, uint64_t currentTime, uint32_t delay, uint32_t interval );
+
+  /**
+   * Stops a timer. Does nothing if the timer is not running.
+   * @param[in] entry The timer.
+   */
+  void Stop( Entry& entry );
+
+  /**
+   * Gets the time the wheel has to be advanced at, for the next timers to expire or move down a level.
+   * @param[out] expiry The time of the start of the next slot which has timers, in milliseconds.
+   * @return Whether there are running timers.
+   */
+  bool GetNextExpiry( uint64_t& expiry ) const;
+
+  /**
+   * Advances the wheel and runs the callbacks of the timers which have expired.
+   * The callbacks may start and stop timers.
+   * @param[in] currentTime The current time, in milliseconds.
+   */
+  void Expire( uint64_t currentTime );
+
+  /**
+   * @return The counts since the wheel has been created.
+   */
+  const Statistics& GetStatistics() const;
+
+private:
+
+  /**
+   * Links a timer in the slot of its expiry.
+   * @param[in] entry The timer.
+   */
+  void Add( Entry& entry );
+
+  /**
+   * Unlinks a timer from its list.
+   * @param[in] entry The timer.
+   */
+  void Remove( Entry& entry );
+
+  /**
+   * Moves the timers of the slots starting at the current time of the wheel to the list of expired timers.
+   */
+  void Collect();
+
+  /**
+   * Output the counts of wakeups and expirations.
+   */
+  void OutputReport();
+
+  // Undefined copy constructor.
+  TimerWheel( const TimerWheel& );
+
+  // Undefined assignment operator.
+  TimerWheel& operator=( const TimerWheel& );
+
+private:
+
+  enum
+  {
+    NUMBER_OF_LEVELS = 8,
+    SLOTS_PER_LEVEL = 64,
+    NUMBER_OF_SLOTS = NUMBER_OF_LEVELS * SLOTS_PER_LEVEL,
+    EXPIRED_SLOT = NUMBER_OF_SLOTS     ///< The slot of the timers which have expired and wait for their callback to run.
+  };
+
+  Entry* mSlots[NUMBER_OF_SLOTS];                ///< The first timer of each slot.
+  uint64_t mPendingSlots[NUMBER_OF_LEVELS];      ///< A bit set for each slot of a level which has timers.
+  Entry* mExpired;                               ///< The timers which have expired and wait for their callback to run.
+  Entry* mRunningEntry;                          ///< The timer whose callback is running, if any.
+  uint64_t mTime;                                ///< The time the wheel has expired the timers up to, in milliseconds.
+  uint32_t mEntryCount;                          ///< The number of running timers.
+  Statistics mStatistics;
+  bool mRunningEntryStopped;                     ///< Whether the timer whose callback is running has been stopped.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TIMER_WHEEL_H
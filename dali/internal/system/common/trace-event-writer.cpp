@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/trace-event-writer.h>
+
+// EXTERNAL INCLUDES
+#include <cstring>
+#include <iterator>
+#include <unistd.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+const char* const ROTATED_FILE_POSTFIX = ".1";
+const char* const START_POSTFIX = "_START";
+const char* const END_POSTFIX = "_END";
+
+/**
+ * Retrieves the length of the event name of a marker description, i.e. without the _START / _END postfix.
+ * @param[in] description The marker description.
+ * @param[in] postfix The postfix to remove.
+ * @return The length of the name.
+ */
+int GetEventNameLength( const char* const description, const char* const postfix )
+{
+  const size_t length = strlen( description );
+  const size_t postfixLength = strlen( postfix );
+  if( ( length > postfixLength ) && ( 0 == strcmp( description + length - postfixLength, postfix ) ) )
+  {
+    return static_cast<int>( length - postfixLength );
+  }
+  return static_cast<int>( length );
+}
+
+} // unnamed namespace
+
+TraceEventWriter::TraceEventWriter( const std::string& path, unsigned int maximumSize )
+: mThreads(),
+  mOpenEvents(),
+  mLastMicroseconds( 0u ),
+  mPath( path ),
+  mFile( NULL ),
+  mMaximumSize( static_cast<long>( maximumSize ) ),
+  mProcessId( getpid() ),
+  mFirstEvent( true )
+{
+  Open();
+}
+
+TraceEventWriter::~TraceEventWriter()
+{
+  Close();
+}
+
+bool TraceEventWriter::IsOpen() const
+{
+  return mFile != NULL;
+}
+
+void TraceEventWriter::AddThread( unsigned int threadId, const std::string& name )
+{
+  mThreads.push_back( std::make_pair( threadId, name ) );
+
+  if( BeginEvent( mLastMicroseconds ) )
+  {
+    WriteThreadName( mThreads.back() );
+  }
+}
+
+void TraceEventWriter::AddMarker( const PerformanceMarker& marker, const char* const description, unsigned int threadId )
+{
+  const uint64_t microseconds = marker.GetTimeStamp().microseconds;
+  if( !BeginEvent( microseconds ) )
+  {
+    return;
+  }
+
+  // custom context names are given by the application
+  switch( marker.GetEventType() )
+  {
+    case PerformanceMarker::START_TIMED_EVENT:
+    {
+      const int length = GetEventNameLength( description, START_POSTFIX );
+      WriteDurationEvent( description, length, 'B', microseconds, threadId );
+
+      OpenEvent event = { threadId, std::string( description, length ) };
+      mOpenEvents.push_back( event );
+      break;
+    }
+    case PerformanceMarker::END_TIMED_EVENT:
+    {
+      const int length = GetEventNameLength( description, END_POSTFIX );
+      WriteDurationEvent( description, length, 'E', microseconds, threadId );
+
+      // the most recent event of the thread with this name, as the events of a thread nest
+      for( auto it = mOpenEvents.rbegin(); it != mOpenEvents.rend(); ++it )
+      {
+        if( ( it->threadId == threadId ) && ( 0 == it->name.compare( 0, std::string::npos, description, length ) ) )
+        {
+          mOpenEvents.erase( std::next( it ).base() );
+          break;
+        }
+      }
+      break;
+    }
+    case PerformanceMarker::SINGLE_EVENT:
+    {
+      fputs( "{\"name\":\"", mFile );
+      WriteEscaped( description, static_cast<int>( strlen( description ) ) );
+      fprintf( mFile, "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%llu,\"pid\":%d,\"tid\":%u}",
+               static_cast<unsigned long long>( microseconds ), mProcessId, threadId );
+      break;
+    }
+  }
+}
+
+void TraceEventWriter::AddStatistics( const char* const statistics, uint64_t microseconds )
+{
+  if( !BeginEvent( microseconds ) )
+  {
+    return;
+  }
+
+  // the statistics are logged one per line
+  int length = static_cast<int>( strlen( statistics ) );
+  while( ( length > 0 ) && ( statistics[length - 1] == '\n' ) )
+  {
+    --length;
+  }
+
+  fprintf( mFile, "{\"name\":\"statistics\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%llu,\"pid\":%d,\"tid\":0,\"args\":%.*s}",
+           static_cast<unsigned long long>( microseconds ), mProcessId, length, statistics );
+}
+
+void TraceEventWriter::Flush()
+{
+  if( mFile )
+  {
+    fflush( mFile );
+  }
+}
+
+void TraceEventWriter::Open()
+{
+  mFile = fopen( mPath.c_str(), "w" );
+  if( !mFile )
+  {
+    DALI_LOG_ERROR( "Failed to open the performance trace file %s\n", mPath.c_str() );
+    return;
+  }
+
+  fputs( "[\n", mFile );
+  mFirstEvent = true;
+
+  // each file has the names of all the threads
+  for( auto&& thread : mThreads )
+  {
+    WriteSeparator();
+    WriteThreadName( thread );
+  }
+}
+
+void TraceEventWriter::Close()
+{
+  if( mFile )
+  {
+    fputs( "\n]\n", mFile );
+    fclose( mFile );
+    mFile = NULL;
+  }
+}
+
+bool TraceEventWriter::BeginEvent( uint64_t microseconds )
+{
+  if( !mFile )
+  {
+    return false;
+  }
+
+  if( ( mMaximumSize > 0 ) && ( ftell( mFile ) >= mMaximumSize ) )
+  {
+    Rotate( microseconds );
+    if( !mFile )
+    {
+      return false;
+    }
+  }
+
+  mLastMicroseconds = microseconds;
+  WriteSeparator();
+  return true;
+}
+
+void TraceEventWriter::Rotate( uint64_t microseconds )
+{
+  // the nested events end before the ones they're in
+  for( auto it = mOpenEvents.rbegin(); it != mOpenEvents.rend(); ++it )
+  {
+    WriteSeparator();
+    WriteDurationEvent( it->name.c_str(), static_cast<int>( it->name.size() ), 'E', microseconds, it->threadId );
+  }
+
+  Close();
+
+  const std::string rotatedPath = mPath + ROTATED_FILE_POSTFIX;
+  if( 0 != rename( mPath.c_str(), rotatedPath.c_str() ) )
+  {
+    DALI_LOG_ERROR( "Failed to rotate the performance trace file %s\n", mPath.c_str() );
+  }
+
+  Open();
+  if( !mFile )
+  {
+    return;
+  }
+
+  for( auto&& event : mOpenEvents )
+  {
+    WriteSeparator();
+    WriteDurationEvent( event.name.c_str(), static_cast<int>( event.name.size() ), 'B', microseconds, event.threadId );
+  }
+}
+
+void TraceEventWriter::WriteSeparator()
+{
+  if( !mFirstEvent )
+  {
+    fputs( ",\n", mFile );
+  }
+  mFirstEvent = false;
+}
+
+void TraceEventWriter::WriteDurationEvent( const char* const name, int length, char phase, uint64_t microseconds, unsigned int threadId )
+{
+  fputs( "{\"name\":\"", mFile );
+  WriteEscaped( name, length );
+  fprintf( mFile, "\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":%d,\"tid\":%u}",
+           phase, static_cast<unsigned long long>( microseconds ), mProcessId, threadId );
+}
+
+void TraceEventWriter::WriteThreadName( const std::pair< unsigned int, std::string >& thread )
+{
+  fprintf( mFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"",
+           mProcessId, thread.first );
+  WriteEscaped( thread.second.c_str(), static_cast<int>( thread.second.size() ) );
+  fputs( "\"}}", mFile );
+}
+
+void TraceEventWriter::WriteEscaped( const char* const text, int length )
+{
+  for( int index = 0; index < length; ++index )
+  {
+    const unsigned char character = static_cast<unsigned char>( text[index] );
+    if( ( character == '"' ) || ( character == '\\' ) )
+    {
+      fputc( '\\', mFile );
+      fputc( character, mFile );
+    }
+    else if( character < 0x20 )
+    {
+      fprintf( mFile, "\\u%04x", character );
+    }
+    else
+    {
+      fputc( character, mFile );
+    }
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,188 @@
+#ifndef DALI_INTERNAL_ADAPTOR_TRACE_EVENT_WRITER_H
+#define DALI_INTERNAL_ADAPTOR_TRACE_EVENT_WRITER_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <cstdio>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/performance-marker.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * Writes performance markers to a file in the Chrome trace event format (JSON array format),
+ * which can be opened with chrome://tracing or the Perfetto UI.
+ *
+ * Each thread adding markers gets its own track. The timed markers become duration events
+ * named after the marker without its _START / _END postfix, the other markers instant events.
+ * The statistics of the contexts are written as global instant events with the statistics as arguments.
+ *
+ * When the file reaches its maximum size it's renamed with a ".1" postfix, replacing the previous one,
+ * and a new file is started, so at most twice the maximum size is used. The duration events still open are
+ * ended in the rotated file and begun again in the new one, so the begin and end events of each file match.
+ *
+ * Only used by one thread.
+ */
+class TraceEventWriter
+{
+public:
+
+  /**
+   * Constructor. Opens the file.
+   * @param[in] path The path of the file.
+   * @param[in] maximumSize The size in bytes the file is rotated at.
+   */
+  TraceEventWriter( const std::string& path, unsigned int maximumSize );
+
+  /**
+   * Destructor, not intended as a base class. Terminates and closes the file.
+   */
+  ~TraceEventWriter();
+
+  /**
+   * @return Whether the file is open.
+   */
+  bool IsOpen() const;
+
+  /**
+   * Names the track of a thread.
+   * @param[in] threadId The thread id.
+   * @param[in] name The thread name.
+   */
+  void AddThread( unsigned int threadId, const std::string& name );
+
+  /**
+   * Writes a marker.
+   * @param[in] marker The marker.
+   * @param[in] description The marker description, e.g. UPDATE_START.
+   * @param[in] threadId The thread that added the marker.
+   */
+  void AddMarker( const PerformanceMarker& marker, const char* const description, unsigned int threadId );
+
+  /**
+   * Writes the statistics of a context.
+   * @param[in] statistics The statistics as a JSON object.
+   * @param[in] microseconds The time of the statistics.
+   */
+  void AddStatistics( const char* const statistics, uint64_t microseconds );
+
+  /**
+   * Flushes the events written so far to the file.
+   */
+  void Flush();
+
+private:
+
+  /**
+   * Opens the file and writes the start of the array and the thread names.
+   */
+  void Open();
+
+  /**
+   * Terminates the array and closes the file.
+   */
+  void Close();
+
+  /**
+   * Writes the separator before an event and rotates the file if it's full.
+   * @param[in] microseconds The time of the event, at which the open duration events are split if the file is rotated.
+   * @return Whether the event can be written, i.e. the file is open.
+   */
+  bool BeginEvent( uint64_t microseconds );
+
+  /**
+   * Rotates the file, ending the open duration events in the rotated file and beginning them again in the new one.
+   * @param[in] microseconds The time the duration events are split at.
+   */
+  void Rotate( uint64_t microseconds );
+
+  /**
+   * Writes the separator before an event.
+   */
+  void WriteSeparator();
+
+  /**
+   * Writes a duration event.
+   * @param[in] name The event name.
+   * @param[in] length The number of characters of the name.
+   * @param[in] phase 'B' for the begin event, 'E' for the end event.
+   * @param[in] microseconds The time of the event.
+   * @param[in] threadId The thread of the event.
+   */
+  void WriteDurationEvent( const char* const name, int length, char phase, uint64_t microseconds, unsigned int threadId );
+
+  /**
+   * Writes the metadata event naming the track of a thread.
+   * @param[in] thread The thread id and name.
+   */
+  void WriteThreadName( const std::pair< unsigned int, std::string >& thread );
+
+  /**
+   * Writes a string in a JSON string, escaping the quotes, backslashes and control characters.
+   * @param[in] text The string.
+   * @param[in] length The number of characters to write.
+   */
+  void WriteEscaped( const char* const text, int length );
+
+  // Undefined copy constructor.
+  TraceEventWriter( const TraceEventWriter& );
+
+  // Undefined assignment operator.
+  TraceEventWriter& operator=( const TraceEventWriter& );
+
+private:
+
+  /**
+   * A duration event begun and not ended yet.
+   */
+  struct OpenEvent
+  {
+    unsigned int threadId; ///< The thread of the event.
+    std::string name;      ///< The event name.
+  };
+
+  std::vector< std::pair< unsigned int, std::string > > mThreads; ///< The thread names, written again to each new file.
+  std::vector< OpenEvent > mOpenEvents;                            ///< The duration events begun and not ended yet, in the order they began.
+  uint64_t mLastMicroseconds;                                      ///< The time of the last event written.
+  std::string mPath;                                               ///< The path of the file.
+  FILE* mFile;                                                     ///< The file, NULL if it couldn't be opened.
+  long mMaximumSize;                                               ///< The size in bytes the file is rotated at.
+  int mProcessId;                                                  ///< The process id written to each event.
+  bool mFirstEvent;                                                ///< Whether no event has been written to the file yet.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_TRACE_EVENT_WRITER_H
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/trigger-event-queue.h>
+
+// EXTERNAL INCLUDES
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <dali/devel-api/threading/conditional-wait.h>
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/time-service.h>
+#include <dali/internal/system/common/trigger-event.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Integration::Log::Filter* gLogFilter = Integration::Log::Filter::New( Debug::NoLogging, false, "LOG_TRIGGER_EVENT" );
+#endif
+
+const uint64_t DISPATCH_TIME_BUDGET = 4000000u;      ///< 4ms, the remaining callbacks run at the next iteration of the main loop.
+const uint64_t NANOSECONDS_PER_MICROSECOND = 1000u;
+
+Dali::ConditionalWait gQueueCondition;               ///< Protects the queue and its reference count, trigger events can be created and destroyed in any thread.
+TriggerEventQueue* gQueue = NULL;
+unsigned int gQueueReferenceCount = 0u;
+
+} // unnamed namespace
+
+TriggerEventQueue* TriggerEventQueue::Acquire()
+{
+  ConditionalWait::ScopedLock lock( gQueueCondition );
+
+  if( 0u == gQueueReferenceCount++ )
+  {
+    gQueue = new TriggerEventQueue();
+  }
+  return gQueue;
+}
+
+void TriggerEventQueue::Release()
+{
+  ConditionalWait::ScopedLock lock( gQueueCondition );
+
+  if( 0u == --gQueueReferenceCount )
+  {
+    if( gQueue->mDispatching )
+    {
+      // The last trigger event is destroyed by a callback, the queue is deleted once the callback returns.
+      gQueue->mReleased = true;
+    }
+    else
+    {
+      delete gQueue;
+    }
+    gQueue = NULL;
+  }
+}
+
+bool TriggerEventQueue::GetStatistics( Statistics& statistics )
+{
+  ConditionalWait::ScopedLock lock( gQueueCondition );
+
+  if( !gQueue )
+  {
+    return false;
+  }
+
+  statistics.triggers = gQueue->mTriggers.load( std::memory_order_relaxed );
+  statistics.coalesced = gQueue->mCoalesced.load( std::memory_order_relaxed );
+  statistics.wakeups = gQueue->mWakeups.load( std::memory_order_relaxed );
+  statistics.callbacks = gQueue->mCallbacks.load( std::memory_order_relaxed );
+  statistics.totalLatency = gQueue->mTotalLatency.load( std::memory_order_relaxed );
+  statistics.maximumLatency = gQueue->mMaximumLatency.load( std::memory_order_relaxed );
+  return true;
+}
+
+TriggerEventQueue::TriggerEventQueue()
+: mPushed( NULL ),
+  mFirst( NULL ),
+  mLast( NULL ),
+  mFileDescriptorMonitor( NULL ),
+  mFileDescriptor( -1 ),
+  mTriggers( 0u ),
+  mCoalesced( 0u ),
+  mWakeups( 0u ),
+  mCallbacks( 0u ),
+  mTotalLatency( 0u ),
+  mMaximumLatency( 0u ),
+  mDispatchedEvent( NULL ),
+  mDispatchThread(),
+  mDispatching( false ),
+  mReleased( false )
+{
+  // Create accompanying file descriptor.
+  mFileDescriptor = eventfd( 0, EFD_NONBLOCK );
+  if( mFileDescriptor >= 0 )
+  {
+    // Now Monitor the created event file descriptor
+    mFileDescriptorMonitor = new FileDescriptorMonitor( mFileDescriptor, MakeCallback( this, &TriggerEventQueue::Dispatch ), FileDescriptorMonitor::FD_READABLE );
+  }
+  else
+  {
+    DALI_LOG_ERROR( "Unable to create TriggerEvent File descriptor\n" );
+  }
+}
+
+TriggerEventQueue::~TriggerEventQueue()
+{
+  DALI_LOG_INFO( gLogFilter, Debug::General, "TriggerEventQueue: triggers %llu, coalesced %llu, wakeups %llu, callbacks %llu, maximum latency %lluus\n",
+                 mTriggers.load(), mCoalesced.load(), mWakeups.load(), mCallbacks.load(), mMaximumLatency.load() );
+
+  delete mFileDescriptorMonitor;
+
+  if( mFileDescriptor >= 0 )
+  {
+    close( mFileDescriptor );
+  }
+}
+
+void TriggerEventQueue::Push( TriggerEvent& triggerEvent )
+{
+  TimeService::GetNanoseconds( triggerEvent.mTriggerTime );
+
+  TriggerEvent* head = mPushed.load( std::memory_order_relaxed );
+  do
+  {
+    triggerEvent.mNext = head;
+  }
+  while( !mPushed.compare_exchange_weak( head, &triggerEvent, std::memory_order_release, std::memory_order_relaxed ) );
+
+  mTriggers.fetch_add( 1u, std::memory_order_relaxed );
+
+  if( NULL == head )
+  {
+    // The event thread takes all the pushed events at once, so it only needs to be woken up by the first one.
+    Signal();
+  }
+}
+
+void TriggerEventQueue::CountCoalesced()
+{
+  mTriggers.fetch_add( 1u, std::memory_order_relaxed );
+  mCoalesced.fetch_add( 1u, std::memory_order_relaxed );
+}
+
+void TriggerEventQueue::Remove( TriggerEvent& triggerEvent )
+{
+  ConditionalWait::ScopedLock lock( gQueueCondition );
+
+  // Destroyed by another thread while its callback runs, which can't be interrupted.
+  while( ( mDispatchedEvent == &triggerEvent ) && !pthread_equal( mDispatchThread, pthread_self() ) )
+  {
+    gQueueCondition.Wait( lock );
+  }
+
+  if( mDispatchedEvent == &triggerEvent )
+  {
+    // Destroyed by its own callback.
+    mDispatchedEvent = NULL;
+  }
+
+  if( !triggerEvent.mQueued.load( std::memory_order_acquire ) )
+  {
+    return;
+  }
+
+  // The event may still be in the pushed list, move it to the list of events to run.
+  TakePushedEvents();
+
+  TriggerEvent* previous = NULL;
+  for( TriggerEvent* current = mFirst; current; previous = current, current = current->mNext )
+  {
+    if( current == &triggerEvent )
+    {
+      if( previous )
+      {
+        previous->mNext = current->mNext;
+      }
+      else
+      {
+        mFirst = current->mNext;
+      }
+
+      if( mLast == current )
+      {
+        mLast = previous;
+      }
+      break;
+    }
+  }
+}
+
+void TriggerEventQueue::Signal()
+{
+  if( mFileDescriptor >= 0 )
+  {
+    // Writing to the file descriptor triggers the Dispatch() method in the event thread.
+    uint64_t data = 1;
+    int size = write( mFileDescriptor, &data, sizeof(uint64_t) );
+
+    if( size != sizeof(uint64_t) )
+    {
+      DALI_LOG_ERROR( "Unable to write to UpdateEvent File descriptor\n" );
+    }
+  }
+  else
+  {
+    DALI_LOG_WARNING( "Attempting to write to an invalid file descriptor\n" );
+  }
+}
+
+void TriggerEventQueue::TakePushedEvents()
+{
+  TriggerEvent* pushed = mPushed.exchange( NULL, std::memory_order_acquire );
+  if( !pushed )
+  {
+    return;
+  }
+
+  // Reverse the list so the events run in the order they were triggered.
+  TriggerEvent* first = NULL;
+  TriggerEvent* last = pushed;
+  while( pushed )
+  {
+    TriggerEvent* next = pushed->mNext;
+    pushed->mNext = first;
+    first = pushed;
+    pushed = next;
+  }
+
+  if( mLast )
+  {
+    mLast->mNext = first;
+  }
+  else
+  {
+    mFirst = first;
+  }
+  mLast = last;
+}
+
+void TriggerEventQueue::Dispatch( FileDescriptorMonitor::EventType eventBitMask, int fileDescriptor )
+{
+  if( !( eventBitMask & FileDescriptorMonitor::FD_READABLE ) )
+  {
+    DALI_ASSERT_ALWAYS( 0 && "Trigger event file descriptor error");
+    return;
+  }
+
+  // Reading from the file descriptor resets the event counter, we can ignore the count.
+  uint64_t receivedData;
+  size_t size;
+  size = read( mFileDescriptor, &receivedData, sizeof(uint64_t) );
+  if( size != sizeof(uint64_t) )
+  {
+    DALI_LOG_WARNING( "Unable to read to UpdateEvent File descriptor\n" );
+  }
+
+  mWakeups.fetch_add( 1u, std::memory_order_relaxed );
+
+  {
+    ConditionalWait::ScopedLock lock( gQueueCondition );
+    TakePushedEvents();
+    mDispatching = true;
+    mDispatchThread = pthread_self();
+  }
+
+  uint64_t startTime = 0u;
+  TimeService::GetNanoseconds( startTime );
+
+  unsigned int callbacks = 0u;
+  uint64_t currentTime = startTime;
+  bool moreEvents = true;
+  while( moreEvents )
+  {
+    TriggerEvent* triggerEvent = NULL;
+    {
+      // The events are removed by the threads destroying them, so they're taken from the list with the lock.
+      ConditionalWait::ScopedLock lock( gQueueCondition );
+      triggerEvent = mFirst;
+      if( !triggerEvent )
+      {
+        break;
+      }
+
+      mFirst = triggerEvent->mNext;
+      if( !mFirst )
+      {
+        mLast = NULL;
+      }
+      triggerEvent->mNext = NULL;
+      mDispatchedEvent = triggerEvent;
+    }
+
+    const uint64_t latency = ( currentTime - triggerEvent->mTriggerTime ) / NANOSECONDS_PER_MICROSECOND;
+    mTotalLatency.fetch_add( latency, std::memory_order_relaxed );
+    if( latency > mMaximumLatency.load( std::memory_order_relaxed ) )
+    {
+      mMaximumLatency.store( latency, std::memory_order_relaxed );
+    }
+
+    // The callback may destroy the trigger event, or any other one.
+    triggerEvent->Triggered();
+    ++callbacks;
+
+    {
+      ConditionalWait::ScopedLock lock( gQueueCondition );
+      mDispatchedEvent = NULL;
+      moreEvents = ( NULL != mFirst );
+
+      // Wakes up the threads waiting for the callback to destroy the event.
+      gQueueCondition.Notify( lock );
+    }
+
+    TimeService::GetNanoseconds( currentTime );
+    if( moreEvents && ( currentTime - startTime > DISPATCH_TIME_BUDGET ) )
+    {
+      // Let the main loop process the other events before running the remaining callbacks.
+      Signal();
+      break;
+    }
+  }
+
+  mCallbacks.fetch_add( callbacks, std::memory_order_relaxed );
+
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "TriggerEventQueue::Dispatch. callbacks : %u, time : %lluus\n", callbacks, ( currentTime - startTime ) / NANOSECONDS_PER_MICROSECOND );
+
+  bool released = false;
+  {
+    ConditionalWait::ScopedLock lock( gQueueCondition );
+    mDispatching = false;
+    released = mReleased;
+  }
+
+  if( released )
+  {
+    delete this;
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,170 @@
+#ifndef DALI_INTERNAL_TRIGGER_EVENT_QUEUE_H
+#define DALI_INTERNAL_TRIGGER_EVENT_QUEUE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <pthread.h>
+#include <stdint.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/file-descriptor-monitor.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class TriggerEvent;
+
+/**
+ * The queue of the trigger events waiting to run their callback on the event thread.
+ *
+ * All the trigger events share this queue and a single event file descriptor. Triggering an event pushes it to
+ * a lock-free list, and the file descriptor is only written to when the list was empty, so the event thread
+ * is woken up once for a whole batch of events. An event triggered again before its callback runs is only queued once.
+ *
+ * The event thread runs the queued callbacks in the order they were triggered. If they take longer than a
+ * time budget, the remaining ones run at the next iteration of the main loop so other events are not delayed.
+ *
+ * The queue exists while there are trigger events. It's created with the first one and destroyed with the last one.
+ * A trigger event can be destroyed by any thread; if its callback is running on the event thread, the destroying
+ * thread waits for the callback to return.
+ */
+class TriggerEventQueue
+{
+public:
+
+  /**
+   * The counters of the queue since it was created.
+   */
+  struct Statistics
+  {
+    uint64_t triggers;        ///< The number of times the events were triggered.
+    uint64_t coalesced;       ///< The number of triggers of events that were already queued.
+    uint64_t wakeups;         ///< The number of times the event thread was woken up.
+    uint64_t callbacks;       ///< The number of callbacks run.
+    uint64_t totalLatency;    ///< The sum of the times from the triggers to the callbacks, in microseconds.
+    uint64_t maximumLatency;  ///< The longest time from a trigger to its callback, in microseconds.
+  };
+
+  /**
+   * Retrieves the queue, creating it if there's none. Called when a trigger event is created.
+   * @return The queue.
+   */
+  static TriggerEventQueue* Acquire();
+
+  /**
+   * Releases the queue, destroying it once all the trigger events are destroyed.
+   */
+  static void Release();
+
+  /**
+   * Retrieves the counters of the queue.
+   * @param[out] statistics The counters.
+   * @return Whether there's a queue.
+   */
+  static bool GetStatistics( Statistics& statistics );
+
+  /**
+   * Queues a trigger event. Can be called from any thread.
+   * @param[in] triggerEvent The trigger event.
+   */
+  void Push( TriggerEvent& triggerEvent );
+
+  /**
+   * Counts a trigger of an event which is already queued. Can be called from any thread.
+   */
+  void CountCoalesced();
+
+  /**
+   * Removes a trigger event from the queue. Called by the thread destroying the trigger event, which waits
+   * if its callback is running on the event thread, unless the callback destroys it.
+   * @param[in] triggerEvent The trigger event.
+   */
+  void Remove( TriggerEvent& triggerEvent );
+
+private:
+
+  /**
+   * Constructor
+   */
+  TriggerEventQueue();
+
+  /**
+   * Destructor
+   */
+  ~TriggerEventQueue();
+
+  /**
+   * Wakes the event thread up.
+   */
+  void Signal();
+
+  /**
+   * Moves the events pushed by the other threads to the end of the list of events to run, in the order they were pushed.
+   * Called with the queue lock.
+   */
+  void TakePushedEvents();
+
+  /**
+   * Called on the event thread when the event file descriptor has been written to. Runs the callbacks of the queued events.
+   * @param[in] eventBitMask bit mask of events that occured on the file descriptor
+   * @param[in] fileDescriptor The file descriptor
+   */
+  void Dispatch( FileDescriptorMonitor::EventType eventBitMask, int fileDescriptor );
+
+  // Undefined copy constructor.
+  TriggerEventQueue( const TriggerEventQueue& );
+
+  // Undefined assignment operator.
+  TriggerEventQueue& operator=( const TriggerEventQueue& );
+
+private:
+
+  std::atomic<TriggerEvent*> mPushed;        ///< The events pushed since the last dispatch, the last pushed first.
+  TriggerEvent* mFirst;                      ///< The first event to run. Protected by the queue lock.
+  TriggerEvent* mLast;                       ///< The last event to run. Protected by the queue lock.
+  FileDescriptorMonitor* mFileDescriptorMonitor;
+  int mFileDescriptor;
+
+  std::atomic<uint64_t> mTriggers;           ///< Counters written by any thread.
+  std::atomic<uint64_t> mCoalesced;
+  std::atomic<uint64_t> mWakeups;            ///< Counters written by the event thread, atomic so they can be read from any thread.
+  std::atomic<uint64_t> mCallbacks;
+  std::atomic<uint64_t> mTotalLatency;
+  std::atomic<uint64_t> mMaximumLatency;
+
+  TriggerEvent* mDispatchedEvent;            ///< The event whose callback is running. Protected by the queue lock.
+  pthread_t mDispatchThread;                 ///< The thread running the callbacks. Protected by the queue lock.
+  bool mDispatching;                         ///< Whether the callbacks are running. Protected by the queue lock.
+  bool mReleased;                            ///< Whether the last trigger event was destroyed by a callback. Protected by the queue lock.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TRIGGER_EVENT_QUEUE_H
@@ -19,15 +19,8 @@
 #include <dali/internal/system/common/trigger-event.h>
 
 // EXTERNAL INCLUDES
-#include <sys/eventfd.h>
-#include <unistd.h>
-
 #include <dali/integration-api/debug.h>
 
-// INTERNAL INCLUDES
-
-#include <dali/internal/system/common/file-descriptor-monitor.h>
-
 namespace Dali
 {
 
@@ -38,80 +31,49 @@ namespace Adaptor
 {
 
 TriggerEvent::TriggerEvent( CallbackBase* callback, TriggerEventInterface::Options options )
-: mFileDescriptorMonitor( NULL ),
+: mQueue( TriggerEventQueue::Acquire() ),
   mCallback( callback ),
-  mFileDescriptor( -1 ),
+  mNext( NULL ),
+  mTriggerTime( 0u ),
+  mQueued( false ),
   mOptions( options )
 {
-  // Create accompanying file descriptor.
-  mFileDescriptor = eventfd(0, EFD_NONBLOCK);
-  if (mFileDescriptor >= 0)
-  {
-    // Now Monitor the created event file descriptor
-    mFileDescriptorMonitor = new FileDescriptorMonitor( mFileDescriptor, MakeCallback( this, &TriggerEvent::Triggered ), FileDescriptorMonitor::FD_READABLE );
-  }
-  else
-  {
-    DALI_LOG_ERROR("Unable to create TriggerEvent File descriptor\n");
-  }
 }
 
 TriggerEvent::~TriggerEvent()
 {
-  delete mFileDescriptorMonitor;
+  mQueue->Remove( *this );
+
   delete mCallback;
 
-  if (mFileDescriptor >= 0)
-  {
-    close(mFileDescriptor);
-    mFileDescriptor = 0;
-  }
+  TriggerEventQueue::Release();
 }
 
 void TriggerEvent::Trigger()
 {
-  if (mFileDescriptor >= 0)
+  // The event is queued once until its callback runs, as the file descriptor counted the triggers in a single event.
+  if( !mQueued.exchange( true, std::memory_order_acq_rel ) )
   {
-    // Increment event counter by 1.
-    // Writing to the file descriptor triggers the Dispatch() method in the other thread
-    // (if in multi-threaded environment).
-
-    uint64_t data = 1;
-    int size = write(mFileDescriptor, &data, sizeof(uint64_t));
-
-    if (size != sizeof(uint64_t))
-    {
-      DALI_LOG_ERROR("Unable to write to UpdateEvent File descriptor\n");
-    }
+    mQueue->Push( *this );
   }
   else
   {
-    DALI_LOG_WARNING("Attempting to write to an invalid file descriptor\n");
+    mQueue->CountCoalesced();
   }
 }
 
-void TriggerEvent::Triggered( FileDescriptorMonitor::EventType eventBitMask, int fileDescriptor )
+void TriggerEvent::Triggered()
 {
-  if( !( eventBitMask & FileDescriptorMonitor::FD_READABLE ) )
-  {
-    DALI_ASSERT_ALWAYS( 0 && "Trigger event file descriptor error");
-    return;
-  }
+  // Triggers from the callback queue the event again.
+  mQueued.store( false, std::memory_order_release );
 
-  // Reading from the file descriptor resets the event counter, we can ignore the count.
-  uint64_t receivedData;
-  size_t size;
-  size = read(mFileDescriptor, &receivedData, sizeof(uint64_t));
-  if (size != sizeof(uint64_t))
-  {
-    DALI_LOG_WARNING("Unable to read to UpdateEvent File descriptor\n");
-  }
+  //check if we should delete ourselves after the trigger
+  const bool deleteAfterTrigger = ( mOptions == TriggerEventInterface::DELETE_AFTER_TRIGGER );
 
   // Call the connected callback
   CallbackBase::Execute( *mCallback );
 
-  //check if we should delete ourselves after the trigger
-  if( mOptions == TriggerEventInterface::DELETE_AFTER_TRIGGER )
+  if( deleteAfterTrigger )
   {
     delete this;
   }
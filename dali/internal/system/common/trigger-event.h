@@ -19,12 +19,14 @@
  */
 
 // EXTERNAL INCLUDES
+#include <atomic>
+#include <stdint.h>
 #include <dali/public-api/signals/callback.h>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/dali-adaptor-common.h>
 #include <dali/integration-api/adaptor-framework/trigger-event-interface.h>
-#include <dali/internal/system/common/file-descriptor-monitor.h>
+#include <dali/internal/system/common/trigger-event-queue.h>
 
 namespace Dali
 {
@@ -44,7 +46,8 @@ namespace Adaptor
  *
  * The observer will be informed whenever the event is triggered.
  *
- * The implementation of TriggerEvent uses an event file descriptor.
+ * The trigger events are queued to the TriggerEventQueue, which wakes the event thread up with an event file descriptor.
+ * Triggering an event several times before its callback runs calls it once.
  */
 class TriggerEvent : public TriggerEventInterface
 {
@@ -52,8 +55,6 @@ public:
 
   /**
    * Constructor
-   * Creates an event file descriptor and starts a GSource which reads from the file
-   * descriptor when there is data.
    *
    * @param[in] callback The callback to call
    * @param[in] options Trigger event options.
@@ -63,6 +64,8 @@ public:
 
   /**
    * Destructor
+   * Removes the event from the queue if it's waiting for its callback. Can be called by any thread,
+   * which waits for the callback if it's running.
    */
   ~TriggerEvent();
 
@@ -78,21 +81,19 @@ public:
 private:
 
   /**
-   * @brief Called when our event file descriptor has been written to.
-   * @param[in] eventBitMask bit mask of events that occured on the file descriptor
-   * @param[in] fileDescriptor The file descriptor
+   * @brief Called by the queue on the event thread to call the callback.
    */
-  void Triggered( FileDescriptorMonitor::EventType eventBitMask, int fileDescriptor );
+  void Triggered();
 
-private:
-
-  struct Source;
+  friend class TriggerEventQueue;
 
 private:
 
-  FileDescriptorMonitor* mFileDescriptorMonitor;
+  TriggerEventQueue* mQueue;           ///< The queue shared by all the trigger events.
   CallbackBase* mCallback;
-  int mFileDescriptor;
+  TriggerEvent* mNext;                 ///< The next event in the queue.
+  uint64_t mTriggerTime;               ///< The time the event was queued, in nanoseconds.
+  std::atomic<bool> mQueued;           ///< Whether the event is waiting for its callback.
   TriggerEventInterface::Options mOptions;
 };
 
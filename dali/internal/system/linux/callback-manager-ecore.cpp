@@ -184,17 +184,6 @@ void EcoreCallbackManager::RemoveIdleCallback( CallbackBase* callback )
   }
 }
 
-bool EcoreCallbackManager::ProcessIdle()
-{
-  // @todo To be implemented.
-  return false;
-}
-
-void EcoreCallbackManager::ClearIdleCallbacks()
-{
-  // @todo To be implemented.
-}
-
 bool EcoreCallbackManager::AddIdleEntererCallback( CallbackBase* callback )
 {
   if( !mRunning )
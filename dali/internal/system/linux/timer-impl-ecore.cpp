@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,8 +18,13 @@
 // CLASS HEADER
 #include <dali/internal/system/common/timer-impl.h>
 
+// EXTERNAL INCLUDES
+#include <memory>
+
 // INTERNAL INCLUDES
 #include <dali/internal/adaptor/common/adaptor-impl.h>
+#include <dali/internal/system/common/time-service.h>
+#include <dali/internal/system/common/timer-wheel.h>
 #include <dali/public-api/dali-adaptor-common.h>
 
 #include <dali/internal/system/linux/dali-ecore.h>
@@ -36,14 +41,154 @@ namespace Adaptor
 // LOCAL STUFF
 namespace
 {
-Eina_Bool TimerSourceFunc (void *data)
+
+const uint64_t NANOSECONDS_PER_MILLISECOND = 1000000u;
+const double NANOSECONDS_TO_SECONDS = 0.000000001;
+
+/**
+ * Drives the timer wheel of the timers with a single ecore timer, armed for the next expiry of the wheel.
+ */
+class TimerWheelSource
 {
-  Timer* timer = static_cast<Timer*>(data);
+public:
+
+  /**
+   * @return The source of the timers of the event thread.
+   */
+  static TimerWheelSource& Get()
+  {
+    static TimerWheelSource source;
+    return source;
+  }
 
-  bool keepRunning = timer->Tick();
+  /**
+   * @copydoc TimerWheel::Start()
+   */
+  void Start( TimerWheel::Entry& entry, uint32_t delay, uint32_t interval )
+  {
+    uint64_t currentTime = 0u;
+    TimeService::GetNanoseconds( currentTime );
+
+    mTimerWheel.Start( entry, currentTime / NANOSECONDS_PER_MILLISECOND, delay, interval );
+    Arm( currentTime );
+  }
+
+  /**
+   * @copydoc TimerWheel::Stop()
+   */
+  void Stop( TimerWheel::Entry& entry )
+  {
+    mTimerWheel.Stop( entry );
+
+    // The ecore timer is kept for the other timers, or deleted once there are none
+    uint64_t expiry = 0u;
+    if( mSource && !mExpiring && !mTimerWheel.GetNextExpiry( expiry ) )
+    {
+      ecore_timer_del( mSource );
+      mSource = NULL;
+    }
+  }
+
+  /**
+   * @return The time the wheel expires the timers at, in milliseconds.
+   */
+  uint64_t GetCurrentTime() const
+  {
+    uint64_t currentTime = 0u;
+    TimeService::GetNanoseconds( currentTime );
+    return currentTime / NANOSECONDS_PER_MILLISECOND;
+  }
+
+private:
+
+  TimerWheelSource()
+  : mTimerWheel(),
+    mSource( NULL ),
+    mSourceExpiry( 0u ),
+    mExpiring( false )
+  {
+  }
+
+  ~TimerWheelSource()
+  {
+    // The ecore timer is not deleted, as ecore may have been shut down already
+  }
+
+  /**
+   * Arms the ecore timer for the next expiry, unless it's already armed for an earlier time.
+   * @param[in] currentTime The current time, in nanoseconds.
+   */
+  void Arm( uint64_t currentTime )
+  {
+    if( mExpiring )
+    {
+      // Armed once all the expired timers have run
+      return;
+    }
+
+    uint64_t expiry = 0u;
+    if( !mTimerWheel.GetNextExpiry( expiry ) )
+    {
+      if( mSource )
+      {
+        ecore_timer_del( mSource );
+        mSource = NULL;
+      }
+      return;
+    }
+
+    if( mSource )
+    {
+      if( mSourceExpiry <= expiry )
+      {
+        return;
+      }
+      ecore_timer_del( mSource );
+    }
+
+    const uint64_t expiryTime = expiry * NANOSECONDS_PER_MILLISECOND;
+    const double delay = ( expiryTime > currentTime ) ? ( expiryTime - currentTime ) * NANOSECONDS_TO_SECONDS : 0.0;
+    mSource = ecore_timer_add( delay, reinterpret_cast<Ecore_Task_Cb>( SourceFunc ), this );
+    mSourceExpiry = expiry;
+  }
+
+  /**
+   * Called when the ecore timer fires.
+   */
+  static Eina_Bool SourceFunc( void* data )
+  {
+    TimerWheelSource* source = static_cast<TimerWheelSource*>( data );
+
+    // Deleted by ecore once it returns
+    source->mSource = NULL;
+
+    uint64_t currentTime = 0u;
+    TimeService::GetNanoseconds( currentTime );
+
+    source->mExpiring = true;
+    source->mTimerWheel.Expire( currentTime / NANOSECONDS_PER_MILLISECOND );
+    source->mExpiring = false;
+
+    TimeService::GetNanoseconds( currentTime );
+    source->Arm( currentTime );
+
+    return ECORE_CALLBACK_CANCEL;
+  }
+
+  // Undefined copy constructor.
+  TimerWheelSource( const TimerWheelSource& );
+
+  // Undefined assignment operator.
+  TimerWheelSource& operator=( const TimerWheelSource& );
+
+private:
+
+  TimerWheel mTimerWheel;
+  Ecore_Timer* mSource;          ///< The ecore timer, NULL if there are no timers running.
+  uint64_t mSourceExpiry;        ///< The time the ecore timer is armed for, in milliseconds.
+  bool mExpiring;                ///< Whether the expired timers are running.
+};
 
-  return keepRunning ? EINA_TRUE : EINA_FALSE;
-}
 } // unnamed namespace
 
 /**
@@ -51,14 +196,22 @@ Eina_Bool TimerSourceFunc (void *data)
  */
 struct Timer::Impl
 {
-  Impl( unsigned int milliSec )
-  : mId(NULL),
-    mInterval(milliSec)
+  Impl( Timer* timer, unsigned int milliSec )
+  : mCallback( MakeCallback( timer, &Timer::Tick ) ),
+    mEntry( mCallback.get() ),
+    mInterval( milliSec ),
+    mRemaining( 0u ),
+    mRunning( false ),
+    mPaused( false )
   {
   }
 
-  Ecore_Timer * mId;
+  std::unique_ptr< CallbackBase > mCallback;
+  TimerWheel::Entry mEntry;
   unsigned int mInterval;
+  uint32_t mRemaining;           ///< The time left before the timer expires when it's paused, in milliseconds.
+  bool mRunning;
+  bool mPaused;
 };
 
 TimerPtr Timer::New( unsigned int milliSec )
@@ -68,7 +221,7 @@ TimerPtr Timer::New( unsigned int milliSec )
 }
 
 Timer::Timer( unsigned int milliSec )
-: mImpl(new Impl(milliSec))
+: mImpl(new Impl(this, milliSec))
 {
 }
 
@@ -83,12 +236,9 @@ void Timer::Start()
   // Timer should be used in the event thread
   DALI_ASSERT_ALWAYS( Adaptor::IsAvailable() );
 
-  if(mImpl->mId != NULL)
-  {
-    Stop();
-  }
-  double interval = static_cast<double> ( mImpl->mInterval ) / 1000.0f;
-  mImpl->mId = ecore_timer_add( interval, reinterpret_cast<Ecore_Task_Cb>( TimerSourceFunc ), this );
+  mImpl->mPaused = false;
+  mImpl->mRunning = true;
+  TimerWheelSource::Get().Start( mImpl->mEntry, mImpl->mInterval, mImpl->mInterval );
 }
 
 void Timer::Stop()
@@ -104,9 +254,13 @@ void Timer::Pause()
   // Timer should be used in the event thread
   DALI_ASSERT_ALWAYS( Adaptor::IsAvailable() );
 
-  if( mImpl->mId != NULL )
+  if( mImpl->mRunning && !mImpl->mPaused )
   {
-    ecore_timer_freeze( mImpl->mId );
+    TimerWheelSource& source = TimerWheelSource::Get();
+    const uint64_t currentTime = source.GetCurrentTime();
+    mImpl->mRemaining = ( mImpl->mEntry.expiry > currentTime ) ? static_cast<uint32_t>( mImpl->mEntry.expiry - currentTime ) : 0u;
+    mImpl->mPaused = true;
+    source.Stop( mImpl->mEntry );
   }
 }
 
@@ -115,9 +269,10 @@ void Timer::Resume()
   // Timer should be used in the event thread
   DALI_ASSERT_ALWAYS( Adaptor::IsAvailable() );
 
-  if( mImpl->mId != NULL )
+  if( mImpl->mRunning && mImpl->mPaused )
   {
-    ecore_timer_thaw( mImpl->mId );
+    mImpl->mPaused = false;
+    TimerWheelSource::Get().Start( mImpl->mEntry, mImpl->mRemaining, mImpl->mInterval );
   }
 }
 
@@ -177,16 +332,17 @@ Dali::Timer::TimerSignalType& Timer::TickSignal()
 
 void Timer::ResetTimerData()
 {
-  if (mImpl->mId != NULL)
+  if( mImpl->mRunning )
   {
-    ecore_timer_del(mImpl->mId);
-    mImpl->mId = NULL;
+    TimerWheelSource::Get().Stop( mImpl->mEntry );
+    mImpl->mRunning = false;
+    mImpl->mPaused = false;
   }
 }
 
 bool Timer::IsRunning() const
 {
-  return mImpl->mId != NULL;
+  return mImpl->mRunning;
 }
 
 } // namespace Adaptor
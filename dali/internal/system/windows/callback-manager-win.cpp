@@ -72,19 +72,6 @@ void WinCallbackManager::RemoveIdleCallback( CallbackBase* callback )
   //Wait for deal
 }
 
-bool WinCallbackManager::ProcessIdle()
-{
-  const bool idleProcessed = !mCallbacks.empty();
-
-  for (CallbackBase* cb : mCallbacks)
-  {
-    Dali::CallbackBase::Execute(*cb);
-  }
-  mCallbacks.clear();
-
-  return idleProcessed;
-}
-
 void WinCallbackManager::ClearIdleCallbacks()
 {
   mCallbacks.clear();
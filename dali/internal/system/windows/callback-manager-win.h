@@ -62,14 +62,9 @@ public:
     void RemoveIdleCallback( CallbackBase* callback ) override;
 
     /**
-     * @copydoc CallbackManager::ProcessIdle()
+     * @brief Clears the container of callbacks, once the main loop has run them.
      */
-    bool ProcessIdle() override;
-
-    /**
-     * @copydoc CallbackManager::ClearIdleCallbacks()
-     */
-    void ClearIdleCallbacks() override;
+    void ClearIdleCallbacks();
 
     /**
     * @brief Adds a @p callback to be run when entering an idle state.
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/mapped-file.h>
+
+// EXTERNAL INCLUDES
+#include <cstdio>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+
+MappedFilePtr MappedFile::New( const std::string& filename )
+{
+  // The file is read into the buffer, as it's not mapped on this platform
+  FILE* file = fopen( filename.c_str(), "rb" );
+  if( !file )
+  {
+    DALI_LOG_ERROR( "file open failed for: \"%s\"\n", filename.c_str() );
+    return MappedFilePtr();
+  }
+
+  Dali::Vector<uint8_t> buffer;
+  fseek( file, 0, SEEK_END );
+  const long size = ftell( file );
+  fseek( file, 0, SEEK_SET );
+
+  bool read = ( size >= 0 );
+  if( read && size > 0 )
+  {
+    buffer.ResizeUninitialized( static_cast<size_t>( size ) );
+    read = ( fread( buffer.Begin(), 1, buffer.Count(), file ) == buffer.Count() );
+  }
+  fclose( file );
+
+  if( !read )
+  {
+    DALI_LOG_ERROR( "file read failed for: \"%s\"\n", filename.c_str() );
+    return MappedFilePtr();
+  }
+
+  return New( buffer );
+}
+
+MappedFilePtr MappedFile::New( Dali::Vector<uint8_t>& buffer )
+{
+  MappedFilePtr mappedFile( new MappedFile() );
+  mappedFile->mBuffer.Swap( buffer );
+  if( mappedFile->mBuffer.Count() > 0u )
+  {
+    mappedFile->mData = mappedFile->mBuffer.Begin();
+    mappedFile->mSize = mappedFile->mBuffer.Count();
+  }
+  return mappedFile;
+}
+
+MappedFile::MappedFile()
+: mData( NULL ),
+  mSize( 0u ),
+  mMapping( NULL ),
+  mBuffer()
+{
+}
+
+MappedFile::~MappedFile()
+{
+}
+
+} // namespace Adaptor
+} // namespace Internal
+} // namespace Dali
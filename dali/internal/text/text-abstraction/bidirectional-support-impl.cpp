@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <memory.h>
+#include <algorithm>
 #include <fribidi/fribidi.h>
 #include <dali/integration-api/debug.h>
 #include <dali/devel-api/common/singleton-service.h>
@@ -102,6 +103,8 @@ struct BidirectionalSupport::Plugin
     FriBidiCharType* characterTypes;      ///< The type of each character (right, left, neutral, ...)
     FriBidiLevel*    embeddedLevels;      ///< Embedded levels.
     FriBidiParType   paragraphDirection;  ///< The paragraph's direction.
+    Length           numberOfCharacters;  ///< The number of characters of the paragraph.
+    Length           capacity;            ///< The number of characters the buffers have room for.
   };
 
   Plugin()
@@ -148,16 +151,13 @@ struct BidirectionalSupport::Plugin
       return 0;
     }
 
+    bidirectionalInfo->numberOfCharacters = numberOfCharacters;
+    bidirectionalInfo->capacity = numberOfCharacters;
+
     // Retrieve the type of each character..
     fribidi_get_bidi_types( paragraph, numberOfCharacters, bidirectionalInfo->characterTypes );
 
-    // Retrieve the paragraph's direction.
-    bidirectionalInfo->paragraphDirection = matchSystemLanguageDirection == true ?
-                                           ( layoutDirection == LayoutDirection::RIGHT_TO_LEFT ? FRIBIDI_PAR_RTL : FRIBIDI_PAR_LTR ) :
-                                           ( fribidi_get_par_direction( bidirectionalInfo->characterTypes, numberOfCharacters ) );
-
-    // Retrieve the embedding levels.
-    if (fribidi_get_par_embedding_levels( bidirectionalInfo->characterTypes, numberOfCharacters, &bidirectionalInfo->paragraphDirection, bidirectionalInfo->embeddedLevels ) == 0)
+    if( !SetEmbeddedLevels( *bidirectionalInfo, matchSystemLanguageDirection, layoutDirection ) )
     {
       free( bidirectionalInfo->characterTypes );
       delete bidirectionalInfo;
@@ -186,6 +186,77 @@ struct BidirectionalSupport::Plugin
     return index;
   }
 
+  bool UpdateInfo( BidiInfoIndex bidiInfoIndex,
+                   const Character* const paragraph,
+                   Length numberOfCharacters,
+                   CharacterIndex updateStartIndex,
+                   Length numberOfCharactersRemoved,
+                   Length numberOfCharactersAdded,
+                   bool matchSystemLanguageDirection,
+                   LayoutDirection::Type layoutDirection )
+  {
+    if( bidiInfoIndex >= mParagraphBidirectionalInfo.Count() )
+    {
+      return false;
+    }
+
+    BidirectionalInfo* bidirectionalInfo = *( mParagraphBidirectionalInfo.Begin() + bidiInfoIndex );
+    if( NULL == bidirectionalInfo )
+    {
+      return false;
+    }
+
+    const Length previousNumberOfCharacters = bidirectionalInfo->numberOfCharacters;
+
+    // The types of the characters which are not in the updated range can be kept if the range is consistent.
+    const bool isRangeValid = ( updateStartIndex + numberOfCharactersRemoved <= previousNumberOfCharacters ) &&
+                              ( previousNumberOfCharacters - numberOfCharactersRemoved + numberOfCharactersAdded == numberOfCharacters );
+    if( !isRangeValid )
+    {
+      updateStartIndex = 0u;
+      numberOfCharactersRemoved = previousNumberOfCharacters;
+      numberOfCharactersAdded = numberOfCharacters;
+    }
+
+    if( numberOfCharacters > bidirectionalInfo->capacity )
+    {
+      // Grow geometrically to avoid reallocations on every keystroke.
+      const Length capacity = std::max( numberOfCharacters, 2u * bidirectionalInfo->capacity );
+
+      FriBidiCharType* characterTypes = reinterpret_cast<FriBidiCharType*>( realloc( bidirectionalInfo->characterTypes, capacity * sizeof( FriBidiCharType ) ) );
+      if( !characterTypes )
+      {
+        return false;
+      }
+      bidirectionalInfo->characterTypes = characterTypes;
+
+      FriBidiLevel* embeddedLevels = reinterpret_cast<FriBidiLevel*>( realloc( bidirectionalInfo->embeddedLevels, capacity * sizeof( FriBidiLevel ) ) );
+      if( !embeddedLevels )
+      {
+        return false;
+      }
+      bidirectionalInfo->embeddedLevels = embeddedLevels;
+
+      bidirectionalInfo->capacity = capacity;
+    }
+
+    // Move the types of the characters after the updated range.
+    const Length numberOfCharactersAfter = previousNumberOfCharacters - updateStartIndex - numberOfCharactersRemoved;
+    if( ( 0u != numberOfCharactersAfter ) && ( numberOfCharactersRemoved != numberOfCharactersAdded ) )
+    {
+      memmove( bidirectionalInfo->characterTypes + updateStartIndex + numberOfCharactersAdded,
+               bidirectionalInfo->characterTypes + updateStartIndex + numberOfCharactersRemoved,
+               numberOfCharactersAfter * sizeof( FriBidiCharType ) );
+    }
+
+    bidirectionalInfo->numberOfCharacters = numberOfCharacters;
+
+    // Retrieve the type of the added characters only.
+    fribidi_get_bidi_types( paragraph + updateStartIndex, numberOfCharactersAdded, bidirectionalInfo->characterTypes + updateStartIndex );
+
+    return SetEmbeddedLevels( *bidirectionalInfo, matchSystemLanguageDirection, layoutDirection );
+  }
+
   void DestroyInfo( BidiInfoIndex bidiInfoIndex )
   {
     if( bidiInfoIndex >= mParagraphBidirectionalInfo.Count() )
@@ -354,6 +425,28 @@ struct BidirectionalSupport::Plugin
     }
   }
 
+  /**
+   * @brief Retrieves the paragraph's direction and the embedding levels from the character types.
+   *
+   * @param[in,out] bidirectionalInfo The paragraph's bidirectional info. Its character types must be set.
+   * @param[in] matchSystemLanguageDirection Whether match for system language direction or not.
+   * @param[in] layoutDirection The direction of the system language.
+   *
+   * @return @e true if fribidi succeeds to retrieve the embedding levels.
+   */
+  bool SetEmbeddedLevels( BidirectionalInfo& bidirectionalInfo,
+                          bool matchSystemLanguageDirection,
+                          LayoutDirection::Type layoutDirection )
+  {
+    // Retrieve the paragraph's direction.
+    bidirectionalInfo.paragraphDirection = matchSystemLanguageDirection == true ?
+                                           ( layoutDirection == LayoutDirection::RIGHT_TO_LEFT ? FRIBIDI_PAR_RTL : FRIBIDI_PAR_LTR ) :
+                                           ( fribidi_get_par_direction( bidirectionalInfo.characterTypes, bidirectionalInfo.numberOfCharacters ) );
+
+    // Retrieve the embedding levels.
+    return fribidi_get_par_embedding_levels( bidirectionalInfo.characterTypes, bidirectionalInfo.numberOfCharacters, &bidirectionalInfo.paragraphDirection, bidirectionalInfo.embeddedLevels ) != 0;
+  }
+
   Vector<BidirectionalInfo*> mParagraphBidirectionalInfo; ///< Stores the bidirectional info per paragraph.
   Vector<BidiInfoIndex>      mFreeIndices;                ///< Stores indices of free positions in the bidirectional info vector.
 };
@@ -406,6 +499,27 @@ BidiInfoIndex BidirectionalSupport::CreateInfo( const Character* const paragraph
                               layoutDirection );
 }
 
+bool BidirectionalSupport::UpdateInfo( BidiInfoIndex bidiInfoIndex,
+                                       const Character* const paragraph,
+                                       Length numberOfCharacters,
+                                       CharacterIndex updateStartIndex,
+                                       Length numberOfCharactersRemoved,
+                                       Length numberOfCharactersAdded,
+                                       bool matchSystemLanguageDirection,
+                                       Dali::LayoutDirection::Type layoutDirection )
+{
+  CreatePlugin();
+
+  return mPlugin->UpdateInfo( bidiInfoIndex,
+                              paragraph,
+                              numberOfCharacters,
+                              updateStartIndex,
+                              numberOfCharactersRemoved,
+                              numberOfCharactersAdded,
+                              matchSystemLanguageDirection,
+                              layoutDirection );
+}
+
 void BidirectionalSupport::DestroyInfo( BidiInfoIndex bidiInfoIndex )
 {
   CreatePlugin();
@@ -64,6 +64,18 @@ public:
                             bool matchSystemLanguageDirection,
                             LayoutDirection::Type layoutDirection );
 
+  /**
+   * @copydoc Dali::BidirectionalSupport::UpdateInfo()
+   */
+  bool UpdateInfo( BidiInfoIndex bidiInfoIndex,
+                   const Character* const paragraph,
+                   Length numberOfCharacters,
+                   CharacterIndex updateStartIndex,
+                   Length numberOfCharactersRemoved,
+                   Length numberOfCharactersAdded,
+                   bool matchSystemLanguageDirection,
+                   LayoutDirection::Type layoutDirection );
+
   /**
    * @copydoc Dali::BidirectionalSupport::DestroyInfo()
    */
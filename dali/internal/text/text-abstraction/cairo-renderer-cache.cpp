@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/cairo-renderer-cache.h>
+
+// INTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+// EXTERNAL INCLUDES
+#include <cairo-ft.h>
+#include FT_MODULE_H
+#include FT_SYSTEM_H
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Dali::Integration::Log::Filter* gLogFilter = Dali::Integration::Log::Filter::New(Debug::NoLogging, false, "LOG_CAIRO_RENDERER_CACHE");
+#endif
+
+const int FONT_FACE_LOAD_FLAGS = CAIRO_HINT_STYLE_SLIGHT;
+const unsigned int MINIMUM_SURFACE_SIZE_SHIFT = 6u; ///< Circular surfaces are 64x64 pixels at least.
+
+const std::size_t MAXIMUM_NUMBER_OF_FONT_FACES = 16u;   ///< The font faces kept between renders, with or without bold synthesis.
+const std::size_t MAXIMUM_NUMBER_OF_SCALED_FONTS = 8u;  ///< The scaled fonts kept per font face.
+const std::size_t MAXIMUM_NUMBER_OF_SURFACES = 2u;      ///< The circular text surfaces kept between renders.
+const std::size_t MAXIMUM_NUMBER_OF_GLYPHS = 4096u;     ///< The glyph buffer is freed after rendering more glyphs than this.
+
+const cairo_user_data_key_t FREETYPE_FACE_KEY = { 0 };
+
+void* Allocate( FT_Memory memory, long size )
+{
+  return malloc( size );
+}
+
+void Free( FT_Memory memory, void* block )
+{
+  free( block );
+}
+
+void* Reallocate( FT_Memory memory, long currentSize, long newSize, void* block )
+{
+  return realloc( block, newSize );
+}
+
+/**
+ * The memory functions of the FreeType library.
+ *
+ * FT_Done_FreeType() frees the memory functions of a library created by FT_Init_FreeType() even if the library is still referenced,
+ * so the library is created with these ones and released with FT_Done_Library() instead.
+ */
+FT_MemoryRec_ gFreeTypeMemory = { nullptr, Allocate, Free, Reallocate };
+
+/**
+ * @brief Releases the references to the FreeType face and library taken by a cairo font face.
+ *
+ * Cairo may keep the font face alive after the cache releases it, so each cairo font face owns a reference to both.
+ *
+ * @param[in] data The FreeType face.
+ */
+void DestroyFreeTypeFace( void* data )
+{
+  FT_Face face = static_cast<FT_Face>( data );
+  FT_Library library = face->glyph->library;
+
+  FT_Done_Face( face );
+  FT_Done_Library( library );
+}
+
+/**
+ * @brief Retrieves the exponent of the power of two equal or greater than the given size.
+ *
+ * @param[in] size The size.
+ *
+ * @return The exponent. Never less than MINIMUM_SURFACE_SIZE_SHIFT.
+ */
+uint32_t GetSizeClass( unsigned int size )
+{
+  uint32_t shift = MINIMUM_SURFACE_SIZE_SHIFT;
+  while( ( 1u << shift ) < size )
+  {
+    ++shift;
+  }
+  return shift;
+}
+
+} // namespace
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+CairoRendererCache::CairoRendererCache()
+: mFreeTypeLibrary( nullptr ),
+  mFontFaces(),
+  mSurfaces(),
+  mGlyphs(),
+  mFontOptions( nullptr ),
+  mUseCount( 0u )
+{
+  int error = FT_New_Library( &gFreeTypeMemory, &mFreeTypeLibrary );
+  if( FT_Err_Ok != error )
+  {
+    DALI_LOG_ERROR( "FreeType Init error: %d\n", error );
+    mFreeTypeLibrary = nullptr;
+    return;
+  }
+
+  FT_Add_Default_Modules( mFreeTypeLibrary );
+}
+
+CairoRendererCache::~CairoRendererCache()
+{
+  Clear();
+
+  if( nullptr != mFreeTypeLibrary )
+  {
+    // The library is freed once the last cairo font face releases its reference.
+    FT_Done_Library( mFreeTypeLibrary );
+  }
+}
+
+CairoRendererCache::FontFaceCacheItem* CairoRendererCache::GetFontFace( const FontPath& path, bool synthesizeBold )
+{
+  std::unordered_map<std::string, FontFaceCacheItem*>& fontFaces = mFontFaces[synthesizeBold ? 1u : 0u];
+
+  auto it = fontFaces.find( path );
+  if( it != fontFaces.end() )
+  {
+    it->second->lastUsed = ++mUseCount;
+    return it->second;
+  }
+
+  if( nullptr == mFreeTypeLibrary )
+  {
+    return nullptr;
+  }
+
+  FT_Face freeTypeFace = nullptr;
+  int error = FT_New_Face( mFreeTypeLibrary, path.c_str(), 0u, &freeTypeFace );
+  if( FT_Err_Ok != error )
+  {
+    DALI_LOG_ERROR( "Error in FT while creating a new face. path : [%s], error : %d\n", path.c_str(), error );
+    return nullptr;
+  }
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "CairoRendererCache::GetFontFace. Opened : [%s], synthesize bold : %d\n", path.c_str(), synthesizeBold );
+
+  FontFaceCacheItem* fontFace = new FontFaceCacheItem();
+  fontFace->freeTypeFace = freeTypeFace;
+  fontFace->cairoFontFace = nullptr;
+  fontFace->lastUsed = ++mUseCount;
+  fontFace->synthesizeBold = synthesizeBold;
+
+  fontFaces[path] = fontFace;
+
+  return fontFace;
+}
+
+cairo_scaled_font_t* CairoRendererCache::GetScaledFont( FontFaceCacheItem& fontFace, double size, cairo_surface_t* surface )
+{
+  fontFace.lastUsed = ++mUseCount;
+
+  for( auto& item : fontFace.scaledFonts )
+  {
+    if( size == item.size )
+    {
+      item.lastUsed = mUseCount;
+      return item.scaledFont;
+    }
+  }
+
+  cairo_font_face_t*& cairoFontFace = fontFace.cairoFontFace;
+  if( nullptr == cairoFontFace )
+  {
+    // The cairo font face keeps its own references to the FreeType face and library.
+    FT_Reference_Face( fontFace.freeTypeFace );
+    FT_Reference_Library( mFreeTypeLibrary );
+
+    cairoFontFace = cairo_ft_font_face_create_for_ft_face( fontFace.freeTypeFace, FONT_FACE_LOAD_FLAGS );
+
+    const cairo_status_t status = cairo_font_face_set_user_data( cairoFontFace, &FREETYPE_FACE_KEY, fontFace.freeTypeFace, DestroyFreeTypeFace );
+    if( CAIRO_STATUS_SUCCESS != status )
+    {
+      DALI_LOG_ERROR( "Failed to load the Freetype Font\n" );
+
+      cairo_font_face_destroy( cairoFontFace );
+      cairoFontFace = nullptr;
+      DestroyFreeTypeFace( fontFace.freeTypeFace );
+      return nullptr;
+    }
+
+    cairo_ft_font_face_set_synthesize( cairoFontFace, fontFace.synthesizeBold ? CAIRO_FT_SYNTHESIZE_BOLD : 0u );
+  }
+
+  if( nullptr == mFontOptions )
+  {
+    // All the text is rendered to image surfaces which share the same default font options.
+    mFontOptions = cairo_font_options_create();
+    cairo_surface_get_font_options( surface, mFontOptions );
+  }
+
+  cairo_matrix_t fontMatrix;
+  cairo_matrix_init_scale( &fontMatrix, size, size );
+
+  cairo_matrix_t ctm;
+  cairo_matrix_init_identity( &ctm );
+
+  cairo_scaled_font_t* scaledFont = cairo_scaled_font_create( cairoFontFace, &fontMatrix, &ctm, mFontOptions );
+  if( CAIRO_STATUS_SUCCESS != cairo_scaled_font_status( scaledFont ) )
+  {
+    DALI_LOG_ERROR( "Failed to create a cairo scaled font\n" );
+
+    cairo_scaled_font_destroy( scaledFont );
+    return nullptr;
+  }
+
+  fontFace.scaledFonts.push_back( { size, scaledFont, mUseCount } );
+
+  return scaledFont;
+}
+
+cairo_surface_t* CairoRendererCache::GetCircularSurface( unsigned int width, unsigned int height )
+{
+  const uint32_t widthClass = GetSizeClass( width );
+  const uint32_t heightClass = GetSizeClass( height );
+  const uint32_t key = ( widthClass << 16u ) | heightClass;
+
+  auto it = mSurfaces.find( key );
+  if( it != mSurfaces.end() )
+  {
+    it->second.lastUsed = ++mUseCount;
+    return it->second.surface;
+  }
+
+  cairo_surface_t* surface = cairo_image_surface_create( CAIRO_FORMAT_A8, 1 << widthClass, 1 << heightClass );
+  if( CAIRO_STATUS_SUCCESS != cairo_surface_status( surface ) )
+  {
+    cairo_surface_destroy( surface );
+    return nullptr;
+  }
+
+  mSurfaces[key] = { surface, ++mUseCount };
+
+  return surface;
+}
+
+cairo_glyph_t* CairoRendererCache::GetGlyphBuffer( Length numberOfGlyphs )
+{
+  if( mGlyphs.size() < numberOfGlyphs )
+  {
+    mGlyphs.resize( numberOfGlyphs );
+  }
+
+  return mGlyphs.data();
+}
+
+void CairoRendererCache::Trim()
+{
+  // The least recently used scaled fonts of each face.
+  std::vector<FontFaceCacheItem*> fontFaces;
+  for( auto& map : mFontFaces )
+  {
+    for( auto& item : map )
+    {
+      FontFaceCacheItem* fontFace = item.second;
+      std::vector<ScaledFontCacheItem>& scaledFonts = fontFace->scaledFonts;
+      if( scaledFonts.size() > MAXIMUM_NUMBER_OF_SCALED_FONTS )
+      {
+        std::sort( scaledFonts.begin(), scaledFonts.end(), []( const ScaledFontCacheItem& lhs, const ScaledFontCacheItem& rhs ) { return lhs.lastUsed > rhs.lastUsed; } );
+        for( auto it = scaledFonts.begin() + MAXIMUM_NUMBER_OF_SCALED_FONTS; it != scaledFonts.end(); ++it )
+        {
+          cairo_scaled_font_destroy( it->scaledFont );
+        }
+        scaledFonts.resize( MAXIMUM_NUMBER_OF_SCALED_FONTS );
+      }
+      fontFaces.push_back( fontFace );
+    }
+  }
+
+  // The least recently used font faces.
+  if( fontFaces.size() > MAXIMUM_NUMBER_OF_FONT_FACES )
+  {
+    std::sort( fontFaces.begin(), fontFaces.end(), []( const FontFaceCacheItem* lhs, const FontFaceCacheItem* rhs ) { return lhs->lastUsed > rhs->lastUsed; } );
+    const uint32_t oldestUse = fontFaces[MAXIMUM_NUMBER_OF_FONT_FACES - 1u]->lastUsed;
+
+    for( auto& map : mFontFaces )
+    {
+      for( auto it = map.begin(); it != map.end(); )
+      {
+        if( it->second->lastUsed < oldestUse )
+        {
+          DALI_LOG_INFO( gLogFilter, Debug::General, "CairoRendererCache::Trim. Closed : [%s], synthesize bold : %d\n", it->first.c_str(), it->second->synthesizeBold );
+
+          DestroyFontFace( it->second );
+          it = map.erase( it );
+        }
+        else
+        {
+          ++it;
+        }
+      }
+    }
+  }
+
+  // The least recently used surfaces.
+  while( mSurfaces.size() > MAXIMUM_NUMBER_OF_SURFACES )
+  {
+    auto oldest = std::min_element( mSurfaces.begin(), mSurfaces.end(), []( const std::pair<const uint32_t, SurfaceCacheItem>& lhs, const std::pair<const uint32_t, SurfaceCacheItem>& rhs ) { return lhs.second.lastUsed < rhs.second.lastUsed; } );
+    cairo_surface_destroy( oldest->second.surface );
+    mSurfaces.erase( oldest );
+  }
+
+  if( mGlyphs.size() > MAXIMUM_NUMBER_OF_GLYPHS )
+  {
+    std::vector<cairo_glyph_t>().swap( mGlyphs );
+  }
+}
+
+void CairoRendererCache::Clear()
+{
+  for( auto& fontFaces : mFontFaces )
+  {
+    for( auto& item : fontFaces )
+    {
+      DestroyFontFace( item.second );
+    }
+    fontFaces.clear();
+  }
+
+  for( auto& item : mSurfaces )
+  {
+    cairo_surface_destroy( item.second.surface );
+  }
+  mSurfaces.clear();
+
+  std::vector<cairo_glyph_t>().swap( mGlyphs );
+
+  if( nullptr != mFontOptions )
+  {
+    cairo_font_options_destroy( mFontOptions );
+    mFontOptions = nullptr;
+  }
+}
+
+void CairoRendererCache::DestroyFontFace( FontFaceCacheItem* fontFace )
+{
+  for( auto& scaledFontItem : fontFace->scaledFonts )
+  {
+    cairo_scaled_font_destroy( scaledFontItem.scaledFont );
+  }
+
+  if( nullptr != fontFace->cairoFontFace )
+  {
+    // The FreeType face is closed once cairo releases the font face.
+    cairo_font_face_destroy( fontFace->cairoFontFace );
+  }
+
+  FT_Done_Face( fontFace->freeTypeFace );
+  delete fontFace;
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
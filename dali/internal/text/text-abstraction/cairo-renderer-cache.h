@@ -0,0 +1,190 @@
+#ifndef DALI_INTERNAL_TEXT_ABSTRACTION_CAIRO_RENDERER_CACHE_H
+#define DALI_INTERNAL_TEXT_ABSTRACTION_CAIRO_RENDERER_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/font-list.h>
+#include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+
+// EXTERNAL INCLUDES
+#include <cairo.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Caches the resources used by the cairo text renderer between renders.
+ *
+ * - The FreeType faces, opened once per font file.
+ * - The cairo font faces created from them and the cairo scaled fonts for each size.
+ * - The surfaces used to lay out circular text, pooled by size class.
+ * - The scratch buffer used to convert DALi glyphs into cairo glyphs.
+ *
+ * The FreeType faces are not the ones of the font client as cairo changes the size and the transform of the faces it uses.
+ * They are keyed by the font's path retrieved from the font client, so they remain valid if the font client's cache is cleared.
+ *
+ * The number of font faces, scaled fonts and surfaces is bounded. The least recently used ones are evicted by Trim(),
+ * which is called after each render as the resources returned during a render must remain valid until it finishes.
+ */
+class CairoRendererCache
+{
+public:
+
+  /**
+   * @brief A cairo scaled font of a font face.
+   */
+  struct ScaledFontCacheItem
+  {
+    double size;                     ///< The size of the font in pixels.
+    cairo_scaled_font_t* scaledFont; ///< The cairo scaled font.
+    uint32_t lastUsed;               ///< When the scaled font was last retrieved.
+  };
+
+  /**
+   * @brief A font face opened by the renderer.
+   *
+   * Cairo shares the font faces created for the same FreeType face, so the faces with bold synthesis are opened apart.
+   */
+  struct FontFaceCacheItem
+  {
+    FT_Face freeTypeFace;                         ///< The FreeType face.
+    cairo_font_face_t* cairoFontFace;             ///< The cairo font face. Created on demand.
+    std::vector<ScaledFontCacheItem> scaledFonts; ///< The scaled fonts created for this face.
+    uint32_t lastUsed;                            ///< When the face or one of its scaled fonts was last retrieved.
+    bool synthesizeBold;                          ///< Whether cairo synthesizes the bold style.
+  };
+
+  /**
+   * @brief A surface to lay out circular text.
+   */
+  struct SurfaceCacheItem
+  {
+    cairo_surface_t* surface; ///< The A8 surface.
+    uint32_t lastUsed;        ///< When the surface was last retrieved.
+  };
+
+  /**
+   * @brief Default constructor.
+   */
+  CairoRendererCache();
+
+  /**
+   * @brief Destructor.
+   */
+  ~CairoRendererCache();
+
+  /**
+   * @brief Retrieves the font face for the given font file. Opens the file the first time it's requested.
+   *
+   * @param[in] path The path to the font file.
+   * @param[in] synthesizeBold Whether the bold style has to be synthesized.
+   *
+   * @return The font face or @e nullptr if FreeType fails to open it.
+   */
+  FontFaceCacheItem* GetFontFace( const FontPath& path, bool synthesizeBold );
+
+  /**
+   * @brief Retrieves the cairo scaled font for the given face and size. Creates it if it doesn't exist.
+   *
+   * @param[in] fontFace The font face.
+   * @param[in] size The size of the font in pixels.
+   * @param[in] surface The surface the text is rendered to. Used to retrieve the font options when the first scaled font is created.
+   *
+   * @return The scaled font or @e nullptr if cairo fails to create it.
+   */
+  cairo_scaled_font_t* GetScaledFont( FontFaceCacheItem& fontFace, double size, cairo_surface_t* surface );
+
+  /**
+   * @brief Retrieves an A8 surface to lay out circular text.
+   *
+   * The size of the surface is rounded up to the next power of two, so surfaces are reused between texts with similar sizes.
+   * The content of the surface is undefined.
+   *
+   * @param[in] width The minimum width of the surface.
+   * @param[in] height The minimum height of the surface.
+   *
+   * @return The surface. It's owned by the cache.
+   */
+  cairo_surface_t* GetCircularSurface( unsigned int width, unsigned int height );
+
+  /**
+   * @brief Retrieves a buffer with space for the given number of cairo glyphs.
+   *
+   * @param[in] numberOfGlyphs The number of glyphs.
+   *
+   * @return A pointer to the first glyph. It's valid until the next call.
+   */
+  cairo_glyph_t* GetGlyphBuffer( Length numberOfGlyphs );
+
+  /**
+   * @brief Destroys the least recently used font faces, scaled fonts and surfaces above the bounds of the cache.
+   *
+   * @note The resources retrieved before are no longer valid.
+   */
+  void Trim();
+
+  /**
+   * @brief Destroys all the cached resources, e.g. when the memory is low.
+   *
+   * @note The resources retrieved before are no longer valid.
+   */
+  void Clear();
+
+private:
+
+  /**
+   * @brief Destroys a font face and its scaled fonts.
+   *
+   * @param[in] fontFace The font face.
+   */
+  void DestroyFontFace( FontFaceCacheItem* fontFace );
+
+  // Declared private and left undefined to avoid copies.
+  CairoRendererCache( const CairoRendererCache& );
+  // Declared private and left undefined to avoid copies.
+  CairoRendererCache& operator=( const CairoRendererCache& );
+
+private:
+
+  FT_Library mFreeTypeLibrary;                                        ///< A handle to a FreeType library instance.
+  std::unordered_map<std::string, FontFaceCacheItem*> mFontFaces[2u]; ///< Maps the path of a font file to its face. Without and with bold synthesis.
+  std::unordered_map<uint32_t, SurfaceCacheItem> mSurfaces;           ///< Maps a size class to a surface for circular text.
+  std::vector<cairo_glyph_t> mGlyphs;                                 ///< Scratch buffer for the cairo glyphs.
+  cairo_font_options_t* mFontOptions;                                 ///< The font options used to create the scaled fonts.
+  uint32_t mUseCount;                                                 ///< Incremented each time a resource is retrieved. Orders the resources by use.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TEXT_ABSTRACTION_CAIRO_RENDERER_CACHE_H
@@ -22,8 +22,13 @@
 #include <dali/public-api/common/constants.h>
 #include <cairo.h>
 #include <cairo-ft.h>
+#include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -32,11 +37,14 @@
 #include FT_STROKER_H
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/worker-thread-pool.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
 #include <dali/devel-api/text-abstraction/text-renderer-layout-helper.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/imaging/common/image-operations.h>
+#include <dali/internal/text/text-abstraction/cairo-renderer-cache.h>
 #include <dali/internal/text/text-abstraction/font-client-impl.h>
+#include <dali/internal/thread/common/worker-thread-pool-impl.h>
 
 using namespace std;
 
@@ -46,6 +54,8 @@ namespace
 const float TO_FLOAT = 1.f / 255.f;
 const float TO_UCHAR = 255.f;
 const float TWO_PI = 2.f * Dali::Math::PI; ///< 360 degrees in radians
+const unsigned int MINIMUM_TILE_HEIGHT = 64u; ///< Texts are not split in tiles with less rows.
+const double TILE_MARGIN_FACTOR = 0.25; ///< Factor applied to the font size to enlarge the vertical extent of the glyphs when they are assigned to tiles.
 
 /**
  * @brief Run of glyphs that have the same style.
@@ -63,7 +73,7 @@ struct GlyphRun
     isBoldRequired{ false }
   {}
 
-  FT_Face      fontFace;           ///< The font face used by the glyphs in the run.
+  Dali::TextAbstraction::Internal::CairoRendererCache::FontFaceCacheItem* fontFace; ///< The font face used by the glyphs in the run.
   double       fontSize;           ///< The font size used by the glyphs in the run. According the Cairo's documentation this is in user space units. It works if I set the size in pixels.
   unsigned int glyphIndex;         ///< Index to the first glyph of the run.
   unsigned int numberOfGlyphs;     ///< Number of glyphs in the run.
@@ -232,7 +242,7 @@ namespace
 /**
  * @brief Converts the size so that it can be used by Cairo
  * @param[in] fontClient A reference to the font client
- * @param[in] ftLibrary A reference to the Freetype library instance
+ * @param[in,out] cache The cache with the font faces opened by the renderer
  * @param[in] numberOfGlyphs The total number of glyphs
  * @param[in] daliGlyphsBuffer A pointer to the glyphs buffer
  * @param[in] colorIndicesBuffer A pointer to the color indices buffer
@@ -240,7 +250,7 @@ namespace
  */
 bool ConvertSizeForCairo(
     TextAbstraction::FontClient& fontClient,
-    FT_Library& ftLibrary,
+    CairoRendererCache& cache,
     const unsigned int numberOfGlyphs,
     const GlyphInfo* const daliGlyphsBuffer,
     const ColorIndex* const colorIndicesBuffer,
@@ -258,6 +268,8 @@ bool ConvertSizeForCairo(
 
   const double FROM_26_DOT_6_TO_PIXELS = dVerticalDpi / ( 64.0 * 72.0 );
 
+  // Reused for all the runs so the path's string is allocated once.
+  FontDescription fontDescription;
 
   GlyphRun currentGlyphRun;
   currentGlyphRun.fontId = 0u;
@@ -297,23 +309,30 @@ bool ConvertSizeForCairo(
       if( 0u != fontId )
       {
         // Get the font's path file name from the font Id.
-        FontDescription fontDescription;
         fontClient.GetDescription( fontId, fontDescription );
 
         switch( fontDescription.type )
         {
           case FontDescription::FACE_FONT:
           {
-            // Create a FreeType font's face.
-            auto error = FT_New_Face( ftLibrary, fontDescription.path.c_str(), 0u, &currentGlyphRun.fontFace );
-            if( error )
+            // Retrieve the FreeType font's face. The file is opened only the first time it's used.
+            currentGlyphRun.fontFace = cache.GetFontFace( fontDescription.path, false );
+            if( nullptr == currentGlyphRun.fontFace )
             {
-              DALI_LOG_ERROR( "Error in FT while creating a new face\n" );
-
               // Error so just return false
               return false;
             }
 
+            if( isBoldRequired && !( currentGlyphRun.fontFace->freeTypeFace->style_flags & FT_STYLE_FLAG_BOLD ) )
+            {
+              // The bold style is synthesized by cairo.
+              currentGlyphRun.fontFace = cache.GetFontFace( fontDescription.path, true );
+              if( nullptr == currentGlyphRun.fontFace )
+              {
+                return false;
+              }
+            }
+
             // Set the font's size. It needs to be set in the Freetype font and in the Cairo's context.
             unsigned int fontSize = fontClient.GetPointSize( fontId );
 
@@ -534,11 +553,64 @@ void CopyImageToSurface(
   } // for height
 }
 
+/**
+ * @brief Shows the glyphs of a run with the current font of the cairo context.
+ * @param[in,out] cr The cairo context
+ * @param[in] run The glyph-run
+ * @param[in] cairoGlyphsBuffer The cairo glyphs buffer. Used to calculate the offset of the italic synthesis for the whole run
+ * @param[in] glyphsBuffer The glyphs to be shown. All the glyphs of the run or a subset of them
+ * @param[in] numberOfGlyphs The number of glyphs to be shown
+ * @param[in] synthesizeItalic Whether the italic style is synthesized
+ */
+void ShowGlyphs(
+    cairo_t* cr,
+    const GlyphRun& run,
+    const cairo_glyph_t* const cairoGlyphsBuffer,
+    const cairo_glyph_t* const glyphsBuffer,
+    const unsigned int numberOfGlyphs,
+    const bool synthesizeItalic)
+{
+  cairo_matrix_t currentMatrix;
+
+  if( synthesizeItalic )
+  {
+    // Apply a shear transform to synthesize the italics.
+    // For a reason Cairo may trim some glyphs if the CAIRO_FT_SYNTHESIZE_OBLIQUE flag is used.
+
+    // This is to calculate an offset used to compensate the 'translation' done by the shear transform
+    // as it's done for the whole render buffer.
+    double maxY = 0.0;
+    for( unsigned int index = run.glyphIndex, endIndex = run.glyphIndex + run.numberOfGlyphs; index < endIndex; ++index )
+    {
+      maxY = std::max( maxY, (*( cairoGlyphsBuffer + index )).y );
+    }
+
+    cairo_matrix_t matrix;
+    cairo_matrix_init( &matrix,
+                                                                            1.0, 0.0,
+                             -TextAbstraction::FontClient::DEFAULT_ITALIC_ANGLE, 1.0,
+                       maxY * TextAbstraction::FontClient::DEFAULT_ITALIC_ANGLE, 0.0 );
+
+    cairo_get_matrix( cr, &currentMatrix );
+    cairo_transform( cr, &matrix );
+  }
+
+  cairo_show_glyphs( cr, glyphsBuffer, numberOfGlyphs );
+
+  if( synthesizeItalic )
+  {
+    // Restore the transform matrix.
+    cairo_set_matrix( cr, &currentMatrix );
+  }
+}
+
 /**
  * @brief Renders the glyph
  * @param[in] parameters The text renderer parameters
  * @param[in] run The current glyph-run
  * @param[in] cairoGlyphsBuffer The cairo glyphs buffer
+ * @param[in,out] cache The cache with the cairo fonts
+ * @param[in] surface The surface the text is rendered to
  * @param[in/out] cr The cairo surface
  * @param[in/out] circularCr The cairo surface if using circular text
  * @param[in] isCircularText Whether we're using circular text or not
@@ -548,6 +620,8 @@ void RenderGlyphs(
     const TextAbstraction::TextRenderer::Parameters& parameters,
     const GlyphRun& run,
     cairo_glyph_t*& cairoGlyphsBuffer,
+    CairoRendererCache& cache,
+    cairo_surface_t* surface,
     cairo_t*& cr,
     cairo_t*& circularCr,
     const bool isCircularText,
@@ -562,41 +636,17 @@ void RenderGlyphs(
                          static_cast<double>( color.r ),
                          static_cast<double>( color.a ) );
 
-  // Create the Cairo's font from the FreeType font.
-  int options = 0;
-  options = CAIRO_HINT_STYLE_SLIGHT;
-  std::unique_ptr<cairo_font_face_t, void(*)(cairo_font_face_t*)> fontFacePtr( cairo_ft_font_face_create_for_ft_face( run.fontFace, options ), cairo_font_face_destroy );
-  cairo_font_face_t* fontFace = fontFacePtr.get();
-
-  static const cairo_user_data_key_t key = { 0 };
-  cairo_status_t status = cairo_font_face_set_user_data( fontFace, &key, run.fontFace, reinterpret_cast<cairo_destroy_func_t>( FT_Done_Face ) );
-  if( status )
+  // Retrieve the Cairo's font created from the FreeType font. It's created only the first time the font and size are used.
+  cairo_scaled_font_t* scaledFont = cache.GetScaledFont( *run.fontFace, run.fontSize, surface );
+  if( nullptr == scaledFont )
   {
-    cairo_font_face_destroy( fontFace );
+    return;
   }
 
-  unsigned int ftSynthesizeFlag = 0u;
-  if( run.isBoldRequired && !( run.fontFace->style_flags & FT_STYLE_FLAG_BOLD ) )
-  {
-    ftSynthesizeFlag |= CAIRO_FT_SYNTHESIZE_BOLD;
-  }
-
-  cairo_ft_font_face_set_synthesize( fontFace, ftSynthesizeFlag );
-
-  cairo_font_face_reference( fontFace );
-
-  const bool synthesizeItalic = ( run.isItalicRequired && !( run.fontFace->style_flags & FT_STYLE_FLAG_ITALIC ) );
-
-  if( CAIRO_STATUS_SUCCESS != cairo_font_face_status( fontFace ) )
-  {
-    DALI_LOG_ERROR( "Failed to load the Freetype Font\n" );
-  }
-
-  // Sets the font.
-  cairo_set_font_face( isCircularText ? circularCr : cr, fontFace );
+  const bool synthesizeItalic = ( run.isItalicRequired && !( run.fontFace->freeTypeFace->style_flags & FT_STYLE_FLAG_ITALIC ) );
 
-  // Sets the size
-  cairo_set_font_size( isCircularText ? circularCr : cr, run.fontSize );
+  // Sets the font and its size.
+  cairo_set_scaled_font( isCircularText ? circularCr : cr, scaledFont );
 
   // Render the glyphs.
   if( isCircularText )
@@ -619,45 +669,333 @@ void RenderGlyphs(
   }
   else
   {
-    if( synthesizeItalic )
+    ShowGlyphs( cr, run, cairoGlyphsBuffer, cairoGlyphsBuffer + run.glyphIndex, run.numberOfGlyphs, synthesizeItalic );
+
+    cairo_fill( cr );
+  }
+}
+
+/**
+ * @brief A horizontal band of the pixel buffer rasterized on its own thread.
+ */
+struct TextTile
+{
+  unsigned int top;                    ///< The first row of the tile.
+  unsigned int height;                 ///< The number of rows of the tile.
+  std::vector<cairo_glyph_t> glyphs;   ///< The glyphs which may cover the tile, in the order of the runs.
+  std::vector<unsigned int> runGlyphs; ///< The number of glyphs of each run which may cover the tile.
+  bool success;                        ///< Whether the tile has been rasterized.
+};
+
+/**
+ * @brief Retrieves the number of tiles the text is split into.
+ *
+ * Circular text and text with emojis or bitmap fonts is rasterized on the calling thread
+ * as it uses the font client to create the bitmaps and it's not thread safe.
+ *
+ * @param[in] parameters The text renderer parameters
+ * @param[in] isCircularText Whether we're using circular text or not
+ * @param[in] glyphRuns The runs of glyphs
+ *
+ * @return The number of tiles. One if the text is rasterized on the calling thread.
+ */
+unsigned int GetNumberOfTiles(
+    const TextAbstraction::TextRenderer::Parameters& parameters,
+    const bool isCircularText,
+    const std::vector<GlyphRun>& glyphRuns)
+{
+  if( ( parameters.maximumNumberOfTiles < 2u ) || isCircularText )
+  {
+    return 1u;
+  }
+
+  unsigned int numberOfTiles = std::min( parameters.maximumNumberOfTiles, parameters.height / MINIMUM_TILE_HEIGHT );
+
+  // The worker threads of the adaptor plus the calling thread, or one thread per core without adaptor.
+  const unsigned int numberOfWorkers = Dali::WorkerThreadPool::GetNumberOfThreads();
+  const unsigned int concurrency = ( 0u != numberOfWorkers ) ? numberOfWorkers + 1u : std::thread::hardware_concurrency();
+  if( 0u != concurrency )
+  {
+    numberOfTiles = std::min( numberOfTiles, concurrency );
+  }
+
+  if( numberOfTiles < 2u )
+  {
+    return 1u;
+  }
+
+  for( const auto& run : glyphRuns )
+  {
+    if( parameters.isEmoji[run.glyphIndex] || ( nullptr == run.fontFace ) )
+    {
+      return 1u;
+    }
+  }
+
+  return numberOfTiles;
+}
+
+/**
+ * @brief Rasterizes the glyphs which cover a tile into its rows of the pixel buffer.
+ *
+ * The tile's cairo context is translated so the glyphs are rasterized at the same pixel positions than
+ * when the whole text is rasterized at once. Glyphs not covering the tile don't modify its pixels so they are skipped.
+ *
+ * @param[in] parameters The text renderer parameters
+ * @param[in] glyphRuns The runs of glyphs
+ * @param[in] scaledFonts The cairo font of each run
+ * @param[in] cairoGlyphsBuffer The cairo glyphs buffer
+ * @param[in] daliGlyphsBuffer A pointer to the glyphs buffer
+ * @param[in] buffer The pixel buffer
+ * @param[in] cairoFormat The format of the pixel buffer
+ * @param[in] stride The number of bytes of a row of the pixel buffer
+ * @param[in,out] tile The tile
+ */
+void RenderTile(
+    const TextAbstraction::TextRenderer::Parameters& parameters,
+    const std::vector<GlyphRun>& glyphRuns,
+    const std::vector<cairo_scaled_font_t*>& scaledFonts,
+    const cairo_glyph_t* const cairoGlyphsBuffer,
+    const GlyphInfo* const daliGlyphsBuffer,
+    unsigned char* buffer,
+    const cairo_format_t cairoFormat,
+    const int stride,
+    TextTile& tile)
+{
+  tile.success = false;
+
+  // Select the glyphs which may cover the tile. Their vertical extent is enlarged by a margin as cairo may embolden them.
+  const double tileTop = static_cast<double>( tile.top );
+  const double tileBottom = static_cast<double>( tile.top + tile.height );
+
+  tile.glyphs.clear();
+  tile.runGlyphs.clear();
+  for( const auto& run : glyphRuns )
+  {
+    const double margin = TILE_MARGIN_FACTOR * run.fontSize + 1.0;
+
+    unsigned int numberOfGlyphs = 0u;
+    for( unsigned int index = run.glyphIndex, endIndex = run.glyphIndex + run.numberOfGlyphs; index < endIndex; ++index )
     {
-      // Apply a shear transform to synthesize the italics.
-      // For a reason Cairo may trim some glyphs if the CAIRO_FT_SYNTHESIZE_OBLIQUE flag is used.
+      const cairo_glyph_t& glyph = *( cairoGlyphsBuffer + index );
+      const GlyphInfo& daliGlyph = *( daliGlyphsBuffer + index );
 
-      // This is to calculate an offset used to compensate the 'translation' done by the shear transform
-      // as it's done for the whole render buffer.
-      double maxY = 0.0;
-      for( unsigned int index = run.glyphIndex, endIndex = run.glyphIndex + run.numberOfGlyphs; index < endIndex; ++index )
+      const double glyphTop = glyph.y - static_cast<double>( daliGlyph.yBearing ) - margin;
+      const double glyphBottom = glyph.y - static_cast<double>( daliGlyph.yBearing ) + static_cast<double>( daliGlyph.height ) + margin;
+
+      if( ( glyphBottom > tileTop ) && ( glyphTop < tileBottom ) )
       {
-        maxY = std::max( maxY, (*( cairoGlyphsBuffer + index )).y );
+        tile.glyphs.push_back( glyph );
+        ++numberOfGlyphs;
       }
+    }
+    tile.runGlyphs.push_back( numberOfGlyphs );
+  }
+
+  std::unique_ptr<cairo_surface_t, void(*)(cairo_surface_t*)> surfacePtr( cairo_image_surface_create_for_data( buffer + tile.top * stride,
+                                                                                                               cairoFormat,
+                                                                                                               parameters.width,
+                                                                                                               tile.height,
+                                                                                                               stride ),
+                                                                          cairo_surface_destroy );
+  cairo_surface_t* surface = surfacePtr.get();
 
-      cairo_matrix_t matrix;
-      cairo_matrix_init( &matrix,
-                                                                              1.0, 0.0,
-                               -TextAbstraction::FontClient::DEFAULT_ITALIC_ANGLE, 1.0,
-                         maxY * TextAbstraction::FontClient::DEFAULT_ITALIC_ANGLE, 0.0 );
+  if( ( nullptr == surface ) || ( CAIRO_STATUS_SUCCESS != cairo_surface_status( surface ) ) )
+  {
+    return;
+  }
 
-      cairo_transform( cr, &matrix );
+  std::unique_ptr<cairo_t, void(*)(cairo_t*)> crPtr( cairo_create( surface ), cairo_destroy );
+  cairo_t* cr = crPtr.get();
+
+  if( CAIRO_STATUS_SUCCESS != cairo_status( cr ) )
+  {
+    return;
+  }
+
+  cairo_translate( cr, 0.0, -tileTop );
+
+  const cairo_glyph_t* tileGlyphsBuffer = tile.glyphs.data();
+  for( unsigned int runIndex = 0u, numberOfRuns = glyphRuns.size(); runIndex < numberOfRuns; ++runIndex )
+  {
+    const GlyphRun& run = glyphRuns[runIndex];
+    const unsigned int numberOfGlyphs = tile.runGlyphs[runIndex];
+    if( 0u == numberOfGlyphs )
+    {
+      continue;
     }
 
-    cairo_show_glyphs( cr, ( cairoGlyphsBuffer + run.glyphIndex ), run.numberOfGlyphs );
+    // Sets the color. The color is actually BGRA
+    const Vector4& color = parameters.colors[run.colorIndex];
+
+    cairo_set_source_rgba( cr,
+                           static_cast<double>( color.b ),
+                           static_cast<double>( color.g ),
+                           static_cast<double>( color.r ),
+                           static_cast<double>( color.a ) );
+
+    cairo_set_scaled_font( cr, scaledFonts[runIndex] );
+
+    const bool synthesizeItalic = ( run.isItalicRequired && !( run.fontFace->freeTypeFace->style_flags & FT_STYLE_FLAG_ITALIC ) );
+
+    ShowGlyphs( cr, run, cairoGlyphsBuffer, tileGlyphsBuffer, numberOfGlyphs, synthesizeItalic );
+
+    tileGlyphsBuffer += numberOfGlyphs;
+  }
+
+  tile.success = true;
+}
+
+/**
+ * @brief The tiles rasterized by the worker threads of the adaptor.
+ */
+struct TileTasks
+{
+  const TextAbstraction::TextRenderer::Parameters& parameters;
+  const std::vector<GlyphRun>& glyphRuns;
+  const std::vector<cairo_scaled_font_t*>& scaledFonts;
+  const cairo_glyph_t* const cairoGlyphsBuffer;
+  const GlyphInfo* const daliGlyphsBuffer;
+  unsigned char* buffer;
+  const cairo_format_t cairoFormat;
+  const int stride;
+  std::mutex mutex;
+  std::condition_variable condition;  ///< Signalled when the last tile is rasterized.
+  unsigned int remaining;             ///< The number of tiles not rasterized yet. Protected by the mutex.
+};
+
+/**
+ * @brief A tile rasterized by a worker thread of the adaptor.
+ */
+struct TileTask
+{
+  /**
+   * @brief Rasterizes the tile and signals the calling thread if it's the last one.
+   */
+  void Run()
+  {
+    RenderTile( tasks->parameters, tasks->glyphRuns, tasks->scaledFonts, tasks->cairoGlyphsBuffer, tasks->daliGlyphsBuffer, tasks->buffer, tasks->cairoFormat, tasks->stride, *tile );
 
-    if( synthesizeItalic )
+    std::lock_guard<std::mutex> lock( tasks->mutex );
+    if( 0u == --tasks->remaining )
     {
-      // Restore the transform matrix to the identity.
-      cairo_matrix_t matrix;
-      cairo_matrix_init_identity( &matrix );
-      cairo_set_matrix( cr, &matrix );
+      tasks->condition.notify_one();
     }
+  }
 
-    cairo_fill( cr );
+  TileTasks* tasks;
+  TextTile* tile;
+};
+
+/**
+ * @brief Splits the pixel buffer in horizontal tiles and rasterizes them concurrently.
+ *
+ * @param[in] parameters The text renderer parameters
+ * @param[in] glyphRuns The runs of glyphs
+ * @param[in] cairoGlyphsBuffer The cairo glyphs buffer
+ * @param[in] daliGlyphsBuffer A pointer to the glyphs buffer
+ * @param[in,out] cache The cache with the cairo fonts
+ * @param[in] buffer The pixel buffer. Its pixels must be transparent
+ * @param[in] cairoFormat The format of the pixel buffer
+ * @param[in] stride The number of bytes of a row of the pixel buffer
+ * @param[in] numberOfTiles The number of tiles
+ *
+ * @return @e true if all the tiles have been rasterized.
+ */
+bool RenderTiles(
+    const TextAbstraction::TextRenderer::Parameters& parameters,
+    const std::vector<GlyphRun>& glyphRuns,
+    const cairo_glyph_t* const cairoGlyphsBuffer,
+    const GlyphInfo* const daliGlyphsBuffer,
+    CairoRendererCache& cache,
+    unsigned char* buffer,
+    const cairo_format_t cairoFormat,
+    const int stride,
+    const unsigned int numberOfTiles)
+{
+  // The cairo fonts are retrieved before the threads start as the cache is not thread safe.
+  // Cairo's scaled fonts can be shared by different threads.
+  std::unique_ptr<cairo_surface_t, void(*)(cairo_surface_t*)> surfacePtr( cairo_image_surface_create_for_data( buffer,
+                                                                                                               cairoFormat,
+                                                                                                               parameters.width,
+                                                                                                               parameters.height,
+                                                                                                               stride ),
+                                                                          cairo_surface_destroy );
+
+  std::vector<cairo_scaled_font_t*> scaledFonts;
+  scaledFonts.reserve( glyphRuns.size() );
+  for( const auto& run : glyphRuns )
+  {
+    cairo_scaled_font_t* scaledFont = cache.GetScaledFont( *run.fontFace, run.fontSize, surfacePtr.get() );
+    if( nullptr == scaledFont )
+    {
+      return false;
+    }
+    scaledFonts.push_back( scaledFont );
+  }
+
+  std::vector<TextTile> tiles( numberOfTiles );
+  const unsigned int tileHeight = parameters.height / numberOfTiles;
+  for( unsigned int index = 0u; index < numberOfTiles; ++index )
+  {
+    TextTile& tile = tiles[index];
+    tile.top = index * tileHeight;
+    tile.height = ( index + 1u == numberOfTiles ) ? parameters.height - tile.top : tileHeight;
+    tile.success = false;
+  }
+
+  // The last tile is rasterized on the calling thread, the others by the worker threads of the adaptor.
+  // A worker thread doesn't wait for other workers, it starts its own threads as the ones without adaptor.
+  TileTasks tasks{ parameters, glyphRuns, scaledFonts, cairoGlyphsBuffer, daliGlyphsBuffer, buffer, cairoFormat, stride, {}, {}, numberOfTiles - 1u };
+  std::vector<TileTask> tileTasks( numberOfTiles - 1u );
+  std::vector<std::thread> workers;
+  bool useWorkerThreadPool = ( nullptr == Dali::Internal::Adaptor::WorkerThreadPool::GetCurrent() );
+  for( unsigned int index = 0u; index < numberOfTiles - 1u; ++index )
+  {
+    TileTask& tileTask = tileTasks[index];
+    tileTask.tasks = &tasks;
+    tileTask.tile = &tiles[index];
+
+    if( useWorkerThreadPool )
+    {
+      CallbackBase* callback = MakeCallback( &tileTask, &TileTask::Run );
+      if( Dali::WorkerThreadPool::AddTask( callback, Dali::WorkerThreadPool::INTERACTIVE ) )
+      {
+        continue;
+      }
+
+      // No adaptor on this thread.
+      delete callback;
+      useWorkerThreadPool = false;
+    }
+
+    workers.emplace_back( &TileTask::Run, &tileTask );
+  }
+
+  RenderTile( parameters, glyphRuns, scaledFonts, cairoGlyphsBuffer, daliGlyphsBuffer, buffer, cairoFormat, stride, tiles.back() );
+
+  for( auto& worker : workers )
+  {
+    worker.join();
+  }
+
+  {
+    std::unique_lock<std::mutex> lock( tasks.mutex );
+    tasks.condition.wait( lock, [&tasks]() { return 0u == tasks.remaining; } );
   }
+
+  bool success = true;
+  for( const auto& tile : tiles )
+  {
+    success = success && tile.success;
+  }
+
+  return success;
 }
 
 } // unnamed namespace
 
-Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Parameters& parameters )
+Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Parameters& parameters, CairoRendererCache& cache )
 {
   const unsigned int numberOfGlyphs = parameters.glyphs.Count();
 
@@ -692,9 +1030,7 @@ Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Paramet
   const int strideWidth = stride / bpp;
 
   // Convert from DALi glyphs to Cairo glyphs.
-  std::vector<cairo_glyph_t> cairoGlyphs;
-  cairoGlyphs.resize( numberOfGlyphs );
-  cairo_glyph_t* cairoGlyphsBuffer = &cairoGlyphs[0u];
+  cairo_glyph_t* cairoGlyphsBuffer = cache.GetGlyphBuffer( numberOfGlyphs );
 
   const GlyphInfo* const daliGlyphsBuffer = parameters.glyphs.Begin();
   const Vector2* const positionsBuffer = parameters.positions.Begin();
@@ -714,21 +1050,11 @@ Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Paramet
   // Retrieve the FreeType fonts needed by Cairo from the font-client.
   Dali::TextAbstraction::FontClient fontClient = Dali::TextAbstraction::FontClient::Get();
 
-  FT_Library ftLibrary;
-  auto error = FT_Init_FreeType( &ftLibrary );
-  if( error )
-  {
-    DALI_LOG_ERROR( "Error initializing FT library\n" );
-
-    // return a pixel buffer with all pixels set to transparent.
-    return CreateVoidPixelBuffer( parameters );
-  }
-
   // Vector used to store the FreeType font faces, its size and the run of glyphs that use the font.
   std::vector<GlyphRun> glyphRuns;
   glyphRuns.reserve( 8u );
 
-  if( ! ConvertSizeForCairo(fontClient, ftLibrary, numberOfGlyphs, daliGlyphsBuffer, colorIndicesBuffer, glyphRuns) )
+  if( ! ConvertSizeForCairo(fontClient, cache, numberOfGlyphs, daliGlyphsBuffer, colorIndicesBuffer, glyphRuns) )
   {
     // return a pixel buffer with all pixels set to transparent.
     return CreateVoidPixelBuffer( parameters );
@@ -741,6 +1067,21 @@ Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Paramet
   const unsigned int bufferSize = stride * parameters.height;
   memset( buffer, 0, bufferSize );
 
+  // Whether the text is circular.
+  const bool isCircularText = 0u != parameters.radius;
+
+  const unsigned int numberOfTiles = GetNumberOfTiles( parameters, isCircularText, glyphRuns );
+  if( numberOfTiles > 1u )
+  {
+    if( RenderTiles( parameters, glyphRuns, cairoGlyphsBuffer, daliGlyphsBuffer, cache, buffer, cairoFormat, stride, numberOfTiles ) )
+    {
+      return pixelBuffer;
+    }
+
+    // Rasterize the text again on the calling thread.
+    memset( buffer, 0, bufferSize );
+  }
+
   std::unique_ptr<cairo_surface_t, void(*)(cairo_surface_t*)> surfacePtr( cairo_image_surface_create_for_data( buffer,
                                                                                                                cairoFormat,
                                                                                                                parameters.width,
@@ -756,9 +1097,6 @@ Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Paramet
     return CreateVoidPixelBuffer( parameters );
   }
 
-  // Whether the text is circular.
-  const bool isCircularText = 0u != parameters.radius;
-
   // Creates a surface for circular text.
   //
   // The reason to create a surface for circular text is that the strategy
@@ -768,17 +1106,14 @@ Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Paramet
   //
   // As the glyphs are laid out first in a straight line they may exceed the
   // boundaries of the surface in that case cairo ignores them.
-  std::unique_ptr<cairo_surface_t, void(*)(cairo_surface_t*)> circularSurfacePtr( nullptr, cairo_surface_destroy );
+  //
+  // The surface is only used to build the paths of the glyphs so it's retrieved from a pool.
   cairo_surface_t* circularSurface = nullptr;
   if( isCircularText )
   {
-    circularSurfacePtr.reset( cairo_surface_create_similar( surface,
-                                                            CAIRO_CONTENT_ALPHA,
-                                                            parameters.circularWidth,
-                                                            parameters.circularHeight ) );
-    circularSurface = circularSurfacePtr.get();
+    circularSurface = cache.GetCircularSurface( parameters.circularWidth, parameters.circularHeight );
 
-    if( ( nullptr == circularSurface ) || ( CAIRO_STATUS_SUCCESS != cairo_surface_status( circularSurface ) ) )
+    if( nullptr == circularSurface )
     {
       DALI_LOG_ERROR( "Failed to create a cairo's circular surface\n" );
 
@@ -969,7 +1304,7 @@ Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Paramet
     }
     else
     {
-      RenderGlyphs(parameters, run, cairoGlyphsBuffer, cr, circularCr, isCircularText, circularTextParameters);
+      RenderGlyphs(parameters, run, cairoGlyphsBuffer, cache, surface, cr, circularCr, isCircularText, circularTextParameters);
     }
   }
 
@@ -29,12 +29,18 @@ namespace TextAbstraction
 
 namespace Internal
 {
+
+class CairoRendererCache;
+
 /**
  * @brief Cairo implementation of the Dali::TextAbstraction::TextRenderer interface.
  *
  * @see Dali::TextAbstraction::TextRenderer.
+ *
+ * @param[in] parameters The text renderer parameters.
+ * @param[in,out] cache The fonts, surfaces and buffers reused between renders.
  */
-Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Parameters& parameters );
+Devel::PixelBuffer RenderTextCairo( const TextAbstraction::TextRenderer::Parameters& parameters, CairoRendererCache& cache );
 
 } // namespace Internal
 
@@ -208,6 +208,23 @@ FontId FontClient::FindFallbackFont( Character charcode,
                                     preferColor );
 }
 
+void FontClient::FindFallbackFonts( const Character* const text,
+                                    Length numberOfCharacters,
+                                    const FontDescription& preferredFontDescription,
+                                    PointSize26Dot6 requestedPointSize,
+                                    bool preferColor,
+                                    FontId* fontIds )
+{
+  CreatePlugin();
+
+  mPlugin->FindFallbackFonts( text,
+                              numberOfCharacters,
+                              preferredFontDescription,
+                              requestedPointSize,
+                              preferColor,
+                              fontIds );
+}
+
 bool FontClient::IsScalable( const FontPath& path )
 {
   CreatePlugin();
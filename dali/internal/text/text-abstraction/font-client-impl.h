@@ -135,6 +135,16 @@ public:
                            PointSize26Dot6 requestedPointSize,
                            bool preferColor );
 
+  /**
+   * @copydoc Dali::TextAbstraction::FontClient::FindFallbackFonts()
+   */
+  void FindFallbackFonts( const Character* const text,
+                          Length numberOfCharacters,
+                          const FontDescription& preferredFontDescription,
+                          PointSize26Dot6 requestedPointSize,
+                          bool preferColor,
+                          FontId* fontIds );
+
   /**
    * @copydoc Dali::TextAbstraction::FontClient::GetFontId( const FontPath& path, PointSize26Dot6 requestedPointSize, FaceIndex faceIndex )
    */
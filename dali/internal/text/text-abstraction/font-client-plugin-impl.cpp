@@ -25,6 +25,7 @@
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/platform-abstraction.h>
+#include <dali/integration-api/trace.h>
 #include <dali/internal/text/text-abstraction/font-client-helper.h>
 #include <dali/internal/imaging/common/image-operations.h>
 #include <dali/internal/adaptor/common/adaptor-impl.h>
@@ -32,6 +33,7 @@
 
 // EXTERNAL INCLUDES
 #include <fontconfig/fontconfig.h>
+#include <algorithm>
 
 namespace
 {
@@ -40,6 +42,8 @@ namespace
 Dali::Integration::Log::Filter* gLogFilter = Dali::Integration::Log::Filter::New(Debug::NoLogging, false, "LOG_FONT_CLIENT");
 #endif
 
+DALI_INIT_TRACE_FILTER( gTraceFilter, DALI_TRACE_FONT_LOADING, false );
+
 /**
  * Conversion from Fractional26.6 to float
  */
@@ -156,10 +160,68 @@ void DestroyCharacterSets( CharacterSetList& characterSets )
   }
 }
 
-FontClient::Plugin::FallbackCacheItem::FallbackCacheItem( FontDescription&& font, FontList* fallbackFonts, CharacterSetList* characterSets )
+/**
+ * @brief Loads a glyph with FreeType and stores its metrics in the given cache @p entry.
+ *
+ * @param[in] ftFace The FreeType face.
+ * @param[in] glyphIndex The index of the glyph within the face.
+ * @param[in] isEmboldeningRequired Whether the glyph needs to be emboldened by software.
+ * @param[out] entry The cache entry. Its state is set to LOAD_ERROR if FreeType fails to load the glyph.
+ */
+void LoadGlyphMetrics( FT_Face ftFace, GlyphIndex glyphIndex, bool isEmboldeningRequired, GlyphMetricsCache::Entry& entry )
+{
+  // FT_LOAD_DEFAULT causes some issues in the alignment of the glyph inside the bitmap.
+  // i.e. with the SNum-3R font.
+  // @todo: add an option to use the FT_LOAD_DEFAULT if required?
+  int error = FT_Load_Glyph( ftFace, glyphIndex, FT_LOAD_NO_AUTOHINT );
+
+  if( FT_Err_Ok != error )
+  {
+    entry.state = GlyphMetricsCache::LOAD_ERROR;
+    return;
+  }
+
+  // Keep the width of the glyph before doing the software emboldening.
+  // It will be used to calculate a scale factor to be applied to the
+  // advance as Harfbuzz doesn't apply any SW emboldening to calculate
+  // the advance of the glyph.
+  const float width = static_cast< float >( ftFace->glyph->metrics.width ) * FROM_266;
+
+  if( isEmboldeningRequired )
+  {
+    // Does the software bold.
+    FT_GlyphSlot_Embolden( ftFace->glyph );
+  }
+
+  const FT_Glyph_Metrics& metrics = ftFace->glyph->metrics;
+
+  entry.width = static_cast< float >( metrics.width ) * FROM_266;
+  entry.height = static_cast< float >( metrics.height ) * FROM_266;
+  entry.horizontalBearingX = static_cast< float >( metrics.horiBearingX ) * FROM_266;
+  entry.horizontalBearingY = static_cast< float >( metrics.horiBearingY ) * FROM_266;
+  entry.verticalBearingX = static_cast< float >( metrics.vertBearingX ) * FROM_266;
+  entry.verticalBearingY = static_cast< float >( metrics.vertBearingY ) * FROM_266;
+  entry.advanceScale = ( isEmboldeningRequired && !Dali::EqualsZero( width ) ) ? ( entry.width / width ) : 1.f;
+
+  FT_Glyph ftGlyph;
+  error = FT_Get_Glyph( ftFace->glyph, &ftGlyph );
+
+  FT_BBox bbox;
+  FT_Glyph_Get_CBox( ftGlyph, FT_GLYPH_BBOX_GRIDFIT, &bbox );
+
+  entry.boundingBoxHeight = ( bbox.yMax -  bbox.yMin ) * FROM_266;
+
+  // Created FT_Glyph object must be released with FT_Done_Glyph
+  FT_Done_Glyph( ftGlyph );
+
+  entry.state = GlyphMetricsCache::CACHED;
+}
+
+FontClient::Plugin::FallbackCacheItem::FallbackCacheItem( FontDescription&& font, FontList* fallbackFonts, CharacterSetList* characterSets, FontCoverageIndex* coverageIndex )
 : fontDescription{ std::move( font ) },
   fallbackFonts{ fallbackFonts },
-  characterSets{ characterSets }
+  characterSets{ characterSets },
+  coverageIndex{ coverageIndex }
 {
 }
 
@@ -197,6 +259,7 @@ FontClient::Plugin::FontFaceCacheItem::FontFaceCacheItem( FT_Face ftFace,
   mFaceIndex( face ),
   mMetrics( metrics ),
   mCharacterSet( nullptr ),
+  mGlyphMetricsCache( nullptr ),
   mFixedSizeIndex( 0 ),
   mFixedWidthPixels( 0.f ),
   mFixedHeightPixels( 0.f ),
@@ -222,6 +285,7 @@ FontClient::Plugin::FontFaceCacheItem::FontFaceCacheItem( FT_Face ftFace,
   mFaceIndex( face ),
   mMetrics( metrics ),
   mCharacterSet( nullptr ),
+  mGlyphMetricsCache( nullptr ),
   mFixedSizeIndex( fixedSizeIndex ),
   mFixedWidthPixels( fixedWidth ),
   mFixedHeightPixels( fixedHeight ),
@@ -240,6 +304,9 @@ FontClient::Plugin::Plugin( unsigned int horizontalDpi,
   mDefaultFontDescription(),
   mSystemFonts(),
   mDefaultFonts(),
+  mDefaultFontCharacterSets(),
+  mDefaultFontCoverageIndex(),
+  mFallbackCache(),
   mFontIdCache(),
   mFontFaceCache(),
   mValidatedFontCache(),
@@ -270,6 +337,7 @@ FontClient::Plugin::~Plugin()
   DestroyCharacterSets( mDefaultFontCharacterSets );
   DestroyCharacterSets( mCharacterSetCache );
   ClearCharacterSetFromFontFaceCache();
+  ClearGlyphMetricsFromFontFaceCache();
 
 #ifdef ENABLE_VECTOR_BASED_TEXT_RENDERING
   delete mVectorFontCache;
@@ -286,6 +354,7 @@ void FontClient::Plugin::ClearCache()
 
   DestroyCharacterSets( mDefaultFontCharacterSets );
   mDefaultFontCharacterSets.Clear();
+  mDefaultFontCoverageIndex.Clear();
 
   ClearFallbackCache( mFallbackCache );
   mFallbackCache.clear();
@@ -293,6 +362,7 @@ void FontClient::Plugin::ClearCache()
   mFontIdCache.Clear();
 
   ClearCharacterSetFromFontFaceCache();
+  ClearGlyphMetricsFromFontFaceCache();
   mFontFaceCache.clear();
 
   mValidatedFontCache.clear();
@@ -438,6 +508,9 @@ void FontClient::Plugin::GetDefaultPlatformFontDescription( FontDescription& fon
     mDefaultFontCharacterSets.Clear();
     mCharacterSetCache.Clear();
 
+    // The pages of the coverage indices refer to the character sets
+    mDefaultFontCoverageIndex.Clear();
+
     for( auto& item : mFallbackCache )
     {
       // Decrease the reference counter and eventually free the resources allocated by FcCharSet objects.
@@ -445,6 +518,11 @@ void FontClient::Plugin::GetDefaultPlatformFontDescription( FontDescription& fon
 
       delete item.characterSets;
       item.characterSets = nullptr;
+
+      if( nullptr != item.coverageIndex )
+      {
+        item.coverageIndex->Clear();
+      }
     }
 
     // Set the character set pointer as null. Will be created again the next time IsCharacterSupportedByFont()
@@ -675,16 +753,9 @@ bool FontClient::Plugin::IsCharacterSupportedByFont( FontId fontId, Character ch
     }
     case FontDescription::BITMAP_FONT:
     {
-      const BitmapFont& bitmapFont = mBitmapFontCache[fontIdCacheItem.id].font;
+      const BitmapFontCacheItem& bitmapFontCacheItem = mBitmapFontCache[fontIdCacheItem.id];
 
-      for( const auto& glyph : bitmapFont.glyphs )
-      {
-        if( glyph.utf32 == character )
-        {
-          isSupported = true;
-          break;
-        }
-      }
+      isSupported = bitmapFontCacheItem.glyphIndices.find( character ) != bitmapFontCacheItem.glyphIndices.end();
       break;
     }
     default:
@@ -700,6 +771,7 @@ bool FontClient::Plugin::IsCharacterSupportedByFont( FontId fontId, Character ch
 
 FontId FontClient::Plugin::FindFontForCharacter( const FontList& fontList,
                                                  const CharacterSetList& characterSetList,
+                                                 FontCoverageIndex& coverageIndex,
                                                  Character character,
                                                  PointSize26Dot6 requestedPointSize,
                                                  bool preferColor )
@@ -716,12 +788,28 @@ FontId FontClient::Plugin::FindFontForCharacter( const FontList& fontList,
 
   DALI_LOG_INFO( gLogFilter, Debug::General, "  number of fonts : %d\n", fontList.size() );
 
-  // Traverse the list of fonts.
+  if( !preferColor )
+  {
+    // The coverage index memoizes the first font of the list which supports the character.
+    const uint32_t index = coverageIndex.FindFirstFont( characterSetList, character );
+
+    if( FontCoverageIndex::NO_FONT != index )
+    {
+      fontId = GetFontId( fontList[index],
+                          requestedPointSize,
+                          0u );
+    }
+
+    DALI_LOG_INFO( gLogFilter, Debug::General, "  font id : %d\n", fontId );
+    DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFontForCharacter\n" );
+    return fontId;
+  }
+
+  // Traverse the fonts which cover the page of the character.
   // Check for each font if supports the character.
-  for( unsigned int index = 0u, numberOfFonts = fontList.size(); index < numberOfFonts; ++index )
+  for( const auto index : coverageIndex.GetCandidateFonts( characterSetList, character ) )
   {
     const FontDescription& description = fontList[index];
-    const FcCharSet* const characterSet = characterSetList[index];
 
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  description; family : [%s]\n", description.family.c_str() );
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "                 path : [%s]\n", description.path.c_str() );
@@ -729,13 +817,7 @@ FontId FontClient::Plugin::FindFontForCharacter( const FontList& fontList,
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "               weight : [%s]\n", FontWeight::Name[description.weight] );
     DALI_LOG_INFO( gLogFilter, Debug::Verbose, "                slant : [%s]\n\n", FontSlant::Name[description.slant] );
 
-    bool foundInRanges = false;
-    if( nullptr != characterSet )
-    {
-      foundInRanges = FcCharSetHasChar( characterSet, character );
-    }
-
-    if( foundInRanges )
+    if( FontCoverageIndex::IsCharacterSupported( characterSetList, index, character ) )
     {
       fontId = GetFontId( description,
                           requestedPointSize,
@@ -743,21 +825,18 @@ FontId FontClient::Plugin::FindFontForCharacter( const FontList& fontList,
 
       DALI_LOG_INFO( gLogFilter, Debug::Verbose, "     font id : %d\n", fontId );
 
-      if( preferColor )
+      if( ( fontId > 0 ) &&
+          ( fontId - 1u < mFontIdCache.Count() ) )
       {
-        if( ( fontId > 0 ) &&
-            ( fontId - 1u < mFontIdCache.Count() ) )
-        {
-          const FontFaceCacheItem& item = mFontFaceCache[mFontIdCache[fontId - 1u].id];
+        const FontFaceCacheItem& item = mFontFaceCache[mFontIdCache[fontId - 1u].id];
 
-          foundColor = item.mHasColorTables;
-        }
-
-        DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  foundColor : %s\n", ( foundColor ? "true" : "false" ) );
+        foundColor = item.mHasColorTables;
       }
 
-      // Keep going unless we prefer a different (color) font.
-      if( !preferColor || foundColor )
+      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  foundColor : %s\n", ( foundColor ? "true" : "false" ) );
+
+      // Keep going unless we found a color font.
+      if( foundColor )
       {
         break;
       }
@@ -796,7 +875,7 @@ FontId FontClient::Plugin::FindDefaultFont( Character charcode,
 
   // Traverse the list of default fonts.
   // Check for each default font if supports the character.
-  fontId = FindFontForCharacter( mDefaultFonts, mDefaultFontCharacterSets, charcode, requestedPointSize, preferColor );
+  fontId = FindFontForCharacter( mDefaultFonts, mDefaultFontCharacterSets, mDefaultFontCoverageIndex, charcode, requestedPointSize, preferColor );
 
   DALI_LOG_INFO( gLogFilter, Debug::General, "  font id : %d\n", fontId );
   DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindDefaultFont\n" );
@@ -817,43 +896,83 @@ FontId FontClient::Plugin::FindFallbackFont( Character charcode,
   // The font id to be returned.
   FontId fontId = 0u;
 
-  FontDescription fontDescription;
+  FontList* fontList = nullptr;
+  CharacterSetList* characterSetList = nullptr;
+  FontCoverageIndex* coverageIndex = nullptr;
 
-  // Fill the font description with the preferred font description and complete with the defaults.
-  fontDescription.family = preferredFontDescription.family.empty() ? DEFAULT_FONT_FAMILY_NAME : preferredFontDescription.family;
-  fontDescription.weight = ( ( FontWeight::NONE == preferredFontDescription.weight ) ? IntToWeightType( DEFAULT_FONT_WEIGHT ) : preferredFontDescription.weight );
-  fontDescription.width = ( ( FontWidth::NONE == preferredFontDescription.width ) ? IntToWidthType( DEFAULT_FONT_WIDTH ) : preferredFontDescription.width );
-  fontDescription.slant = ( ( FontSlant::NONE == preferredFontDescription.slant ) ? IntToSlantType( DEFAULT_FONT_SLANT ) : preferredFontDescription.slant );
+  GetFallbackFontList( preferredFontDescription, fontList, characterSetList, coverageIndex );
 
-  DALI_LOG_INFO( gLogFilter, Debug::General, "  preferredFontDescription --> fontDescription\n" );
-  DALI_LOG_INFO( gLogFilter, Debug::General, "  [%s] --> [%s]\n", preferredFontDescription.family.c_str(), fontDescription.family.c_str() );
-  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontWeight::Name[preferredFontDescription.weight], FontWeight::Name[fontDescription.weight] );
-  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontWidth::Name[preferredFontDescription.width], FontWidth::Name[fontDescription.width] );
-  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontSlant::Name[preferredFontDescription.slant], FontSlant::Name[fontDescription.slant] );
+  if( fontList && characterSetList && coverageIndex )
+  {
+    fontId = FindFontForCharacter( *fontList, *characterSetList, *coverageIndex, charcode, requestedPointSize, preferColor );
+  }
 
-  // Check first if the font's description has been queried before.
+  DALI_LOG_INFO( gLogFilter, Debug::General, "  font id : %d\n", fontId );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFallbackFont\n");
+  return fontId;
+}
+
+void FontClient::Plugin::FindFallbackFonts( const Character* const text,
+                                            Length numberOfCharacters,
+                                            const FontDescription& preferredFontDescription,
+                                            PointSize26Dot6 requestedPointSize,
+                                            bool preferColor,
+                                            FontId* fontIds )
+{
+  DALI_LOG_INFO( gLogFilter, Debug::General, "-->FontClient::Plugin::FindFallbackFonts\n" );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "  number of characters : %d\n", numberOfCharacters );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "    requestedPointSize : %d\n", requestedPointSize );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "           preferColor : %s\n", ( preferColor ? "true" : "false" ) );
+
+  // The fallback font list is retrieved only once for the whole run.
   FontList* fontList = nullptr;
   CharacterSetList* characterSetList = nullptr;
+  FontCoverageIndex* coverageIndex = nullptr;
 
-  if( !FindFallbackFontList( fontDescription, fontList, characterSetList ) )
-  {
-    fontList = new FontList;
-    characterSetList = new CharacterSetList;
+  GetFallbackFontList( preferredFontDescription, fontList, characterSetList, coverageIndex );
 
-    SetFontList( fontDescription, *fontList, *characterSetList );
+  if( !( fontList && characterSetList && coverageIndex ) )
+  {
+    std::fill( fontIds, fontIds + numberOfCharacters, 0u );
 
-    // Add the font-list to the cache.
-    mFallbackCache.push_back( std::move( FallbackCacheItem( std::move( fontDescription ), fontList, characterSetList ) ) );
+    DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFallbackFonts\n" );
+    return;
   }
 
-  if( fontList && characterSetList )
+  Character previousCharacter = 0u;
+  FontId previousFontId = 0u;
+  uint32_t previousIndex = FontCoverageIndex::NO_FONT;
+
+  for( Length index = 0u; index < numberOfCharacters; ++index )
   {
-    fontId = FindFontForCharacter( *fontList, *characterSetList, charcode, requestedPointSize, preferColor );
+    const Character character = *( text + index );
+
+    if( ( 0u != index ) && ( character == previousCharacter ) )
+    {
+      *( fontIds + index ) = previousFontId;
+      continue;
+    }
+
+    if( preferColor )
+    {
+      previousFontId = FindFontForCharacter( *fontList, *characterSetList, *coverageIndex, character, requestedPointSize, true );
+    }
+    else
+    {
+      // Consecutive characters are likely supported by the same font. Avoid validating its description again.
+      const uint32_t fontIndex = coverageIndex->FindFirstFont( *characterSetList, character );
+      if( fontIndex != previousIndex )
+      {
+        previousIndex = fontIndex;
+        previousFontId = ( FontCoverageIndex::NO_FONT == fontIndex ) ? 0u : GetFontId( ( *fontList )[fontIndex], requestedPointSize, 0u );
+      }
+    }
+
+    previousCharacter = character;
+    *( fontIds + index ) = previousFontId;
   }
 
-  DALI_LOG_INFO( gLogFilter, Debug::General, "  font id : %d\n", fontId );
-  DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFallbackFont\n");
-  return fontId;
+  DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFallbackFonts\n" );
 }
 
 FontId FontClient::Plugin::GetFontId( const FontPath& path,
@@ -1005,6 +1124,9 @@ FontId FontClient::Plugin::GetFontId( const BitmapFont& bitmapFont )
     bitmapFontCacheItem.font.ascender = std::max( glyph.ascender, bitmapFontCacheItem.font.ascender );
     bitmapFontCacheItem.font.descender = std::min( glyph.descender, bitmapFontCacheItem.font.descender );
 
+    // Keep the first glyph if the character is repeated, as the previous linear searches did.
+    bitmapFontCacheItem.glyphIndices.insert( std::make_pair( glyph.utf32, index ) );
+
     ++index;
   }
 
@@ -1182,6 +1304,14 @@ bool FontClient::Plugin::GetBitmapMetrics( GlyphInfo* array,
 {
   bool success( true );
 
+  // Shaped glyphs come in runs of the same font.
+  // The font is resolved once per run and the metrics of each glyph are loaded by FreeType only once.
+  FontId currentFontId = 0u;
+  const FontIdCacheItem* fontIdCacheItem = nullptr;
+#ifdef FREETYPE_BITMAP_SUPPORT
+  bool isFixedSizeSelected = false;
+#endif
+
   for( unsigned int i=0; i<size; ++i )
   {
     GlyphInfo& glyph = array[i];
@@ -1191,23 +1321,52 @@ bool FontClient::Plugin::GetBitmapMetrics( GlyphInfo* array,
     if( ( glyph.fontId > 0u ) &&
         ( index < mFontIdCache.Count() ) )
     {
-      const FontIdCacheItem& fontIdCacheItem = mFontIdCache[index];
+      if( glyph.fontId != currentFontId )
+      {
+        currentFontId = glyph.fontId;
+        fontIdCacheItem = &mFontIdCache[index];
+#ifdef FREETYPE_BITMAP_SUPPORT
+        isFixedSizeSelected = false;
+#endif
+      }
 
-      switch( fontIdCacheItem.type )
+      switch( fontIdCacheItem->type )
       {
         case FontDescription::FACE_FONT:
         {
-          const FontFaceCacheItem& font = mFontFaceCache[fontIdCacheItem.id];
+          FontFaceCacheItem& font = mFontFaceCache[fontIdCacheItem->id];
 
           FT_Face ftFace = font.mFreeTypeFace;
 
+          if( nullptr == font.mGlyphMetricsCache )
+          {
+            font.mGlyphMetricsCache = new GlyphMetricsCache();
+          }
+
 #ifdef FREETYPE_BITMAP_SUPPORT
           // Check to see if we should be loading a Fixed Size bitmap?
           if( font.mIsFixedSizeBitmap )
           {
-            FT_Select_Size( ftFace, font.mFixedSizeIndex ); ///< @todo: needs to be investigated why it's needed to select the size again.
-            int error = FT_Load_Glyph( ftFace, glyph.index, FT_LOAD_COLOR );
-            if ( FT_Err_Ok == error )
+            GlyphMetricsCache::Entry& entry = font.mGlyphMetricsCache->GetEntry( glyph.index, false );
+
+            if( GlyphMetricsCache::NOT_CACHED == entry.state )
+            {
+              if( !isFixedSizeSelected )
+              {
+                FT_Select_Size( ftFace, font.mFixedSizeIndex ); ///< @todo: needs to be investigated why it's needed to select the size again.
+                isFixedSizeSelected = true;
+              }
+
+              int error = FT_Load_Glyph( ftFace, glyph.index, FT_LOAD_COLOR );
+              entry.state = ( FT_Err_Ok == error ) ? GlyphMetricsCache::CACHED : GlyphMetricsCache::LOAD_ERROR;
+
+              if( FT_Err_Ok != error )
+              {
+                DALI_LOG_INFO( gLogFilter, Debug::General, "FontClient::Plugin::GetBitmapMetrics. FreeType Bitmap Load_Glyph error %d\n", error );
+              }
+            }
+
+            if( GlyphMetricsCache::CACHED == entry.state )
             {
               glyph.width = font.mFixedWidthPixels;
               glyph.height = font.mFixedHeightPixels;
@@ -1233,70 +1392,50 @@ bool FontClient::Plugin::GetBitmapMetrics( GlyphInfo* array,
             }
             else
             {
-              DALI_LOG_INFO( gLogFilter, Debug::General, "FontClient::Plugin::GetBitmapMetrics. FreeType Bitmap Load_Glyph error %d\n", error );
               success = false;
             }
           }
           else
 #endif
           {
-            // FT_LOAD_DEFAULT causes some issues in the alignment of the glyph inside the bitmap.
-            // i.e. with the SNum-3R font.
-            // @todo: add an option to use the FT_LOAD_DEFAULT if required?
-            int error = FT_Load_Glyph( ftFace, glyph.index, FT_LOAD_NO_AUTOHINT );
-
-            // Keep the width of the glyph before doing the software emboldening.
-            // It will be used to calculate a scale factor to be applied to the
-            // advance as Harfbuzz doesn't apply any SW emboldening to calculate
-            // the advance of the glyph.
-            const float width = static_cast< float >( ftFace->glyph->metrics.width ) * FROM_266;
-
-            if( FT_Err_Ok == error )
+            const bool isEmboldeningRequired = glyph.isBoldRequired && !( ftFace->style_flags & FT_STYLE_FLAG_BOLD );
+
+            GlyphMetricsCache::Entry& entry = font.mGlyphMetricsCache->GetEntry( glyph.index, isEmboldeningRequired );
+
+            if( GlyphMetricsCache::NOT_CACHED == entry.state )
             {
-              const bool isEmboldeningRequired = glyph.isBoldRequired && !( ftFace->style_flags & FT_STYLE_FLAG_BOLD );
-              if( isEmboldeningRequired )
-              {
-                // Does the software bold.
-                FT_GlyphSlot_Embolden( ftFace->glyph );
-              }
+              LoadGlyphMetrics( ftFace, glyph.index, isEmboldeningRequired, entry );
+            }
 
-              glyph.width  = static_cast< float >( ftFace->glyph->metrics.width ) * FROM_266;
-              glyph.height = static_cast< float >( ftFace->glyph->metrics.height ) * FROM_266;
+            if( GlyphMetricsCache::CACHED == entry.state )
+            {
+              glyph.width  = entry.width;
+              glyph.height = entry.height;
               if( horizontal )
               {
-                glyph.xBearing += static_cast< float >( ftFace->glyph->metrics.horiBearingX ) * FROM_266;
-                glyph.yBearing += static_cast< float >( ftFace->glyph->metrics.horiBearingY ) * FROM_266;
+                glyph.xBearing += entry.horizontalBearingX;
+                glyph.yBearing += entry.horizontalBearingY;
               }
               else
               {
-                glyph.xBearing += static_cast< float >( ftFace->glyph->metrics.vertBearingX ) * FROM_266;
-                glyph.yBearing += static_cast< float >( ftFace->glyph->metrics.vertBearingY ) * FROM_266;
+                glyph.xBearing += entry.verticalBearingX;
+                glyph.yBearing += entry.verticalBearingY;
               }
 
-              if( isEmboldeningRequired && !Dali::EqualsZero( width ) )
+              if( isEmboldeningRequired )
               {
                 // If the glyph is emboldened by software, the advance is multiplied by a
                 // scale factor to make it slightly bigger.
-                glyph.advance *= ( glyph.width / width );
+                glyph.advance *= entry.advanceScale;
               }
 
               // Use the bounding box of the bitmap to correct the metrics.
               // For some fonts i.e the SNum-3R the metrics need to be corrected,
               // otherwise the glyphs 'dance' up and down depending on the
               // font's point size.
-
-              FT_Glyph ftGlyph;
-              error = FT_Get_Glyph( ftFace->glyph, &ftGlyph );
-
-              FT_BBox bbox;
-              FT_Glyph_Get_CBox( ftGlyph, FT_GLYPH_BBOX_GRIDFIT, &bbox );
-
               const float descender = glyph.height - glyph.yBearing;
-              glyph.height = ( bbox.yMax -  bbox.yMin) * FROM_266;
+              glyph.height = entry.boundingBoxHeight;
               glyph.yBearing = glyph.height - round( descender );
-
-              // Created FT_Glyph object must be released with FT_Done_Glyph
-              FT_Done_Glyph( ftGlyph );
             }
             else
             {
@@ -1307,28 +1446,25 @@ bool FontClient::Plugin::GetBitmapMetrics( GlyphInfo* array,
         }
         case FontDescription::BITMAP_FONT:
         {
-          BitmapFontCacheItem& bitmapFontCacheItem = mBitmapFontCache[fontIdCacheItem.id];
+          BitmapFontCacheItem& bitmapFontCacheItem = mBitmapFontCache[fontIdCacheItem->id];
 
-          unsigned int index = 0u;
-          for( auto& item : bitmapFontCacheItem.font.glyphs )
+          const auto it = bitmapFontCacheItem.glyphIndices.find( glyph.index );
+          if( it != bitmapFontCacheItem.glyphIndices.end() )
           {
-            if( item.utf32 == glyph.index )
-            {
-              Devel::PixelBuffer& pixelBuffer = bitmapFontCacheItem.pixelBuffers[index];
-              if( !pixelBuffer )
-              {
-                pixelBuffer = LoadImageFromFile( item.url );
-              }
+            const BitmapGlyph& item = bitmapFontCacheItem.font.glyphs[it->second];
 
-              glyph.width  = static_cast< float >( pixelBuffer.GetWidth() );
-              glyph.height = static_cast< float >( pixelBuffer.GetHeight() );
-              glyph.xBearing = 0.f;
-              glyph.yBearing = glyph.height + item.descender;
-              glyph.advance = glyph.width;
-              glyph.scaleFactor = 1.f;
-              break;
+            Devel::PixelBuffer& pixelBuffer = bitmapFontCacheItem.pixelBuffers[it->second];
+            if( !pixelBuffer )
+            {
+              pixelBuffer = LoadImageFromFile( item.url );
             }
-            ++index;
+
+            glyph.width  = static_cast< float >( pixelBuffer.GetWidth() );
+            glyph.height = static_cast< float >( pixelBuffer.GetHeight() );
+            glyph.xBearing = 0.f;
+            glyph.yBearing = glyph.height + item.descender;
+            glyph.advance = glyph.width;
+            glyph.scaleFactor = 1.f;
           }
 
           success = true;
@@ -1371,6 +1507,11 @@ bool FontClient::Plugin::GetVectorMetrics( GlyphInfo* array,
 #ifdef ENABLE_VECTOR_BASED_TEXT_RENDERING
   bool success( true );
 
+  // The font and the scale are resolved once per run of glyphs with the same font.
+  FontId currentFontId = 0u;
+  FontFaceCacheItem* font = nullptr;
+  float scale = 1.f;
+
   for( unsigned int i = 0u; i < size; ++i )
   {
     FontId fontId = array[i].fontId;
@@ -1378,17 +1519,22 @@ bool FontClient::Plugin::GetVectorMetrics( GlyphInfo* array,
     if( ( fontId > 0u ) &&
         ( fontId - 1u ) < mFontIdCache.Count() )
     {
-      FontFaceCacheItem& font = mFontFaceCache[mFontIdCache[fontId - 1u].id];
-
-      if( ! font.mVectorFontId )
+      if( fontId != currentFontId )
       {
-        font.mVectorFontId = mVectorFontCache->GetFontId( font.mPath );
+        currentFontId = fontId;
+        font = &mFontFaceCache[mFontIdCache[fontId - 1u].id];
+
+        if( ! font->mVectorFontId )
+        {
+          font->mVectorFontId = mVectorFontCache->GetFontId( font->mPath );
+        }
+
+        // Vector metrics are in EMs, convert to pixels
+        scale = ( static_cast<float>( font->mRequestedPointSize ) * FROM_266 ) * static_cast<float>( mDpiVertical ) / POINTS_PER_INCH;
       }
 
-      mVectorFontCache->GetGlyphMetrics( font.mVectorFontId, array[i] );
+      mVectorFontCache->GetGlyphMetrics( font->mVectorFontId, array[i] );
 
-      // Vector metrics are in EMs, convert to pixels
-      const float scale = ( static_cast<float>( font.mRequestedPointSize ) * FROM_266 ) * static_cast<float>( mDpiVertical ) / POINTS_PER_INCH;
       array[i].width    *= scale;
       array[i].height   *= scale;
       array[i].xBearing *= scale;
@@ -1559,29 +1705,24 @@ void FontClient::Plugin::CreateBitmap( FontId fontId, GlyphIndex glyphIndex, boo
       {
         BitmapFontCacheItem& bitmapFontCacheItem = mBitmapFontCache[fontIdCacheItem.id];
 
-        unsigned int index = 0u;
-        for( auto& item : bitmapFontCacheItem.font.glyphs )
+        const auto it = bitmapFontCacheItem.glyphIndices.find( glyphIndex );
+        if( it != bitmapFontCacheItem.glyphIndices.end() )
         {
-          if( item.utf32 == glyphIndex )
+          Devel::PixelBuffer& pixelBuffer = bitmapFontCacheItem.pixelBuffers[it->second];
+          if( !pixelBuffer )
           {
-            Devel::PixelBuffer& pixelBuffer = bitmapFontCacheItem.pixelBuffers[index];
-            if( !pixelBuffer )
-            {
-              pixelBuffer = LoadImageFromFile( item.url );
-            }
+            pixelBuffer = LoadImageFromFile( bitmapFontCacheItem.font.glyphs[it->second].url );
+          }
 
-            data.width = pixelBuffer.GetWidth();
-            data.height = pixelBuffer.GetHeight();
+          data.width = pixelBuffer.GetWidth();
+          data.height = pixelBuffer.GetHeight();
 
-            data.isColorBitmap = bitmapFontCacheItem.font.isColorFont;
+          data.isColorBitmap = bitmapFontCacheItem.font.isColorFont;
 
-            ConvertBitmap( data, data.width, data.height, pixelBuffer.GetBuffer() );
+          ConvertBitmap( data, data.width, data.height, pixelBuffer.GetBuffer() );
 
-            // Sets the pixel format.
-            data.format = pixelBuffer.GetPixelFormat();
-            break;
-          }
-          ++index;
+          // Sets the pixel format.
+          data.format = pixelBuffer.GetPixelFormat();
         }
         break;
       }
@@ -2096,6 +2237,7 @@ FontId FontClient::Plugin::CreateFont( const FontPath& path,
   DALI_LOG_INFO( gLogFilter, Debug::General, "-->FontClient::Plugin::CreateFont\n" );
   DALI_LOG_INFO( gLogFilter, Debug::General, "                path : [%s]\n", path.c_str() );
   DALI_LOG_INFO( gLogFilter, Debug::General, "  requestedPointSize : %d\n", requestedPointSize );
+  DALI_TRACE_SCOPE( gTraceFilter, "DALI_FONT_LOADING" );
 
   FontId id = 0u;
 
@@ -2449,7 +2591,8 @@ bool FontClient::Plugin::FindValidatedFont( const FontDescription& fontDescripti
 
 bool FontClient::Plugin::FindFallbackFontList( const FontDescription& fontDescription,
                                                FontList*& fontList,
-                                               CharacterSetList*& characterSetList )
+                                               CharacterSetList*& characterSetList,
+                                               FontCoverageIndex*& coverageIndex )
 {
   DALI_LOG_INFO( gLogFilter, Debug::General, "-->FontClient::Plugin::FindFallbackFontList\n" );
   DALI_LOG_INFO( gLogFilter, Debug::General, "  description; family : [%s]\n", fontDescription.family.c_str() );
@@ -2471,6 +2614,7 @@ bool FontClient::Plugin::FindFallbackFontList( const FontDescription& fontDescri
     {
       fontList = item.fallbackFonts;
       characterSetList = item.characterSets;
+      coverageIndex = item.coverageIndex;
 
       DALI_LOG_INFO( gLogFilter, Debug::General, "  fallback font list found.\n" );
       DALI_LOG_INFO( gLogFilter, Debug::General, "<--FontClient::Plugin::FindFallbackFontList\n" );
@@ -2483,6 +2627,39 @@ bool FontClient::Plugin::FindFallbackFontList( const FontDescription& fontDescri
   return false;
 }
 
+void FontClient::Plugin::GetFallbackFontList( const FontDescription& preferredFontDescription,
+                                              FontList*& fontList,
+                                              CharacterSetList*& characterSetList,
+                                              FontCoverageIndex*& coverageIndex )
+{
+  FontDescription fontDescription;
+
+  // Fill the font description with the preferred font description and complete with the defaults.
+  fontDescription.family = preferredFontDescription.family.empty() ? DEFAULT_FONT_FAMILY_NAME : preferredFontDescription.family;
+  fontDescription.weight = ( ( FontWeight::NONE == preferredFontDescription.weight ) ? IntToWeightType( DEFAULT_FONT_WEIGHT ) : preferredFontDescription.weight );
+  fontDescription.width = ( ( FontWidth::NONE == preferredFontDescription.width ) ? IntToWidthType( DEFAULT_FONT_WIDTH ) : preferredFontDescription.width );
+  fontDescription.slant = ( ( FontSlant::NONE == preferredFontDescription.slant ) ? IntToSlantType( DEFAULT_FONT_SLANT ) : preferredFontDescription.slant );
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "  preferredFontDescription --> fontDescription\n" );
+  DALI_LOG_INFO( gLogFilter, Debug::General, "  [%s] --> [%s]\n", preferredFontDescription.family.c_str(), fontDescription.family.c_str() );
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontWeight::Name[preferredFontDescription.weight], FontWeight::Name[fontDescription.weight] );
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontWidth::Name[preferredFontDescription.width], FontWidth::Name[fontDescription.width] );
+  DALI_LOG_INFO( gLogFilter, Debug::Verbose, "  [%s] --> [%s]\n", FontSlant::Name[preferredFontDescription.slant], FontSlant::Name[fontDescription.slant] );
+
+  // Check first if the font's description has been queried before.
+  if( !FindFallbackFontList( fontDescription, fontList, characterSetList, coverageIndex ) )
+  {
+    fontList = new FontList;
+    characterSetList = new CharacterSetList;
+    coverageIndex = new FontCoverageIndex;
+
+    SetFontList( fontDescription, *fontList, *characterSetList );
+
+    // Add the font-list to the cache.
+    mFallbackCache.push_back( std::move( FallbackCacheItem( std::move( fontDescription ), fontList, characterSetList, coverageIndex ) ) );
+  }
+}
+
 bool FontClient::Plugin::FindFont( FontDescriptionId validatedFontId,
                                    PointSize26Dot6 requestedPointSize,
                                    FontId& fontId )
@@ -2752,6 +2929,8 @@ void FontClient::Plugin::ClearFallbackCache( std::vector<FallbackCacheItem>& fal
       DestroyCharacterSets( *item.characterSets );
       delete item.characterSets;
     }
+
+    delete item.coverageIndex;
   }
 }
 
@@ -2764,6 +2943,15 @@ void FontClient::Plugin::ClearCharacterSetFromFontFaceCache()
   }
 }
 
+void FontClient::Plugin::ClearGlyphMetricsFromFontFaceCache()
+{
+  for( auto& item : mFontFaceCache )
+  {
+    delete item.mGlyphMetricsCache;
+    item.mGlyphMetricsCache = nullptr;
+  }
+}
+
 } // namespace Internal
 
 } // namespace TextAbstraction
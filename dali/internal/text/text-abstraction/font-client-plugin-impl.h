@@ -23,6 +23,8 @@
 #include <dali/devel-api/text-abstraction/font-metrics.h>
 #include <dali/devel-api/text-abstraction/glyph-info.h>
 #include <dali/internal/text/text-abstraction/font-client-impl.h>
+#include <dali/internal/text/text-abstraction/font-coverage-index.h>
+#include <dali/internal/text/text-abstraction/glyph-metrics-cache.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 
 #ifdef ENABLE_VECTOR_BASED_TEXT_RENDERING
@@ -38,9 +40,9 @@ class VectorFontCache;
 #include FT_OUTLINE_H
 #include FT_STROKER_H
 #include FT_SYNTHESIS_H
+#include <unordered_map>
 
 // forward declarations of font config types.
-struct _FcCharSet;
 struct _FcFontSet;
 struct _FcPattern;
 
@@ -63,11 +65,6 @@ typedef uint32_t FontDescriptionId;
  */
 typedef uint32_t PixelBufferId;
 
-/**
- * @brief Vector of character sets.
- */
-typedef Vector<_FcCharSet*> CharacterSetList;
-
 /**
  * @brief FontClient implementation.
  */
@@ -84,11 +81,12 @@ struct FontClient::Plugin
    */
   struct FallbackCacheItem
   {
-    FallbackCacheItem( FontDescription&& fontDescription, FontList* fallbackFonts, CharacterSetList* characterSets );
+    FallbackCacheItem( FontDescription&& fontDescription, FontList* fallbackFonts, CharacterSetList* characterSets, FontCoverageIndex* coverageIndex );
 
-    FontDescription fontDescription; ///< The font description.
-    FontList* fallbackFonts;         ///< The list of fallback fonts for the given font-description.
-    CharacterSetList* characterSets; ///< The list of character sets for the given font-description.
+    FontDescription fontDescription;  ///< The font description.
+    FontList* fallbackFonts;          ///< The list of fallback fonts for the given font-description.
+    CharacterSetList* characterSets;  ///< The list of character sets for the given font-description.
+    FontCoverageIndex* coverageIndex; ///< Maps characters to the fallback fonts which support them.
   };
 
   /**
@@ -146,6 +144,7 @@ struct FontClient::Plugin
     FaceIndex mFaceIndex;                ///< The face index.
     FontMetrics mMetrics;                ///< The font metrics.
     _FcCharSet* mCharacterSet;           ///< Pointer with the range of characters.
+    GlyphMetricsCache* mGlyphMetricsCache; ///< The metrics of the glyphs loaded so far. Created on demand.
     int mFixedSizeIndex;                 ///< Index to the fixed size table for the requested size.
     float mFixedWidthPixels;             ///< The height in pixels (fixed size bitmaps only)
     float mFixedHeightPixels;            ///< The height in pixels (fixed size bitmaps only)
@@ -187,6 +186,7 @@ struct FontClient::Plugin
   {
     BitmapFont font;                              ///< The bitmap font.
     std::vector<Devel::PixelBuffer> pixelBuffers; ///< The pixel buffers of the glyphs.
+    std::unordered_map<uint32_t, unsigned int> glyphIndices; ///< Maps the utf32 code of a glyph to its index within the font's glyphs.
     FontId id;                                    ///< Index to the vector with the cache of font's ids.
   };
 
@@ -263,6 +263,7 @@ struct FontClient::Plugin
    *
    * @param[in] fontList A list of font paths, family, width, weight and slant.
    * @param[in] characterSetList A list that contains a character set for each description of the font list.
+   * @param[in] coverageIndex The coverage index of the @p characterSetList.
    * @param[in] charcode The character for which a font is needed.
    * @param[in] requestedPointSize The point size in 26.6 fractional points.
    * @param[in] preferColor @e true if a color font is preferred.
@@ -271,6 +272,7 @@ struct FontClient::Plugin
    */
   FontId FindFontForCharacter( const FontList& fontList,
                                const CharacterSetList& characterSetList,
+                               FontCoverageIndex& coverageIndex,
                                Character charcode,
                                PointSize26Dot6 requestedPointSize,
                                bool preferColor );
@@ -290,6 +292,16 @@ struct FontClient::Plugin
                            PointSize26Dot6 requestedPointSize,
                            bool preferColor );
 
+  /**
+   * @copydoc Dali::TextAbstraction::FontClient::FindFallbackFonts()
+   */
+  void FindFallbackFonts( const Character* const text,
+                          Length numberOfCharacters,
+                          const FontDescription& preferredFontDescription,
+                          PointSize26Dot6 requestedPointSize,
+                          bool preferColor,
+                          FontId* fontIds );
+
   /**
    * @see Dali::TextAbstraction::FontClient::GetFontId( const FontPath& path, PointSize26Dot6 requestedPointSize, FaceIndex faceIndex )
    *
@@ -355,6 +367,8 @@ struct FontClient::Plugin
 
   /**
    * Helper for GetGlyphMetrics when using bitmaps
+   *
+   * The metrics of the glyphs are cached per font face, so each glyph is loaded by FreeType only once.
    */
   bool GetBitmapMetrics( GlyphInfo* array, uint32_t size, bool horizontal );
 
@@ -536,10 +550,25 @@ private:
    * @param[in] fontDescription The font to validate.
    * @param[out] A valid pointer to a font list, or @e nullptr if not found.
    * @param[out] characterSetList A valid pointer to a character set list, or @e nullptr if not found.
+   * @param[out] coverageIndex A valid pointer to the coverage index of the character set list, or @e nullptr if not found.
    */
   bool FindFallbackFontList( const FontDescription& fontDescription,
                              FontList*& fontList,
-                             CharacterSetList*& characterSetList );
+                             CharacterSetList*& characterSetList,
+                             FontCoverageIndex*& coverageIndex );
+
+  /**
+   * @brief Retrieves the fallback font list for the preferred font description. Creates and caches it if it's not in the cache.
+   *
+   * @param[in] preferredFontDescription Description of the preferred font. Its empty fields are completed with the defaults.
+   * @param[out] fontList A valid pointer to a font list.
+   * @param[out] characterSetList A valid pointer to a character set list.
+   * @param[out] coverageIndex A valid pointer to the coverage index of the character set list.
+   */
+  void GetFallbackFontList( const FontDescription& preferredFontDescription,
+                            FontList*& fontList,
+                            CharacterSetList*& characterSetList,
+                            FontCoverageIndex*& coverageIndex );
 
   /**
    * @brief Finds in the cache a pair 'validated font identifier and font point size'.
@@ -618,6 +647,11 @@ private:
    */
   void ClearCharacterSetFromFontFaceCache();
 
+  /**
+   * @brief Free the resources allocated by the glyph metrics caches.
+   */
+  void ClearGlyphMetricsFromFontFaceCache();
+
 private:
 
   // Declared private and left undefined to avoid copies.
@@ -637,6 +671,7 @@ private:
   FontList mSystemFonts;       ///< Cached system fonts.
   FontList mDefaultFonts;      ///< Cached default fonts.
   CharacterSetList mDefaultFontCharacterSets;
+  FontCoverageIndex mDefaultFontCoverageIndex; ///< Maps characters to the default fonts which support them.
 
   std::vector<FallbackCacheItem> mFallbackCache; ///< Cached fallback font lists.
 
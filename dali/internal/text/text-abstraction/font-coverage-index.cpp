@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/font-coverage-index.h>
+
+// INTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+// EXTERNAL INCLUDES
+#include <fontconfig/fontconfig.h>
+#include <algorithm>
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Dali::Integration::Log::Filter* gLogFilter = Dali::Integration::Log::Filter::New(Debug::NoLogging, false, "LOG_FONT_COVERAGE_INDEX");
+#endif
+
+const uint32_t PAGE_SHIFT = 8u;
+const uint32_t CHARACTERS_PER_PAGE = 1u << PAGE_SHIFT;
+const uint32_t INVALID_PAGE_NUMBER = 0xFFFFFFFFu;
+const uint32_t NOT_COMPUTED = 0xFFFFFFFEu; ///< The first font of a character has not been searched yet.
+
+} // namespace
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+const uint32_t FontCoverageIndex::NO_FONT = 0xFFFFFFFFu;
+
+FontCoverageIndex::FontCoverageIndex()
+: mPages(),
+  mLastPageNumber( INVALID_PAGE_NUMBER ),
+  mLastPage( nullptr )
+{
+}
+
+FontCoverageIndex::~FontCoverageIndex()
+{
+  Clear();
+}
+
+uint32_t FontCoverageIndex::FindFirstFont( const CharacterSetList& characterSetList, Character character )
+{
+  Page& page = GetPage( characterSetList, character );
+
+  uint32_t& firstFont = page.firstFont[character & ( CHARACTERS_PER_PAGE - 1u )];
+  if( NOT_COMPUTED == firstFont )
+  {
+    firstFont = NO_FONT;
+    for( const auto fontIndex : page.candidates )
+    {
+      if( IsCharacterSupported( characterSetList, fontIndex, character ) )
+      {
+        firstFont = fontIndex;
+        break;
+      }
+    }
+  }
+
+  return firstFont;
+}
+
+const Vector<uint32_t>& FontCoverageIndex::GetCandidateFonts( const CharacterSetList& characterSetList, Character character )
+{
+  return GetPage( characterSetList, character ).candidates;
+}
+
+bool FontCoverageIndex::IsCharacterSupported( const CharacterSetList& characterSetList, uint32_t fontIndex, Character character )
+{
+  const FcCharSet* const characterSet = characterSetList[fontIndex];
+  return ( nullptr != characterSet ) && FcCharSetHasChar( characterSet, character );
+}
+
+void FontCoverageIndex::Clear()
+{
+  for( auto& item : mPages )
+  {
+    delete item.second;
+  }
+  mPages.clear();
+
+  mLastPageNumber = INVALID_PAGE_NUMBER;
+  mLastPage = nullptr;
+}
+
+FontCoverageIndex::Page& FontCoverageIndex::GetPage( const CharacterSetList& characterSetList, Character character )
+{
+  const uint32_t pageNumber = character >> PAGE_SHIFT;
+  if( pageNumber == mLastPageNumber )
+  {
+    return *mLastPage;
+  }
+
+  Page* page = nullptr;
+
+  auto it = mPages.find( pageNumber );
+  if( it != mPages.end() )
+  {
+    page = it->second;
+  }
+  else
+  {
+    page = new Page;
+    std::fill( page->firstFont, page->firstFont + CHARACTERS_PER_PAGE, NOT_COMPUTED );
+
+    // Build a character set with all the characters of the page and find which fonts intersect it.
+    FcCharSet* pageCharacterSet = FcCharSetCreate();
+    const Character firstCharacter = pageNumber << PAGE_SHIFT;
+    for( Character pageCharacter = firstCharacter; pageCharacter < firstCharacter + CHARACTERS_PER_PAGE; ++pageCharacter )
+    {
+      FcCharSetAddChar( pageCharacterSet, pageCharacter );
+    }
+
+    for( uint32_t fontIndex = 0u, numberOfFonts = characterSetList.Count(); fontIndex < numberOfFonts; ++fontIndex )
+    {
+      const FcCharSet* const characterSet = characterSetList[fontIndex];
+      if( ( nullptr != characterSet ) && ( 0u != FcCharSetIntersectCount( characterSet, pageCharacterSet ) ) )
+      {
+        page->candidates.PushBack( fontIndex );
+      }
+    }
+
+    FcCharSetDestroy( pageCharacterSet );
+
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "FontCoverageIndex::GetPage. page : %d, candidate fonts : %d of %d\n", pageNumber, page->candidates.Count(), characterSetList.Count() );
+
+    mPages[pageNumber] = page;
+  }
+
+  mLastPageNumber = pageNumber;
+  mLastPage = page;
+
+  return *page;
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
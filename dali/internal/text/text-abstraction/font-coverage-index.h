@@ -0,0 +1,148 @@
+#ifndef DALI_INTERNAL_TEXT_ABSTRACTION_FONT_COVERAGE_INDEX_H
+#define DALI_INTERNAL_TEXT_ABSTRACTION_FONT_COVERAGE_INDEX_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+
+// EXTERNAL INCLUDES
+#include <unordered_map>
+
+// forward declarations of font config types.
+struct _FcCharSet;
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Vector of character sets.
+ */
+typedef Vector<_FcCharSet*> CharacterSetList;
+
+/**
+ * @brief Maps Unicode pages to the fonts of a font list which cover them.
+ *
+ * The index splits the code space in pages of 256 characters (the granularity used by fontconfig's character sets).
+ * The first time a character of a page is queried, the fonts of the list covering at least one character of the page
+ * are found and stored in order. The first font supporting each character of the page is memoized as well,
+ * so subsequent queries for the same character are resolved without traversing the font list.
+ *
+ * The index doesn't own the character sets. It must be cleared whenever the character set list it's used with changes.
+ */
+class FontCoverageIndex
+{
+public:
+
+  static const uint32_t NO_FONT; ///< Returned when none of the fonts of the list supports a character.
+
+  /**
+   * @brief Default constructor.
+   */
+  FontCoverageIndex();
+
+  /**
+   * @brief Destructor.
+   */
+  ~FontCoverageIndex();
+
+  /**
+   * @brief Retrieves the index to the first font of the list which supports the given @p character.
+   *
+   * @param[in] characterSetList The character sets of the font list.
+   * @param[in] character The character.
+   *
+   * @return The index to the font within the list or NO_FONT if no font supports the character.
+   */
+  uint32_t FindFirstFont( const CharacterSetList& characterSetList, Character character );
+
+  /**
+   * @brief Retrieves the ordered indices to the fonts of the list which cover, at least, a character of the page of the given @p character.
+   *
+   * @note Fonts in the list may not support the given @p character. Use IsCharacterSupported() to check it.
+   *
+   * @param[in] characterSetList The character sets of the font list.
+   * @param[in] character The character.
+   *
+   * @return The candidate fonts.
+   */
+  const Vector<uint32_t>& GetCandidateFonts( const CharacterSetList& characterSetList, Character character );
+
+  /**
+   * @brief Whether the font at @p fontIndex within the list supports the given @p character.
+   *
+   * @param[in] characterSetList The character sets of the font list.
+   * @param[in] fontIndex Index to the font within the list.
+   * @param[in] character The character.
+   *
+   * @return @e true if the character is supported.
+   */
+  static bool IsCharacterSupported( const CharacterSetList& characterSetList, uint32_t fontIndex, Character character );
+
+  /**
+   * @brief Clears all the cached pages.
+   */
+  void Clear();
+
+private:
+
+  /**
+   * @brief The coverage of a page of 256 characters.
+   */
+  struct Page
+  {
+    Vector<uint32_t> candidates; ///< Indices to the fonts which cover at least one character of the page.
+    uint32_t firstFont[256u];    ///< Memoized index to the first font supporting each character of the page.
+  };
+
+  /**
+   * @brief Retrieves the page for the given @p character. Creates it if it doesn't exist.
+   *
+   * @param[in] characterSetList The character sets of the font list.
+   * @param[in] character The character.
+   *
+   * @return The page.
+   */
+  Page& GetPage( const CharacterSetList& characterSetList, Character character );
+
+  // Declared private and left undefined to avoid copies.
+  FontCoverageIndex( const FontCoverageIndex& );
+  // Declared private and left undefined to avoid copies.
+  FontCoverageIndex& operator=( const FontCoverageIndex& );
+
+private:
+
+  std::unordered_map<uint32_t, Page*> mPages; ///< Maps a page number to its coverage. Pages are created on demand.
+  uint32_t mLastPageNumber;                   ///< The page number of the last query. Consecutive characters usually belong to the same page.
+  Page* mLastPage;                            ///< The page of the last query.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TEXT_ABSTRACTION_FONT_COVERAGE_INDEX_H
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/text/text-abstraction/glyph-metrics-cache.h>
+
+namespace
+{
+
+const uint32_t PAGE_SHIFT = 8u;
+const uint32_t GLYPHS_PER_PAGE = 1u << PAGE_SHIFT;
+
+} // namespace
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+GlyphMetricsCache::GlyphMetricsCache()
+: mPages()
+{
+}
+
+GlyphMetricsCache::~GlyphMetricsCache()
+{
+  Clear();
+}
+
+GlyphMetricsCache::Entry& GlyphMetricsCache::GetEntry( GlyphIndex glyphIndex, bool isEmboldened )
+{
+  std::vector<Entry*>& pages = mPages[isEmboldened ? 1u : 0u];
+
+  const uint32_t pageNumber = glyphIndex >> PAGE_SHIFT;
+  if( pageNumber >= pages.size() )
+  {
+    pages.resize( pageNumber + 1u, nullptr );
+  }
+
+  Entry*& page = pages[pageNumber];
+  if( nullptr == page )
+  {
+    // Value-initialization sets the state of all the entries to NOT_CACHED.
+    page = new Entry[GLYPHS_PER_PAGE]();
+  }
+
+  return page[glyphIndex & ( GLYPHS_PER_PAGE - 1u )];
+}
+
+void GlyphMetricsCache::Clear()
+{
+  for( auto& pages : mPages )
+  {
+    for( auto page : pages )
+    {
+      delete[] page;
+    }
+    pages.clear();
+  }
+}
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
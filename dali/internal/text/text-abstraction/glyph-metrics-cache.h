@@ -0,0 +1,117 @@
+#ifndef DALI_INTERNAL_TEXT_ABSTRACTION_GLYPH_METRICS_CACHE_H
+#define DALI_INTERNAL_TEXT_ABSTRACTION_GLYPH_METRICS_CACHE_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/text-abstraction/text-abstraction-definitions.h>
+
+// EXTERNAL INCLUDES
+#include <vector>
+
+namespace Dali
+{
+
+namespace TextAbstraction
+{
+
+namespace Internal
+{
+
+/**
+ * @brief Caches the metrics of the glyphs of a font face, as loaded by FreeType.
+ *
+ * The cache is a dense array indexed by glyph index. It's split in pages of 256 glyphs which are allocated the first time
+ * one of their glyphs is accessed, so fonts with a big number of glyphs (i.e. CJK fonts) only pay for the glyphs used.
+ *
+ * Metrics of the software emboldened glyphs are stored apart from the regular ones.
+ */
+class GlyphMetricsCache
+{
+public:
+
+  /**
+   * @brief The state of an entry of the cache.
+   */
+  enum State
+  {
+    NOT_CACHED, ///< The glyph hasn't been loaded yet.
+    CACHED,     ///< The metrics of the glyph are cached.
+    LOAD_ERROR  ///< FreeType failed to load the glyph.
+  };
+
+  /**
+   * @brief The metrics of a glyph, in pixels.
+   */
+  struct Entry
+  {
+    float width;              ///< The width of the glyph.
+    float height;             ///< The height of the glyph.
+    float boundingBoxHeight;  ///< The height of the grid fitted bounding box of the glyph.
+    float horizontalBearingX; ///< The horizontal layout's x bearing.
+    float horizontalBearingY; ///< The horizontal layout's y bearing.
+    float verticalBearingX;   ///< The vertical layout's x bearing.
+    float verticalBearingY;   ///< The vertical layout's y bearing.
+    float advanceScale;       ///< The factor to be applied to the advance of the emboldened glyphs.
+    State state;              ///< The state of the entry.
+  };
+
+  /**
+   * @brief Default constructor.
+   */
+  GlyphMetricsCache();
+
+  /**
+   * @brief Destructor.
+   */
+  ~GlyphMetricsCache();
+
+  /**
+   * @brief Retrieves the entry of the given glyph. Allocates the page of the glyph if it doesn't exist.
+   *
+   * @param[in] glyphIndex The index of the glyph within the font.
+   * @param[in] isEmboldened Whether the metrics of the software emboldened glyph are required.
+   *
+   * @return The entry. Its state is NOT_CACHED if the glyph's metrics haven't been set.
+   */
+  Entry& GetEntry( GlyphIndex glyphIndex, bool isEmboldened );
+
+  /**
+   * @brief Clears all the cached metrics.
+   */
+  void Clear();
+
+private:
+
+  // Declared private and left undefined to avoid copies.
+  GlyphMetricsCache( const GlyphMetricsCache& );
+  // Declared private and left undefined to avoid copies.
+  GlyphMetricsCache& operator=( const GlyphMetricsCache& );
+
+private:
+
+  std::vector<Entry*> mPages[2u]; ///< Pages of entries for the regular and the emboldened glyphs.
+};
+
+} // namespace Internal
+
+} // namespace TextAbstraction
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TEXT_ABSTRACTION_GLYPH_METRICS_CACHE_H
@@ -22,6 +22,7 @@
 #include <dali/devel-api/common/singleton-service.h>
 #include <third-party/libunibreak/linebreak.h>
 #include <third-party/libunibreak/wordbreak.h>
+#include <algorithm>
 
 namespace Dali
 {
@@ -32,6 +33,116 @@ namespace TextAbstraction
 namespace Internal
 {
 
+namespace
+{
+
+const Character CHAR_LF  = 0x000A; // NL Line feed, new line.
+const Character CHAR_VT  = 0x000B; // Vertical tab.
+const Character CHAR_FF  = 0x000C; // NP Form feed, new page.
+const Character CHAR_CR  = 0x000D; // Carriage return, new line.
+const Character CHAR_NEL = 0x0085; // Next line.
+const Character CHAR_LS  = 0x2028; // Line separator.
+const Character CHAR_PS  = 0x2029; // Paragraph separator.
+
+/**
+ * @brief Whether the character is a new line or a paragraph separator.
+ *
+ * @param[in] character The character.
+ *
+ * @return @e true if the character is a separator.
+ */
+bool IsParagraphSeparator( Character character )
+{
+  switch( character )
+  {
+    case CHAR_LF:
+    case CHAR_VT:
+    case CHAR_FF:
+    case CHAR_CR:
+    case CHAR_NEL:
+    case CHAR_LS:
+    case CHAR_PS:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief Whether there is a mandatory break after the character at @p index.
+ *
+ * Both the line and the word break algorithms start from scratch after a mandatory break,
+ * so the text between two of them can be analyzed independently from the rest.
+ *
+ * @param[in] text Pointer to the first character of the text coded in UTF32.
+ * @param[in] numberOfCharacters The number of characters.
+ * @param[in] index Index to the character.
+ *
+ * @return @e true if there is a mandatory break after the character.
+ */
+bool IsMandatoryBreak( const Character* const text, Length numberOfCharacters, CharacterIndex index )
+{
+  const Character character = *( text + index );
+
+  if( CHAR_CR == character )
+  {
+    // A CR followed by a LF is a single break.
+    return ( index + 1u == numberOfCharacters ) || ( CHAR_LF != *( text + index + 1u ) );
+  }
+
+  return IsParagraphSeparator( character );
+}
+
+/**
+ * @brief Retrieves the range of paragraphs affected by an edit.
+ *
+ * The range starts with the mandatory break before the edited characters and ends with the first mandatory break
+ * after them, or with the start and the end of the text.
+ *
+ * @param[in] text Pointer to the first character of the edited text coded in UTF32.
+ * @param[in] numberOfCharacters The number of characters of the edited text.
+ * @param[in] updateStartIndex Index to the first edited character.
+ * @param[in] numberOfCharactersToUpdate The number of characters added or modified. Zero if characters have been removed only.
+ * @param[out] startIndex Index to the first character of the range.
+ * @param[out] endIndex Index to the character after the range.
+ */
+void GetAffectedRange( const Character* const text,
+                       Length numberOfCharacters,
+                       CharacterIndex updateStartIndex,
+                       Length numberOfCharactersToUpdate,
+                       CharacterIndex& startIndex,
+                       CharacterIndex& endIndex )
+{
+  updateStartIndex = std::min( updateStartIndex, numberOfCharacters );
+
+  startIndex = ( 0u == updateStartIndex ) ? 0u : updateStartIndex - 1u;
+  while( ( 0u != startIndex ) && !IsMandatoryBreak( text, numberOfCharacters, startIndex - 1u ) )
+  {
+    --startIndex;
+  }
+
+  // The mandatory break characters before the range are analyzed as well.
+  // Otherwise libunibreak handles the first character of the range as the start of the text (i.e. leading spaces).
+  while( ( 0u != startIndex ) && IsParagraphSeparator( *( text + startIndex - 1u ) ) )
+  {
+    --startIndex;
+  }
+
+  // The character after the edited ones has to be analyzed as its previous context has changed.
+  // If a mandatory break has been added, the rest of the paragraph it splits is analyzed too.
+  endIndex = std::min( updateStartIndex + numberOfCharactersToUpdate + 1u, numberOfCharacters );
+  while( ( endIndex < numberOfCharacters ) && !IsMandatoryBreak( text, numberOfCharacters, endIndex - 1u ) )
+  {
+    ++endIndex;
+  }
+}
+
+} // namespace
+
 struct Segmentation::Plugin
 {
   void GetLineBreakPositions( const Character* const text,
@@ -47,6 +158,38 @@ struct Segmentation::Plugin
   {
     set_wordbreaks_utf32( text, numberOfCharacters, NULL, breakInfo );
   }
+
+  void UpdateLineBreakPositions( const Character* const text,
+                                 Length numberOfCharacters,
+                                 CharacterIndex updateStartIndex,
+                                 Length numberOfCharactersToUpdate,
+                                 LineBreakInfo* breakInfo )
+  {
+    CharacterIndex startIndex = 0u;
+    CharacterIndex endIndex = 0u;
+    GetAffectedRange( text, numberOfCharacters, updateStartIndex, numberOfCharactersToUpdate, startIndex, endIndex );
+
+    if( startIndex < endIndex )
+    {
+      set_linebreaks_utf32( text + startIndex, endIndex - startIndex, NULL, breakInfo + startIndex );
+    }
+  }
+
+  void UpdateWordBreakPositions( const Character* const text,
+                                 Length numberOfCharacters,
+                                 CharacterIndex updateStartIndex,
+                                 Length numberOfCharactersToUpdate,
+                                 WordBreakInfo* breakInfo )
+  {
+    CharacterIndex startIndex = 0u;
+    CharacterIndex endIndex = 0u;
+    GetAffectedRange( text, numberOfCharacters, updateStartIndex, numberOfCharactersToUpdate, startIndex, endIndex );
+
+    if( startIndex < endIndex )
+    {
+      set_wordbreaks_utf32( text + startIndex, endIndex - startIndex, NULL, breakInfo + startIndex );
+    }
+  }
 };
 
 Segmentation::Segmentation()
@@ -101,6 +244,28 @@ void Segmentation::GetWordBreakPositions( const Character* const text,
   mPlugin->GetWordBreakPositions( text, numberOfCharacters, breakInfo );
 }
 
+void Segmentation::UpdateLineBreakPositions( const Character* const text,
+                                             Length numberOfCharacters,
+                                             CharacterIndex updateStartIndex,
+                                             Length numberOfCharactersToUpdate,
+                                             LineBreakInfo* breakInfo )
+{
+  CreatePlugin();
+
+  mPlugin->UpdateLineBreakPositions( text, numberOfCharacters, updateStartIndex, numberOfCharactersToUpdate, breakInfo );
+}
+
+void Segmentation::UpdateWordBreakPositions( const Character* const text,
+                                             Length numberOfCharacters,
+                                             CharacterIndex updateStartIndex,
+                                             Length numberOfCharactersToUpdate,
+                                             WordBreakInfo* breakInfo )
+{
+  CreatePlugin();
+
+  mPlugin->UpdateWordBreakPositions( text, numberOfCharacters, updateStartIndex, numberOfCharactersToUpdate, breakInfo );
+}
+
 void Segmentation::CreatePlugin()
 {
   if( !mPlugin )
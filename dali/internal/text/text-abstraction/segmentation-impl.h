@@ -71,6 +71,24 @@ public:
                               Length numberOfCharacters,
                               WordBreakInfo* breakInfo );
 
+  /**
+   * @copydoc Dali::Segmentation::UpdateLineBreakPositions()
+   */
+  void UpdateLineBreakPositions( const Character* const text,
+                                 Length numberOfCharacters,
+                                 CharacterIndex updateStartIndex,
+                                 Length numberOfCharactersToUpdate,
+                                 LineBreakInfo* breakInfo );
+
+  /**
+   * @copydoc Dali::Segmentation::UpdateWordBreakPositions()
+   */
+  void UpdateWordBreakPositions( const Character* const text,
+                                 Length numberOfCharacters,
+                                 CharacterIndex updateStartIndex,
+                                 Length numberOfCharactersToUpdate,
+                                 WordBreakInfo* breakInfo );
+
 private:
 
   /**
@@ -23,6 +23,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/internal/text/text-abstraction/cairo-renderer.h>
+#include <dali/internal/text/text-abstraction/cairo-renderer-cache.h>
 
 namespace Dali
 {
@@ -34,11 +35,13 @@ namespace Internal
 {
 
 TextRenderer::TextRenderer()
+: mCache(new CairoRendererCache())
 {
 }
 
 TextRenderer::~TextRenderer()
 {
+  delete mCache;
 }
 
 TextAbstraction::TextRenderer TextRenderer::Get()
@@ -68,7 +71,31 @@ TextAbstraction::TextRenderer TextRenderer::Get()
 
 Devel::PixelBuffer TextRenderer::Render(const TextAbstraction::TextRenderer::Parameters& parameters)
 {
-  return RenderTextCairo(parameters);
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  Devel::PixelBuffer pixelBuffer = RenderTextCairo(parameters, *mCache);
+
+  // Keeps the resources of the most recent renders only.
+  mCache->Trim();
+
+  return pixelBuffer;
+}
+
+void TextRenderer::ClearCache()
+{
+  SingletonService service(SingletonService::Get());
+  if (service)
+  {
+    // The text renderer isn't created just to clear its cache
+    Dali::BaseHandle handle = service.GetSingleton(typeid(TextAbstraction::TextRenderer));
+    if (handle)
+    {
+      TextRenderer& impl = static_cast<Internal::TextRenderer&>(handle.GetBaseObject());
+
+      std::lock_guard<std::mutex> lock(impl.mMutex);
+      impl.mCache->Clear();
+    }
+  }
 }
 
 } // namespace Internal
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/object/base-object.h>
+#include <mutex>
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/text-abstraction/text-renderer.h>
@@ -33,6 +34,8 @@ namespace TextAbstraction
 namespace Internal
 {
 
+class CairoRendererCache;
+
 /**
  * Implementation of the TextRenderer
  */
@@ -60,6 +63,13 @@ public:
    */
   Devel::PixelBuffer Render(const TextAbstraction::TextRenderer::Parameters& parameters);
 
+  /**
+   * @brief Frees the font faces, fonts and surfaces kept between renders, e.g. when the memory is low.
+   *
+   * Does nothing if the text renderer hasn't been created.
+   */
+  static void ClearCache();
+
 private:
 
   // Undefined copy constructor.
@@ -68,6 +78,11 @@ private:
   // Undefined assignment constructor.
   TextRenderer& operator=(const TextRenderer&);
 
+private:
+
+  CairoRendererCache* mCache; ///< The font faces, fonts and surfaces reused between renders.
+  std::mutex          mMutex; ///< Protects the cache, which may be cleared from another thread than the one rendering.
+
 }; // class TextRenderer
 
 } // namespace Internal
@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/thread/common/worker-thread-pool-impl.h>
+
+// EXTERNAL INCLUDES
+#include <sched.h>
+#include <dali/integration-api/debug.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/environment-options.h>
+#include <dali/internal/system/common/time-service.h>
+#include <dali/internal/thread/common/thread-settings-impl.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+#if defined(DEBUG_ENABLED)
+Integration::Log::Filter* gLogFilter = Integration::Log::Filter::New( Debug::NoLogging, false, "LOG_WORKER_THREAD_POOL" );
+
+const char* const PRIORITY_NAMES[] = { "interactive", "prefetch", "background" };
+#endif
+
+const uint64_t NANOSECONDS_PER_MICROSECOND = 1000u;
+
+thread_local WorkerThreadPool* gCurrentPool = NULL;   ///< The pool of the calling worker thread.
+thread_local unsigned int gCurrentWorker = 0u;        ///< The index of the calling worker thread in its pool.
+
+/**
+ * Retrieves the default number of workers: one per CPU the process can run on, minus one for the event thread.
+ */
+unsigned int GetDefaultNumberOfThreads()
+{
+  unsigned int numberOfCpus = 0u;
+
+  cpu_set_t cpuSet;
+  CPU_ZERO( &cpuSet );
+  if( 0 == sched_getaffinity( 0, sizeof( cpuSet ), &cpuSet ) )
+  {
+    numberOfCpus = CPU_COUNT( &cpuSet );
+  }
+
+  if( 0u == numberOfCpus )
+  {
+    numberOfCpus = std::thread::hardware_concurrency();
+  }
+
+  return ( numberOfCpus > 2u ) ? numberOfCpus - 1u : 1u;
+}
+
+/**
+ * Updates a maximum shared between threads.
+ */
+void UpdateMaximum( std::atomic<uint64_t>& maximum, uint64_t value )
+{
+  uint64_t current = maximum.load( std::memory_order_relaxed );
+  while( ( value > current ) && !maximum.compare_exchange_weak( current, value, std::memory_order_relaxed ) )
+  {
+  }
+}
+
+} // unnamed namespace
+
+WorkerThreadPool* WorkerThreadPool::GetCurrent()
+{
+  return gCurrentPool;
+}
+
+WorkerThreadPool::WorkerThreadPool( const EnvironmentOptions& environmentOptions )
+: mEnvironmentOptions( environmentOptions ),
+  mWorkers(),
+  mMutex(),
+  mCondition(),
+  mNextWorker( 0u ),
+  mPaused( false ),
+  mStop( false )
+{
+  for( auto& counters : mCounters )
+  {
+    counters.queued.store( 0, std::memory_order_relaxed );
+    counters.tasks.store( 0u, std::memory_order_relaxed );
+    counters.stolen.store( 0u, std::memory_order_relaxed );
+    counters.totalWaitTime.store( 0u, std::memory_order_relaxed );
+    counters.maximumWaitTime.store( 0u, std::memory_order_relaxed );
+    counters.totalRunTime.store( 0u, std::memory_order_relaxed );
+    counters.maximumRunTime.store( 0u, std::memory_order_relaxed );
+  }
+
+  unsigned int numberOfThreads = environmentOptions.GetWorkerThreadCount();
+  if( 0u == numberOfThreads )
+  {
+    numberOfThreads = GetDefaultNumberOfThreads();
+  }
+
+  // All the workers exist before any of them starts stealing.
+  mWorkers.reserve( numberOfThreads );
+  for( unsigned int index = 0u; index < numberOfThreads; ++index )
+  {
+    mWorkers.emplace_back( new Worker() );
+  }
+
+  for( unsigned int index = 0u; index < numberOfThreads; ++index )
+  {
+    mWorkers[index]->thread = std::thread( &WorkerThreadPool::Run, this, index );
+  }
+
+  DALI_LOG_RELEASE_INFO( "WorkerThreadPool: %u threads\n", numberOfThreads );
+}
+
+WorkerThreadPool::~WorkerThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock( mMutex );
+    mStop = true;
+  }
+  mCondition.notify_all();
+
+  for( auto& worker : mWorkers )
+  {
+    worker->thread.join();
+  }
+
+  // The tasks which didn't start are not run, see the header.
+  for( auto& worker : mWorkers )
+  {
+    for( unsigned int priority = 0u; priority < NUMBER_OF_PRIORITIES; ++priority )
+    {
+      for( auto& task : worker->tasks[priority] )
+      {
+        delete task.callback;
+      }
+      for( auto& task : worker->ownTasks[priority] )
+      {
+        delete task.callback;
+      }
+    }
+  }
+
+#if defined(DEBUG_ENABLED)
+  for( unsigned int priority = 0u; priority < NUMBER_OF_PRIORITIES; ++priority )
+  {
+    Statistics statistics;
+    GetStatistics( static_cast<Priority>( priority ), statistics );
+    DALI_LOG_INFO( gLogFilter, Debug::General, "WorkerThreadPool: %s tasks %llu, stolen %llu, maximum wait %lluus, maximum run %lluus\n",
+                   PRIORITY_NAMES[priority], statistics.tasks, statistics.stolen, statistics.maximumWaitTime, statistics.maximumRunTime );
+  }
+#endif
+}
+
+unsigned int WorkerThreadPool::GetNumberOfThreads() const
+{
+  return static_cast<unsigned int>( mWorkers.size() );
+}
+
+void WorkerThreadPool::AddTask( CallbackBase* task, Priority priority )
+{
+  uint64_t addTime = 0u;
+  TimeService::GetNanoseconds( addTime );
+
+  // A worker keeps the tasks it adds, the other threads spread them.
+  const bool ownTask = ( gCurrentPool == this );
+  const unsigned int index = ownTask ? gCurrentWorker : mNextWorker.fetch_add( 1u, std::memory_order_relaxed ) % mWorkers.size();
+  Worker& worker = *mWorkers[index];
+  {
+    std::lock_guard<std::mutex> lock( worker.mutex );
+    std::deque<Task>& tasks = ownTask ? worker.ownTasks[priority] : worker.tasks[priority];
+    tasks.push_back( Task{ task, addTime } );
+  }
+  mCounters[priority].queued.fetch_add( 1, std::memory_order_release );
+
+  // Locked so the task can't be counted between a worker checking for tasks and waiting.
+  {
+    std::lock_guard<std::mutex> lock( mMutex );
+  }
+  mCondition.notify_one();
+}
+
+void WorkerThreadPool::Pause()
+{
+  mPaused.store( true, std::memory_order_relaxed );
+}
+
+void WorkerThreadPool::Resume()
+{
+  {
+    std::lock_guard<std::mutex> lock( mMutex );
+    mPaused.store( false, std::memory_order_relaxed );
+  }
+  mCondition.notify_all();
+}
+
+void WorkerThreadPool::GetStatistics( Priority priority, Statistics& statistics ) const
+{
+  const Counters& counters = mCounters[priority];
+  statistics.tasks = counters.tasks.load( std::memory_order_relaxed );
+  statistics.stolen = counters.stolen.load( std::memory_order_relaxed );
+  statistics.totalWaitTime = counters.totalWaitTime.load( std::memory_order_relaxed );
+  statistics.maximumWaitTime = counters.maximumWaitTime.load( std::memory_order_relaxed );
+  statistics.totalRunTime = counters.totalRunTime.load( std::memory_order_relaxed );
+  statistics.maximumRunTime = counters.maximumRunTime.load( std::memory_order_relaxed );
+}
+
+void WorkerThreadPool::Run( unsigned int index )
+{
+  ThreadSettings::SetThreadName( "DALiWorker" + std::to_string( index ) );
+  mEnvironmentOptions.InstallLogFunction();
+
+  gCurrentPool = this;
+  gCurrentWorker = index;
+
+  while( true )
+  {
+    Task task;
+    unsigned int priority = 0u;
+    bool stolen = false;
+    if( TakeTask( index, task, priority, stolen ) )
+    {
+      uint64_t startTime = 0u;
+      TimeService::GetNanoseconds( startTime );
+
+      CallbackBase::Execute( *task.callback );
+      delete task.callback;
+
+      uint64_t endTime = 0u;
+      TimeService::GetNanoseconds( endTime );
+
+      const uint64_t waitTime = ( startTime - task.addTime ) / NANOSECONDS_PER_MICROSECOND;
+      const uint64_t runTime = ( endTime - startTime ) / NANOSECONDS_PER_MICROSECOND;
+
+      Counters& counters = mCounters[priority];
+      counters.tasks.fetch_add( 1u, std::memory_order_relaxed );
+      if( stolen )
+      {
+        counters.stolen.fetch_add( 1u, std::memory_order_relaxed );
+      }
+      counters.totalWaitTime.fetch_add( waitTime, std::memory_order_relaxed );
+      counters.totalRunTime.fetch_add( runTime, std::memory_order_relaxed );
+      UpdateMaximum( counters.maximumWaitTime, waitTime );
+      UpdateMaximum( counters.maximumRunTime, runTime );
+
+      DALI_LOG_INFO( gLogFilter, Debug::Verbose, "WorkerThreadPool::Run. worker : %u, priority : %s, wait : %lluus, run : %lluus%s\n",
+                     index, PRIORITY_NAMES[priority], waitTime, runTime, stolen ? ", stolen" : "" );
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock( mMutex );
+    mCondition.wait( lock, [this]() { return mStop || HasRunnableTask(); } );
+    if( mStop )
+    {
+      break;
+    }
+  }
+
+  gCurrentPool = NULL;
+
+  mEnvironmentOptions.UnInstallLogFunction();
+}
+
+bool WorkerThreadPool::TakeTask( unsigned int index, Task& task, unsigned int& priority, bool& stolen )
+{
+  const unsigned int numberOfWorkers = static_cast<unsigned int>( mWorkers.size() );
+  const unsigned int numberOfPriorities = mPaused.load( std::memory_order_relaxed ) ? Dali::WorkerThreadPool::INTERACTIVE + 1u : NUMBER_OF_PRIORITIES;
+
+  for( priority = 0u; priority < numberOfPriorities; ++priority )
+  {
+    if( mCounters[priority].queued.load( std::memory_order_acquire ) <= 0 )
+    {
+      continue;
+    }
+
+    // The newest task the worker added, then the oldest task added by the other threads.
+    {
+      Worker& worker = *mWorkers[index];
+      std::lock_guard<std::mutex> lock( worker.mutex );
+      std::deque<Task>& ownTasks = worker.ownTasks[priority];
+      std::deque<Task>& tasks = worker.tasks[priority];
+      if( !ownTasks.empty() )
+      {
+        task = ownTasks.back();
+        ownTasks.pop_back();
+        mCounters[priority].queued.fetch_sub( 1, std::memory_order_relaxed );
+        stolen = false;
+        return true;
+      }
+      if( !tasks.empty() )
+      {
+        task = tasks.front();
+        tasks.pop_front();
+        mCounters[priority].queued.fetch_sub( 1, std::memory_order_relaxed );
+        stolen = false;
+        return true;
+      }
+    }
+
+    // The oldest task of another worker, added by the other threads first.
+    for( unsigned int offset = 1u; offset < numberOfWorkers; ++offset )
+    {
+      Worker& worker = *mWorkers[( index + offset ) % numberOfWorkers];
+      std::lock_guard<std::mutex> lock( worker.mutex );
+      std::deque<Task>& tasks = worker.tasks[priority].empty() ? worker.ownTasks[priority] : worker.tasks[priority];
+      if( !tasks.empty() )
+      {
+        task = tasks.front();
+        tasks.pop_front();
+        mCounters[priority].queued.fetch_sub( 1, std::memory_order_relaxed );
+        stolen = true;
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+bool WorkerThreadPool::HasRunnableTask() const
+{
+  if( mCounters[Dali::WorkerThreadPool::INTERACTIVE].queued.load( std::memory_order_acquire ) > 0 )
+  {
+    return true;
+  }
+
+  if( mPaused.load( std::memory_order_relaxed ) )
+  {
+    return false;
+  }
+
+  return ( mCounters[Dali::WorkerThreadPool::PREFETCH].queued.load( std::memory_order_acquire ) > 0 ) ||
+         ( mCounters[Dali::WorkerThreadPool::BACKGROUND].queued.load( std::memory_order_acquire ) > 0 );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,211 @@
+#ifndef DALI_INTERNAL_WORKER_THREAD_POOL_IMPL_H
+#define DALI_INTERNAL_WORKER_THREAD_POOL_IMPL_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include <dali/public-api/signals/callback.h>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/worker-thread-pool.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+class EnvironmentOptions;
+
+/**
+ * A pool of worker threads shared by the subsystems of the adaptor.
+ *
+ * Each worker has two queues of tasks for each priority. The tasks added by a worker go to its own queues and
+ * the ones added by other threads are spread between the workers. A worker runs the last task it added, which is
+ * likely to use the data it has just used, then the tasks added by the other threads in the order they were added.
+ * It steals the oldest task of another worker when its queues are empty. All the interactive tasks run before any
+ * prefetch task, and these before any background task.
+ *
+ * The prefetch and background tasks are not started while the pool is paused, the interactive ones are as
+ * the event thread may be waiting for them.
+ *
+ * The workers are named "DALiWorker<n>". By default there's one per CPU the process is allowed to run on,
+ * minus one for the event thread, so the affinity set by the platform is honoured.
+ */
+class WorkerThreadPool
+{
+public:
+
+  using Priority = Dali::WorkerThreadPool::Priority;
+
+  static const unsigned int NUMBER_OF_PRIORITIES = Dali::WorkerThreadPool::BACKGROUND + 1u;
+
+  /**
+   * The timings of the tasks of a priority since the pool was created.
+   */
+  struct Statistics
+  {
+    uint64_t tasks;           ///< The number of tasks run.
+    uint64_t stolen;          ///< The number of tasks run by a worker other than the one they were queued to.
+    uint64_t totalWaitTime;   ///< The sum of the times from the tasks being added to them starting, in microseconds.
+    uint64_t maximumWaitTime; ///< The longest time a task waited for a worker, in microseconds.
+    uint64_t totalRunTime;    ///< The sum of the times the tasks took, in microseconds.
+    uint64_t maximumRunTime;  ///< The longest time a task took, in microseconds.
+  };
+
+  /**
+   * Retrieves the pool the calling thread belongs to.
+   * @return The pool, or NULL if the calling thread is not a worker.
+   */
+  static WorkerThreadPool* GetCurrent();
+
+  /**
+   * Constructor. Starts the worker threads.
+   * @param[in] environmentOptions The environment options. The number of threads is read from DALI_WORKER_THREAD_COUNT.
+   */
+  WorkerThreadPool( const EnvironmentOptions& environmentOptions );
+
+  /**
+   * Destructor. Waits for the running tasks to finish and deletes the ones which didn't start without running them,
+   * as they may be waiting for a paused adaptor or for the event thread which is destroying the pool.
+   */
+  ~WorkerThreadPool();
+
+  /**
+   * @return The number of worker threads.
+   */
+  unsigned int GetNumberOfThreads() const;
+
+  /**
+   * Adds a task. Can be called from any thread.
+   * @param[in] task The task. The ownership is taken.
+   * @param[in] priority The priority of the task.
+   */
+  void AddTask( CallbackBase* task, Priority priority );
+
+  /**
+   * Stops starting prefetch and background tasks. Called when the adaptor is paused.
+   */
+  void Pause();
+
+  /**
+   * Starts the prefetch and background tasks again. Called when the adaptor is resumed.
+   */
+  void Resume();
+
+  /**
+   * Retrieves the timings of the tasks of a priority.
+   * @param[in] priority The priority.
+   * @param[out] statistics The timings.
+   */
+  void GetStatistics( Priority priority, Statistics& statistics ) const;
+
+private:
+
+  /**
+   * A task waiting for a worker.
+   */
+  struct Task
+  {
+    CallbackBase* callback;   ///< The task.
+    uint64_t addTime;         ///< The time the task was added, in nanoseconds.
+  };
+
+  /**
+   * A worker thread and its queues.
+   */
+  struct Worker
+  {
+    std::thread thread;
+    std::mutex mutex;                                ///< Protects the queues.
+    std::deque<Task> tasks[NUMBER_OF_PRIORITIES];    ///< The tasks added by other threads, run oldest first.
+    std::deque<Task> ownTasks[NUMBER_OF_PRIORITIES]; ///< The tasks added by the worker, run newest first.
+  };
+
+  /**
+   * The counters of a priority.
+   */
+  struct Counters
+  {
+    std::atomic<int> queued;                ///< The number of tasks waiting for a worker.
+    std::atomic<uint64_t> tasks;
+    std::atomic<uint64_t> stolen;
+    std::atomic<uint64_t> totalWaitTime;
+    std::atomic<uint64_t> maximumWaitTime;
+    std::atomic<uint64_t> totalRunTime;
+    std::atomic<uint64_t> maximumRunTime;
+  };
+
+  /**
+   * The main function of the worker threads.
+   * @param[in] index The index of the worker.
+   */
+  void Run( unsigned int index );
+
+  /**
+   * Takes the next task to run, from the worker's own queues or stolen from the other workers.
+   * @param[in] index The index of the worker.
+   * @param[out] task The task.
+   * @param[out] priority The priority of the task.
+   * @param[out] stolen Whether the task was queued to another worker.
+   * @return Whether there was a task to run.
+   */
+  bool TakeTask( unsigned int index, Task& task, unsigned int& priority, bool& stolen );
+
+  /**
+   * Whether there's a task the workers can start. Called with mMutex locked.
+   */
+  bool HasRunnableTask() const;
+
+  // Undefined copy constructor.
+  WorkerThreadPool( const WorkerThreadPool& );
+
+  // Undefined assignment operator.
+  WorkerThreadPool& operator=( const WorkerThreadPool& );
+
+private:
+
+  const EnvironmentOptions& mEnvironmentOptions;
+  std::vector<std::unique_ptr<Worker>> mWorkers;
+  Counters mCounters[NUMBER_OF_PRIORITIES];
+  std::mutex mMutex;                          ///< Protects the sleep and wake up of the workers.
+  std::condition_variable mCondition;         ///< Signalled when a task is added, on resume and on destruction.
+  std::atomic<unsigned int> mNextWorker;      ///< The worker the next task added by another thread is queued to.
+  std::atomic<bool> mPaused;
+  bool mStop;                                 ///< Protected by mMutex.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_WORKER_THREAD_POOL_IMPL_H
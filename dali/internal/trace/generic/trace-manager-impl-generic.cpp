@@ -33,7 +33,9 @@ namespace Adaptor
 TraceManagerGeneric* TraceManagerGeneric::traceManagerGeneric = nullptr;
 
 TraceManagerGeneric::TraceManagerGeneric( PerformanceInterface* performanceInterface )
-: TraceManager( performanceInterface )
+: TraceManager( performanceInterface ),
+  mContextIds(),
+  mContextMutex()
 {
   TraceManagerGeneric::traceManagerGeneric = this;
 }
@@ -45,16 +47,27 @@ Dali::Integration::Trace::LogContextFunction TraceManagerGeneric::GetLogContextF
 
 void TraceManagerGeneric::LogContext( bool start, const char* tag )
 {
-  if( start )
+  if( !traceManagerGeneric->mPerformanceInterface )
   {
-    unsigned short contextId = traceManagerGeneric->mPerformanceInterface->AddContext( tag );
-    traceManagerGeneric->mPerformanceInterface->AddMarker( PerformanceInterface::START, contextId );
+    // performance logging is disabled
+    return;
   }
-  else
+
+  unsigned short contextId = traceManagerGeneric->GetContextId( tag );
+  traceManagerGeneric->mPerformanceInterface->AddMarker( start ? PerformanceInterface::START : PerformanceInterface::END, contextId );
+}
+
+unsigned short TraceManagerGeneric::GetContextId( const char* tag )
+{
+  Mutex::ScopedLock lock( mContextMutex );
+
+  // a context is added once per tag, so the start and end markers are matched in the same context
+  auto iter = mContextIds.find( tag );
+  if( iter == mContextIds.end() )
   {
-    unsigned short contextId = traceManagerGeneric->mPerformanceInterface->AddContext( tag );
-    traceManagerGeneric->mPerformanceInterface->AddMarker( PerformanceInterface::END, contextId );
+    iter = mContextIds.insert( std::make_pair( std::string( tag ), mPerformanceInterface->AddContext( tag ) ) ).first;
   }
+  return iter->second;
 }
 
 } // namespace Adaptor
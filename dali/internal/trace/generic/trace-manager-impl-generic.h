@@ -19,6 +19,9 @@
  */
 
 // EXTERNAL INCLUDES
+#include <string>
+#include <unordered_map>
+#include <dali/devel-api/threading/mutex.h>
 
 // INTERNAL INCLUDES
 #include <dali/internal/trace/common/trace-manager-impl.h>
@@ -64,6 +67,18 @@ private:
    * LogContext method (Generic specific) used for tracing
    */
   static void LogContext( bool start, const char* tag );
+
+  /**
+   * Retrieves the performance context of a trace tag. Adds it the first time the tag is traced.
+   * @param[in] tag The trace tag.
+   * @return The context id.
+   */
+  unsigned short GetContextId( const char* tag );
+
+private:
+
+  std::unordered_map<std::string, unsigned short> mContextIds; ///< The performance contexts of the traced tags.
+  Dali::Mutex mContextMutex;                                   ///< Tags are traced from any thread.
 };
 
 } // namespace Adaptor
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/window-system/common/damage-region.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+const unsigned int MAXIMUM_PAIRWISE_RECTS = 64u; ///< Over this number of rects, all of them are merged instead of looking for the cheapest pairs.
+
+bool IsEmptyRect( const Rect<int>& rect )
+{
+  return rect.width <= 0 || rect.height <= 0;
+}
+
+int GetRectArea( const Rect<int>& rect )
+{
+  return rect.width * rect.height;
+}
+
+bool Overlaps( const Rect<int>& first, const Rect<int>& second )
+{
+  return ( first.x < second.x + second.width ) && ( second.x < first.x + first.width ) &&
+         ( first.y < second.y + second.height ) && ( second.y < first.y + first.height );
+}
+
+bool Contains( const Rect<int>& outer, const Rect<int>& inner )
+{
+  return ( outer.x <= inner.x ) && ( inner.x + inner.width <= outer.x + outer.width ) &&
+         ( outer.y <= inner.y ) && ( inner.y + inner.height <= outer.y + outer.height );
+}
+
+Rect<int> GetBoundingBox( const Rect<int>& first, const Rect<int>& second )
+{
+  const int left = std::min( first.x, second.x );
+  const int top = std::min( first.y, second.y );
+  const int right = std::max( first.x + first.width, second.x + second.width );
+  const int bottom = std::max( first.y + first.height, second.y + second.height );
+  return Rect<int>( left, top, right - left, bottom - top );
+}
+
+/**
+ * Adds the parts of a rect outside a hole to a list: the bands above and below the hole across the whole rect,
+ * then the bands on its left and right.
+ */
+void SubtractRect( const Rect<int>& rect, const Rect<int>& hole, std::vector<Rect<int>>& pieces )
+{
+  if( !Overlaps( rect, hole ) )
+  {
+    pieces.push_back( rect );
+    return;
+  }
+
+  const int rectRight = rect.x + rect.width;
+  const int rectBottom = rect.y + rect.height;
+  const int holeRight = hole.x + hole.width;
+  const int holeBottom = hole.y + hole.height;
+  const int top = std::max( rect.y, hole.y );
+  const int bottom = std::min( rectBottom, holeBottom );
+
+  if( hole.y > rect.y )
+  {
+    pieces.push_back( Rect<int>( rect.x, rect.y, rect.width, hole.y - rect.y ) );
+  }
+  if( holeBottom < rectBottom )
+  {
+    pieces.push_back( Rect<int>( rect.x, holeBottom, rect.width, rectBottom - holeBottom ) );
+  }
+  if( hole.x > rect.x )
+  {
+    pieces.push_back( Rect<int>( rect.x, top, hole.x - rect.x, bottom - top ) );
+  }
+  if( holeRight < rectRight )
+  {
+    pieces.push_back( Rect<int>( holeRight, top, rectRight - holeRight, bottom - top ) );
+  }
+}
+
+} // unnamed namespace
+
+DamageRegion::DamageRegion()
+: mRects()
+{
+}
+
+DamageRegion::~DamageRegion()
+{
+}
+
+void DamageRegion::Add( const Rect<int>& rect )
+{
+  if( IsEmptyRect( rect ) )
+  {
+    return;
+  }
+
+  // The rects the new one covers are replaced by it.
+  mRects.erase( std::remove_if( mRects.begin(), mRects.end(), [&rect]( const Rect<int>& current ) { return Contains( rect, current ); } ), mRects.end() );
+
+  std::vector<Rect<int>> pieces( 1u, rect );
+  std::vector<Rect<int>> remaining;
+  for( const auto& current : mRects )
+  {
+    remaining.clear();
+    for( const auto& piece : pieces )
+    {
+      SubtractRect( piece, current, remaining );
+    }
+    pieces.swap( remaining );
+
+    if( pieces.empty() )
+    {
+      return;
+    }
+  }
+
+  mRects.insert( mRects.end(), pieces.begin(), pieces.end() );
+}
+
+void DamageRegion::Add( const std::vector<Rect<int>>& rects )
+{
+  for( const auto& rect : rects )
+  {
+    Add( rect );
+  }
+}
+
+void DamageRegion::Subtract( const Rect<int>& rect )
+{
+  if( IsEmptyRect( rect ) )
+  {
+    return;
+  }
+
+  std::vector<Rect<int>> rects;
+  rects.reserve( mRects.size() );
+  for( const auto& current : mRects )
+  {
+    SubtractRect( current, rect, rects );
+  }
+  mRects.swap( rects );
+}
+
+void DamageRegion::Intersect( const Rect<int>& rect )
+{
+  std::vector<Rect<int>>::iterator end = mRects.begin();
+  for( const auto& current : mRects )
+  {
+    const int left = std::max( current.x, rect.x );
+    const int top = std::max( current.y, rect.y );
+    const int right = std::min( current.x + current.width, rect.x + rect.width );
+    const int bottom = std::min( current.y + current.height, rect.y + rect.height );
+    if( ( left < right ) && ( top < bottom ) )
+    {
+      *end++ = Rect<int>( left, top, right - left, bottom - top );
+    }
+  }
+  mRects.erase( end, mRects.end() );
+}
+
+void DamageRegion::Coalesce( int rectCost, unsigned int maximumRects )
+{
+  if( mRects.size() > MAXIMUM_PAIRWISE_RECTS )
+  {
+    const Rect<int> bounds = GetBounds();
+    mRects.assign( 1u, bounds );
+    return;
+  }
+
+  while( mRects.size() > 1u )
+  {
+    // The pair whose bounding box adds the fewest pixels.
+    const unsigned int numberOfRects = static_cast<unsigned int>( mRects.size() );
+    unsigned int first = 0u;
+    unsigned int second = 1u;
+    int minimumCost = -1;
+    for( unsigned int i = 0u; i < numberOfRects - 1u; ++i )
+    {
+      for( unsigned int j = i + 1u; j < numberOfRects; ++j )
+      {
+        const int cost = GetRectArea( GetBoundingBox( mRects[i], mRects[j] ) ) - GetRectArea( mRects[i] ) - GetRectArea( mRects[j] );
+        if( ( minimumCost < 0 ) || ( cost < minimumCost ) )
+        {
+          minimumCost = cost;
+          first = i;
+          second = j;
+        }
+      }
+    }
+
+    if( ( minimumCost > rectCost ) && ( numberOfRects <= maximumRects ) )
+    {
+      break;
+    }
+
+    Merge( first, second );
+  }
+}
+
+void DamageRegion::Clear()
+{
+  mRects.clear();
+}
+
+bool DamageRegion::IsEmpty() const
+{
+  return mRects.empty();
+}
+
+int DamageRegion::GetArea() const
+{
+  int area = 0;
+  for( const auto& rect : mRects )
+  {
+    area += GetRectArea( rect );
+  }
+  return area;
+}
+
+Rect<int> DamageRegion::GetBounds() const
+{
+  if( mRects.empty() )
+  {
+    return Rect<int>();
+  }
+
+  Rect<int> bounds = mRects[0];
+  for( const auto& rect : mRects )
+  {
+    bounds = GetBoundingBox( bounds, rect );
+  }
+  return bounds;
+}
+
+const std::vector<Rect<int>>& DamageRegion::GetRects() const
+{
+  return mRects;
+}
+
+void DamageRegion::Merge( unsigned int first, unsigned int second )
+{
+  Rect<int> bounds = GetBoundingBox( mRects[first], mRects[second] );
+
+  mRects.erase( mRects.begin() + std::max( first, second ) );
+  mRects.erase( mRects.begin() + std::min( first, second ) );
+
+  // The rects the bounding box overlaps are merged too, so the rects never overlap and their number always decreases.
+  bool grown = true;
+  while( grown )
+  {
+    grown = false;
+    for( auto iter = mRects.begin(); iter != mRects.end(); )
+    {
+      if( Overlaps( bounds, *iter ) )
+      {
+        bounds = GetBoundingBox( bounds, *iter );
+        iter = mRects.erase( iter );
+        grown = true;
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+  }
+
+  mRects.push_back( bounds );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
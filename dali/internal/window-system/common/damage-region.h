@@ -0,0 +1,132 @@
+#ifndef DALI_INTERNAL_WINDOW_SYSTEM_COMMON_DAMAGE_REGION_H
+#define DALI_INTERNAL_WINDOW_SYSTEM_COMMON_DAMAGE_REGION_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <vector>
+#include <dali/public-api/math/rect.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * The damaged area of a surface, as a list of rectangles which don't overlap.
+ *
+ * Merging all the damaged rects into their bounding box redraws everything in between, e.g. the whole
+ * screen when two small items change in opposite corners. The region keeps the rects apart instead, and
+ * Coalesce() merges only the ones close enough for an extra rect to cost more than the pixels it saves.
+ */
+class DamageRegion
+{
+public:
+
+  /**
+   * Constructor. The region is empty.
+   */
+  DamageRegion();
+
+  /**
+   * Destructor, not intended as a base class
+   */
+  ~DamageRegion();
+
+  /**
+   * Adds a rect to the region. Only the parts not in the region yet are added.
+   * @param[in] rect The rect. Ignored if it's empty.
+   */
+  void Add( const Rect<int>& rect );
+
+  /**
+   * Adds a list of rects to the region.
+   * @param[in] rects The rects.
+   */
+  void Add( const std::vector<Rect<int>>& rects );
+
+  /**
+   * Removes a rect from the region. The rects of the region it overlaps are split.
+   * @param[in] rect The rect.
+   */
+  void Subtract( const Rect<int>& rect );
+
+  /**
+   * Clips the region to a rect, e.g. the surface.
+   * @param[in] rect The rect.
+   */
+  void Intersect( const Rect<int>& rect );
+
+  /**
+   * Merges the rects of the region into their bounding boxes while it's cheaper to draw the extra pixels
+   * than to handle another rect, or while there are more rects than the maximum.
+   * @param[in] rectCost The cost of a rect, in pixels.
+   * @param[in] maximumRects The maximum number of rects.
+   */
+  void Coalesce( int rectCost, unsigned int maximumRects );
+
+  /**
+   * Empties the region.
+   */
+  void Clear();
+
+  /**
+   * @return Whether the region is empty.
+   */
+  bool IsEmpty() const;
+
+  /**
+   * @return The number of pixels in the region.
+   */
+  int GetArea() const;
+
+  /**
+   * @return The bounding box of the region, empty if the region is.
+   */
+  Rect<int> GetBounds() const;
+
+  /**
+   * @return The rects of the region, which don't overlap.
+   */
+  const std::vector<Rect<int>>& GetRects() const;
+
+private:
+
+  /**
+   * Merges the rects at the given indices, and the ones their bounding box overlaps, into it.
+   * @param[in] first The index of the first rect.
+   * @param[in] second The index of the second rect.
+   */
+  void Merge( unsigned int first, unsigned int second );
+
+private:
+
+  std::vector<Rect<int>> mRects; ///< The rects, which don't overlap.
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_WINDOW_SYSTEM_COMMON_DAMAGE_REGION_H
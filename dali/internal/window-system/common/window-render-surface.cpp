@@ -46,32 +46,13 @@ namespace
 
 const int MINIMUM_DIMENSION_CHANGE( 1 ); ///< Minimum change for window to be considered to have moved
 const float FULL_UPDATE_RATIO( 0.8f );   ///< Force full update when the dirty area is larget than this ratio
+const float DAMAGED_RECT_COST_RATIO( 0.05f ); ///< The cost of one more damaged rect for the driver and the compositor, as a ratio of the surface area
+const unsigned int MAXIMUM_DAMAGED_RECTS( 4u );  ///< The maximum number of damaged rects passed to EGL
 
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gWindowRenderSurfaceLogFilter = Debug::Filter::New(Debug::Verbose, false, "LOG_WINDOW_RENDER_SURFACE");
 #endif
 
-void MergeRects( Rect< int >& mergingRect, const std::vector< Rect< int > >& rects )
-{
-  uint32_t i = 0;
-  if( mergingRect.IsEmpty() )
-  {
-    for( ; i < rects.size(); i++ )
-    {
-      if( !rects[i].IsEmpty() )
-      {
-        mergingRect = rects[i];
-        break;
-      }
-    }
-  }
-
-  for( ; i < rects.size(); i++ )
-  {
-    mergingRect.Merge( rects[i] );
-  }
-}
-
 void InsertRects( WindowRenderSurface::DamagedRectsContainer& damagedRectsList, const std::vector< Rect< int > >& damagedRects )
 {
   damagedRectsList.push_front( damagedRects );
@@ -99,6 +80,7 @@ WindowRenderSurface::WindowRenderSurface( Dali::PositionSize positionSize, Any s
   mOutputTransformedSignal(),
   mFrameCallbackInfoContainer(),
   mBufferDamagedRects(),
+  mDamageRegion(),
   mMutex(),
   mRotationAngle( 0 ),
   mScreenRotationAngle( 0 ),
@@ -680,6 +662,8 @@ void WindowRenderSurface::SetBufferDamagedRects( const std::vector< Rect< int >
 
     Rect< int > surfaceRect( 0, 0, mPositionSize.width, mPositionSize.height );
 
+    mDamageRegion.Clear();
+
     if( mFullSwapNextFrame )
     {
       InsertRects( mBufferDamagedRects, std::vector< Rect< int > >( 1, surfaceRect ) );
@@ -700,25 +684,30 @@ void WindowRenderSurface::SetBufferDamagedRects( const std::vector< Rect< int >
     // We push current frame damaged rects here, zero index for current frame
     InsertRects( mBufferDamagedRects, damagedRects );
 
-    // Merge damaged rects into clipping rect
+    // The back buffer has to be redrawn where any of the frames since it was presented is damaged
     auto bufferDamagedRects = mBufferDamagedRects.begin();
     while( bufferAge-- >= 0 && bufferDamagedRects != mBufferDamagedRects.end() )
     {
-      const std::vector< Rect< int > >& rects = *bufferDamagedRects++;
-      MergeRects( clippingRect, rects );
+      mDamageRegion.Add( *bufferDamagedRects++ );
     }
 
-    if( !clippingRect.Intersect( surfaceRect ) || clippingRect.Area() > surfaceRect.Area() * FULL_UPDATE_RATIO )
+    mDamageRegion.Intersect( surfaceRect );
+    if( mDamageRegion.IsEmpty() || mDamageRegion.GetArea() > surfaceRect.Area() * FULL_UPDATE_RATIO )
     {
       // clipping area too big or doesn't intersect surface rect
       clippingRect = Rect< int >();
       return;
     }
 
-    std::vector< Rect< int > > damagedRegion;
-    damagedRegion.push_back( clippingRect );
+    // The scene is rendered once in the bounds of the region, the rects only tell EGL which pixels have to be updated
+    mDamageRegion.Coalesce( static_cast< int >( surfaceRect.Area() * DAMAGED_RECT_COST_RATIO ), MAXIMUM_DAMAGED_RECTS );
+
+    clippingRect = mDamageRegion.GetBounds();
 
-    eglImpl.SetDamageRegion( mEGLSurface, damagedRegion );
+    DALI_LOG_INFO( gWindowRenderSurfaceLogFilter, Debug::Verbose, "WindowRenderSurface::SetBufferDamagedRects: rects %zu, area %d, clipping area %d\n",
+                   mDamageRegion.GetRects().size(), mDamageRegion.GetArea(), clippingRect.Area() );
+
+    eglImpl.SetDamageRegion( mEGLSurface, mDamageRegion.GetRects() );
   }
 }
 
@@ -740,55 +729,19 @@ void WindowRenderSurface::SwapBuffers( const std::vector<Rect<int>>& damagedRect
 
     mFullSwapNextFrame = false;
 
-    std::vector< Rect< int > > mergedRects = damagedRects;
-
-    // Merge intersecting rects, form an array of non intersecting rects to help driver a bit
-    // Could be optional and can be removed, needs to be checked with and without on platform
-    const int n = mergedRects.size();
-    for( int i = 0; i < n - 1; i++ )
-    {
-      if( mergedRects[i].IsEmpty() )
-      {
-        continue;
-      }
-
-      for( int j = i + 1; j < n; j++ )
-      {
-        if( mergedRects[j].IsEmpty() )
-        {
-          continue;
-        }
-
-        if( mergedRects[i].Intersects( mergedRects[j] ) )
-        {
-          mergedRects[i].Merge( mergedRects[j] );
-          mergedRects[j].width = 0;
-          mergedRects[j].height = 0;
-        }
-      }
-    }
-
-    int j = 0;
-    for( int i = 0; i < n; i++ )
-    {
-      if( !mergedRects[i].IsEmpty() )
-      {
-        mergedRects[j++] = mergedRects[i];
-      }
-    }
-
-    if( j != 0 )
-    {
-      mergedRects.resize( j );
-    }
+    // Form an array of non intersecting rects to help driver a bit
+    mDamageRegion.Clear();
+    mDamageRegion.Add( damagedRects );
+    mDamageRegion.Intersect( surfaceRect );
 
-    if( !mergedRects.size() || ( mergedRects[0].Area() > surfaceRect.Area() * FULL_UPDATE_RATIO ) )
+    if( mDamageRegion.IsEmpty() || ( mDamageRegion.GetArea() > surfaceRect.Area() * FULL_UPDATE_RATIO ) )
     {
       eglImpl.SwapBuffers( mEGLSurface );
     }
     else
     {
-      eglImpl.SwapBuffers( mEGLSurface, mergedRects );
+      mDamageRegion.Coalesce( static_cast< int >( surfaceRect.Area() * DAMAGED_RECT_COST_RATIO ), MAXIMUM_DAMAGED_RECTS );
+      eglImpl.SwapBuffers( mEGLSurface, mDamageRegion.GetRects() );
     }
   }
 }
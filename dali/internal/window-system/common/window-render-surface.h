@@ -30,6 +30,7 @@
 #include <dali/integration-api/adaptor-framework/render-surface-interface.h>
 #include <dali/internal/graphics/common/graphics-interface.h>
 #include <dali/internal/system/common/file-descriptor-monitor.h>
+#include <dali/internal/window-system/common/damage-region.h>
 
 namespace Dali
 {
@@ -234,8 +235,9 @@ private:
 
   /**
    * @brief Set the buffer damage rects.
+   * The damage of the frames since the back buffer was presented is kept as separate rects, merged only where it's cheaper.
    * @param[in] damagedRects List of damaged rects
-   * @param[in] clippingRect The rect to clip rendered scene
+   * @param[out] clippingRect The rect to clip rendered scene, the bounding box of the damaged rects. Empty for a full update
    */
   void SetBufferDamagedRects( const std::vector< Rect< int > >& damagedRects, Rect< int >& clippingRect );
 
@@ -300,6 +302,7 @@ private: // Data
   OutputSignalType                mOutputTransformedSignal;
   FrameCallbackInfoContainer      mFrameCallbackInfoContainer;
   DamagedRectsContainer           mBufferDamagedRects;
+  DamageRegion                    mDamageRegion;       ///< The damaged rects of the current frame, kept to reuse their memory
   Dali::Mutex                     mMutex;
   int                             mRotationAngle;
   int                             mScreenRotationAngle;
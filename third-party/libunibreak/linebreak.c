@@ -648,6 +648,8 @@ int lb_process_next_char(
     {
     case LINEBREAK_MUSTBREAK:
         lbpCtx->lbcCur = resolve_lb_class(lbpCtx->lbcNew, lbpCtx->lang);
+        /* Rule LB21a doesn't apply across a mandatory break */
+        lbpCtx->fLb21aHebrew = 0;
         treat_first_char(lbpCtx);
         break;
     case LINEBREAK_UNDEFINED: